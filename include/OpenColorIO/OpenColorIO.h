@@ -133,6 +133,46 @@ public:
  */
 extern OCIOEXPORT void ClearAllCaches();
 
+/**
+ * \brief Set the maximum number of entries of each cache i.e. the global LUT file cache and the
+ * Processor caches of each Config and Processor instance. When a new entry exceeds the limit, the
+ * least recently used entries are evicted. Zero means no limit.
+ *
+ * You can override the default value (i.e. no limit) using the \ref OCIO_CACHE_MAX_ENTRIES
+ * environment variable.
+ */
+extern OCIOEXPORT void SetCacheMaxEntries(size_t maxEntries);
+extern OCIOEXPORT size_t GetCacheMaxEntries();
+
+/**
+ * \brief Set the maximum memory size in bytes of each cache. The memory size of an entry is
+ * estimated from its LUT arrays. When a new entry exceeds the limit, the least recently used
+ * entries are evicted (but the new one is always kept). Zero means no limit.
+ *
+ * You can override the default value (i.e. no limit) using the \ref OCIO_CACHE_MAX_MEMORY_SIZE
+ * environment variable.
+ */
+extern OCIOEXPORT void SetCacheMaxMemorySize(size_t maxMemorySize);
+extern OCIOEXPORT size_t GetCacheMaxMemorySize();
+
+/**
+ * \brief Set the directory of the persistent LUT file cache. The parsed content of the LUT files
+ * (e.g. .cube, .spi1d, .spi3d and .3dl files) is saved in this directory so that the other
+ * processes load it instead of parsing the LUT files again. An entry is ignored when it does not
+ * match the path and the content (i.e. a hash of the file) of its LUT file, or the library
+ * version. An empty directory (the default) disables the persistent file cache. Note that the
+ * directory must exist.
+ *
+ * You can override the default value (i.e. disabled) using the \ref OCIO_FILE_CACHE_DIR
+ * environment variable.
+ */
+extern OCIOEXPORT void SetFileCacheDirectory(const char * directory);
+/**
+ * \brief Get the directory of the persistent LUT file cache. The returned pointer remains valid
+ * for the lifetime of the library, even after the directory is changed.
+ */
+extern OCIOEXPORT const char * GetFileCacheDirectory();
+
 /**
  * \brief Get the version number for the library, as a dot-delimited string 
  *     (e.g., "1.0.0").
@@ -2588,6 +2628,18 @@ public:
                                                     BitDepth outBitDepth,
                                                     OptimizationFlags oFlags) const;
 
+    /**
+     * Same as above but also provides the grid size (i.e. in [2, 129]) and the maximum error
+     * (i.e. a positive number) used by the OPTIMIZATION_BAKE_LUT optimization instead of the
+     * default ones (i.e. 65 and 1e-2). Throws if a value is invalid. Note that the
+     * OCIO_BAKE_LUT_SIZE and OCIO_BAKE_LUT_MAX_ERROR envvars, when set, override these values.
+     */
+    ConstCPUProcessorRcPtr getOptimizedCPUProcessor(BitDepth inBitDepth,
+                                                    BitDepth outBitDepth,
+                                                    OptimizationFlags oFlags,
+                                                    unsigned bakeLutSize,
+                                                    float bakeLutMaxError) const;
+
     Processor(const Processor &) = delete;
     Processor & operator= (const Processor &) = delete;
     /// Do not use (needed only for pybind11).
@@ -2655,6 +2707,19 @@ public:
     void apply(const ImageDesc & imgDesc) const;
     void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
 
+    /**
+     * \brief Apply to an image using several threads.
+     *
+     * The image is split in bands of scanlines which are processed concurrently by numThreads
+     * threads, the calling thread being one of them. A value of 0 uses all the hardware threads,
+     * and a value of 1 is equivalent to the single-threaded apply.
+     *
+     * \note
+     *    The source and destination images must not overlap, unless it is the same image.
+     */
+    void apply(const ImageDesc & imgDesc, unsigned numThreads) const;
+    void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc, unsigned numThreads) const;
+
     /**
      * Apply to a single pixel respecting that the input and output bit-depths
      * be 32-bit float and the image buffer be packed RGB/RGBA.
@@ -3007,11 +3072,33 @@ public:
                     ptrdiff_t xStrideBytes,
                     ptrdiff_t yStrideBytes);
 
+    /**
+     * The pixels are directly processed in their packed format (i.e. without any copy of the
+     * image). The bit-depth is the one of the packed format channels (i.e. BIT_DEPTH_UINT10 or
+     * BIT_DEPTH_UINT12), and the channel ordering is RGBA or RGB.
+     *
+     * \note
+     *    The R, G, B and A data pointers are the address of the first pixel when the channels
+     *    are not byte-aligned, the channel stride is then 0.
+     */
+    PackedImageDesc(void * data,
+                    long width, long height,
+                    PackedFormat packedFormat);
+
+    PackedImageDesc(void * data,
+                    long width, long height,
+                    PackedFormat packedFormat,
+                    ptrdiff_t xStrideBytes,
+                    ptrdiff_t yStrideBytes);
+
     virtual ~PackedImageDesc();
 
     /// Get the channel ordering of all the pixels.
     ChannelOrdering getChannelOrder() const;
 
+    /// Get the packed format of the pixels, PACKED_FORMAT_NONE when there is none.
+    PackedFormat getPackedFormat() const;
+
     /// Get the bit-depth.
     BitDepth getBitDepth() const override;
 
@@ -436,6 +436,21 @@ enum ChannelOrdering
     CHANNEL_ORDERING_BGR
 };
 
+/**
+ * Used by \ref PackedImageDesc to describe the image pixels whose channels are packed in
+ * words (e.g. the 10-bit DPX files or SDI captures) instead of being stored in the containers
+ * of the bit-depth. The words are in the native byte order.
+ */
+enum PackedFormat
+{
+    PACKED_FORMAT_NONE = 0,     ///< The channels are in the containers of the bit-depth
+    PACKED_FORMAT_RGB10_A2,     ///< 10-bit R, G, B & 2-bit A in a 32-bit word, R in the low bits
+    PACKED_FORMAT_DPX_RGB10,    ///< 10-bit R, G & B in a 32-bit word, R in the high bits and the
+                                ///< 2 low bits unused (i.e. DPX method A)
+    PACKED_FORMAT_DPX_RGB12     ///< 12-bit R, G & B in the high bits of 16-bit words (i.e. DPX
+                                ///< method A)
+};
+
 enum Allocation {
     ALLOCATION_UNKNOWN = 0,
     ALLOCATION_UNIFORM,
@@ -596,7 +611,10 @@ enum OptimizationFlags : unsigned long
 
     /**
      * For integer and half bit-depths only, replace separable ops (i.e. no channel crosstalk
-     * ops) by a single 1D LUT of input bit-depth domain.
+     * ops) by a single 1D LUT of input bit-depth domain. For CPU processor, when the input and
+     * output bit-depths are both integer ones and the whole color transformation is separable,
+     * the images are processed by exact 1D tables of the output codes (i.e. without any
+     * conversion to float).
      */
     OPTIMIZATION_COMP_SEPARABLE_PREFIX           = 0x01000000,
 
@@ -619,6 +637,33 @@ enum OptimizationFlags : unsigned long
      */
     OPTIMIZATION_NO_DYNAMIC_PROPERTIES           = 0x10000000,
 
+    /**
+     * For CPU processor only, replace the whole color transformation by a shaper 1D LUT (only
+     * for float input bit-depths) followed by a 3D LUT when it contains computationally heavy
+     * ops. The bake is discarded if its error (measured at the 3D LUT cell centers) exceeds the
+     * maximum error. The default grid size is 65 and the default maximum error is 1e-2 i.e. a
+     * lossy optimization, which is why only OPTIMIZATION_DRAFT (i.e. OPTIMIZATION_ALL) includes
+     * it. Refer to Processor::getOptimizedCPUProcessor() to tune the grid size & the error, or
+     * to the OCIO_BAKE_LUT_SIZE and OCIO_BAKE_LUT_MAX_ERROR envvars to override them.
+     * Note that the shaper clamps the float input values outside of its domain (i.e. negative
+     * values and values above 16384) and maps NaNs to zero. The bake is then also discarded if
+     * the error for such values exceeds the maximum error i.e. only the color transformations
+     * not altered by this clamping are baked for float input bit-depths.
+     */
+    OPTIMIZATION_BAKE_LUT                        = 0x20000000,
+
+    /**
+     * For CPU processor only, when the input and output bit-depths are both integer ones (i.e.
+     * 8, 10, 12 or 16-bit) and the color transformation has channel crosstalk, process the
+     * images by a 3D table of the output codes indexed by the input codes (i.e. without any
+     * conversion to float) using a fixed-point interpolation. The table is discarded if its
+     * error (measured at the cell centers) exceeds one output code i.e. the higher the output
+     * bit-depth, the finer the grid must be. Refer to the OCIO_INTEGER_LOOKUP_SIZE envvar to
+     * tune the grid size e.g. to have an exact table for 8-bit inputs. Note that the alpha
+     * channel must not be mixed with the RGB channels.
+     */
+    OPTIMIZATION_INTEGER_LOOKUP                  = 0x40000000,
+
     /// Apply all possible optimizations.
     OPTIMIZATION_ALL                             = 0xFFFFFFFF,
 
@@ -764,6 +809,32 @@ extern OCIOEXPORT const char * OCIO_INACTIVE_COLORSPACES_ENVVAR;
  */
 extern OCIOEXPORT const char * OCIO_OPTIMIZATION_FLAGS_ENVVAR;
 
+/**
+ * The envvar 'OCIO_BAKE_LUT_SIZE' overrides the grid size of the 3D LUT used by the
+ * OPTIMIZATION_BAKE_LUT optimization (i.e. the default one or the one provided to
+ * Processor::getOptimizedCPUProcessor()). Remove the variable or set the value to empty to not
+ * use it. The value must be in [2, 129], an invalid value is ignored with a warning.
+ */
+extern OCIOEXPORT const char * OCIO_BAKE_LUT_SIZE_ENVVAR;
+
+/**
+ * The envvar 'OCIO_BAKE_LUT_MAX_ERROR' overrides the maximum error allowed by the
+ * OPTIMIZATION_BAKE_LUT optimization (i.e. the default one or the one provided to
+ * Processor::getOptimizedCPUProcessor()) i.e. the error is the absolute difference for values
+ * below 1.0 and the relative one otherwise. Remove the variable or set the value to empty to not
+ * use it. The value must be a positive number, an invalid value is ignored with a warning.
+ */
+extern OCIOEXPORT const char * OCIO_BAKE_LUT_MAX_ERROR_ENVVAR;
+
+/**
+ * The envvar 'OCIO_INTEGER_LOOKUP_SIZE' provides the grid size of the 3D table used by the
+ * OPTIMIZATION_INTEGER_LOOKUP optimization. The value must be in [2, 256] and the default is 65.
+ * For 8-bit inputs, 256 gives an exact table of all the input codes (i.e. no interpolation) at
+ * the cost of a larger memory footprint (i.e. up to 96MB). An invalid value is replaced by the
+ * default one, with a warning.
+ */
+extern OCIOEXPORT const char * OCIO_INTEGER_LOOKUP_SIZE_ENVVAR;
+
 /**
  * The envvar 'OCIO_USER_CATEGORIES' allows the end-user to filter color spaces shown by
  * applications.  Only color spaces that include at least one of the supplied categories will be
@@ -938,6 +1009,27 @@ extern OCIOEXPORT const char * OCIO_DISABLE_PROCESSOR_CACHES;
 // variable to disable the fallback.
 extern OCIOEXPORT const char * OCIO_DISABLE_CACHE_FALLBACK;
 
+//!rst::
+// .. c:var:: const char * OCIO_CACHE_MAX_ENTRIES
+//
+// The default maximum number of entries of each cache (see SetCacheMaxEntries). The default is 0
+// i.e. no limit.
+extern OCIOEXPORT const char * OCIO_CACHE_MAX_ENTRIES;
+
+//!rst::
+// .. c:var:: const char * OCIO_CACHE_MAX_MEMORY_SIZE
+//
+// The default maximum memory size in bytes of each cache (see SetCacheMaxMemorySize). The default
+// is 0 i.e. no limit.
+extern OCIOEXPORT const char * OCIO_CACHE_MAX_MEMORY_SIZE;
+
+//!rst::
+// .. c:var:: const char * OCIO_FILE_CACHE_DIR
+//
+// The default directory of the persistent LUT file cache (see SetFileCacheDirectory). The
+// persistent file cache is disabled by default.
+extern OCIOEXPORT const char * OCIO_FILE_CACHE_DIR;
+
 
 // Archive config feature
 // Default filename (with extension) of an config.
@@ -9,6 +9,7 @@
 #if OCIO_USE_AVX2
 
 #include <immintrin.h>
+#include <limits>
 
 #include <OpenColorIO/OpenColorIO.h>
 #include "BitDepthUtils.h"
@@ -37,6 +38,91 @@ inline __m256 avx2_clamp(__m256 value, const __m256& maxValue)
     return _mm256_min_ps(value, maxValue);
 }
 
+// Same log2, exp2 & power approximations as the SSE2 version (refer to SSE.h for the details)
+// i.e. a precision of approximately 15 bits of mantissa.
+
+inline __m256 avx2Log2(__m256 x)
+{
+    const __m256i emask = _mm256_set1_epi32(0x7F800000);
+
+    // y = log2( x ) = exponent + log2( mantissa ) with the mantissa in [1.0, 2.0[.
+    const __m256 mantissa
+        = _mm256_or_ps(_mm256_andnot_ps(_mm256_castsi256_ps(emask), x), _mm256_set1_ps(1.0f));
+
+    __m256 log2 = _mm256_set1_ps((float)+4.487361286440374006195e-2);
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), _mm256_set1_ps((float)-4.165637071209677112635e-1));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), _mm256_set1_ps((float)+1.631148826119436277100));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), _mm256_set1_ps((float)-3.550793018041176193407));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), _mm256_set1_ps((float)+5.091710879305474367557));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), _mm256_set1_ps((float)-2.800364054395965731506));
+
+    const __m256i exponent
+        = _mm256_sub_epi32(_mm256_srli_epi32(_mm256_and_si256(_mm256_castps_si256(x), emask), 23),
+                           _mm256_set1_epi32(127));
+
+    return _mm256_add_ps(log2, _mm256_cvtepi32_ps(exponent));
+}
+
+inline __m256 avx2Exp2(__m256 x)
+{
+    // y = exp2( x ) = exp2( floor(x) ) * exp2( fraction ) with the fraction in [0.0, 1.0[.
+    // Note that floor(x) is wrong for values outside of the int range & NaNs but these cases are
+    // handled below (or result in a NaN).
+    const __m256i floor_x
+        = _mm256_add_epi32(_mm256_cvttps_epi32(x),
+                           _mm256_castps_si256(_mm256_cmp_ps(_mm256_setzero_ps(), x, _CMP_NLE_UQ)));
+
+    const __m256 zf
+        = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(floor_x, _mm256_set1_epi32(127)), 23));
+
+    const __m256 fraction = _mm256_sub_ps(x, _mm256_cvtepi32_ps(floor_x));
+
+    __m256 mexp = _mm256_set1_ps((float)1.353416792833547468620e-2);
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction), _mm256_set1_ps((float)5.201146058412685018921e-2));
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction), _mm256_set1_ps((float)2.414427569091865207710e-1));
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction), _mm256_set1_ps((float)6.930038344665415134202e-1));
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction), _mm256_set1_ps((float)1.000002593370603213644));
+
+    __m256 exp2 = _mm256_mul_ps(zf, mexp);
+
+    // Handle the underflow & the overflow.
+    exp2 = _mm256_andnot_ps(_mm256_cmp_ps(x, _mm256_set1_ps(-126.0f), _CMP_LT_OQ), exp2);
+    exp2 = _mm256_blendv_ps(exp2,
+                            _mm256_set1_ps(std::numeric_limits<float>::infinity()),
+                            _mm256_cmp_ps(x, _mm256_set1_ps(128.0f), _CMP_GE_OQ));
+
+    return exp2;
+}
+
+// pow( x, exp ) = exp2( exp * log2( x ) ) where base values smaller or equal to zero are mapped
+// to zero.
+inline __m256 avx2Power(__m256 x, __m256 exp)
+{
+    const __m256 values = avx2Exp2(_mm256_mul_ps(exp, avx2Log2(x)));
+
+    return _mm256_and_ps(values, _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_GT_OQ));
+}
+
+// Same cube root approximation as the SSE2 version (refer to SSE.h for the details) i.e. the
+// input values must be positive and normalized.
+inline __m256 avx2Cbrt(__m256 x)
+{
+    const __m256 one_third = _mm256_set1_ps(1.0f / 3.0f);
+
+    const __m256 bits = _mm256_cvtepi32_ps(_mm256_castps_si256(x));
+    __m256i est = _mm256_cvttps_epi32(_mm256_mul_ps(bits, one_third));
+    est = _mm256_add_epi32(est, _mm256_set1_epi32(0x2a514067));
+
+    __m256 y = _mm256_castsi256_ps(est);
+    for (int i = 0; i < 3; ++i)
+    {
+        const __m256 delta = _mm256_sub_ps(y, _mm256_div_ps(x, _mm256_mul_ps(y, y)));
+        y = _mm256_sub_ps(y, _mm256_mul_ps(delta, one_third));
+    }
+
+    return y;
+}
+
 inline void avx2RGBATranspose_4x4_4x4(__m256 row0, __m256 row1, __m256 row2, __m256 row3,
             
                                       __m256 &out_r, __m256 &out_g, __m256 &out_b, __m256 &out_a )
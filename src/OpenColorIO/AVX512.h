@@ -9,6 +9,7 @@
 #if OCIO_USE_AVX512
 
 #include <immintrin.h>
+#include <limits>
 
 #include <OpenColorIO/OpenColorIO.h>
 #include "BitDepthUtils.h"
@@ -26,6 +27,97 @@ inline __m512 av512_clamp(__m512 value, const __m512& maxValue)
     return _mm512_min_ps(value, maxValue);
 }
 
+// Same log2, exp2 & power approximations as the SSE2 version (refer to SSE.h for the details)
+// i.e. a precision of approximately 15 bits of mantissa.
+
+inline __m512 avx512Log2(__m512 x)
+{
+    const __m512i emask = _mm512_set1_epi32(0x7F800000);
+
+    // y = log2( x ) = exponent + log2( mantissa ) with the mantissa in [1.0, 2.0[.
+    const __m512 mantissa
+        = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_andnot_epi32(emask, _mm512_castps_si512(x)),
+                                              _mm512_castps_si512(_mm512_set1_ps(1.0f))));
+
+    __m512 log2 = _mm512_set1_ps((float)+4.487361286440374006195e-2);
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa), _mm512_set1_ps((float)-4.165637071209677112635e-1));
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa), _mm512_set1_ps((float)+1.631148826119436277100));
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa), _mm512_set1_ps((float)-3.550793018041176193407));
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa), _mm512_set1_ps((float)+5.091710879305474367557));
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa), _mm512_set1_ps((float)-2.800364054395965731506));
+
+    const __m512i exponent
+        = _mm512_sub_epi32(_mm512_srli_epi32(_mm512_and_epi32(_mm512_castps_si512(x), emask), 23),
+                           _mm512_set1_epi32(127));
+
+    return _mm512_add_ps(log2, _mm512_cvtepi32_ps(exponent));
+}
+
+inline __m512 avx512Exp2(__m512 x)
+{
+    // y = exp2( x ) = exp2( floor(x) ) * exp2( fraction ) with the fraction in [0.0, 1.0[.
+    // Note that floor(x) is wrong for values outside of the int range & NaNs but these cases are
+    // handled below (or result in a NaN).
+    const __m512i trunc_x = _mm512_cvttps_epi32(x);
+    const __m512i floor_x
+        = _mm512_mask_sub_epi32(trunc_x,
+                                _mm512_cmp_ps_mask(_mm512_setzero_ps(), x, _CMP_NLE_UQ),
+                                trunc_x,
+                                _mm512_set1_epi32(1));
+
+    const __m512 zf
+        = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_add_epi32(floor_x, _mm512_set1_epi32(127)), 23));
+
+    const __m512 fraction = _mm512_sub_ps(x, _mm512_cvtepi32_ps(floor_x));
+
+    __m512 mexp = _mm512_set1_ps((float)1.353416792833547468620e-2);
+    mexp = _mm512_add_ps(_mm512_mul_ps(mexp, fraction), _mm512_set1_ps((float)5.201146058412685018921e-2));
+    mexp = _mm512_add_ps(_mm512_mul_ps(mexp, fraction), _mm512_set1_ps((float)2.414427569091865207710e-1));
+    mexp = _mm512_add_ps(_mm512_mul_ps(mexp, fraction), _mm512_set1_ps((float)6.930038344665415134202e-1));
+    mexp = _mm512_add_ps(_mm512_mul_ps(mexp, fraction), _mm512_set1_ps((float)1.000002593370603213644));
+
+    __m512 exp2 = _mm512_mul_ps(zf, mexp);
+
+    // Handle the underflow & the overflow.
+    exp2 = _mm512_mask_mov_ps(exp2,
+                              _mm512_cmp_ps_mask(x, _mm512_set1_ps(-126.0f), _CMP_LT_OQ),
+                              _mm512_setzero_ps());
+    exp2 = _mm512_mask_mov_ps(exp2,
+                              _mm512_cmp_ps_mask(x, _mm512_set1_ps(128.0f), _CMP_GE_OQ),
+                              _mm512_set1_ps(std::numeric_limits<float>::infinity()));
+
+    return exp2;
+}
+
+// pow( x, exp ) = exp2( exp * log2( x ) ) where base values smaller or equal to zero are mapped
+// to zero.
+inline __m512 avx512Power(__m512 x, __m512 exp)
+{
+    const __m512 values = avx512Exp2(_mm512_mul_ps(exp, avx512Log2(x)));
+
+    return _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_GT_OQ), values);
+}
+
+// Same cube root approximation as the SSE2 version (refer to SSE.h for the details) i.e. the
+// input values must be positive and normalized.
+inline __m512 avx512Cbrt(__m512 x)
+{
+    const __m512 one_third = _mm512_set1_ps(1.0f / 3.0f);
+
+    const __m512 bits = _mm512_cvtepi32_ps(_mm512_castps_si512(x));
+    __m512i est = _mm512_cvttps_epi32(_mm512_mul_ps(bits, one_third));
+    est = _mm512_add_epi32(est, _mm512_set1_epi32(0x2a514067));
+
+    __m512 y = _mm512_castsi512_ps(est);
+    for (int i = 0; i < 3; ++i)
+    {
+        const __m512 delta = _mm512_sub_ps(y, _mm512_div_ps(x, _mm512_mul_ps(y, y)));
+        y = _mm512_sub_ps(y, _mm512_mul_ps(delta, one_third));
+    }
+
+    return y;
+}
+
 inline __m512 avx512_movelh_ps(__m512 a, __m512 b)
 {
     return _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(a), _mm512_castps_pd(b)));
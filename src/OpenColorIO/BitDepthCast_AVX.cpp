@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "BitDepthCast_AVX.h"
+#if OCIO_USE_AVX
+
+#include <immintrin.h>
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+#if OCIO_USE_F16C
+
+// Note that the conversions are exact from half to float and round to the nearest even value
+// from float to half, like the half class does.
+
+void HalfToFloat(const void * inImg, void * outImg, long numPixels)
+{
+    const uint16_t * in = reinterpret_cast<const uint16_t *>(inImg);
+    float * out = reinterpret_cast<float *>(outImg);
+
+    // Each pixel has 4 values so the remaining pixels are processed one by one.
+    const long numValues = 4 * numPixels;
+    long idx = 0;
+
+    for (; idx + 16 <= numValues; idx += 16)
+    {
+        const __m256i values = _mm256_loadu_si256((const __m256i *)(in + idx));
+
+        _mm256_storeu_ps(out + idx,     _mm256_cvtph_ps(_mm256_castsi256_si128(values)));
+        _mm256_storeu_ps(out + idx + 8, _mm256_cvtph_ps(_mm256_extractf128_si256(values, 1)));
+    }
+
+    for (; idx < numValues; idx += 4)
+    {
+        _mm_storeu_ps(out + idx, _mm_cvtph_ps(_mm_loadl_epi64((const __m128i *)(in + idx))));
+    }
+}
+
+void FloatToHalf(const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = reinterpret_cast<const float *>(inImg);
+    uint16_t * out = reinterpret_cast<uint16_t *>(outImg);
+
+    const long numValues = 4 * numPixels;
+    long idx = 0;
+
+    for (; idx + 16 <= numValues; idx += 16)
+    {
+        const __m128i values0 = _mm256_cvtps_ph(_mm256_loadu_ps(in + idx),     0);
+        const __m128i values1 = _mm256_cvtps_ph(_mm256_loadu_ps(in + idx + 8), 0);
+
+        _mm256_storeu_si256((__m256i *)(out + idx),
+                            _mm256_insertf128_si256(_mm256_castsi128_si256(values0), values1, 1));
+    }
+
+    for (; idx < numValues; idx += 4)
+    {
+        _mm_storel_epi64((__m128i *)(out + idx), _mm_cvtps_ph(_mm_loadu_ps(in + idx), 0));
+    }
+}
+
+#endif // OCIO_USE_F16C
+
+} // anonymous namespace
+
+BitDepthCastFunc * AVXGetBitDepthCastFunc(BitDepth inBD, BitDepth outBD)
+{
+#if OCIO_USE_F16C
+    if (CPUInfo::instance().hasF16C())
+    {
+        if (inBD == BIT_DEPTH_F16 && outBD == BIT_DEPTH_F32)
+        {
+            return HalfToFloat;
+        }
+        else if (inBD == BIT_DEPTH_F32 && outBD == BIT_DEPTH_F16)
+        {
+            return FloatToHalf;
+        }
+    }
+#else
+    (void)inBD;
+    (void)outBD;
+#endif
+
+    return nullptr;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX
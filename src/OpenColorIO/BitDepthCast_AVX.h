@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_BITDEPTHCAST_AVX_H
+#define INCLUDED_OCIO_BITDEPTHCAST_AVX_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+typedef void (BitDepthCastFunc)(const void * inImg, void * outImg, long numPixels);
+
+#if OCIO_USE_AVX
+namespace OCIO_NAMESPACE
+{
+
+// Return the F16C conversion of RGBA pixels between the half & float bit-depths, or null if the
+// bit-depths are not supported.
+BitDepthCastFunc * AVXGetBitDepthCastFunc(BitDepth inBD, BitDepth outBD);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX
+
+#endif /* INCLUDED_OCIO_BITDEPTHCAST_AVX_H */
@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "BitDepthCast_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <cstring>
+#include <immintrin.h>
+
+#include "BitDepthUtils.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Note that the conversions produce the same values as the scalar BitDepthCast i.e. the integer
+// values are scaled to float, and the float values are scaled, rounded by adding 0.5 and then
+// clamped before being truncated (so that a NaN becomes 0).
+
+inline __m256 LoadIntegers(const uint8_t * in)
+{
+    return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)in)));
+}
+
+inline __m256 LoadIntegers(const uint16_t * in)
+{
+    return _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)in)));
+}
+
+inline __m128 LoadIntegers4(const uint8_t * in)
+{
+    int values;
+    memcpy(&values, in, sizeof(values));
+    return _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(values)));
+}
+
+inline __m128 LoadIntegers4(const uint16_t * in)
+{
+    return _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)in)));
+}
+
+// The values are already clamped so the saturations of the packing never happen.
+
+inline void StoreIntegers(uint8_t * out, __m256i values)
+{
+    const __m128i values16 = _mm_packus_epi32(_mm256_castsi256_si128(values),
+                                              _mm256_extracti128_si256(values, 1));
+    _mm_storel_epi64((__m128i *)out, _mm_packus_epi16(values16, values16));
+}
+
+inline void StoreIntegers(uint16_t * out, __m256i values)
+{
+    _mm_storeu_si128((__m128i *)out, _mm_packus_epi32(_mm256_castsi256_si128(values),
+                                                      _mm256_extracti128_si256(values, 1)));
+}
+
+inline void StoreIntegers4(uint8_t * out, __m128i values)
+{
+    const __m128i values16 = _mm_packus_epi32(values, values);
+    const int values8 = _mm_cvtsi128_si32(_mm_packus_epi16(values16, values16));
+    memcpy(out, &values8, sizeof(values8));
+}
+
+inline void StoreIntegers4(uint16_t * out, __m128i values)
+{
+    _mm_storel_epi64((__m128i *)out, _mm_packus_epi32(values, values));
+}
+
+template<BitDepth inBD>
+void IntegerToFloat(const void * inImg, void * outImg, long numPixels)
+{
+    typedef typename BitDepthInfo<inBD>::Type InType;
+
+    const InType * in = reinterpret_cast<const InType *>(inImg);
+    float * out = reinterpret_cast<float *>(outImg);
+
+    const float scale = float(BitDepthInfo<BIT_DEPTH_F32>::maxValue)
+                          / float(BitDepthInfo<inBD>::maxValue);
+
+    const __m256 scale8 = _mm256_set1_ps(scale);
+
+    // Each pixel has 4 values so the remaining pixels are processed one by one.
+    const long numValues = 4 * numPixels;
+    long idx = 0;
+
+    for (; idx + 16 <= numValues; idx += 16)
+    {
+        _mm256_storeu_ps(out + idx,     _mm256_mul_ps(LoadIntegers(in + idx),     scale8));
+        _mm256_storeu_ps(out + idx + 8, _mm256_mul_ps(LoadIntegers(in + idx + 8), scale8));
+    }
+
+    for (; idx < numValues; idx += 4)
+    {
+        _mm_storeu_ps(out + idx, _mm_mul_ps(LoadIntegers4(in + idx), _mm256_castps256_ps128(scale8)));
+    }
+}
+
+template<BitDepth outBD>
+void FloatToInteger(const void * inImg, void * outImg, long numPixels)
+{
+    typedef typename BitDepthInfo<outBD>::Type OutType;
+
+    const float * in = reinterpret_cast<const float *>(inImg);
+    OutType * out = reinterpret_cast<OutType *>(outImg);
+
+    const float scale = float(BitDepthInfo<outBD>::maxValue)
+                          / float(BitDepthInfo<BIT_DEPTH_F32>::maxValue);
+
+    const __m256 scale8 = _mm256_set1_ps(scale);
+    const __m256 half8  = _mm256_set1_ps(0.5f);
+    const __m256 zero8  = _mm256_setzero_ps();
+    const __m256 max8   = _mm256_set1_ps(float(BitDepthInfo<outBD>::maxValue));
+
+    const long numValues = 4 * numPixels;
+    long idx = 0;
+
+    for (; idx + 8 <= numValues; idx += 8)
+    {
+        __m256 values = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(in + idx), scale8), half8);
+        // The max must be first to also replace a NaN by zero.
+        values = _mm256_min_ps(_mm256_max_ps(values, zero8), max8);
+
+        StoreIntegers(out + idx, _mm256_cvttps_epi32(values));
+    }
+
+    if (idx < numValues)
+    {
+        __m128 values = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(in + idx),
+                                              _mm256_castps256_ps128(scale8)),
+                                   _mm256_castps256_ps128(half8));
+        values = _mm_min_ps(_mm_max_ps(values, _mm256_castps256_ps128(zero8)),
+                            _mm256_castps256_ps128(max8));
+
+        StoreIntegers4(out + idx, _mm_cvttps_epi32(values));
+    }
+}
+
+} // anonymous namespace
+
+BitDepthCastFunc * AVX2GetBitDepthCastFunc(BitDepth inBD, BitDepth outBD)
+{
+    if (inBD == BIT_DEPTH_F32)
+    {
+        switch (outBD)
+        {
+            case BIT_DEPTH_UINT8:  return FloatToInteger<BIT_DEPTH_UINT8>;
+            case BIT_DEPTH_UINT10: return FloatToInteger<BIT_DEPTH_UINT10>;
+            case BIT_DEPTH_UINT12: return FloatToInteger<BIT_DEPTH_UINT12>;
+            case BIT_DEPTH_UINT16: return FloatToInteger<BIT_DEPTH_UINT16>;
+            case BIT_DEPTH_UINT14:
+            case BIT_DEPTH_UINT32:
+            case BIT_DEPTH_F16:
+            case BIT_DEPTH_F32:
+            case BIT_DEPTH_UNKNOWN:
+            default: break;
+        }
+    }
+    else if (outBD == BIT_DEPTH_F32)
+    {
+        switch (inBD)
+        {
+            case BIT_DEPTH_UINT8:  return IntegerToFloat<BIT_DEPTH_UINT8>;
+            case BIT_DEPTH_UINT10: return IntegerToFloat<BIT_DEPTH_UINT10>;
+            case BIT_DEPTH_UINT12: return IntegerToFloat<BIT_DEPTH_UINT12>;
+            case BIT_DEPTH_UINT16: return IntegerToFloat<BIT_DEPTH_UINT16>;
+            case BIT_DEPTH_UINT14:
+            case BIT_DEPTH_UINT32:
+            case BIT_DEPTH_F16:
+            case BIT_DEPTH_F32:
+            case BIT_DEPTH_UNKNOWN:
+            default: break;
+        }
+    }
+
+    return nullptr;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "BitDepthCast_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Note that the conversions are exact from half to float and round to the nearest even value
+// from float to half, like the half class does.
+
+// Mask of the first numValues (i.e. at most 16) values of a vector.
+inline __mmask16 ValuesMask(long numValues)
+{
+    return numValues >= 16 ? __mmask16(0xFFFF) : __mmask16((1u << numValues) - 1);
+}
+
+void HalfToFloat(const void * inImg, void * outImg, long numPixels)
+{
+    const uint16_t * in = reinterpret_cast<const uint16_t *>(inImg);
+    float * out = reinterpret_cast<float *>(outImg);
+
+    const long numValues = 4 * numPixels;
+    long idx = 0;
+
+    for (; idx + 32 <= numValues; idx += 32)
+    {
+        const __m512i values = _mm512_loadu_si512((const __m512i *)(in + idx));
+
+        _mm512_storeu_ps(out + idx,      _mm512_cvtph_ps(_mm512_castsi512_si256(values)));
+        _mm512_storeu_ps(out + idx + 16, _mm512_cvtph_ps(_mm512_extracti64x4_epi64(values, 1)));
+    }
+
+    const long remaining = numValues - idx;
+    if (remaining > 0)
+    {
+        // The number of remaining values is even so the half values are loaded by pairs.
+        const __m512i values
+            = _mm512_maskz_loadu_epi32(ValuesMask(remaining / 2), (const __m512i *)(in + idx));
+
+        _mm512_mask_storeu_ps(out + idx, ValuesMask(remaining),
+                              _mm512_cvtph_ps(_mm512_castsi512_si256(values)));
+        if (remaining > 16)
+        {
+            _mm512_mask_storeu_ps(out + idx + 16, ValuesMask(remaining - 16),
+                                  _mm512_cvtph_ps(_mm512_extracti64x4_epi64(values, 1)));
+        }
+    }
+}
+
+void FloatToHalf(const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = reinterpret_cast<const float *>(inImg);
+    uint16_t * out = reinterpret_cast<uint16_t *>(outImg);
+
+    const long numValues = 4 * numPixels;
+    long idx = 0;
+
+    for (; idx + 32 <= numValues; idx += 32)
+    {
+        const __m256i values0 = _mm512_cvtps_ph(_mm512_loadu_ps(in + idx),      0);
+        const __m256i values1 = _mm512_cvtps_ph(_mm512_loadu_ps(in + idx + 16), 0);
+
+        _mm512_storeu_si512((__m512i *)(out + idx),
+                            _mm512_inserti64x4(_mm512_castsi256_si512(values0), values1, 1));
+    }
+
+    const long remaining = numValues - idx;
+    if (remaining > 0)
+    {
+        const __m256i values0
+            = _mm512_cvtps_ph(_mm512_maskz_loadu_ps(ValuesMask(remaining), in + idx), 0);
+        const __m256i values1
+            = remaining > 16
+                ? _mm512_cvtps_ph(_mm512_maskz_loadu_ps(ValuesMask(remaining - 16), in + idx + 16), 0)
+                : _mm256_setzero_si256();
+
+        // The number of remaining values is even so the half values are stored by pairs.
+        _mm512_mask_storeu_epi32((__m512i *)(out + idx), ValuesMask(remaining / 2),
+                                 _mm512_inserti64x4(_mm512_castsi256_si512(values0), values1, 1));
+    }
+}
+
+} // anonymous namespace
+
+BitDepthCastFunc * AVX512GetBitDepthCastFunc(BitDepth inBD, BitDepth outBD)
+{
+    if (inBD == BIT_DEPTH_F16 && outBD == BIT_DEPTH_F32)
+    {
+        return HalfToFloat;
+    }
+    else if (inBD == BIT_DEPTH_F32 && outBD == BIT_DEPTH_F16)
+    {
+        return FloatToHalf;
+    }
+
+    return nullptr;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -147,5 +147,20 @@ unsigned GetChannelSizeInBytes(BitDepth in)
     }
 }
 
+unsigned GetPackedPixelSizeInBytes(PackedFormat format)
+{
+    switch(format)
+    {
+        case PACKED_FORMAT_RGB10_A2:
+        case PACKED_FORMAT_DPX_RGB10:
+            return sizeof(uint32_t);
+        case PACKED_FORMAT_DPX_RGB12:
+            return 3 * sizeof(uint16_t);
+        case PACKED_FORMAT_NONE:
+        default:
+            throw Exception("Unsupported packed format.");
+    }
+}
+
 } // namespace OCIO_NAMESPACE
 
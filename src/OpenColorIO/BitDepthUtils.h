@@ -24,6 +24,9 @@ bool IsFloatBitDepth(BitDepth in);
 // Return the size in bytes of one channel.
 unsigned GetChannelSizeInBytes(BitDepth in);
 
+// Return the size in bytes of one pixel of a packed format.
+unsigned GetPackedPixelSizeInBytes(PackedFormat format);
+
 // Metaprogramming requires templated structures to access
 // some bit depth information at compile time.
 
@@ -71,7 +71,7 @@ static inline void cpuid(int index, int *data)
 
 CPUInfo::CPUInfo()
 {
-    flags = 0, family = 0, model = 0;
+    flags = 0, family = 0, model = 0, l1DataCacheSize = 0;
     memset(name, 0, sizeof(name));
     memset(vendor, 0, sizeof(vendor));
 
@@ -174,6 +174,26 @@ CPUInfo::CPUInfo()
         /* Haswell has slow gather */
         if ((flags & X86_CPU_FLAG_AVX2) && family == 6 && model < 70)
             flags |= X86_CPU_FLAG_AVX2_SLOWGATHER;
+
+        /* Deterministic cache parameters, the first sub-leaf describes the L1 data cache */
+        if (max_std_level >= 4)
+        {
+            cpuid(4, info.i);
+            if ((info.reg.eax & 0x1f) == 1 && ((info.reg.eax >> 5) & 0x7) == 1)
+            {
+                const uint32_t ways       = ((info.reg.ebx >> 22) & 0x3ff) + 1;
+                const uint32_t partitions = ((info.reg.ebx >> 12) & 0x3ff) + 1;
+                const uint32_t lineSize   = (info.reg.ebx & 0xfff) + 1;
+                const uint32_t sets       = info.reg.ecx + 1;
+                l1DataCacheSize = ways * partitions * lineSize * sets;
+            }
+        }
+    }
+    else if (!strncmp(vendor, "AuthenticAMD", 12) && max_ext_level >= 0x80000005)
+    {
+        /* L1 data cache size in KB */
+        cpuid(0x80000005, info.i);
+        l1DataCacheSize = (info.reg.ecx >> 24) * 1024;
     }
 
     // get cpu brand string
@@ -187,7 +207,7 @@ CPUInfo::CPUInfo()
 
 CPUInfo::CPUInfo()
 {
-    flags = 0;
+    flags = 0, l1DataCacheSize = 0;
     memset(name, 0, sizeof(name));
     memset(vendor, 0, sizeof(vendor));
 
@@ -214,7 +234,7 @@ CPUInfo::CPUInfo()
 
 CPUInfo::CPUInfo() // Unknown Processor
 {
-    flags = 0;
+    flags = 0, l1DataCacheSize = 0;
     memset(name, 0, sizeof(name));
     memset(vendor, 0, sizeof(vendor));
     snprintf(name, sizeof(name), "%s", "Unknown");
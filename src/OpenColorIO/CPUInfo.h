@@ -43,6 +43,7 @@ struct CPUInfo
     int model;
     char name[65];
     char vendor[13];
+    unsigned int l1DataCacheSize; // In bytes, 0 when unknown.
 
     CPUInfo();
 
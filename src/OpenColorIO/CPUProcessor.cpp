@@ -1,22 +1,74 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <sstream>
 #include <string.h>
+#include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BitDepthCast_AVX.h"
+#include "BitDepthCast_AVX2.h"
+#include "BitDepthCast_AVX512.h"
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "CPUProcessor.h"
+#include "Logging.h"
 #include "ops/lut1d/Lut1DOpCPU.h"
 #include "ops/lut3d/Lut3DOpCPU.h"
+#include "ops/lut3d/Lut3DOpData.h"
 #include "ops/matrix/MatrixOp.h"
+#include "ops/OpTools.h"
 #include "ops/range/RangeOpCPU.h"
+#include "ParseUtils.h"
+#include "Platform.h"
 #include "ScanlineHelper.h"
+#include "ThreadUtils.h"
 
 
 namespace OCIO_NAMESPACE
 {
 
+// Return the fastest vectorized bit-depth conversion supported by the CPU, or null if there is
+// none for these bit-depths.
+BitDepthCastFunc * GetSIMDBitDepthCastFunc(BitDepth inBD, BitDepth outBD)
+{
+    BitDepthCastFunc * func = nullptr;
+
+#if OCIO_USE_AVX
+    if (CPUInfo::instance().hasAVX())
+    {
+        func = AVXGetBitDepthCastFunc(inBD, outBD);
+    }
+#endif
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        if (BitDepthCastFunc * avx2Func = AVX2GetBitDepthCastFunc(inBD, outBD))
+        {
+            func = avx2Func;
+        }
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        if (BitDepthCastFunc * avx512Func = AVX512GetBitDepthCastFunc(inBD, outBD))
+        {
+            func = avx512Func;
+        }
+    }
+#endif
+
+    (void)inBD;
+    (void)outBD;
+
+    return func;
+}
+
 template<BitDepth inBD, BitDepth outBD>
 class BitDepthCast : public OpCPU
 {
@@ -29,6 +81,12 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override
     {
+        if (m_applyCastFunc)
+        {
+            m_applyCastFunc(inImg, outImg, numPixels);
+            return;
+        }
+
         const InType * in = reinterpret_cast<const InType*>(inImg);
         OutType * out = reinterpret_cast<OutType*>(outImg);
 
@@ -47,6 +105,9 @@ public:
 protected:
     const float m_scale = float(BitDepthInfo<outBD>::maxValue)
                             / float(BitDepthInfo<inBD>::maxValue);
+
+    // Vectorized implementation, if any, of the conversion.
+    BitDepthCastFunc * const m_applyCastFunc = GetSIMDBitDepthCastFunc(inBD, outBD);
 };
 
 template<>
@@ -63,6 +124,22 @@ public:
             memcpy(outImg, inImg, 4*numPixels*sizeof(float));
         }
     }
+
+    // The planes are processed in-place so there is nothing to do.
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * /* rPlane */, float * /* gPlane */, float * /* bPlane */,
+                     float * /* aPlane */, long /* numPixels */) const override
+    {
+    }
+
+    bool hasPackedRGBApply() const override { return true; }
+    void applyPackedRGB(const void * inImg, void * outImg, long numPixels) const override
+    {
+        if(inImg!=outImg)
+        {
+            memcpy(outImg, inImg, 3*numPixels*sizeof(float));
+        }
+    }
 };
 
 ConstOpCPURcPtr CreateGenericBitDepthHelper(BitDepth in, BitDepth out)
@@ -128,8 +205,13 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
                      // The remaining CPU Ops.
                      ConstOpCPURcPtrVec & cpuOps,
                      // The bit-depth 'cast' or the last CPU Op.
-                     ConstOpCPURcPtr & outBitDepthOp)
+                     ConstOpCPURcPtr & outBitDepthOp,
+                     // The flattened form of all the above CPU Ops.
+                     CPUProgram & program)
 {
+    // Note that the program instructions are appended in the processing order i.e.
+    // inBitDepthOp, then cpuOps and then outBitDepthOp.
+
     const size_t maxOps = ops.size();
     const bool fastLogExpPow = HasFlag(oFlags, OPTIMIZATION_FAST_LOG_EXP_POW);
     for(size_t idx=0; idx<maxOps; ++idx)
@@ -143,20 +225,25 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
             {
                 ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(opData);
                 inBitDepthOp = GetLut1DRenderer(lut, in, BIT_DEPTH_F32);
+                program.addCall(inBitDepthOp);
             }
             else if(in==BIT_DEPTH_F32)
             {
                 inBitDepthOp = op->getCPUOp(fastLogExpPow);
+                program.addOp(op, inBitDepthOp);
             }
             else
             {
                 inBitDepthOp = CreateGenericBitDepthHelper(in, BIT_DEPTH_F32);
+                program.addCall(inBitDepthOp);
                 cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+                program.addOp(op, cpuOps.back());
             }
 
             if(maxOps==1)
             {
                 outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
+                program.addCall(outBitDepthOp);
             }
         }
         else if(idx==(maxOps-1))
@@ -165,20 +252,25 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
             {
                 ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(opData);
                 outBitDepthOp = GetLut1DRenderer(lut, BIT_DEPTH_F32, out);
+                program.addCall(outBitDepthOp);
             }
             else if(out==BIT_DEPTH_F32)
             {
                 outBitDepthOp = op->getCPUOp(fastLogExpPow);
+                program.addOp(op, outBitDepthOp);
             }
             else
             {
                 outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
                 cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+                program.addOp(op, cpuOps.back());
+                program.addCall(outBitDepthOp);
             }
         }
         else
         {
             cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+            program.addOp(op, cpuOps.back());
         }
     }
 }
@@ -239,6 +331,64 @@ case in:                                              \
     throw Exception("Unsupported bit-depths");
 }
 
+ScanlineHelperPool::~ScanlineHelperPool()
+{
+}
+
+void ScanlineHelperPool::reset(BitDepth in, const ConstOpCPURcPtr & inBitDepthOp,
+                               BitDepth out, const ConstOpCPURcPtr & outBitDepthOp)
+{
+    AutoMutex lock(m_mutex);
+
+    m_inBitDepth    = in;
+    m_inBitDepthOp  = inBitDepthOp;
+    m_outBitDepth   = out;
+    m_outBitDepthOp = outBitDepthOp;
+
+    m_helpers.clear();
+
+    // Keep enough helpers for a multi-threaded apply using all the hardware threads. The
+    // reservation guarantees that release() never reallocates.
+    m_maxHelpers = GetNumWorkerThreads(0);
+    m_helpers.reserve(m_maxHelpers);
+}
+
+std::unique_ptr<ScanlineHelper> ScanlineHelperPool::acquire()
+{
+    AutoMutex lock(m_mutex);
+
+    if (!m_helpers.empty())
+    {
+        std::unique_ptr<ScanlineHelper> helper = std::move(m_helpers.back());
+        m_helpers.pop_back();
+        return helper;
+    }
+
+    return std::unique_ptr<ScanlineHelper>(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
+                                                                m_outBitDepth, m_outBitDepthOp));
+}
+
+void ScanlineHelperPool::release(std::unique_ptr<ScanlineHelper> && helper) noexcept
+{
+    if (!helper)
+    {
+        return;
+    }
+
+    AutoMutex lock(m_mutex);
+
+    if (m_helpers.size() < m_maxHelpers)
+    {
+        m_helpers.push_back(std::move(helper));
+    }
+}
+
+size_t ScanlineHelperPool::size() const
+{
+    AutoMutex lock(m_mutex);
+    return m_helpers.size();
+}
+
 bool CPUProcessor::Impl::isDynamic() const noexcept
 {
     if (m_inBitDepthOp->isDynamic())
@@ -308,9 +458,125 @@ DynamicPropertyRcPtr CPUProcessor::Impl::getDynamicProperty(DynamicPropertyType
     throw Exception("Cannot find dynamic property; not used by CPU processor.");
 }
 
+namespace
+{
+
+// The envvar, if set, overrides the grid size requested through the API.
+unsigned long GetBakeLutSize(unsigned bakeLutSize)
+{
+    std::string envSize;
+    if (!Platform::Getenv(OCIO_BAKE_LUT_SIZE_ENVVAR, envSize) || envSize.empty())
+    {
+        return bakeLutSize;
+    }
+
+    int size = 0;
+    if (!StringToInt(&size, envSize.c_str(), true)
+        || size < 2 || size > (int)Lut3DOpData::maxSupportedLength)
+    {
+        std::ostringstream oss;
+        oss << "Invalid value '" << envSize << "' for the env. variable '"
+            << OCIO_BAKE_LUT_SIZE_ENVVAR << "', it must be in [2, "
+            << Lut3DOpData::maxSupportedLength << "]. The value " << bakeLutSize
+            << " is used.";
+        LogWarning(oss.str());
+        return bakeLutSize;
+    }
+
+    return (unsigned long)size;
+}
+
+// The envvar, if set, overrides the maximum error requested through the API.
+float GetBakeLutMaxError(float bakeLutMaxError)
+{
+    std::string envError;
+    if (!Platform::Getenv(OCIO_BAKE_LUT_MAX_ERROR_ENVVAR, envError) || envError.empty())
+    {
+        return bakeLutMaxError;
+    }
+
+    float error = 0.0f;
+    if (!StringToFloat(&error, envError.c_str()) || !(error > 0.0f))
+    {
+        std::ostringstream oss;
+        oss << "Invalid value '" << envError << "' for the env. variable '"
+            << OCIO_BAKE_LUT_MAX_ERROR_ENVVAR << "', it must be a positive number. The value "
+            << bakeLutMaxError << " is used.";
+        LogWarning(oss.str());
+        return bakeLutMaxError;
+    }
+
+    return error;
+}
+
+unsigned long GetIntegerLookupSize()
+{
+    static constexpr int defaultSize = 65;
+    static constexpr int maxSize = 256;
+
+    std::string envSize;
+    if (!Platform::Getenv(OCIO_INTEGER_LOOKUP_SIZE_ENVVAR, envSize) || envSize.empty())
+    {
+        return defaultSize;
+    }
+
+    int size = 0;
+    if (!StringToInt(&size, envSize.c_str(), true) || size < 2 || size > maxSize)
+    {
+        std::ostringstream oss;
+        oss << "Invalid value '" << envSize << "' for the env. variable '"
+            << OCIO_INTEGER_LOOKUP_SIZE_ENVVAR << "', it must be in [2, " << maxSize
+            << "]. The default value " << defaultSize << " is used.";
+        LogWarning(oss.str());
+        return defaultSize;
+    }
+
+    return (unsigned long)size;
+}
+
+// Process packed RGBA pixels through the CPU ops i.e. from the input bit-depth of the first op
+// to the output bit-depth of the last one.
+void EvalCPUOps(const ConstOpCPURcPtr & inBitDepthOp,
+                const ConstOpCPURcPtrVec & cpuOps,
+                const ConstOpCPURcPtr & outBitDepthOp,
+                const void * inImg, void * outImg, long numPixels)
+{
+    std::vector<float> buffer(4 * numPixels);
+
+    inBitDepthOp->apply(inImg, buffer.data(), numPixels);
+    for (const auto & op : cpuOps)
+    {
+        op->apply(buffer.data(), buffer.data(), numPixels);
+    }
+    outBitDepthOp->apply(buffer.data(), outImg, numPixels);
+}
+
+} // anon.
+
+void CheckBakeLutParams(unsigned bakeLutSize, float bakeLutMaxError)
+{
+    if (bakeLutSize < 2 || bakeLutSize > Lut3DOpData::maxSupportedLength)
+    {
+        std::ostringstream oss;
+        oss << "Invalid bake LUT size '" << bakeLutSize << "', it must be in [2, "
+            << Lut3DOpData::maxSupportedLength << "].";
+        throw Exception(oss.str().c_str());
+    }
+
+    if (!(bakeLutMaxError > 0.0f))
+    {
+        std::ostringstream oss;
+        oss << "Invalid bake LUT maximum error '" << bakeLutMaxError
+            << "', it must be a positive number.";
+        throw Exception(oss.str().c_str());
+    }
+}
+
 void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
                        BitDepth in, BitDepth out,
-                       OptimizationFlags oFlags)
+                       OptimizationFlags oFlags,
+                       unsigned bakeLutSize = DefaultBakeLutSize,
+                       float bakeLutMaxError = DefaultBakeLutMaxError)
 {
     ops = rawOps;
 
@@ -322,6 +588,14 @@ void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
         // Optimize the ops.
         ops.optimize(oFlags);
         ops.optimizeForBitdepth(in, out, oFlags);
+
+        // Lossy replacement of the remaining ops by LUTs i.e. only kept if accurate enough.
+        if (HasFlag(oFlags, OPTIMIZATION_BAKE_LUT))
+        {
+            BakeOpsToLut(ops, in,
+                         GetBakeLutSize(bakeLutSize), GetBakeLutMaxError(bakeLutMaxError),
+                         HasFlag(oFlags, OPTIMIZATION_FAST_LOG_EXP_POW));
+        }
     }
 
     // The previous code could change the list of ops so an explicit check to empty is still needed.
@@ -340,14 +614,15 @@ void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
 
 void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
                                   BitDepth in, BitDepth out,
-                                  OptimizationFlags oFlags)
+                                  OptimizationFlags oFlags,
+                                  unsigned bakeLutSize, float bakeLutMaxError)
 {
     AutoMutex lock(m_mutex);
 
     // Get the ops of the color transformation without the bit-depth adjustments.
 
     OpRcPtrVec ops;
-    FinalizeOpsForCPU(ops, rawOps, in, out, oFlags);
+    FinalizeOpsForCPU(ops, rawOps, in, out, oFlags, bakeLutSize, bakeLutMaxError);
 
     m_inBitDepth  = in;
     m_outBitDepth = out;
@@ -363,7 +638,55 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
     m_cpuOps.clear();
     m_inBitDepthOp = nullptr;
     m_outBitDepthOp = nullptr;
-    CreateCPUEngine(ops, in, out, oFlags, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp);
+    m_program.clear();
+    CreateCPUEngine(ops, in, out, oFlags, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp, m_program);
+
+    m_scanlineHelpers.reset(in, m_inBitDepthOp, out, m_outBitDepthOp);
+
+    // Precompute the color processing of the integer images.
+
+    m_integerLookup = nullptr;
+    IntegerLookup::Type lookupType = IntegerLookup::TYPE_1D;
+    if (IntegerLookup::GetType(ops, in, out, oFlags, lookupType))
+    {
+        // The output codes of the exact tables come from the CPU ops, but the interpolated
+        // nodes need the float values i.e. before the conversion to the output bit-depth.
+        ConstOpCPURcPtr floatInOp, floatOutOp;
+        ConstOpCPURcPtrVec floatOps;
+        CPUProgram floatProgram;
+        CreateCPUEngine(ops, in, BIT_DEPTH_F32, oFlags,
+                        floatInOp, floatOps, floatOutOp, floatProgram);
+
+        m_integerLookup = IntegerLookup::Create(
+            in, out, lookupType,
+            lookupType == IntegerLookup::TYPE_1D ? 0 : GetIntegerLookupSize(),
+            [this](const void * inImg, void * outImg, long numPixels)
+            {
+                EvalCPUOps(m_inBitDepthOp, m_cpuOps, m_outBitDepthOp, inImg, outImg, numPixels);
+            },
+            [&floatInOp, &floatOps, &floatOutOp](const void * inImg, void * outImg,
+                                                  long numPixels)
+            {
+                EvalCPUOps(floatInOp, floatOps, floatOutOp, inImg, outImg, numPixels);
+            });
+    }
+
+    m_hasPlanarApply = in == BIT_DEPTH_F32 && out == BIT_DEPTH_F32
+                       && m_inBitDepthOp->hasPlanarApply() && m_outBitDepthOp->hasPlanarApply()
+                       && std::all_of(m_cpuOps.begin(), m_cpuOps.end(),
+                                      [](const ConstOpCPURcPtr & op)
+                                      { return op->hasPlanarApply(); });
+
+    m_hasPackedRGBApply = in == BIT_DEPTH_F32 && out == BIT_DEPTH_F32
+                          && m_inBitDepthOp->hasPackedRGBApply()
+                          && m_outBitDepthOp->hasPackedRGBApply()
+                          && std::all_of(m_cpuOps.begin(), m_cpuOps.end(),
+                                         [](const ConstOpCPURcPtr & op)
+                                         { return op->hasPackedRGBApply(); });
+
+    // The CPU ops hold their own copies of the op parameters (e.g. the LUTs).
+    m_memorySize = sizeof(*this) + ops.getMemorySize()
+                   + (m_integerLookup ? m_integerLookup->getMemorySize() : 0);
 
     // Compute the cache id.
 
@@ -376,75 +699,621 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
     m_cacheID = ss.str();
 }
 
-void CPUProcessor::Impl::apply(const ImageDesc & imgDesc) const
-{   
-    // Get the ScanlineHelper for this thread (no significant performance impact).
-    std::unique_ptr<ScanlineHelper> 
-        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
-                                             m_outBitDepth, m_outBitDepthOp));
-
-    // Prepare the processing.
-    scanlineBuilder->init(imgDesc);
+namespace
+{
 
+// Process all the scanlines selected by the scanline helper. The scanline helper returns
+// blocks of pixels small enough to stay in cache while all the ops are applied.
+void ProcessScanlines(ScanlineHelper & scanlineBuilder, const ConstOpCPURcPtrVec & cpuOps)
+{
     float * rgbaBuffer = nullptr;
     long numPixels = 0;
 
+    const size_t numOps = cpuOps.size();
+
     while(true)
     {
-        scanlineBuilder->prepRGBAScanline(&rgbaBuffer, numPixels);
+        scanlineBuilder.prepRGBAScanline(&rgbaBuffer, numPixels);
         if(numPixels == 0) break;
 
-        const size_t numOps = m_cpuOps.size();
         for(size_t i = 0; i<numOps; ++i)
         {
-            m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+            cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+        }
+
+        scanlineBuilder.finishRGBAScanline();
+    }
+}
+
+// Scoped use of a scanline helper from the pool i.e. the helper goes back to the pool even if
+// the processing throws.
+class PooledScanlineHelper
+{
+public:
+    PooledScanlineHelper() = delete;
+    PooledScanlineHelper(const PooledScanlineHelper &) = delete;
+    PooledScanlineHelper & operator=(const PooledScanlineHelper &) = delete;
+
+    explicit PooledScanlineHelper(ScanlineHelperPool & pool)
+        :   m_pool(pool)
+        ,   m_helper(pool.acquire())
+    {
+    }
+
+    ~PooledScanlineHelper()
+    {
+        m_pool.release(std::move(m_helper));
+    }
+
+    ScanlineHelper & operator*() const { return *m_helper; }
+    ScanlineHelper * operator->() const { return m_helper.get(); }
+
+private:
+    ScanlineHelperPool & m_pool;
+    std::unique_ptr<ScanlineHelper> m_helper;
+};
+
+// Scoped use of several scanline helpers from the pool.
+class PooledScanlineHelpers
+{
+public:
+    PooledScanlineHelpers() = delete;
+    PooledScanlineHelpers(const PooledScanlineHelpers &) = delete;
+    PooledScanlineHelpers & operator=(const PooledScanlineHelpers &) = delete;
+
+    PooledScanlineHelpers(ScanlineHelperPool & pool, unsigned numHelpers)
+        :   m_pool(pool)
+    {
+        m_helpers.reserve(numHelpers);
+        for(unsigned idx = 0; idx < numHelpers; ++idx)
+        {
+            m_helpers.push_back(m_pool.acquire());
+        }
+    }
+
+    ~PooledScanlineHelpers()
+    {
+        for(auto & helper : m_helpers)
+        {
+            m_pool.release(std::move(helper));
         }
+    }
+
+    ScanlineHelperVec & helpers() { return m_helpers; }
+
+private:
+    ScanlineHelperPool & m_pool;
+    ScanlineHelperVec m_helpers;
+};
+
+// Number of scanline bands per worker thread, more bands balance the work better between
+// the threads (i.e. the processing cost could be very different between scanlines) at the
+// price of more synchronizations.
+constexpr long BANDS_PER_THREAD = 4;
 
-        scanlineBuilder->finishRGBAScanline();
+// Channel planes of a 32-bit float image i.e. one buffer per channel, where the alpha plane
+// is optional.
+struct FloatPlanes
+{
+    explicit FloatPlanes(const ImageDesc & img)
+        :   m_width(img.getWidth())
+        ,   m_height(img.getHeight())
+        ,   m_yStrideBytes(img.getYStrideBytes())
+    {
+        m_planes[0] = reinterpret_cast<char *>(img.getRData());
+        m_planes[1] = reinterpret_cast<char *>(img.getGData());
+        m_planes[2] = reinterpret_cast<char *>(img.getBData());
+        m_planes[3] = reinterpret_cast<char *>(img.getAData());
     }
+
+    float * row(int chan, long yIndex) const
+    {
+        return reinterpret_cast<float *>(m_planes[chan] + m_yStrideBytes * yIndex);
+    }
+
+    long m_width;
+    long m_height;
+    ptrdiff_t m_yStrideBytes;
+    char * m_planes[4];
+};
+
+bool IsFloatPlanar(const ImageDesc & img)
+{
+    if (img.getBitDepth() != BIT_DEPTH_F32 || img.getXStrideBytes() != sizeof(float))
+    {
+        return false;
+    }
+
+    // The channels must be in distinct buffers.
+    const FloatPlanes planes(img);
+    const int numChannels = planes.m_planes[3] ? 4 : 3;
+    for (int chan = 0; chan < numChannels; ++chan)
+    {
+        for (int other = chan + 1; other < numChannels; ++other)
+        {
+            if (planes.m_planes[chan] == planes.m_planes[other])
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Process the scanlines [yBegin, yEnd) of the channel planes. The source planes are first copied
+// to the destination ones (unless they are the same), then all the ops process them in-place.
+void ProcessPlanarScanlines(const FloatPlanes & src, const FloatPlanes & dst,
+                            const ConstOpCPURcPtr & inBitDepthOp,
+                            const ConstOpCPURcPtrVec & cpuOps,
+                            const ConstOpCPURcPtr & outBitDepthOp,
+                            long yBegin, long yEnd)
+{
+    const long blockSize = std::min(dst.m_width, GetDefaultPixelBlockSize());
+
+    // The ops always process an alpha channel, when the destination image has none the alpha
+    // values are only kept in this buffer.
+    std::vector<float> alphaBuffer(dst.m_planes[3] ? 0 : blockSize);
+
+    for (long yIndex = yBegin; yIndex < yEnd; ++yIndex)
+    {
+        for (long xIndex = 0; xIndex < dst.m_width; xIndex += blockSize)
+        {
+            const long numPixels = std::min(blockSize, dst.m_width - xIndex);
+
+            float * planes[4];
+            for (int chan = 0; chan < 4; ++chan)
+            {
+                planes[chan] = dst.m_planes[chan] ? dst.row(chan, yIndex) + xIndex
+                                                  : alphaBuffer.data();
+
+                // Like the packing of the RGBA buffers, the alpha is 0 when the source image has
+                // no alpha channel.
+                if (!src.m_planes[chan])
+                {
+                    std::fill(planes[chan], planes[chan] + numPixels, 0.0f);
+                }
+                else
+                {
+                    const float * srcPlane = src.row(chan, yIndex) + xIndex;
+                    if (srcPlane != planes[chan])
+                    {
+                        memcpy(planes[chan], srcPlane, numPixels * sizeof(float));
+                    }
+                }
+            }
+
+            inBitDepthOp->applyPlanar(planes[0], planes[1], planes[2], planes[3], numPixels);
+            for (const auto & op : cpuOps)
+            {
+                op->applyPlanar(planes[0], planes[1], planes[2], planes[3], numPixels);
+            }
+            outBitDepthOp->applyPlanar(planes[0], planes[1], planes[2], planes[3], numPixels);
+        }
+    }
+}
+
+// Packed RGB 32-bit float image i.e. three floats per pixel without alpha.
+struct FloatPackedRGB
+{
+    explicit FloatPackedRGB(const ImageDesc & img)
+        :   m_width(img.getWidth())
+        ,   m_height(img.getHeight())
+        ,   m_yStrideBytes(img.getYStrideBytes())
+        ,   m_data(reinterpret_cast<char *>(img.getRData()))
+    {
+    }
+
+    float * row(long yIndex) const
+    {
+        return reinterpret_cast<float *>(m_data + m_yStrideBytes * yIndex);
+    }
+
+    long m_width;
+    long m_height;
+    ptrdiff_t m_yStrideBytes;
+    char * m_data;
+};
+
+bool IsFloatPackedRGB(const ImageDesc & img)
+{
+    if (img.getBitDepth() != BIT_DEPTH_F32 || img.getAData()
+        || img.getXStrideBytes() != 3 * sizeof(float))
+    {
+        return false;
+    }
+
+    // The channels must be in the RGB order.
+    const char * rData = reinterpret_cast<const char *>(img.getRData());
+    return reinterpret_cast<const char *>(img.getGData()) == rData + sizeof(float)
+           && reinterpret_cast<const char *>(img.getBData()) == rData + 2 * sizeof(float);
+}
+
+// Process the scanlines [yBegin, yEnd) of packed RGB images. The first op reads the source
+// pixels, then all the other ops process the destination pixels in-place.
+void ProcessPackedRGBScanlines(const FloatPackedRGB & src, const FloatPackedRGB & dst,
+                               const ConstOpCPURcPtr & inBitDepthOp,
+                               const ConstOpCPURcPtrVec & cpuOps,
+                               const ConstOpCPURcPtr & outBitDepthOp,
+                               long yBegin, long yEnd)
+{
+    const long blockSize = std::min(dst.m_width, GetDefaultPixelBlockSize());
+
+    for (long yIndex = yBegin; yIndex < yEnd; ++yIndex)
+    {
+        for (long xIndex = 0; xIndex < dst.m_width; xIndex += blockSize)
+        {
+            const long numPixels = std::min(blockSize, dst.m_width - xIndex);
+
+            const float * in = src.row(yIndex) + 3 * xIndex;
+            float * out = dst.row(yIndex) + 3 * xIndex;
+
+            inBitDepthOp->applyPackedRGB(in, out, numPixels);
+            for (const auto & op : cpuOps)
+            {
+                op->applyPackedRGB(out, out, numPixels);
+            }
+            outBitDepthOp->applyPackedRGB(out, out, numPixels);
+        }
+    }
+}
+
+// Integer image i.e. the channels could be interleaved or in planes, and in any order.
+// Are the pixels in a packed format i.e. not in the containers of the bit-depth?
+bool HasPackedFormat(const ImageDesc & img)
+{
+    const PackedImageDesc * packedImg = dynamic_cast<const PackedImageDesc *>(&img);
+    return packedImg && packedImg->getPackedFormat() != PACKED_FORMAT_NONE;
+}
+
+struct IntegerImage
+{
+    explicit IntegerImage(const ImageDesc & img)
+        :   m_width(img.getWidth())
+        ,   m_height(img.getHeight())
+        ,   m_xStrideBytes(img.getXStrideBytes())
+        ,   m_yStrideBytes(img.getYStrideBytes())
+    {
+        m_channels[0] = reinterpret_cast<char *>(img.getRData());
+        m_channels[1] = reinterpret_cast<char *>(img.getGData());
+        m_channels[2] = reinterpret_cast<char *>(img.getBData());
+        m_channels[3] = reinterpret_cast<char *>(img.getAData());
+    }
+
+    // Get the channels of the first pixel of a scanline, the missing channels stay null.
+    void row(long yIndex, char * channels[4]) const
+    {
+        for (int chan = 0; chan < 4; ++chan)
+        {
+            channels[chan] = m_channels[chan] ? m_channels[chan] + m_yStrideBytes * yIndex
+                                              : nullptr;
+        }
+    }
+
+    long m_width;
+    long m_height;
+    ptrdiff_t m_xStrideBytes;
+    ptrdiff_t m_yStrideBytes;
+    char * m_channels[4];
+};
+
+// Process the scanlines [yBegin, yEnd) of integer images using only the lookup tables.
+void ProcessIntegerLookupScanlines(const IntegerImage & src, const IntegerImage & dst,
+                                   const IntegerLookup & lookup,
+                                   long yBegin, long yEnd)
+{
+    char * srcChannels[4];
+    char * dstChannels[4];
+
+    for (long yIndex = yBegin; yIndex < yEnd; ++yIndex)
+    {
+        src.row(yIndex, srcChannels);
+        dst.row(yIndex, dstChannels);
+
+        lookup.apply(srcChannels, src.m_xStrideBytes, dstChannels, dst.m_xStrideBytes,
+                     dst.m_width);
+    }
+}
+
+// Process the scanlines by bands using several threads, or directly when only one thread is used.
+template<typename Fn>
+void ProcessScanlineBands(long height, unsigned numThreads, const Fn & processScanlines)
+{
+    numThreads = (unsigned)std::min<long>(GetNumWorkerThreads(numThreads), height);
+    if (numThreads <= 1)
+    {
+        processScanlines(0, height);
+        return;
+    }
+
+    // Split the image in bands of scanlines.
+    const long numBands = std::min<long>(height, numThreads * BANDS_PER_THREAD);
+    const long bandSize = (height + numBands - 1) / numBands;
+
+    ParallelFor(height, bandSize, numThreads,
+                [&processScanlines](unsigned /* workerIndex */, long yBegin, long yEnd)
+                {
+                    processScanlines(yBegin, yEnd);
+                });
+}
+
+} // anon.
+
+bool CPUProcessor::Impl::canApplyPlanar(const ImageDesc & srcImgDesc,
+                                        const ImageDesc & dstImgDesc) const
+{
+    if (!m_hasPlanarApply || !IsFloatPlanar(dstImgDesc))
+    {
+        return false;
+    }
+
+    if (&srcImgDesc == &dstImgDesc)
+    {
+        return true;
+    }
+
+    if (!IsFloatPlanar(srcImgDesc)
+        || srcImgDesc.getWidth() != dstImgDesc.getWidth()
+        || srcImgDesc.getHeight() != dstImgDesc.getHeight())
+    {
+        return false;
+    }
+
+    // A source plane could only be re-used as the destination plane of the same channel
+    // because the source planes are copied channel by channel before being processed.
+    const FloatPlanes src(srcImgDesc);
+    const FloatPlanes dst(dstImgDesc);
+    for (int chan = 0; chan < 4; ++chan)
+    {
+        for (int other = 0; other < 4; ++other)
+        {
+            if (chan != other && src.m_planes[chan] && src.m_planes[chan] == dst.m_planes[other])
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+void CPUProcessor::Impl::applyPlanar(const ImageDesc & srcImgDesc,
+                                     const ImageDesc & dstImgDesc,
+                                     unsigned numThreads) const
+{
+    const FloatPlanes src(srcImgDesc);
+    const FloatPlanes dst(dstImgDesc);
+
+    ProcessScanlineBands(dst.m_height, numThreads,
+                         [this, &src, &dst](long yBegin, long yEnd)
+                         {
+                             ProcessPlanarScanlines(src, dst,
+                                                    m_inBitDepthOp, m_cpuOps, m_outBitDepthOp,
+                                                    yBegin, yEnd);
+                         });
+}
+
+bool CPUProcessor::Impl::canApplyPackedRGB(const ImageDesc & srcImgDesc,
+                                           const ImageDesc & dstImgDesc) const
+{
+    if (!m_hasPackedRGBApply || !IsFloatPackedRGB(dstImgDesc))
+    {
+        return false;
+    }
+
+    if (&srcImgDesc == &dstImgDesc)
+    {
+        return true;
+    }
+
+    return IsFloatPackedRGB(srcImgDesc)
+           && srcImgDesc.getWidth() == dstImgDesc.getWidth()
+           && srcImgDesc.getHeight() == dstImgDesc.getHeight();
+}
+
+void CPUProcessor::Impl::applyPackedRGB(const ImageDesc & srcImgDesc,
+                                        const ImageDesc & dstImgDesc,
+                                        unsigned numThreads) const
+{
+    const FloatPackedRGB src(srcImgDesc);
+    const FloatPackedRGB dst(dstImgDesc);
+
+    ProcessScanlineBands(dst.m_height, numThreads,
+                         [this, &src, &dst](long yBegin, long yEnd)
+                         {
+                             ProcessPackedRGBScanlines(src, dst,
+                                                       m_inBitDepthOp, m_cpuOps, m_outBitDepthOp,
+                                                       yBegin, yEnd);
+                         });
+}
+
+bool CPUProcessor::Impl::canApplyIntegerLookup(const ImageDesc & srcImgDesc,
+                                               const ImageDesc & dstImgDesc) const
+{
+    return m_integerLookup
+           && srcImgDesc.getBitDepth() == m_inBitDepth
+           && dstImgDesc.getBitDepth() == m_outBitDepth
+           && !HasPackedFormat(srcImgDesc) && !HasPackedFormat(dstImgDesc)
+           && srcImgDesc.getWidth() == dstImgDesc.getWidth()
+           && srcImgDesc.getHeight() == dstImgDesc.getHeight();
+}
+
+void CPUProcessor::Impl::applyIntegerLookup(const ImageDesc & srcImgDesc,
+                                            const ImageDesc & dstImgDesc,
+                                            unsigned numThreads) const
+{
+    const IntegerImage src(srcImgDesc);
+    const IntegerImage dst(dstImgDesc);
+
+    ProcessScanlineBands(dst.m_height, numThreads,
+                         [this, &src, &dst](long yBegin, long yEnd)
+                         {
+                             ProcessIntegerLookupScanlines(src, dst, *m_integerLookup,
+                                                           yBegin, yEnd);
+                         });
+}
+
+void CPUProcessor::Impl::apply(const ImageDesc & imgDesc) const
+{
+    if (canApplyPlanar(imgDesc, imgDesc))
+    {
+        applyPlanar(imgDesc, imgDesc, 1);
+        return;
+    }
+
+    if (canApplyPackedRGB(imgDesc, imgDesc))
+    {
+        applyPackedRGB(imgDesc, imgDesc, 1);
+        return;
+    }
+
+    if (canApplyIntegerLookup(imgDesc, imgDesc))
+    {
+        applyIntegerLookup(imgDesc, imgDesc, 1);
+        return;
+    }
+
+    // Get a ScanlineHelper for this thread, its buffers are re-used between the calls.
+    PooledScanlineHelper scanlineBuilder(m_scanlineHelpers);
+
+    // Prepare the processing.
+    scanlineBuilder->init(imgDesc);
+
+    ProcessScanlines(*scanlineBuilder, m_cpuOps);
 }
 
 void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const
 {
-    // Get the ScanlineHelper for this thread (no significant performance impact).
-    std::unique_ptr<ScanlineHelper> 
-        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
-                                             m_outBitDepth, m_outBitDepthOp));
+    if (canApplyPlanar(srcImgDesc, dstImgDesc))
+    {
+        applyPlanar(srcImgDesc, dstImgDesc, 1);
+        return;
+    }
+
+    if (canApplyPackedRGB(srcImgDesc, dstImgDesc))
+    {
+        applyPackedRGB(srcImgDesc, dstImgDesc, 1);
+        return;
+    }
+
+    if (canApplyIntegerLookup(srcImgDesc, dstImgDesc))
+    {
+        applyIntegerLookup(srcImgDesc, dstImgDesc, 1);
+        return;
+    }
+
+    // Get a ScanlineHelper for this thread, its buffers are re-used between the calls.
+    PooledScanlineHelper scanlineBuilder(m_scanlineHelpers);
 
     // Prepare the processing.
     scanlineBuilder->init(srcImgDesc, dstImgDesc);
 
-    float * rgbaBuffer = nullptr;
-    long numPixels = 0;
+    ProcessScanlines(*scanlineBuilder, m_cpuOps);
+}
 
-    while(true)
+void CPUProcessor::Impl::apply(const ImageDesc & imgDesc, unsigned numThreads) const
+{
+    if (canApplyPlanar(imgDesc, imgDesc))
     {
-        scanlineBuilder->prepRGBAScanline(&rgbaBuffer, numPixels);
-        if(numPixels == 0) break;
+        applyPlanar(imgDesc, imgDesc, numThreads);
+        return;
+    }
 
-        const size_t numOps = m_cpuOps.size();
-        for(size_t i = 0; i<numOps; ++i)
-        {
-            m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
-        }
+    if (canApplyPackedRGB(imgDesc, imgDesc))
+    {
+        applyPackedRGB(imgDesc, imgDesc, numThreads);
+        return;
+    }
+
+    if (canApplyIntegerLookup(imgDesc, imgDesc))
+    {
+        applyIntegerLookup(imgDesc, imgDesc, numThreads);
+        return;
+    }
+
+    const long height = imgDesc.getHeight();
 
-        scanlineBuilder->finishRGBAScanline();
+    numThreads = (unsigned)std::min<long>(GetNumWorkerThreads(numThreads), height);
+    if(numThreads <= 1)
+    {
+        apply(imgDesc);
+        return;
+    }
+
+    // Each worker thread has its own ScanlineHelper i.e. its own intermediate buffers.
+    PooledScanlineHelpers scanlineBuilders(m_scanlineHelpers, numThreads);
+    for(auto & scanlineBuilder : scanlineBuilders.helpers())
+    {
+        scanlineBuilder->init(imgDesc);
     }
+
+    applyInParallel(scanlineBuilders.helpers(), height);
 }
 
-void CPUProcessor::Impl::applyRGB(float * pixel) const
+void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc,
+                               ImageDesc & dstImgDesc,
+                               unsigned numThreads) const
 {
-    float v[4]{pixel[0], pixel[1], pixel[2], 0.0f};
+    if (canApplyPlanar(srcImgDesc, dstImgDesc))
+    {
+        applyPlanar(srcImgDesc, dstImgDesc, numThreads);
+        return;
+    }
+
+    if (canApplyPackedRGB(srcImgDesc, dstImgDesc))
+    {
+        applyPackedRGB(srcImgDesc, dstImgDesc, numThreads);
+        return;
+    }
 
-    m_inBitDepthOp->apply(v, v, 1);
+    if (canApplyIntegerLookup(srcImgDesc, dstImgDesc))
+    {
+        applyIntegerLookup(srcImgDesc, dstImgDesc, numThreads);
+        return;
+    }
+
+    const long height = dstImgDesc.getHeight();
+
+    numThreads = (unsigned)std::min<long>(GetNumWorkerThreads(numThreads), height);
+    if(numThreads <= 1)
+    {
+        apply(srcImgDesc, dstImgDesc);
+        return;
+    }
 
-    const size_t numOps = m_cpuOps.size();
-    for(size_t i = 0; i<numOps; ++i)
+    // Each worker thread has its own ScanlineHelper i.e. its own intermediate buffers.
+    PooledScanlineHelpers scanlineBuilders(m_scanlineHelpers, numThreads);
+    for(auto & scanlineBuilder : scanlineBuilders.helpers())
     {
-        m_cpuOps[i]->apply(v, v, 1);
+        scanlineBuilder->init(srcImgDesc, dstImgDesc);
     }
 
-    m_outBitDepthOp->apply(v, v, 1);
+    applyInParallel(scanlineBuilders.helpers(), height);
+}
+
+void CPUProcessor::Impl::applyInParallel(ScanlineHelperVec & scanlineBuilders, long height) const
+{
+    const unsigned numThreads = (unsigned)scanlineBuilders.size();
+
+    // Split the image in bands of scanlines.
+    const long numBands  = std::min<long>(height, numThreads * BANDS_PER_THREAD);
+    const long bandSize  = (height + numBands - 1) / numBands;
+
+    ParallelFor(height, bandSize, numThreads,
+                [this, &scanlineBuilders](unsigned workerIndex, long yBegin, long yEnd)
+                {
+                    ScanlineHelper & scanlineBuilder = *scanlineBuilders[workerIndex];
+
+                    scanlineBuilder.setScanlineRange(yBegin, yEnd);
+                    ProcessScanlines(scanlineBuilder, m_cpuOps);
+                });
+}
+
+void CPUProcessor::Impl::applyRGB(float * pixel) const
+{
+    float v[4]{pixel[0], pixel[1], pixel[2], 0.0f};
+
+    m_program.applyRGBA(v);
 
     pixel[0] = v[0];
     pixel[1] = v[1];
@@ -453,15 +1322,7 @@ void CPUProcessor::Impl::applyRGB(float * pixel) const
 
 void CPUProcessor::Impl::applyRGBA(float * pixel) const
 {
-    m_inBitDepthOp->apply(pixel, pixel, 1);
-
-    const size_t numOps = m_cpuOps.size();
-    for(size_t i = 0; i<numOps; ++i)
-    {
-        m_cpuOps[i]->apply(pixel, pixel, 1);
-    }
-
-    m_outBitDepthOp->apply(pixel, pixel, 1);
+    m_program.applyRGBA(pixel);
 }
 
 
@@ -543,6 +1404,18 @@ void CPUProcessor::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) c
     getImpl()->apply(srcImgDesc, dstImgDesc);
 }
 
+void CPUProcessor::apply(const ImageDesc & imgDesc, unsigned numThreads) const
+{
+    getImpl()->apply(imgDesc, numThreads);
+}
+
+void CPUProcessor::apply(const ImageDesc & srcImgDesc,
+                         ImageDesc & dstImgDesc,
+                         unsigned numThreads) const
+{
+    getImpl()->apply(srcImgDesc, dstImgDesc, numThreads);
+}
+
 void CPUProcessor::applyRGB(float * pixel) const
 {
     getImpl()->applyRGB(pixel);
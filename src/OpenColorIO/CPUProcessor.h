@@ -6,15 +6,65 @@
 #define INCLUDED_OCIO_CPUPROCESSOR_H
 
 
+#include <memory>
+#include <vector>
+
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "CPUProgram.h"
+#include "IntegerLookup.h"
 #include "Op.h"
 
 
 namespace OCIO_NAMESPACE
 {
 
+// Default grid size & maximum error of the OPTIMIZATION_BAKE_LUT optimization.
+constexpr unsigned DefaultBakeLutSize = 65;
+constexpr float DefaultBakeLutMaxError = 1e-2f;
+
+// Throw if the grid size or the maximum error of the OPTIMIZATION_BAKE_LUT optimization is
+// invalid.
+void CheckBakeLutParams(unsigned bakeLutSize, float bakeLutMaxError);
+
 class ScanlineHelper;
+typedef std::vector<std::unique_ptr<ScanlineHelper>> ScanlineHelperVec;
+
+// Thread-safe pool of scanline helpers. A CPU processor keeps its scanline helpers, and their
+// intermediate buffers, between apply() calls so that repeated calls (e.g. one per tile of an
+// image) do not allocate once the buffers are large enough.
+class ScanlineHelperPool
+{
+public:
+    ScanlineHelperPool() = default;
+    ScanlineHelperPool(const ScanlineHelperPool &) = delete;
+    ScanlineHelperPool & operator=(const ScanlineHelperPool &) = delete;
+
+    ~ScanlineHelperPool();
+
+    // Discard all the pooled helpers and set how the new ones are created.
+    void reset(BitDepth in, const ConstOpCPURcPtr & inBitDepthOp,
+               BitDepth out, const ConstOpCPURcPtr & outBitDepthOp);
+
+    // Get a helper from the pool or create a new one if the pool is empty.
+    std::unique_ptr<ScanlineHelper> acquire();
+
+    // Give back a helper to the pool. The helper is destroyed if the pool is already full.
+    void release(std::unique_ptr<ScanlineHelper> && helper) noexcept;
+
+    // Number of helpers available in the pool.
+    size_t size() const;
+
+private:
+    BitDepth          m_inBitDepth = BIT_DEPTH_F32;
+    ConstOpCPURcPtr   m_inBitDepthOp;
+    BitDepth          m_outBitDepth = BIT_DEPTH_F32;
+    ConstOpCPURcPtr   m_outBitDepthOp;
+
+    ScanlineHelperVec m_helpers;
+    size_t            m_maxHelpers = 0; // Helpers above this count are not kept.
+    mutable Mutex     m_mutex;
+};
 
 class CPUProcessor::Impl
 {
@@ -39,6 +89,10 @@ public:
     BitDepth getInputBitDepth() const noexcept { return m_inBitDepth; }
     BitDepth getOutputBitDepth() const noexcept { return m_outBitDepth; }
 
+    // Estimation of the memory used by the processing (e.g. the LUTs, baked or not, and the
+    // integer lookup tables), in bytes.
+    size_t getMemorySize() const noexcept { return m_memorySize; }
+
     bool isDynamic() const noexcept;
     bool hasDynamicProperty(DynamicPropertyType type) const noexcept;
     DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
@@ -46,6 +100,9 @@ public:
     void apply(const ImageDesc & imgDesc) const;
     void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
 
+    void apply(const ImageDesc & imgDesc, unsigned numThreads) const;
+    void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc, unsigned numThreads) const;
+
     // Note that the method only accepts one packed RGB and 32-bit float pixel.
     void applyRGB(float * pixel) const;
     // Note that the method only accepts one packed RGBA and 32-bit float pixel.
@@ -55,21 +112,57 @@ public:
     //
     // Functions not exposed to the OCIO public API.
 
-    void finalize(const OpRcPtrVec & rawOps, BitDepth in, BitDepth out, OptimizationFlags oFlags);
+    void finalize(const OpRcPtrVec & rawOps, BitDepth in, BitDepth out, OptimizationFlags oFlags,
+                  unsigned bakeLutSize, float bakeLutMaxError);
 
 private:
+    // Process the image scanlines in parallel, one ScanlineHelper per worker thread.
+    void applyInParallel(ScanlineHelperVec & scanlineBuilders, long height) const;
+
+    // Could the images be processed directly on their channel planes i.e. without packing the
+    // pixels into RGBA buffers?
+    bool canApplyPlanar(const ImageDesc & srcImgDesc, const ImageDesc & dstImgDesc) const;
+    // Process the channel planes of 32-bit float images, src & dst could be the same image.
+    void applyPlanar(const ImageDesc & srcImgDesc,
+                     const ImageDesc & dstImgDesc,
+                     unsigned numThreads) const;
+
+    // Could the images be processed directly on their packed RGB pixels i.e. without expanding
+    // the pixels into RGBA buffers?
+    bool canApplyPackedRGB(const ImageDesc & srcImgDesc, const ImageDesc & dstImgDesc) const;
+    // Process the pixels of packed RGB 32-bit float images, src & dst could be the same image.
+    void applyPackedRGB(const ImageDesc & srcImgDesc,
+                        const ImageDesc & dstImgDesc,
+                        unsigned numThreads) const;
+
+    // Could the images be processed by the integer lookup i.e. without any float conversion?
+    bool canApplyIntegerLookup(const ImageDesc & srcImgDesc, const ImageDesc & dstImgDesc) const;
+    // Process the pixels of integer images, src & dst could be the same image.
+    void applyIntegerLookup(const ImageDesc & srcImgDesc,
+                            const ImageDesc & dstImgDesc,
+                            unsigned numThreads) const;
+
     ConstOpCPURcPtr    m_inBitDepthOp; // Converts from in to F32. It could be done by the first op.
     ConstOpCPURcPtrVec m_cpuOps;       // It could be empty if the OpVec only contains a 1D LUT op
                                        // (e.g. the 1D LUT CPUOp instance would be in the m_inBitDepthOp).
     ConstOpCPURcPtr    m_outBitDepthOp;// Converts from F32 to out. It could be done by the last op.
+    CPUProgram         m_program;      // Flattened form of the above CPU ops to process one pixel.
+    // Tables of the above CPU ops to process the integer images, if any.
+    std::unique_ptr<IntegerLookup> m_integerLookup;
 
     BitDepth           m_inBitDepth = BIT_DEPTH_F32;
     BitDepth           m_outBitDepth = BIT_DEPTH_F32;
     bool               m_isNoOp = false;
     bool               m_isIdentity = false;
     bool               m_hasChannelCrosstalk = true;
+    // Do all the CPU ops support the planar & packed RGB processing?
+    bool               m_hasPlanarApply = false;
+    bool               m_hasPackedRGBApply = false;
+    size_t             m_memorySize = 0;
     std::string        m_cacheID;
     Mutex              m_mutex;
+
+    mutable ScanlineHelperPool m_scanlineHelpers;
 };
 
 } // namespace OCIO_NAMESPACE
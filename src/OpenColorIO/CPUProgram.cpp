@@ -0,0 +1,323 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <algorithm>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUProgram.h"
+#include "MathUtils.h"
+#include "ops/matrix/MatrixOpData.h"
+#include "ops/range/RangeOpData.h"
+#include "SSE.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// Note that the computations must exactly match the ones from the matrix renderers
+// (refer to MatrixOpCPU.cpp) so that a pixel gives the same result than in an image i.e. the
+// optimized implementations, when available, are used instead.
+inline void ApplyMatrix(float * pixel, const float * params, bool hasOffsets)
+{
+#if OCIO_USE_SSE2
+    const __m128 m0 = _mm_loadu_ps(params);
+    const __m128 m1 = _mm_loadu_ps(params + 4);
+    const __m128 m2 = _mm_loadu_ps(params + 8);
+    const __m128 m3 = _mm_loadu_ps(params + 12);
+
+    const __m128 rm0 = _mm_mul_ps(m0, _mm_set1_ps(pixel[0]));
+    const __m128 gm1 = _mm_mul_ps(m1, _mm_set1_ps(pixel[1]));
+    const __m128 bm2 = _mm_mul_ps(m2, _mm_set1_ps(pixel[2]));
+    const __m128 am3 = _mm_mul_ps(m3, _mm_set1_ps(pixel[3]));
+
+    __m128 img = _mm_add_ps(_mm_add_ps(rm0, gm1), _mm_add_ps(bm2, am3));
+    if (hasOffsets)
+    {
+        img = _mm_add_ps(img, _mm_loadu_ps(params + 16));
+    }
+
+    _mm_storeu_ps(pixel, img);
+#else
+    const float r = pixel[0];
+    const float g = pixel[1];
+    const float b = pixel[2];
+    const float a = pixel[3];
+
+    for (int channel = 0; channel < 4; ++channel)
+    {
+        pixel[channel] = r * params[channel]
+                       + g * params[4 + channel]
+                       + b * params[8 + channel]
+                       + a * params[12 + channel];
+
+        if (hasOffsets)
+        {
+            pixel[channel] += params[16 + channel];
+        }
+    }
+#endif
+}
+
+} // anon.
+
+CPUProgram::CPUProgram()
+    : m_applyMatrixFunc(GetMatrixApplyFunc())
+    , m_applyScaleFunc(GetScaleApplyFunc())
+{
+}
+
+void CPUProgram::clear()
+{
+    m_instructions.clear();
+    m_calledOps.clear();
+}
+
+void CPUProgram::addOp(const ConstOpRcPtr & op, const ConstOpCPURcPtr & cpuOp)
+{
+    ConstOpDataRcPtr opData = op->data();
+
+    switch (opData->getType())
+    {
+        case OpData::MatrixType:
+        {
+            if (addMatrix(opData))
+            {
+                return;
+            }
+            break;
+        }
+        case OpData::RangeType:
+        {
+            if (addRange(opData))
+            {
+                return;
+            }
+            break;
+        }
+
+        case OpData::CDLType:
+        case OpData::ExponentType:
+        case OpData::ExposureContrastType:
+        case OpData::FixedFunctionType:
+        case OpData::GammaType:
+        case OpData::GradingPrimaryType:
+        case OpData::GradingRGBCurveType:
+        case OpData::GradingToneType:
+        case OpData::LogType:
+        case OpData::Lut1DType:
+        case OpData::Lut3DType:
+        case OpData::ReferenceType:
+        case OpData::NoOpType:
+            // The other ops are called through their CPU renderers.
+            break;
+    }
+
+    addCall(cpuOp);
+}
+
+void CPUProgram::addCall(const ConstOpCPURcPtr & cpuOp)
+{
+    if (!cpuOp)
+    {
+        throw Exception("CPU program: missing CPU op.");
+    }
+
+    Instruction inst;
+    inst.m_opcode = OPCODE_CALL;
+    inst.m_cpuOp  = cpuOp.get();
+
+    m_instructions.push_back(inst);
+    m_calledOps.push_back(cpuOp);
+}
+
+bool CPUProgram::addMatrix(const ConstOpDataRcPtr & opData)
+{
+    ConstMatrixOpDataRcPtr mat = DynamicPtrCast<const MatrixOpData>(opData);
+    if (!mat || mat->getDirection() != TRANSFORM_DIR_FORWARD)
+    {
+        return false;
+    }
+
+    Instruction inst;
+
+    const ArrayDouble::Values & m = mat->getArray().getValues();
+    const MatrixOpData::Offsets & o = mat->getOffsets();
+
+    if (mat->isDiagonal())
+    {
+        inst.m_opcode = mat->hasOffsets() ? OPCODE_SCALE_OFFSET : OPCODE_SCALE;
+
+        inst.m_params[0] = (float)m[0];
+        inst.m_params[1] = (float)m[5];
+        inst.m_params[2] = (float)m[10];
+        inst.m_params[3] = (float)m[15];
+
+        for (int channel = 0; channel < 4; ++channel)
+        {
+            inst.m_params[4 + channel] = (float)o[channel];
+        }
+    }
+    else
+    {
+        inst.m_opcode = mat->hasOffsets() ? OPCODE_MATRIX_OFFSET : OPCODE_MATRIX;
+
+        const unsigned long dim = mat->getArray().getLength();
+
+        // Store the matrix per column i.e. the red, green, blue and then alpha multipliers.
+        for (unsigned long column = 0; column < 4; ++column)
+        {
+            for (unsigned long row = 0; row < 4; ++row)
+            {
+                inst.m_params[4 * column + row] = (float)m[row * dim + column];
+            }
+        }
+
+        for (int channel = 0; channel < 4; ++channel)
+        {
+            inst.m_params[16 + channel] = (float)o[channel];
+        }
+    }
+
+    m_instructions.push_back(inst);
+
+    return true;
+}
+
+bool CPUProgram::addRange(const ConstOpDataRcPtr & opData)
+{
+    ConstRangeOpDataRcPtr range = DynamicPtrCast<const RangeOpData>(opData);
+    if (!range || range->getDirection() != TRANSFORM_DIR_FORWARD)
+    {
+        return false;
+    }
+
+    Instruction inst;
+
+    // Same renderer selection than the range op (refer to RangeOpCPU.cpp).
+    if (range->minIsEmpty())
+    {
+        inst.m_opcode = OPCODE_RANGE_MAX;
+    }
+    else if (range->maxIsEmpty())
+    {
+        inst.m_opcode = OPCODE_RANGE_MIN;
+    }
+    else if (!range->scales())
+    {
+        inst.m_opcode = OPCODE_RANGE_MIN_MAX;
+    }
+    else
+    {
+        inst.m_opcode = OPCODE_RANGE_SCALE_MIN_MAX;
+    }
+
+    inst.m_params[0] = (float)range->getScale();
+    inst.m_params[1] = (float)range->getOffset();
+    inst.m_params[2] = (float)range->getMinOutValue();
+    inst.m_params[3] = (float)range->getMaxOutValue();
+
+    m_instructions.push_back(inst);
+
+    return true;
+}
+
+void CPUProgram::applyRGBA(float * pixel) const
+{
+    for (const Instruction & inst : m_instructions)
+    {
+        const float * p = inst.m_params;
+
+        switch (inst.m_opcode)
+        {
+            case OPCODE_CALL:
+            {
+                inst.m_cpuOp->apply(pixel, pixel, 1);
+                break;
+            }
+            case OPCODE_SCALE:
+            {
+                if (m_applyScaleFunc)
+                {
+                    m_applyScaleFunc(p, nullptr, pixel, pixel, 1);
+                    break;
+                }
+                pixel[0] = pixel[0] * p[0];
+                pixel[1] = pixel[1] * p[1];
+                pixel[2] = pixel[2] * p[2];
+                pixel[3] = pixel[3] * p[3];
+                break;
+            }
+            case OPCODE_SCALE_OFFSET:
+            {
+                if (m_applyScaleFunc)
+                {
+                    m_applyScaleFunc(p, p + 4, pixel, pixel, 1);
+                    break;
+                }
+                pixel[0] = pixel[0] * p[0] + p[4];
+                pixel[1] = pixel[1] * p[1] + p[5];
+                pixel[2] = pixel[2] * p[2] + p[6];
+                pixel[3] = pixel[3] * p[3] + p[7];
+                break;
+            }
+            case OPCODE_MATRIX:
+            {
+                if (m_applyMatrixFunc)
+                {
+                    m_applyMatrixFunc(p, nullptr, pixel, pixel, 1);
+                    break;
+                }
+                ApplyMatrix(pixel, p, false);
+                break;
+            }
+            case OPCODE_MATRIX_OFFSET:
+            {
+                if (m_applyMatrixFunc)
+                {
+                    m_applyMatrixFunc(p, p + 16, pixel, pixel, 1);
+                    break;
+                }
+                ApplyMatrix(pixel, p, true);
+                break;
+            }
+            case OPCODE_RANGE_SCALE_MIN_MAX:
+            {
+                // NaNs become the lower bound.
+                pixel[0] = Clamp(pixel[0] * p[0] + p[1], p[2], p[3]);
+                pixel[1] = Clamp(pixel[1] * p[0] + p[1], p[2], p[3]);
+                pixel[2] = Clamp(pixel[2] * p[0] + p[1], p[2], p[3]);
+                break;
+            }
+            case OPCODE_RANGE_MIN_MAX:
+            {
+                // NaNs become the lower bound.
+                pixel[0] = Clamp(pixel[0], p[2], p[3]);
+                pixel[1] = Clamp(pixel[1], p[2], p[3]);
+                pixel[2] = Clamp(pixel[2], p[2], p[3]);
+                break;
+            }
+            case OPCODE_RANGE_MIN:
+            {
+                // NaNs become the lower bound.
+                pixel[0] = std::max(p[2], pixel[0]);
+                pixel[1] = std::max(p[2], pixel[1]);
+                pixel[2] = std::max(p[2], pixel[2]);
+                break;
+            }
+            case OPCODE_RANGE_MAX:
+            {
+                // NaNs become the upper bound.
+                pixel[0] = std::min(p[3], pixel[0]);
+                pixel[1] = std::min(p[3], pixel[1]);
+                pixel[2] = std::min(p[3], pixel[2]);
+                break;
+            }
+        }
+    }
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_CPUPROGRAM_H
+#define INCLUDED_OCIO_CPUPROGRAM_H
+
+
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Op.h"
+#include "ops/matrix/MatrixOpCPU.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// A CPU program is a flattened form of a chain of CPU ops used to process individual pixels
+// (i.e. CPUProcessor::applyRGB() & CPUProcessor::applyRGBA()). The instructions, and the
+// parameters of the simple ops (e.g. matrix & range ops), are stored in one contiguous buffer
+// and directly evaluated by the interpreter loop, avoiding the pointer chasing and virtual calls
+// of the op chain. All the other ops are called through their OpCPU.
+class CPUProgram
+{
+public:
+    CPUProgram();
+    CPUProgram(const CPUProgram &) = delete;
+    CPUProgram & operator=(const CPUProgram &) = delete;
+
+    ~CPUProgram() = default;
+
+    void clear();
+
+    // Append the CPU op created for the op i.e. the op parameters are inlined in the program
+    // when the op type is supported by the interpreter. Note that the op must be finalized.
+    void addOp(const ConstOpRcPtr & op, const ConstOpCPURcPtr & cpuOp);
+
+    // Append a call to the CPU op (e.g. a bit-depth conversion).
+    void addCall(const ConstOpCPURcPtr & cpuOp);
+
+    size_t getNumInstructions() const noexcept { return m_instructions.size(); }
+    size_t getNumCalls() const noexcept { return m_calledOps.size(); }
+
+    // Process in place one packed RGBA 32-bit float pixel.
+    void applyRGBA(float * pixel) const;
+
+private:
+    enum Opcode
+    {
+        OPCODE_CALL = 0,
+        OPCODE_SCALE,
+        OPCODE_SCALE_OFFSET,
+        OPCODE_MATRIX,
+        OPCODE_MATRIX_OFFSET,
+        OPCODE_RANGE_SCALE_MIN_MAX,
+        OPCODE_RANGE_MIN_MAX,
+        OPCODE_RANGE_MIN,
+        OPCODE_RANGE_MAX
+    };
+
+    struct Instruction
+    {
+        Opcode        m_opcode = OPCODE_CALL;
+        const OpCPU * m_cpuOp  = nullptr; // Only used by OPCODE_CALL.
+
+        // The inlined op parameters i.e. up to a 4x4 matrix (stored per column) with offsets.
+        float m_params[20];
+    };
+
+    bool addMatrix(const ConstOpDataRcPtr & opData);
+    bool addRange(const ConstOpDataRcPtr & opData);
+
+    std::vector<Instruction> m_instructions;
+
+    // The optimized matrix implementations also used by the matrix renderers, if any.
+    MatrixApplyFunc * m_applyMatrixFunc = nullptr;
+    MatrixApplyFunc * m_applyScaleFunc  = nullptr;
+
+    // Holds the CPU ops called by the program.
+    ConstOpCPURcPtrVec m_calledOps;
+};
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_CPUPROGRAM_H
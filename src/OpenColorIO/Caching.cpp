@@ -2,10 +2,15 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <atomic>
+#include <cstdlib>
+#include <sstream>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Caching.h"
 #include "transforms/CDLTransform.h"
+#include "Logging.h"
 #include "PathUtils.h"
 #include "transforms/FileTransform.h"
 
@@ -16,6 +21,69 @@ namespace OCIO_NAMESPACE
 const char * OCIO_DISABLE_ALL_CACHES       = "OCIO_DISABLE_ALL_CACHES";
 const char * OCIO_DISABLE_PROCESSOR_CACHES = "OCIO_DISABLE_PROCESSOR_CACHES";
 const char * OCIO_DISABLE_CACHE_FALLBACK   = "OCIO_DISABLE_CACHE_FALLBACK";
+const char * OCIO_CACHE_MAX_ENTRIES        = "OCIO_CACHE_MAX_ENTRIES";
+const char * OCIO_CACHE_MAX_MEMORY_SIZE    = "OCIO_CACHE_MAX_MEMORY_SIZE";
+const char * OCIO_FILE_CACHE_DIR           = "OCIO_FILE_CACHE_DIR";
+
+namespace
+{
+
+// Read a cache limit from an env. variable, an invalid value meaning no limit.
+size_t GetEnvCacheLimit(const char * envvar)
+{
+    std::string value;
+    if (!Platform::Getenv(envvar, value) || value.empty())
+    {
+        return 0;
+    }
+
+    char * end = nullptr;
+    const unsigned long long limit = strtoull(value.c_str(), &end, 10);
+    if (*end != '\0' || value[0] == '-')
+    {
+        std::ostringstream oss;
+        oss << "Invalid value '" << value << "' for the env. variable '" << envvar
+            << "', the cache is not limited.";
+        LogWarning(oss.str());
+        return 0;
+    }
+
+    return (size_t)limit;
+}
+
+std::atomic<size_t> & CacheMaxEntries()
+{
+    static std::atomic<size_t> maxEntries{ GetEnvCacheLimit(OCIO_CACHE_MAX_ENTRIES) };
+    return maxEntries;
+}
+
+std::atomic<size_t> & CacheMaxMemorySize()
+{
+    static std::atomic<size_t> maxMemorySize{ GetEnvCacheLimit(OCIO_CACHE_MAX_MEMORY_SIZE) };
+    return maxMemorySize;
+}
+
+} // anon.
+
+void SetCacheMaxEntries(size_t maxEntries)
+{
+    CacheMaxEntries() = maxEntries;
+}
+
+size_t GetCacheMaxEntries()
+{
+    return CacheMaxEntries();
+}
+
+void SetCacheMaxMemorySize(size_t maxMemorySize)
+{
+    CacheMaxMemorySize() = maxMemorySize;
+}
+
+size_t GetCacheMaxMemorySize()
+{
+    return CacheMaxMemorySize();
+}
 
 
 // TODO: Processors which the user hangs onto have local caches.
@@ -6,6 +6,10 @@
 #define INCLUDED_OCIO_CACHING_H
 
 
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <future>
 #include <map>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -21,13 +25,20 @@ namespace OCIO_NAMESPACE
 // instance type of the key. Note that having efficient key generation & comparison are critical.
 // For example integer comparison is efficent but string one could be far less efficient depending
 // of its length & where changes occur (e.g. absolute filepaths are inefficient). 
+//
+// The cache is bounded by the limits from SetCacheMaxEntries() and SetCacheMaxMemorySize() i.e.
+// the least recently used entries are evicted when a new entry exceeds one of them. The memory
+// size of an entry is provided by the size function of the cache (see setSizeFunction()).
+//
+// The cache is read-mostly: the cache hits of getOrCreate() only share the ownership of the
+// cache lock, and do not write anything when hitting again the most recently used entry.
 template<typename KeyType, typename EntryType>
 class GenericCache
 {
 public:
 
-    using Entries = std::map<KeyType, EntryType>;
-    using Iterator = typename Entries::iterator;
+    // Estimate of the memory used by a cache entry, in bytes.
+    using SizeFunction = std::function<size_t(const EntryType &)>;
 
     // Forbid copy & move semantics. 
     GenericCache(const GenericCache &)  = delete;
@@ -40,26 +51,48 @@ public:
     {
     }
 
+    explicit GenericCache(const SizeFunction & sizeFunc)
+        :   m_envDisableAllCaches(Platform::isEnvPresent(OCIO_DISABLE_ALL_CACHES))
+        ,   m_sizeFunc(sizeFunc)
+    {
+    }
+
     virtual ~GenericCache() = default;
 
     void clear() noexcept
     {
-        AutoMutex lock(m_mutex);
+        AutoExclusiveLock lock(m_mutex);
 
         m_entries.clear();
+        m_memorySize = 0;
+
+        // The entries being created are not published once the cache is cleared, but their
+        // pending callers still get them.
+        m_pending.clear();
+        ++m_generation;
     }
 
     inline void enable(bool enable) noexcept
     {
-        AutoMutex lock(m_mutex);
+        AutoExclusiveLock lock(m_mutex);
 
         m_enabled = enable;
     }
 
     inline bool isEnabled() const noexcept { return !m_envDisableAllCaches && m_enabled; }
 
-    // Get and lock the mutex before accessing to a cache entry.
-    Mutex & lock() noexcept { return m_mutex; }
+    // Get and lock the mutex before accessing to a cache entry i.e. AutoSharedLock to only read
+    // the cache and AutoExclusiveLock otherwise.
+    SharedMutex & lock() noexcept { return m_mutex; }
+
+    // Set the function estimating the memory size of the entries. Without it, only the number of
+    // entries is bounded.
+    void setSizeFunction(const SizeFunction & sizeFunc)
+    {
+        AutoExclusiveLock lock(m_mutex);
+
+        m_sizeFunc = sizeFunc;
+    }
 
     // Check existence of an entry the cache.
     // To only use when lock is on to protect the cache access.
@@ -68,29 +101,202 @@ public:
         return isEnabled() && m_entries.end() != m_entries.find(key);
     }
 
-    // Get a cache entry. It creates the cache entry if not existing.
-    // To only use when lock is on to protect the cache access.
-    EntryType & operator[](const KeyType & key) noexcept
+    // Get a cache entry. It creates the cache entry if not existing. Note that the memory size of
+    // an entry set using the returned reference is not accounted.
+    // To only use when the exclusive lock is on to protect the cache access.
+    EntryType & operator[](const KeyType & key)
     {
         static EntryType dummy;
-        return isEnabled() ? m_entries[key] : dummy;
+        if (!isEnabled())
+        {
+            return dummy;
+        }
+
+        Entry & entry = touch(key);
+        evict();
+        return entry.m_value;
     }
 
-    Iterator begin() noexcept { return m_entries.begin(); }
-    Iterator end()   noexcept { return m_entries.end();   }
+    // Number of entries and estimated memory size of the cache.
+    // To only use when lock is on to protect the cache access.
+    size_t getNumEntries() const noexcept { return m_entries.size(); }
+    size_t getMemorySize() const noexcept { return m_memorySize; }
+
+    // Get a cache entry, creating it with 'create' if not existing. The creation runs without
+    // holding the cache lock so the other keys stay accessible meanwhile, and only the first
+    // caller for a key creates the entry i.e. the concurrent callers for the same key wait for
+    // it. An exception thrown by the creation is propagated to all these callers and nothing is
+    // cached. Note that the lock must not be held by the caller, and that 'create' may lock it.
+    template<typename CreateFunc>
+    EntryType getOrCreate(const KeyType & key, CreateFunc create)
+    {
+        if (!isEnabled())
+        {
+            return create();
+        }
+
+        {
+            // The fast path of the cache hits.
+            AutoSharedLock lock(m_mutex);
+
+            auto entry = m_entries.find(key);
+            if (entry != m_entries.end() && entry->second.m_value)
+            {
+                markUsed(entry->second);
+                return entry->second.m_value;
+            }
+        }
+
+        std::promise<EntryType> promise;
+        std::shared_future<EntryType> pendingEntry;
+        unsigned long generation = 0;
+        SizeFunction sizeFunc;
+
+        {
+            AutoExclusiveLock lock(m_mutex);
+
+            // The entry could have been created meanwhile.
+            auto entry = m_entries.find(key);
+            if (entry != m_entries.end() && entry->second.m_value)
+            {
+                markUsed(entry->second);
+                return entry->second.m_value;
+            }
+
+            auto pending = m_pending.find(key);
+            if (pending != m_pending.end())
+            {
+                pendingEntry = pending->second;
+            }
+            else
+            {
+                m_pending[key] = promise.get_future().share();
+                generation = m_generation;
+                sizeFunc = m_sizeFunc;
+            }
+        }
+
+        if (pendingEntry.valid())
+        {
+            // Another caller is creating the entry.
+            return pendingEntry.get();
+        }
+
+        EntryType value;
+        try
+        {
+            value = create();
+        }
+        catch (...)
+        {
+            {
+                AutoExclusiveLock lock(m_mutex);
+                if (generation == m_generation)
+                {
+                    m_pending.erase(key);
+                }
+            }
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+
+        // Estimate the size before locking the cache.
+        const size_t size = sizeFunc && value ? sizeFunc(value) : 0;
+
+        {
+            AutoExclusiveLock lock(m_mutex);
+            if (generation == m_generation)
+            {
+                Entry & entry = touch(key);
+                entry.m_value = value;
+                m_memorySize -= entry.m_size;
+                m_memorySize += size;
+                entry.m_size  = size;
+                m_pending.erase(key);
+
+                evict();
+            }
+        }
+        promise.set_value(value);
+
+        return value;
+    }
 
 protected:
-    explicit GenericCache(bool disableCaches)
+    GenericCache(bool disableCaches, const SizeFunction & sizeFunc)
         :   m_envDisableAllCaches(Platform::isEnvPresent(OCIO_DISABLE_ALL_CACHES) || disableCaches)
+        ,   m_sizeFunc(sizeFunc)
     {
     }
 
     const bool m_envDisableAllCaches = false;
-    bool m_enabled = true;
+    std::atomic<bool> m_enabled{ true };
 
 private:
-    Mutex m_mutex;
-    Entries m_entries;
+    struct Entry
+    {
+        EntryType m_value;
+        size_t m_size = 0;
+        // Value of the use clock at the last use of the entry.
+        std::atomic<unsigned long> m_lastUse{ 0 };
+    };
+
+    // Make an entry the most recently used one. As it only needs the shared ownership of the
+    // lock, several threads could concurrently update the use clock and the entry.
+    void markUsed(Entry & entry) noexcept
+    {
+        if (entry.m_lastUse.load(std::memory_order_relaxed)
+                != m_useClock.load(std::memory_order_relaxed))
+        {
+            entry.m_lastUse.store(++m_useClock, std::memory_order_relaxed);
+        }
+    }
+
+    // Get an entry, creating it if needed, and make it the most recently used one.
+    Entry & touch(const KeyType & key)
+    {
+        Entry & entry = m_entries[key];
+        entry.m_lastUse.store(++m_useClock, std::memory_order_relaxed);
+        return entry;
+    }
+
+    // Evict the least recently used entries exceeding the cache limits. The most recently used
+    // entry is always kept.
+    void evict()
+    {
+        const size_t maxEntries    = GetCacheMaxEntries();
+        const size_t maxMemorySize = GetCacheMaxMemorySize();
+
+        while (m_entries.size() > 1
+               && ((maxEntries != 0 && m_entries.size() > maxEntries)
+                   || (maxMemorySize != 0 && m_memorySize > maxMemorySize)))
+        {
+            auto lru = m_entries.begin();
+            for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+            {
+                if (it->second.m_lastUse.load(std::memory_order_relaxed)
+                        < lru->second.m_lastUse.load(std::memory_order_relaxed))
+                {
+                    lru = it;
+                }
+            }
+
+            m_memorySize -= lru->second.m_size;
+            m_entries.erase(lru);
+        }
+    }
+
+    SharedMutex m_mutex;
+    std::map<KeyType, Entry> m_entries;
+    size_t m_memorySize = 0;
+    SizeFunction m_sizeFunc;
+
+    // The use clock, increasing each time an entry becomes the most recently used one.
+    std::atomic<unsigned long> m_useClock{ 0 };
+
+    // Entries being created, and the number of cache flushes.
+    std::map<KeyType, std::shared_future<EntryType>> m_pending;
+    unsigned long m_generation = 0;
 };
 
 // A Processor instance uses this class to cache its derived optimized, CPU, and GPU Processors.
@@ -100,8 +306,11 @@ template<typename KeyType, typename EntryType>
 class ProcessorCache : public GenericCache<KeyType, EntryType>
 {
 public:
+    using SizeFunction = typename GenericCache<KeyType, EntryType>::SizeFunction;
+
     ProcessorCache()
-        :   GenericCache<KeyType, EntryType>(Platform::isEnvPresent(OCIO_DISABLE_PROCESSOR_CACHES))
+        :   GenericCache<KeyType, EntryType>(Platform::isEnvPresent(OCIO_DISABLE_PROCESSOR_CACHES),
+                                             SizeFunction())
     {
     }
 
@@ -2,11 +2,13 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <set>
 #include <sstream>
 #include <fstream>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include <regex>
@@ -49,6 +51,9 @@ const char * OCIO_ACTIVE_DISPLAYS_ENVVAR      = "OCIO_ACTIVE_DISPLAYS";
 const char * OCIO_ACTIVE_VIEWS_ENVVAR         = "OCIO_ACTIVE_VIEWS";
 const char * OCIO_INACTIVE_COLORSPACES_ENVVAR = "OCIO_INACTIVE_COLORSPACES";
 const char * OCIO_OPTIMIZATION_FLAGS_ENVVAR   = "OCIO_OPTIMIZATION_FLAGS";
+const char * OCIO_BAKE_LUT_SIZE_ENVVAR        = "OCIO_BAKE_LUT_SIZE";
+const char * OCIO_BAKE_LUT_MAX_ERROR_ENVVAR   = "OCIO_BAKE_LUT_MAX_ERROR";
+const char * OCIO_INTEGER_LOOKUP_SIZE_ENVVAR  = "OCIO_INTEGER_LOOKUP_SIZE";
 const char * OCIO_USER_CATEGORIES_ENVVAR      = "OCIO_USER_CATEGORIES";
 
 // Default filename (with extension) of a config and archived config.
@@ -331,6 +336,11 @@ public:
 
     mutable ProcessorCacheFlags m_cacheFlags { PROCESSOR_CACHE_DEFAULT };
     mutable ProcessorCache<std::size_t, ProcessorRcPtr> m_processorCache;
+    // Index of the cached processors by processor cache ID (i.e. the cache fallback), protected
+    // by the processor cache lock. It does not keep the processors alive.
+    mutable std::unordered_map<std::string, std::weak_ptr<Processor>> m_processorCacheIDs;
+    // Size of the index triggering the removal of the released processors.
+    mutable size_t m_processorCacheIDsPurgeSize = 64;
 
     Impl() :
         m_majorVersion(LastSupportedMajorVersion),
@@ -367,6 +377,10 @@ public:
         m_inactiveColorSpaceNamesEnv = StringUtils::Trim(m_inactiveColorSpaceNamesEnv);
 
         m_processorCache.enable((m_cacheFlags & PROCESSOR_CACHE_ENABLED) == PROCESSOR_CACHE_ENABLED);
+        m_processorCache.setSizeFunction([](const ProcessorRcPtr & proc)
+        {
+            return proc->getImpl()->getMemorySize();
+        });
 
         // This is used to allow the YAML writer to not save any virtual displays that were
         // instantiated.
@@ -450,7 +464,7 @@ public:
             
             m_cacheFlags = rhs.m_cacheFlags;
 
-            m_processorCache.clear();
+            clearProcessorCache();
             m_processorCache.enable((m_cacheFlags & PROCESSOR_CACHE_ENABLED) == PROCESSOR_CACHE_ENABLED);
         }
         return *this;
@@ -932,6 +946,15 @@ public:
         m_processorCache.enable((m_cacheFlags & PROCESSOR_CACHE_ENABLED) == PROCESSOR_CACHE_ENABLED);
     }
 
+    void clearProcessorCache() const noexcept
+    {
+        {
+            AutoExclusiveLock guard(m_processorCache.lock());
+            m_processorCacheIDs.clear();
+        }
+        m_processorCache.clear();
+    }
+
     ConstProcessorRcPtr getProcessorWithoutCaching(
         const Config & config,
         const ConstTransformRcPtr & transform, 
@@ -4443,8 +4466,6 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
 
     if (getImpl()->m_processorCache.isEnabled())
     {
-        AutoMutex guard(getImpl()->m_processorCache.lock());
-
         // Note that the key includes a string description of the transform which does not include
         // all the LUT entries (just the arguments of the FileTransforms for LUTs).
         std::ostringstream oss;
@@ -4454,10 +4475,9 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
 
         const std::size_t key = std::hash<std::string>{}(oss.str());
 
-        // As the entry is a shared pointer instance, having an empty one means that the entry does
-        // not exist in the cache. So, it provides a fast existence check & access in one call.
-        ProcessorRcPtr & processor = getImpl()->m_processorCache[key];
-        if (!processor)
+        // The processor is created without locking the cache so the processors of other keys
+        // could be concurrently created or read, while the callers for the same key wait for it.
+        return getImpl()->m_processorCache.getOrCreate(key, [&]() -> ProcessorRcPtr
         {
             ProcessorRcPtr proc = CreateProcessor(*this, context, transform, direction);
 
@@ -4472,27 +4492,33 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
                 // The benefit to using the existing one is that it may already have an optimized
                 // Processor, CPUProcessor, or GPUProcessor inside it.
 
-                // TODO: With the original context part of the cache data, the code could first
-                // compare the two contexts before doing the lengthy Processor::getCacheID()
-                // computation.
+                // Compute the cache ID before locking the cache.
+                const std::string cacheID = proc->getCacheID();
 
-                for (auto & entry : getImpl()->m_processorCache)
+                AutoExclusiveLock guard(getImpl()->m_processorCache.lock());
+
+                std::weak_ptr<Processor> & entry = getImpl()->m_processorCacheIDs[cacheID];
+                if (ProcessorRcPtr existing = entry.lock())
                 {
-                    if (entry.second && 0 == strcmp(entry.second->getCacheID(), proc->getCacheID()))
+                    return existing;
+                }
+                entry = proc;
+
+                // The processors evicted from the cache could be released.
+                auto & cacheIDs = getImpl()->m_processorCacheIDs;
+                if (cacheIDs.size() >= getImpl()->m_processorCacheIDsPurgeSize)
+                {
+                    for (auto it = cacheIDs.begin(); it != cacheIDs.end();)
                     {
-                        processor = entry.second;
-                        break;
+                        it = it->second.expired() ? cacheIDs.erase(it) : std::next(it);
                     }
+                    getImpl()->m_processorCacheIDsPurgeSize
+                        = std::max<size_t>(64, 2 * cacheIDs.size());
                 }
             }
 
-            if (!processor)
-            {
-                processor = proc;
-            }
-        }
-
-        return processor;
+            return proc;
+        });
     }
     else
     {
@@ -4956,7 +4982,7 @@ void Config::setProcessorCacheFlags(ProcessorCacheFlags flags) const noexcept
 
 void Config::clearProcessorCache() noexcept
 {
-    getImpl()->m_processorCache.clear();
+    getImpl()->clearProcessorCache();
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -5084,7 +5110,7 @@ void Config::Impl::resetCacheIDs()
 
     // As any changes could impact the cache keys, it's better to always flush the cache
     // of processors to not keep in memory useless instances.
-    m_processorCache.clear();
+    clearProcessorCache();
 }
 
 void Config::Impl::getAllInternalTransforms(ConstTransformVec & transformVec) const
@@ -0,0 +1,554 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <pystring.h>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "DiskCache.h"
+#include "HashUtils.h"
+#include "Logging.h"
+#include "Mutex.h"
+#include "Platform.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// The version of the entry layout, to increase when the layout or a payload changes.
+static constexpr uint32_t DISK_CACHE_LAYOUT_VERSION = 2;
+
+static constexpr char DISK_CACHE_MAGIC[8] = { 'O', 'C', 'I', 'O', 'L', 'U', 'T', 'C' };
+
+static constexpr uint32_t DISK_CACHE_BYTE_ORDER = 0x01020304;
+
+// The alignment of the arrays in the payload.
+static constexpr size_t DISK_CACHE_ALIGNMENT = 16;
+
+struct EntryHeader
+{
+    char     magic[8];
+    uint32_t layoutVersion;
+    uint32_t byteOrder;
+    uint32_t libraryVersion;
+    uint32_t interpolation;
+    uint64_t fileSize;
+    uint64_t sourcePathSize;
+    uint64_t payloadSize;
+    char     fileHash[48];
+    char     checksum[48];
+    char     formatName[64];
+};
+
+static_assert(sizeof(EntryHeader) % DISK_CACHE_ALIGNMENT == 0,
+              "The payload arrays must stay aligned in the entry file.");
+
+// The source path follows the header, padded to keep the payload aligned.
+size_t GetPaddedSize(size_t size)
+{
+    return (size + DISK_CACHE_ALIGNMENT - 1) & ~(DISK_CACHE_ALIGNMENT - 1);
+}
+
+Mutex g_directoryMutex;
+
+// To only use when the lock is on. All the directories ever set are kept, so the pointers
+// returned by GetFileCacheDirectory() remain valid after the directory changes.
+std::set<std::string> & Directories()
+{
+    static std::set<std::string> directories;
+    return directories;
+}
+
+// To only use when the lock is on.
+const std::string * & Directory()
+{
+    static const std::string * directory = []()
+    {
+        std::string value;
+        Platform::Getenv(OCIO_FILE_CACHE_DIR, value);
+        return &*Directories().insert(value).first;
+    }();
+    return directory;
+}
+
+void CopyString(char * dst, size_t size, const std::string & src)
+{
+    memset(dst, 0, size);
+    strncpy(dst, src.c_str(), size - 1);
+}
+
+std::string ComputeChecksum(const char * payload, size_t size)
+{
+    return CacheIDHash(payload, size);
+}
+
+// Hash the content of a file. Return false when the file could not be read.
+bool ComputeFileHash(const std::string & filepath, std::string & hash, unsigned long long & size)
+{
+    std::ifstream stream;
+    Platform::OpenInputFileStream(stream, filepath.c_str(), std::ios_base::binary);
+    if (!stream.is_open())
+    {
+        return false;
+    }
+
+    std::ostringstream content;
+    content << stream.rdbuf();
+    if (stream.bad())
+    {
+        return false;
+    }
+
+    const std::string str = content.str();
+    hash = CacheIDHash(str.c_str(), str.size());
+    size = str.size();
+
+    return true;
+}
+
+} // anon.
+
+void SetFileCacheDirectory(const char * directory)
+{
+    AutoMutex lock(g_directoryMutex);
+    Directory() = &*Directories().insert(directory ? directory : "").first;
+}
+
+const char * GetFileCacheDirectory()
+{
+    AutoMutex lock(g_directoryMutex);
+    return Directory()->c_str();
+}
+
+void DiskCacheWriter::writeUInt(uint32_t value)
+{
+    m_payload.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+void DiskCacheWriter::writeFloat(float value)
+{
+    m_payload.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+void DiskCacheWriter::writeFloats(const float * values, size_t numValues)
+{
+    align();
+    m_payload.append(reinterpret_cast<const char *>(values), numValues * sizeof(float));
+}
+
+void DiskCacheWriter::writeLut1D(const ConstLut1DOpDataRcPtr & lut)
+{
+    writeUInt(lut ? 1 : 0);
+    if (!lut)
+    {
+        return;
+    }
+
+    writeUInt(lut->getHalfFlags());
+    writeUInt(lut->getHueAdjust());
+    writeUInt(lut->getInterpolation());
+    writeUInt(lut->getDirection());
+    writeUInt(lut->getFileOutputBitDepth());
+
+    const Array & array = lut->getArray();
+    writeUInt(array.getLength());
+    writeUInt(array.getNumColorComponents());
+    writeUInt((uint32_t)array.getValues().size());
+    writeFloats(array.getValues().data(), array.getValues().size());
+}
+
+void DiskCacheWriter::writeLut3D(const ConstLut3DOpDataRcPtr & lut)
+{
+    writeUInt(lut ? 1 : 0);
+    if (!lut)
+    {
+        return;
+    }
+
+    writeUInt(lut->getInterpolation());
+    writeUInt(lut->getDirection());
+    writeUInt(lut->getFileOutputBitDepth());
+
+    const Array & array = lut->getArray();
+    writeUInt(array.getLength());
+    writeUInt((uint32_t)array.getValues().size());
+    writeFloats(array.getValues().data(), array.getValues().size());
+}
+
+void DiskCacheWriter::align()
+{
+    m_payload.resize((m_payload.size() + DISK_CACHE_ALIGNMENT - 1) & ~(DISK_CACHE_ALIGNMENT - 1),
+                     '\0');
+}
+
+DiskCacheReader::DiskCacheReader(const char * payload, size_t size)
+    :   m_payload(payload)
+    ,   m_size(size)
+{
+}
+
+uint32_t DiskCacheReader::readUInt()
+{
+    uint32_t value = 0;
+    read(&value, sizeof(value));
+    return value;
+}
+
+float DiskCacheReader::readFloat()
+{
+    float value = 0.0f;
+    read(&value, sizeof(value));
+    return value;
+}
+
+void DiskCacheReader::readFloats(float * values, size_t numValues)
+{
+    align();
+    read(values, numValues * sizeof(float));
+}
+
+Lut1DOpDataRcPtr DiskCacheReader::readLut1D()
+{
+    if (!readUInt())
+    {
+        return Lut1DOpDataRcPtr();
+    }
+
+    const uint32_t halfFlags     = readUInt();
+    const uint32_t hueAdjust     = readUInt();
+    const uint32_t interpolation = readUInt();
+    const uint32_t direction     = readUInt();
+    const uint32_t bitDepth      = readUInt();
+
+    const uint32_t length        = readUInt();
+    const uint32_t numComponents = readUInt();
+    const uint32_t numValues     = readUInt();
+
+    Lut1DOpDataRcPtr lut
+        = std::make_shared<Lut1DOpData>(Lut1DOpData::HalfFlags(halfFlags), length, false);
+
+    lut->setHueAdjust(Lut1DHueAdjust(hueAdjust));
+    lut->setInterpolation(Interpolation(interpolation));
+    lut->setDirection(TransformDirection(direction));
+    lut->setFileOutputBitDepth(BitDepth(bitDepth));
+
+    Array & array = lut->getArray();
+    array.resize(length, numComponents);
+    if (numValues != array.getNumValues())
+    {
+        throw Exception("Invalid number of values for a 1D LUT.");
+    }
+    readFloats(array.getValues().data(), numValues);
+
+    lut->validate();
+
+    return lut;
+}
+
+Lut3DOpDataRcPtr DiskCacheReader::readLut3D()
+{
+    if (!readUInt())
+    {
+        return Lut3DOpDataRcPtr();
+    }
+
+    const uint32_t interpolation = readUInt();
+    const uint32_t direction     = readUInt();
+    const uint32_t bitDepth      = readUInt();
+
+    const uint32_t gridSize      = readUInt();
+    const uint32_t numValues     = readUInt();
+
+    Lut3DOpDataRcPtr lut = std::make_shared<Lut3DOpData>((unsigned long)gridSize);
+
+    lut->setInterpolation(Interpolation(interpolation));
+    lut->setDirection(TransformDirection(direction));
+    lut->setFileOutputBitDepth(BitDepth(bitDepth));
+
+    Array & array = lut->getArray();
+    if (numValues != array.getNumValues())
+    {
+        throw Exception("Invalid number of values for a 3D LUT.");
+    }
+    readFloats(array.getValues().data(), numValues);
+
+    lut->validate();
+
+    return lut;
+}
+
+void DiskCacheReader::read(void * value, size_t size)
+{
+    if (size > m_size - m_pos)
+    {
+        throw Exception("Unexpected end of the file cache entry.");
+    }
+
+    memcpy(value, m_payload + m_pos, size);
+    m_pos += size;
+}
+
+void DiskCacheReader::align()
+{
+    const size_t pos = (m_pos + DISK_CACHE_ALIGNMENT - 1) & ~(DISK_CACHE_ALIGNMENT - 1);
+    if (pos > m_size)
+    {
+        throw Exception("Unexpected end of the file cache entry.");
+    }
+    m_pos = pos;
+}
+
+bool GetDiskCacheEntry(DiskCacheEntry & entry,
+                       const std::string & filepath,
+                       Interpolation interp,
+                       const Config & config)
+{
+    // The LUT files of an archived config are not on the disk.
+    if (config.getConfigIOProxy())
+    {
+        return false;
+    }
+
+    std::string directory;
+    {
+        AutoMutex lock(g_directoryMutex);
+        directory = *Directory();
+    }
+    if (directory.empty())
+    {
+        return false;
+    }
+
+    // The entry is named from the source path (i.e. not from the device & inode which could
+    // collide between the hosts sharing the directory) and validated by the content hash of the
+    // LUT file (i.e. the modification time could miss an in-place rewrite). Note that hashing
+    // the file is still much faster than parsing it.
+    if (!pystring::os::path::isabs(filepath))
+    {
+        return false;
+    }
+    entry.sourcePath = pystring::os::path::normpath(filepath);
+
+    if (!ComputeFileHash(entry.sourcePath, entry.fileHash, entry.fileSize))
+    {
+        return false;
+    }
+
+    std::ostringstream key;
+    key << entry.sourcePath << ":" << interp << ":" << DISK_CACHE_LAYOUT_VERSION;
+
+    const std::string keyStr = key.str();
+    entry.path = pystring::os::path::join(directory,
+                                          CacheIDHash(keyStr.c_str(), keyStr.size()) + ".ocioc");
+    entry.interpolation = interp;
+
+    return true;
+}
+
+bool LoadDiskCachedFile(FileFormat * & format,
+                        CachedFileRcPtr & cachedFile,
+                        const DiskCacheEntry & entry)
+{
+    std::ifstream stream;
+    Platform::OpenInputFileStream(stream, entry.path.c_str(), std::ios_base::binary);
+    if (!stream.is_open())
+    {
+        return false;
+    }
+
+    try
+    {
+        EntryHeader header;
+        if (!stream.read(reinterpret_cast<char *>(&header), sizeof(header)))
+        {
+            throw Exception("Invalid header.");
+        }
+
+        header.formatName[sizeof(header.formatName) - 1] = '\0';
+        header.checksum[sizeof(header.checksum) - 1]     = '\0';
+        header.fileHash[sizeof(header.fileHash) - 1]     = '\0';
+
+        if (memcmp(header.magic, DISK_CACHE_MAGIC, sizeof(DISK_CACHE_MAGIC)) != 0
+            || header.layoutVersion  != DISK_CACHE_LAYOUT_VERSION
+            || header.byteOrder      != DISK_CACHE_BYTE_ORDER
+            || header.libraryVersion != (uint32_t)OCIO_VERSION_HEX
+            || header.interpolation  != (uint32_t)entry.interpolation
+            || header.fileSize       != (uint64_t)entry.fileSize
+            || header.sourcePathSize != (uint64_t)entry.sourcePath.size()
+            || entry.fileHash        != header.fileHash)
+        {
+            throw Exception("Stale entry.");
+        }
+
+        std::vector<char> sourcePath(GetPaddedSize(entry.sourcePath.size()));
+        if (!stream.read(sourcePath.data(), sourcePath.size())
+            || entry.sourcePath.compare(0, std::string::npos,
+                                        sourcePath.data(), entry.sourcePath.size()) != 0)
+        {
+            throw Exception("Entry of another file.");
+        }
+
+        FileFormat * entryFormat
+            = FormatRegistry::GetInstance().getFileFormatByName(header.formatName);
+        if (!entryFormat)
+        {
+            throw Exception("Unknown file format.");
+        }
+
+        // The entry file size bounds the payload size.
+        const std::streamoff payloadPos = stream.tellg();
+        stream.seekg(0, std::ios_base::end);
+        const std::streamoff entrySize = stream.tellg();
+        if (payloadPos < 0 || entrySize - payloadPos != (std::streamoff)header.payloadSize)
+        {
+            throw Exception("Invalid payload size.");
+        }
+        stream.seekg(payloadPos);
+
+        std::vector<char> payload((size_t)header.payloadSize);
+        if (!stream.read(payload.data(), payload.size())
+            || ComputeChecksum(payload.data(), payload.size()) != header.checksum)
+        {
+            throw Exception("Invalid payload.");
+        }
+
+        DiskCacheReader reader(payload.data(), payload.size());
+        CachedFileRcPtr entryFile = entryFormat->readCachedFile(reader);
+        if (!entryFile || !reader.atEnd())
+        {
+            throw Exception("Invalid payload content.");
+        }
+
+        if (IsDebugLoggingEnabled())
+        {
+            std::ostringstream os;
+            os << "    Loaded the file cache entry " << entry.path
+               << " of format " << entryFormat->getName();
+            LogDebug(os.str());
+        }
+
+        format     = entryFormat;
+        cachedFile = entryFile;
+
+        return true;
+    }
+    catch (std::exception & e)
+    {
+        if (IsDebugLoggingEnabled())
+        {
+            std::ostringstream os;
+            os << "    Ignored the file cache entry " << entry.path << ": " << e.what();
+            LogDebug(os.str());
+        }
+    }
+
+    return false;
+}
+
+void SaveDiskCachedFile(const DiskCacheEntry & entry,
+                        const FileFormat * format,
+                        const CachedFileRcPtr & cachedFile)
+{
+    if (!format || !cachedFile)
+    {
+        return;
+    }
+
+    try
+    {
+        // The content must not be saved with the hash of a file changed while being parsed.
+        std::string fileHash;
+        unsigned long long fileSize = 0;
+        if (!ComputeFileHash(entry.sourcePath, fileHash, fileSize) || fileHash != entry.fileHash)
+        {
+            return;
+        }
+
+        DiskCacheWriter writer;
+        if (!format->writeCachedFile(writer, cachedFile))
+        {
+            return;
+        }
+
+        const std::string & payload = writer.getPayload();
+
+        EntryHeader header;
+        memcpy(header.magic, DISK_CACHE_MAGIC, sizeof(DISK_CACHE_MAGIC));
+        header.layoutVersion  = DISK_CACHE_LAYOUT_VERSION;
+        header.byteOrder      = DISK_CACHE_BYTE_ORDER;
+        header.libraryVersion = (uint32_t)OCIO_VERSION_HEX;
+        header.interpolation  = (uint32_t)entry.interpolation;
+        header.fileSize       = (uint64_t)entry.fileSize;
+        header.sourcePathSize = (uint64_t)entry.sourcePath.size();
+        header.payloadSize    = (uint64_t)payload.size();
+        CopyString(header.fileHash, sizeof(header.fileHash), entry.fileHash);
+        CopyString(header.checksum, sizeof(header.checksum),
+                   ComputeChecksum(payload.data(), payload.size()));
+        CopyString(header.formatName, sizeof(header.formatName), format->getName());
+
+        // Write a temporary file then rename it, so the concurrent processes never read a
+        // partially written entry.
+        std::ostringstream tmpPath;
+        tmpPath << entry.path << "." << Platform::GetProcessId() << "."
+                << std::hash<std::thread::id>{}(std::this_thread::get_id()) << "."
+                << std::chrono::steady_clock::now().time_since_epoch().count() << ".tmp";
+
+        {
+            std::ofstream stream;
+            Platform::OpenOutputFileStream(stream, tmpPath.str().c_str(),
+                                           std::ios_base::binary | std::ios_base::trunc);
+            if (!stream.is_open())
+            {
+                throw Exception("Could not create the entry file.");
+            }
+
+            std::string sourcePath = entry.sourcePath;
+            sourcePath.resize(GetPaddedSize(sourcePath.size()), '\0');
+
+            stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            stream.write(sourcePath.data(), sourcePath.size());
+            stream.write(payload.data(), payload.size());
+            stream.close();
+
+            if (stream.fail())
+            {
+                Platform::RemoveFile(tmpPath.str());
+                throw Exception("Could not write the entry file.");
+            }
+        }
+
+        if (!Platform::RenameFile(tmpPath.str(), entry.path))
+        {
+            Platform::RemoveFile(tmpPath.str());
+            throw Exception("Could not rename the entry file.");
+        }
+
+        if (IsDebugLoggingEnabled())
+        {
+            std::ostringstream os;
+            os << "    Saved the file cache entry " << entry.path;
+            LogDebug(os.str());
+        }
+    }
+    catch (std::exception & e)
+    {
+        std::ostringstream os;
+        os << "Could not save the file cache entry '" << entry.path << "': " << e.what();
+        LogWarning(os.str());
+    }
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_DISKCACHE_H
+#define INCLUDED_OCIO_DISKCACHE_H
+
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
+#include "transforms/FileTransform.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// The persistent file cache stores the parsed content of the LUT files in a directory (see
+// SetFileCacheDirectory()) so other processes load it instead of parsing the LUT files again.
+//
+// An entry file is named from the absolute path of the LUT file, the interpolation and the entry
+// layout version. It holds:
+//  - A header with the layout version, the library version and the byte order, the size and the
+//    content hash of the LUT file, the file format name and a checksum of the payload.
+//  - The path of the LUT file, padded to 16 bytes.
+//  - The payload written by the file format (see FileFormat::writeCachedFile()) i.e. a sequence
+//    of 32-bit words where the arrays (e.g. the LUT values) start on 16-byte boundaries i.e. the
+//    entry file could be memory-mapped.
+// An entry not matching the LUT file (i.e. its path and content) or the library is stale and the
+// LUT file is parsed again.
+
+// Write the payload of an entry.
+class DiskCacheWriter
+{
+public:
+    DiskCacheWriter() = default;
+    DiskCacheWriter(const DiskCacheWriter &) = delete;
+    DiskCacheWriter & operator=(const DiskCacheWriter &) = delete;
+
+    void writeUInt(uint32_t value);
+    void writeFloat(float value);
+    void writeFloats(const float * values, size_t numValues);
+
+    // Write a LUT with its values, or a null one.
+    void writeLut1D(const ConstLut1DOpDataRcPtr & lut);
+    void writeLut3D(const ConstLut3DOpDataRcPtr & lut);
+
+    const std::string & getPayload() const noexcept { return m_payload; }
+
+private:
+    void align();
+
+    std::string m_payload;
+};
+
+// Read the payload of an entry. An exception is thrown when the payload is invalid.
+class DiskCacheReader
+{
+public:
+    // Note that the payload must outlive the reader.
+    DiskCacheReader(const char * payload, size_t size);
+    DiskCacheReader(const DiskCacheReader &) = delete;
+    DiskCacheReader & operator=(const DiskCacheReader &) = delete;
+
+    uint32_t readUInt();
+    float readFloat();
+    void readFloats(float * values, size_t numValues);
+
+    Lut1DOpDataRcPtr readLut1D();
+    Lut3DOpDataRcPtr readLut3D();
+
+    // True when the complete payload was read.
+    bool atEnd() const noexcept { return m_pos == m_size; }
+
+private:
+    void read(void * value, size_t size);
+    void align();
+
+    const char * m_payload;
+    const size_t m_size;
+    size_t m_pos = 0;
+};
+
+// The entry of a LUT file in the persistent file cache.
+struct DiskCacheEntry
+{
+    std::string path;       // The entry file.
+    std::string sourcePath; // The normalized absolute path of the LUT file.
+    Interpolation interpolation = INTERP_DEFAULT;
+    unsigned long long fileSize = 0;
+    std::string fileHash;   // The hash of the LUT file content.
+};
+
+// Get the entry of a LUT file. Return false when the persistent file cache is disabled or does
+// not apply to the file (e.g. the file is in a config archive or its path is relative).
+bool GetDiskCacheEntry(DiskCacheEntry & entry,
+                       const std::string & filepath,
+                       Interpolation interp,
+                       const Config & config);
+
+// Load the content of a LUT file from its entry. Return false when the entry does not exist or
+// is stale.
+bool LoadDiskCachedFile(FileFormat * & format,
+                        CachedFileRcPtr & cachedFile,
+                        const DiskCacheEntry & entry);
+
+// Save the content of a LUT file to its entry, if supported by the file format. A failure is only
+// logged.
+void SaveDiskCachedFile(const DiskCacheEntry & entry,
+                        const FileFormat * format,
+                        const CachedFileRcPtr & cachedFile);
+
+} // namespace OCIO_NAMESPACE
+
+#endif
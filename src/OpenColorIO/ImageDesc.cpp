@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <cstdlib>
 #include <math.h>
 #include <sstream>
@@ -8,7 +9,9 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "ImagePacking.h"
+#include "ImagePacking_AVX2.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -72,6 +75,153 @@ ImageDesc::~ImageDesc()
 ///////////////////////////////////////////////////////////////////////////
 
 
+namespace
+{
+
+// Build the byte shuffle between the interleaved pixels, whose R, G, B & A channels are at the
+// chanIndex positions (-1 for a missing channel), and the RGBA pixels.
+void BuildChannelShuffle(const int (&chanIndex)[4], int numChannels, int chanBytes, bool toRGBA,
+                         ChannelShuffle & shuffle)
+{
+    const int blockPixels  = 16 / (4 * chanBytes);
+    const int interleavedBytes = blockPixels * numChannels * chanBytes;
+
+    shuffle.m_blockPixels   = blockPixels;
+    shuffle.m_srcBlockBytes = toRGBA ? interleavedBytes : 16;
+    shuffle.m_dstBlockBytes = toRGBA ? 16 : interleavedBytes;
+
+    for (int idx = 0; idx < 16; ++idx)
+    {
+        shuffle.m_mask[idx] = 0x80;
+    }
+
+    for (int pxl = 0; pxl < blockPixels; ++pxl)
+    {
+        for (int chan = 0; chan < 4; ++chan)
+        {
+            if (chanIndex[chan] < 0)
+            {
+                continue;
+            }
+
+            for (int byte = 0; byte < chanBytes; ++byte)
+            {
+                const int rgbaByte        = (pxl * 4 + chan) * chanBytes + byte;
+                const int interleavedByte = (pxl * numChannels + chanIndex[chan]) * chanBytes + byte;
+
+                if (toRGBA)
+                {
+                    shuffle.m_mask[rgbaByte] = uint8_t(interleavedByte);
+                }
+                else
+                {
+                    shuffle.m_mask[interleavedByte] = uint8_t(rgbaByte);
+                }
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
+void GenericImageDesc::initChannelShuffles(BitDepth bitDepth)
+{
+    m_pixelOffsetBytes = 0;
+    m_packShuffle      = ChannelShuffle();
+    m_unpackShuffle    = ChannelShuffle();
+
+    ChannelShuffle::ShuffleFunc * func = nullptr;
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        func = AVX2ShuffleChannels;
+    }
+#endif
+
+    const ptrdiff_t chanBytes = GetChannelSizeInBytes(bitDepth);
+    const int numChannels = m_aData ? 4 : 3;
+
+    // Note that the channels packed in 32-bit words are not byte-aligned.
+    if (!func || m_xStrideBytes != numChannels * chanBytes || hasPackedWords())
+    {
+        return;
+    }
+
+    // The channels must be interleaved i.e. each one at a distinct position in the pixel.
+    const char * chanData[4] = { m_rData, m_gData, m_bData, m_aData };
+    const char * pixelData = std::min({ m_rData, m_gData, m_bData });
+    if (m_aData)
+    {
+        pixelData = std::min<const char *>(pixelData, m_aData);
+    }
+
+    int chanIndex[4] = { -1, -1, -1, -1 };
+    int foundChannels = 0;
+    for (int chan = 0; chan < numChannels; ++chan)
+    {
+        const ptrdiff_t offset = chanData[chan] - pixelData;
+        if (offset >= m_xStrideBytes || offset % chanBytes != 0)
+        {
+            return;
+        }
+
+        chanIndex[chan] = int(offset / chanBytes);
+        foundChannels |= 1 << chanIndex[chan];
+    }
+
+    if (foundChannels != (1 << numChannels) - 1)
+    {
+        return;
+    }
+
+    m_pixelOffsetBytes = pixelData - m_rData;
+
+    BuildChannelShuffle(chanIndex, numChannels, int(chanBytes), true,  m_packShuffle);
+    BuildChannelShuffle(chanIndex, numChannels, int(chanBytes), false, m_unpackShuffle);
+
+    m_packShuffle.m_func   = func;
+    m_unpackShuffle.m_func = func;
+}
+
+void GenericImageDesc::initPackedWords()
+{
+    m_packedWords = PackedWords();
+
+    switch (m_packedFormat)
+    {
+        case PACKED_FORMAT_RGB10_A2:
+        {
+            m_packedWords.m_shifts[0]  = 0;
+            m_packedWords.m_shifts[1]  = 10;
+            m_packedWords.m_shifts[2]  = 20;
+            m_packedWords.m_alphaShift = 30;
+            break;
+        }
+        case PACKED_FORMAT_DPX_RGB10:
+        {
+            m_packedWords.m_shifts[0]  = 22;
+            m_packedWords.m_shifts[1]  = 12;
+            m_packedWords.m_shifts[2]  = 2;
+            break;
+        }
+        case PACKED_FORMAT_DPX_RGB12:
+        case PACKED_FORMAT_NONE:
+        default:
+        {
+            return;
+        }
+    }
+
+#if OCIO_USE_AVX2
+    // The vectorized implementations expect contiguous words.
+    if (CPUInfo::instance().hasAVX2() && m_xStrideBytes == sizeof(uint32_t))
+    {
+        m_packedWords.m_unpackFunc = AVX2UnpackWords;
+        m_packedWords.m_packFunc   = AVX2PackWords;
+    }
+#endif
+}
+
 void GenericImageDesc::init(const ImageDesc & img, BitDepth bitDepth, const ConstOpCPURcPtr & bitDepthOp)
 {
     m_bitDepthOp = bitDepthOp;
@@ -94,6 +244,17 @@ void GenericImageDesc::init(const ImageDesc & img, BitDepth bitDepth, const Cons
     {
         throw Exception("Bit-depth mismatch between the image buffer and the finalization setting.");
     }
+
+    const PackedImageDesc * packedImg = dynamic_cast<const PackedImageDesc *>(&img);
+    m_packedFormat = packedImg ? packedImg->getPackedFormat() : PACKED_FORMAT_NONE;
+
+    initPackedWords();
+    initChannelShuffles(bitDepth);
+}
+
+bool GenericImageDesc::hasPackedWords() const
+{
+    return m_packedFormat == PACKED_FORMAT_RGB10_A2 || m_packedFormat == PACKED_FORMAT_DPX_RGB10;
 }
 
 bool GenericImageDesc::isPackedFloatRGBA() const
@@ -125,6 +286,7 @@ struct PackedImageDesc::Impl
     void * m_aData = nullptr;
 
     ChannelOrdering m_chanOrder = CHANNEL_ORDERING_RGBA;
+    PackedFormat m_packedFormat = PACKED_FORMAT_NONE;
 
     BitDepth m_bitDepth = BIT_DEPTH_UNKNOWN;
 
@@ -187,7 +349,7 @@ struct PackedImageDesc::Impl
 
     bool isRGBAPacked() const
     {
-        if(m_aData==nullptr) return false;
+        if(m_aData==nullptr || m_packedFormat!=PACKED_FORMAT_NONE) return false;
 
         switch(m_bitDepth)
         {
@@ -290,20 +452,32 @@ struct PackedImageDesc::Impl
             throw Exception("PackedImageDesc Error: Invalid image dimensions.");
         }
 
-        if (std::abs(m_chanStrideBytes) < GetChannelSizeInBytes(m_bitDepth)
-            || m_chanStrideBytes == AutoStride)
+        if (m_packedFormat != PACKED_FORMAT_NONE)
         {
-            throw Exception("PackedImageDesc Error: Invalid channel stride.");
+            if (std::abs(m_xStrideBytes) < GetPackedPixelSizeInBytes(m_packedFormat))
+            {
+                throw Exception("PackedImageDesc Error: The packed format and x stride are "
+                                "inconsistent.");
+            }
         }
-
-        if (m_numChannels < 3 || m_numChannels > 4)
+        else
         {
-            throw Exception("PackedImageDesc Error: Invalid channel number.");
-        }
+            if (std::abs(m_chanStrideBytes) < GetChannelSizeInBytes(m_bitDepth)
+                || m_chanStrideBytes == AutoStride)
+            {
+                throw Exception("PackedImageDesc Error: Invalid channel stride.");
+            }
 
-        if (std::abs(m_chanStrideBytes * m_numChannels) > std::abs(m_xStrideBytes))
-        {
-            throw Exception("PackedImageDesc Error: The channel and x strides are inconsistent.");
+            if (m_numChannels < 3 || m_numChannels > 4)
+            {
+                throw Exception("PackedImageDesc Error: Invalid channel number.");
+            }
+
+            if (std::abs(m_chanStrideBytes * m_numChannels) > std::abs(m_xStrideBytes))
+            {
+                throw Exception("PackedImageDesc Error: The channel and x strides are "
+                                "inconsistent.");
+            }
         }
 
         if (m_xStrideBytes == AutoStride)
@@ -505,6 +679,72 @@ PackedImageDesc::PackedImageDesc(void * data,
     getImpl()->validate();
 }
 
+PackedImageDesc::PackedImageDesc(void * data,
+                                 long width, long height,
+                                 PackedFormat packedFormat)
+    :   PackedImageDesc(data, width, height, packedFormat, AutoStride, AutoStride)
+{
+}
+
+PackedImageDesc::PackedImageDesc(void * data,
+                                 long width, long height,
+                                 PackedFormat packedFormat,
+                                 ptrdiff_t xStrideBytes,
+                                 ptrdiff_t yStrideBytes)
+    :   ImageDesc()
+    ,   m_impl(new PackedImageDesc::Impl)
+{
+    getImpl()->m_data         = data;
+    getImpl()->m_width        = width;
+    getImpl()->m_height       = height;
+    getImpl()->m_packedFormat = packedFormat;
+
+    switch (packedFormat)
+    {
+        case PACKED_FORMAT_RGB10_A2:
+        {
+            getImpl()->m_chanOrder   = CHANNEL_ORDERING_RGBA;
+            getImpl()->m_numChannels = 4;
+            getImpl()->m_bitDepth    = BIT_DEPTH_UINT10;
+            break;
+        }
+        case PACKED_FORMAT_DPX_RGB10:
+        {
+            getImpl()->m_chanOrder   = CHANNEL_ORDERING_RGB;
+            getImpl()->m_numChannels = 3;
+            getImpl()->m_bitDepth    = BIT_DEPTH_UINT10;
+            break;
+        }
+        case PACKED_FORMAT_DPX_RGB12:
+        {
+            getImpl()->m_chanOrder   = CHANNEL_ORDERING_RGB;
+            getImpl()->m_numChannels = 3;
+            getImpl()->m_bitDepth    = BIT_DEPTH_UINT12;
+            break;
+        }
+        case PACKED_FORMAT_NONE:
+        default:
+        {
+            throw Exception("PackedImageDesc Error: Invalid packed format.");
+        }
+    }
+
+    // Only the channels in 16-bit words are byte-aligned.
+    getImpl()->m_chanStrideBytes = (packedFormat == PACKED_FORMAT_DPX_RGB12)
+        ? GetChannelSizeInBytes(getImpl()->m_bitDepth) : 0;
+    getImpl()->m_xStrideBytes = (xStrideBytes == AutoStride)
+        ? GetPackedPixelSizeInBytes(packedFormat) : xStrideBytes;
+    getImpl()->m_yStrideBytes = (yStrideBytes == AutoStride)
+        ? getImpl()->m_xStrideBytes * width : yStrideBytes;
+
+    getImpl()->initValues();
+
+    getImpl()->m_isRGBAPacked = getImpl()->isRGBAPacked();
+    getImpl()->m_isFloat      = getImpl()->isFloat();
+
+    getImpl()->validate();
+}
+
 PackedImageDesc::~PackedImageDesc()
 {
     delete m_impl;
@@ -516,6 +756,11 @@ ChannelOrdering PackedImageDesc::getChannelOrder() const
     return getImpl()->m_chanOrder;
 }
 
+PackedFormat PackedImageDesc::getPackedFormat() const
+{
+    return getImpl()->m_packedFormat;
+}
+
 BitDepth PackedImageDesc::getBitDepth() const
 {
     return getImpl()->m_bitDepth;
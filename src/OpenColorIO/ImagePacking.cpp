@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
@@ -17,6 +18,164 @@
 namespace OCIO_NAMESPACE
 {
 
+namespace
+{
+
+// Reorder the first pixels of the interleaved channels using the vectorized shuffle, if any,
+// and return the number of pixels processed. The remaining pixels are left to the generic copy.
+inline int ShuffleChannels(const ChannelShuffle & shuffle,
+                           const char * src, char * dst, int numPixels)
+{
+    return shuffle.m_func ? int(shuffle.m_func(shuffle, src, dst, numPixels)) : 0;
+}
+
+// The 2-bit alpha codes are scaled to the 10-bit codes, and the 10-bit codes are rounded to the
+// nearest 2-bit codes (i.e. using the mid-points between the scaled 2-bit codes).
+constexpr uint16_t ALPHA_2BIT_SCALE = 341;
+constexpr uint16_t ALPHA_2BIT_MIDPOINTS[3] = { 171, 512, 853 };
+
+void ReadPackedWords(const PackedWords & words, const char * src, ptrdiff_t xStrideBytes,
+                     uint16_t * dst, int numPixels)
+{
+    int idx = words.m_unpackFunc
+        ? int(words.m_unpackFunc(words, reinterpret_cast<const uint32_t *>(src), dst, numPixels))
+        : 0;
+
+    for (; idx < numPixels; ++idx)
+    {
+        const uint32_t word = *reinterpret_cast<const uint32_t *>(src + xStrideBytes * idx);
+
+        dst[4 * idx + 0] = uint16_t((word >> words.m_shifts[0]) & 0x3FF);
+        dst[4 * idx + 1] = uint16_t((word >> words.m_shifts[1]) & 0x3FF);
+        dst[4 * idx + 2] = uint16_t((word >> words.m_shifts[2]) & 0x3FF);
+        dst[4 * idx + 3] = words.m_alphaShift < 0
+            ? 0 : uint16_t(((word >> words.m_alphaShift) & 0x3) * ALPHA_2BIT_SCALE);
+    }
+}
+
+void WritePackedWords(const PackedWords & words, const uint16_t * src,
+                      char * dst, ptrdiff_t xStrideBytes, int numPixels)
+{
+    int idx = words.m_packFunc
+        ? int(words.m_packFunc(words, src, reinterpret_cast<uint32_t *>(dst), numPixels))
+        : 0;
+
+    for (; idx < numPixels; ++idx)
+    {
+        const uint16_t * pixel = &src[4 * idx];
+
+        uint32_t word = uint32_t(std::min<uint16_t>(pixel[0], 0x3FF)) << words.m_shifts[0]
+                      | uint32_t(std::min<uint16_t>(pixel[1], 0x3FF)) << words.m_shifts[1]
+                      | uint32_t(std::min<uint16_t>(pixel[2], 0x3FF)) << words.m_shifts[2];
+
+        if (words.m_alphaShift >= 0)
+        {
+            const uint32_t alpha = uint32_t(pixel[3] >= ALPHA_2BIT_MIDPOINTS[0])
+                                 + uint32_t(pixel[3] >= ALPHA_2BIT_MIDPOINTS[1])
+                                 + uint32_t(pixel[3] >= ALPHA_2BIT_MIDPOINTS[2]);
+            word |= alpha << words.m_alphaShift;
+        }
+
+        *reinterpret_cast<uint32_t *>(dst + xStrideBytes * idx) = word;
+    }
+}
+
+// Only the 10 and 12-bit integer bit-depths (i.e. uint16_t buffers) have packed formats.
+template<typename Type>
+bool ReadPackedFormat(const GenericImageDesc &, const char *, Type *, int)
+{
+    return false;
+}
+
+template<typename Type>
+bool WritePackedFormat(GenericImageDesc &, Type *, char *, int)
+{
+    return false;
+}
+
+// Read the pixels of a packed format to RGBA codes, and return false if there is no packed format.
+bool ReadPackedFormat(const GenericImageDesc & img, const char * src, uint16_t * dst,
+                      int numPixels)
+{
+    switch (img.m_packedFormat)
+    {
+        case PACKED_FORMAT_RGB10_A2:
+        case PACKED_FORMAT_DPX_RGB10:
+        {
+            ReadPackedWords(img.m_packedWords, src, img.m_xStrideBytes, dst, numPixels);
+            return true;
+        }
+        case PACKED_FORMAT_DPX_RGB12:
+        {
+            int idx = ShuffleChannels(img.m_packShuffle, src, reinterpret_cast<char *>(dst),
+                                      numPixels);
+            for (; idx < numPixels; ++idx)
+            {
+                const uint16_t * pixel
+                    = reinterpret_cast<const uint16_t *>(src + img.m_xStrideBytes * idx);
+
+                dst[4 * idx + 0] = pixel[0];
+                dst[4 * idx + 1] = pixel[1];
+                dst[4 * idx + 2] = pixel[2];
+                dst[4 * idx + 3] = 0;
+            }
+
+            // The 12-bit codes are in the high bits of the 16-bit words.
+            for (idx = 0; idx < 4 * numPixels; ++idx)
+            {
+                dst[idx] = uint16_t(dst[idx] >> 4);
+            }
+            return true;
+        }
+        case PACKED_FORMAT_NONE:
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+// Write the RGBA codes to the pixels of a packed format, and return false if there is no packed
+// format. Note that the RGBA codes could be modified.
+bool WritePackedFormat(GenericImageDesc & img, uint16_t * src, char * dst, int numPixels)
+{
+    switch (img.m_packedFormat)
+    {
+        case PACKED_FORMAT_RGB10_A2:
+        case PACKED_FORMAT_DPX_RGB10:
+        {
+            WritePackedWords(img.m_packedWords, src, dst, img.m_xStrideBytes, numPixels);
+            return true;
+        }
+        case PACKED_FORMAT_DPX_RGB12:
+        {
+            for (int idx = 0; idx < 4 * numPixels; ++idx)
+            {
+                src[idx] = uint16_t(std::min<uint16_t>(src[idx], 0xFFF) << 4);
+            }
+
+            int idx = ShuffleChannels(img.m_unpackShuffle, reinterpret_cast<const char *>(src),
+                                      dst, numPixels);
+            for (; idx < numPixels; ++idx)
+            {
+                uint16_t * pixel = reinterpret_cast<uint16_t *>(dst + img.m_xStrideBytes * idx);
+
+                pixel[0] = src[4 * idx + 0];
+                pixel[1] = src[4 * idx + 1];
+                pixel[2] = src[4 * idx + 2];
+            }
+            return true;
+        }
+        case PACKED_FORMAT_NONE:
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+} // anonymous namespace
+
 
 template<typename Type>
 void Generic<Type>::PackRGBAFromImageDesc(const GenericImageDesc & srcImg,
@@ -45,6 +204,21 @@ void Generic<Type>::PackRGBAFromImageDesc(const GenericImageDesc & srcImg,
     const long yIndex = imagePixelStartIndex / imgWidth;
     long xIndex = imagePixelStartIndex % imgWidth;
 
+    if (ReadPackedFormat(srcImg, srcImg.m_rData + yStrideBytes * yIndex + xStrideBytes * xIndex,
+                         inBitDepthBuffer, outputBufferSize))
+    {
+        srcImg.m_bitDepthOp->apply(&inBitDepthBuffer[0], outputBuffer, outputBufferSize);
+        return;
+    }
+
+    int pixelsCopied
+        = ShuffleChannels(srcImg.m_packShuffle,
+                          srcImg.m_rData + srcImg.m_pixelOffsetBytes
+                            + yStrideBytes * yIndex + xStrideBytes * xIndex,
+                          reinterpret_cast<char *>(inBitDepthBuffer),
+                          outputBufferSize);
+    xIndex += pixelsCopied;
+
     // Figure out our initial ptr positions
     char * rRow = srcImg.m_rData + yStrideBytes * yIndex;
     char * gRow = srcImg.m_gData + yStrideBytes * yIndex;
@@ -62,8 +236,7 @@ void Generic<Type>::PackRGBAFromImageDesc(const GenericImageDesc & srcImg,
         aPtr = reinterpret_cast<Type*>(aRow + xStrideBytes*xIndex);
     }
 
-    // Process one single, complete scanline.
-    int pixelsCopied = 0;
+    // Process the rest of the scanline.
     while(pixelsCopied < outputBufferSize)
     {
         // Reorder channels from arbitrary channel ordering to RGBA 32-bit float.
@@ -115,6 +288,14 @@ void Generic<float>::PackRGBAFromImageDesc(const GenericImageDesc & srcImg,
     const long yIndex = imagePixelStartIndex / imgWidth;
     long xIndex = imagePixelStartIndex % imgWidth;
 
+    int pixelsCopied
+        = ShuffleChannels(srcImg.m_packShuffle,
+                          srcImg.m_rData + srcImg.m_pixelOffsetBytes
+                            + yStrideBytes * yIndex + xStrideBytes * xIndex,
+                          reinterpret_cast<char *>(outputBuffer),
+                          outputBufferSize);
+    xIndex += pixelsCopied;
+
     // Figure out our initial ptr positions
     char * rRow = srcImg.m_rData + yStrideBytes * yIndex;
     char * gRow = srcImg.m_gData + yStrideBytes * yIndex;
@@ -132,8 +313,7 @@ void Generic<float>::PackRGBAFromImageDesc(const GenericImageDesc & srcImg,
         aPtr = reinterpret_cast<float*>(aRow + xStrideBytes*xIndex);
     }
 
-    // Process one single, complete scanline.
-    int pixelsCopied = 0;
+    // Process the rest of the scanline.
     while(pixelsCopied < outputBufferSize)
     {
         // Reorder channels from arbitrary channel ordering to RGBA 32-bit float.
@@ -185,6 +365,24 @@ void Generic<Type>::UnpackRGBAToImageDesc(GenericImageDesc & dstImg,
     const long yIndex = imagePixelStartIndex / imgWidth;
     long xIndex = imagePixelStartIndex % imgWidth;
 
+    // Convert from F32 to the output bit-depth (i.e always RGBA).
+    dstImg.m_bitDepthOp->apply(&inputBuffer[0], &outBitDepthBuffer[0], numPixelsToUnpack);
+
+    if (WritePackedFormat(dstImg, outBitDepthBuffer,
+                          dstImg.m_rData + yStrideBytes * yIndex + xStrideBytes * xIndex,
+                          numPixelsToUnpack))
+    {
+        return;
+    }
+
+    int pixelsCopied
+        = ShuffleChannels(dstImg.m_unpackShuffle,
+                          reinterpret_cast<const char *>(outBitDepthBuffer),
+                          dstImg.m_rData + dstImg.m_pixelOffsetBytes
+                            + yStrideBytes * yIndex + xStrideBytes * xIndex,
+                          numPixelsToUnpack);
+    xIndex += pixelsCopied;
+
     // Figure out our initial ptr positions
     char * rRow = dstImg.m_rData + yStrideBytes * yIndex;
     char * gRow = dstImg.m_gData + yStrideBytes * yIndex;
@@ -202,11 +400,7 @@ void Generic<Type>::UnpackRGBAToImageDesc(GenericImageDesc & dstImg,
         aPtr = reinterpret_cast<Type*>(aRow + xStrideBytes * xIndex);
     }
 
-    // Convert from F32 to the output bit-depth (i.e always RGBA).
-    dstImg.m_bitDepthOp->apply(&inputBuffer[0], &outBitDepthBuffer[0], numPixelsToUnpack);
-
-    // Process one single, complete scanline.
-    int pixelsCopied = 0;
+    // Process the rest of the scanline.
     while(pixelsCopied < numPixelsToUnpack)
     {
         // Copy from RGBA buffer to arbitrary channel ordering.
@@ -255,6 +449,17 @@ void Generic<float>::UnpackRGBAToImageDesc(GenericImageDesc & dstImg,
     const long yIndex = imagePixelStartIndex / imgWidth;
     long xIndex = imagePixelStartIndex % imgWidth;
 
+    // In the float specialization, the BitDepthOp is the last Op of the color processing.
+    dstImg.m_bitDepthOp->apply(&inputBuffer[0], &inputBuffer[0], numPixelsToUnpack);
+
+    int pixelsCopied
+        = ShuffleChannels(dstImg.m_unpackShuffle,
+                          reinterpret_cast<const char *>(inputBuffer),
+                          dstImg.m_rData + dstImg.m_pixelOffsetBytes
+                            + yStrideBytes * yIndex + xStrideBytes * xIndex,
+                          numPixelsToUnpack);
+    xIndex += pixelsCopied;
+
     // Figure out our initial ptr positions
     char * rRow = dstImg.m_rData + yStrideBytes * yIndex;
     char * gRow = dstImg.m_gData + yStrideBytes * yIndex;
@@ -272,11 +477,7 @@ void Generic<float>::UnpackRGBAToImageDesc(GenericImageDesc & dstImg,
         aPtr = reinterpret_cast<float*>(aRow + xStrideBytes * xIndex);
     }
 
-    // In the float specialization, the BitDepthOp is the last Op of the color processing.
-    dstImg.m_bitDepthOp->apply(&inputBuffer[0], &inputBuffer[0], numPixelsToUnpack);
-
-    // Process one single, complete scanline.
-    int pixelsCopied = 0;
+    // Process the rest of the scanline.
     while(pixelsCopied < numPixelsToUnpack)
     {
         // Copy from RGBA buffer to arbitrary channel ordering.
@@ -13,6 +13,46 @@
 namespace OCIO_NAMESPACE
 {
 
+// Byte shuffle reordering the channels of interleaved pixels (e.g. RGB or BGRA) to or from the
+// RGBA ordering. The pixels are processed by blocks of 16 bytes in the RGBA buffer.
+struct ChannelShuffle
+{
+    // Source byte of each byte of a destination block, 0x80 to set the byte to zero.
+    uint8_t m_mask[16];
+
+    ptrdiff_t m_srcBlockBytes = 0;
+    ptrdiff_t m_dstBlockBytes = 0;
+    long m_blockPixels = 0;
+
+    // Reorder as many of the numPixels pixels as possible, and return how many were processed.
+    typedef long (ShuffleFunc)(const ChannelShuffle & shuffle,
+                               const char * src, char * dst, long numPixels);
+
+    // Vectorized implementation, null if the layout or the CPU are not supported.
+    ShuffleFunc * m_func = nullptr;
+};
+
+// Layout of the pixels packed in 32-bit words of 10-bit R, G & B codes and an optional 2-bit
+// alpha (e.g. RGB10_A2 or the DPX method A). Refer to PackedFormat.
+struct PackedWords
+{
+    // Lowest bit of the R, G & B codes.
+    unsigned m_shifts[3] = { 0, 0, 0 };
+    // Lowest bit of the alpha, -1 when there is no alpha.
+    int m_alphaShift = -1;
+
+    // Convert as many of the numPixels words to RGBA 10-bit codes (or back) as possible, and
+    // return how many were processed.
+    typedef long (UnpackFunc)(const PackedWords & words,
+                              const uint32_t * src, uint16_t * dst, long numPixels);
+    typedef long (PackFunc)(const PackedWords & words,
+                            const uint16_t * src, uint32_t * dst, long numPixels);
+
+    // Vectorized implementations, null if the layout or the CPU are not supported.
+    UnpackFunc * m_unpackFunc = nullptr;
+    PackFunc * m_packFunc = nullptr;
+};
+
 struct GenericImageDesc
 {
     long m_width  = 0;
@@ -34,10 +74,30 @@ struct GenericImageDesc
     // Is the image buffer a 32-bit float image buffer?
     bool m_isFloat      = false;
 
+    // Byte offset of the first channel of an interleaved pixel from the red channel.
+    ptrdiff_t m_pixelOffsetBytes = 0;
+    // Reordering of the interleaved pixels to & from the RGBA buffers.
+    ChannelShuffle m_packShuffle;
+    ChannelShuffle m_unpackShuffle;
+
+    // Packed format of the pixels, if any. The R, G, B & A data pointers of the formats packing
+    // the channels in 32-bit words are then the address of the pixel.
+    PackedFormat m_packedFormat = PACKED_FORMAT_NONE;
+    PackedWords m_packedWords;
+
 
     // Resolves all AutoStride.
     void init(const ImageDesc & img, BitDepth bitDepth, const ConstOpCPURcPtr & bitDepthOp);
 
+    // Set the channel shuffles when the pixels are interleaved (e.g. RGB or BGRA) and the CPU
+    // supports their vectorized reordering.
+    void initChannelShuffles(BitDepth bitDepth);
+
+    // Set the packed words layout when the pixels are packed in 32-bit words.
+    void initPackedWords();
+
+    // Are the pixels packed in 32-bit words (refer to PackedWords)?
+    bool hasPackedWords() const;
     // Is the image buffer a packed RGBA 32-bit float buffer?
     bool isPackedFloatRGBA() const;
     // Is the image buffer a RGBA packed buffer?
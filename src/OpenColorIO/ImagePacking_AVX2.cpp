@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "ImagePacking_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <algorithm>
+#include <immintrin.h>
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Number of blocks which could be loaded or stored with 16 bytes without reaching past the end.
+inline long NumSafeBlocks(ptrdiff_t numBytes, ptrdiff_t blockBytes)
+{
+    return numBytes < 16 ? 0 : long((numBytes - 16) / blockBytes + 1);
+}
+
+} // anonymous namespace
+
+long AVX2ShuffleChannels(const ChannelShuffle & shuffle,
+                         const char * src, char * dst, long numPixels)
+{
+    const ptrdiff_t srcBlockBytes = shuffle.m_srcBlockBytes;
+    const ptrdiff_t dstBlockBytes = shuffle.m_dstBlockBytes;
+    const long blockPixels = shuffle.m_blockPixels;
+
+    // The blocks always hold complete pixels.
+    const long numBlocks
+        = std::min(numPixels / blockPixels,
+                   std::min(NumSafeBlocks(numPixels * (srcBlockBytes / blockPixels), srcBlockBytes),
+                            NumSafeBlocks(numPixels * (dstBlockBytes / blockPixels), dstBlockBytes)));
+
+    const __m128i mask = _mm_loadu_si128((const __m128i *)shuffle.m_mask);
+    const __m256i mask2 = _mm256_broadcastsi128_si256(mask);
+
+    long block = 0;
+    for (; block + 2 <= numBlocks; block += 2)
+    {
+        // Note that with blocks of 12 bytes, the store of the second block overwrites the last
+        // 4 bytes of the first store.
+        const __m256i values
+            = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)src)),
+                _mm_loadu_si128((const __m128i *)(src + srcBlockBytes)), 1);
+
+        const __m256i shuffled = _mm256_shuffle_epi8(values, mask2);
+
+        _mm_storeu_si128((__m128i *)dst, _mm256_castsi256_si128(shuffled));
+        _mm_storeu_si128((__m128i *)(dst + dstBlockBytes), _mm256_extracti128_si256(shuffled, 1));
+
+        src += 2 * srcBlockBytes;
+        dst += 2 * dstBlockBytes;
+    }
+
+    if (block < numBlocks)
+    {
+        _mm_storeu_si128((__m128i *)dst,
+                         _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)src), mask));
+        ++block;
+    }
+
+    return block * blockPixels;
+}
+
+long AVX2UnpackWords(const PackedWords & words,
+                     const uint32_t * src, uint16_t * dst, long numPixels)
+{
+    const __m128i rShift = _mm_cvtsi32_si128(int(words.m_shifts[0]));
+    const __m128i gShift = _mm_cvtsi32_si128(int(words.m_shifts[1]));
+    const __m128i bShift = _mm_cvtsi32_si128(int(words.m_shifts[2]));
+    const __m128i aShift = _mm_cvtsi32_si128(std::max(words.m_alphaShift, 0));
+
+    const __m256i codeMask  = _mm256_set1_epi32(0x3FF);
+    // Scale the 2-bit alpha codes to the 10-bit codes, or clear the alpha if there is none.
+    const __m256i alphaMask = _mm256_set1_epi32(words.m_alphaShift < 0 ? 0 : 0x3);
+    const __m256i alphaScale = _mm256_set1_epi32(341);
+
+    long idx = 0;
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        const __m256i word = _mm256_loadu_si256((const __m256i *)(src + idx));
+
+        const __m256i r = _mm256_and_si256(_mm256_srl_epi32(word, rShift), codeMask);
+        const __m256i g = _mm256_and_si256(_mm256_srl_epi32(word, gShift), codeMask);
+        const __m256i b = _mm256_and_si256(_mm256_srl_epi32(word, bShift), codeMask);
+        const __m256i a = _mm256_mullo_epi32(_mm256_and_si256(_mm256_srl_epi32(word, aShift),
+                                                              alphaMask),
+                                             alphaScale);
+
+        // Each 32-bit element holds two 16-bit channels of a pixel.
+        const __m256i rg = _mm256_or_si256(r, _mm256_slli_epi32(g, 16));
+        const __m256i ba = _mm256_or_si256(b, _mm256_slli_epi32(a, 16));
+
+        // Pixels 0, 1, 4 & 5, and pixels 2, 3, 6 & 7.
+        const __m256i lo = _mm256_unpacklo_epi32(rg, ba);
+        const __m256i hi = _mm256_unpackhi_epi32(rg, ba);
+
+        _mm256_storeu_si256((__m256i *)(dst + 4 * idx),
+                            _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256((__m256i *)(dst + 4 * idx + 16),
+                            _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+
+    return idx;
+}
+
+long AVX2PackWords(const PackedWords & words,
+                   const uint16_t * src, uint32_t * dst, long numPixels)
+{
+    const __m128i rShift = _mm_cvtsi32_si128(int(words.m_shifts[0]));
+    const __m128i gShift = _mm_cvtsi32_si128(int(words.m_shifts[1]));
+    const __m128i bShift = _mm_cvtsi32_si128(int(words.m_shifts[2]));
+    const __m128i aShift = _mm_cvtsi32_si128(std::max(words.m_alphaShift, 0));
+
+    const __m256i maxCode  = _mm256_set1_epi32(0x3FF);
+    const __m256i lowMask  = _mm256_set1_epi32(0xFFFF);
+    // Round the 10-bit alpha codes to the 2-bit codes, or ignore the alpha if there is none.
+    const bool hasAlpha = words.m_alphaShift >= 0;
+    const __m256i alphaMid0 = _mm256_set1_epi32(hasAlpha ? 170 : 0xFFFF);
+    const __m256i alphaMid1 = _mm256_set1_epi32(hasAlpha ? 511 : 0xFFFF);
+    const __m256i alphaMid2 = _mm256_set1_epi32(hasAlpha ? 852 : 0xFFFF);
+
+    // Gather the R & G channels of the pixels in the low lane, and the B & A in the high lane.
+    const __m256i gather = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+
+    long idx = 0;
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        const __m256i pixels0
+            = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i *)(src + 4 * idx)),
+                                          gather);
+        const __m256i pixels1
+            = _mm256_permutevar8x32_epi32(
+                _mm256_loadu_si256((const __m256i *)(src + 4 * idx + 16)), gather);
+
+        const __m256i rg = _mm256_permute2x128_si256(pixels0, pixels1, 0x20);
+        const __m256i ba = _mm256_permute2x128_si256(pixels0, pixels1, 0x31);
+
+        const __m256i r = _mm256_min_epu32(_mm256_and_si256(rg, lowMask), maxCode);
+        const __m256i g = _mm256_min_epu32(_mm256_srli_epi32(rg, 16), maxCode);
+        const __m256i b = _mm256_min_epu32(_mm256_and_si256(ba, lowMask), maxCode);
+        const __m256i a = _mm256_srli_epi32(ba, 16);
+
+        // The comparisons are -1 when true.
+        __m256i alpha = _mm256_add_epi32(_mm256_cmpgt_epi32(a, alphaMid0),
+                                         _mm256_cmpgt_epi32(a, alphaMid1));
+        alpha = _mm256_sub_epi32(_mm256_setzero_si256(),
+                                 _mm256_add_epi32(alpha, _mm256_cmpgt_epi32(a, alphaMid2)));
+
+        __m256i word = _mm256_or_si256(_mm256_sll_epi32(r, rShift), _mm256_sll_epi32(g, gShift));
+        word = _mm256_or_si256(word, _mm256_sll_epi32(b, bShift));
+        word = _mm256_or_si256(word, _mm256_sll_epi32(alpha, aShift));
+
+        _mm256_storeu_si256((__m256i *)(dst + idx), word);
+    }
+
+    return idx;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_IMAGEPACKING_AVX2_H
+#define INCLUDED_OCIO_IMAGEPACKING_AVX2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "ImagePacking.h"
+
+#if OCIO_USE_AVX2
+namespace OCIO_NAMESPACE
+{
+
+// Reorder the channels of the pixels using the byte shuffle, two blocks at a time. The blocks
+// are read & written with 16 bytes so the trailing pixels reaching past the end of the pixels
+// are left to the caller. Return the number of pixels processed.
+long AVX2ShuffleChannels(const ChannelShuffle & shuffle,
+                         const char * src, char * dst, long numPixels);
+
+// Convert the contiguous 32-bit words of packed pixels to RGBA 10-bit codes (or back), 8 pixels
+// at a time. The trailing pixels are left to the caller. Return the number of pixels processed.
+long AVX2UnpackWords(const PackedWords & words,
+                     const uint32_t * src, uint16_t * dst, long numPixels);
+long AVX2PackWords(const PackedWords & words,
+                   const uint16_t * src, uint32_t * dst, long numPixels);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
+
+#endif /* INCLUDED_OCIO_IMAGEPACKING_AVX2_H */
@@ -0,0 +1,631 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "BitDepthUtils.h"
+#include "IntegerLookup.h"
+#include "ops/matrix/MatrixOpData.h"
+#include "ThreadUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+bool IsIntegerBitDepth(BitDepth bitDepth)
+{
+    return bitDepth == BIT_DEPTH_UINT8 || bitDepth == BIT_DEPTH_UINT10
+           || bitDepth == BIT_DEPTH_UINT12 || bitDepth == BIT_DEPTH_UINT16;
+}
+
+// Is the alpha channel mixed with the RGB channels i.e. only a matrix could do that?
+bool HasAlphaCrosstalk(const OpRcPtrVec & ops)
+{
+    for (const auto & op : ops)
+    {
+        ConstOpRcPtr constOp = op;
+        if (constOp->data()->getType() == OpData::MatrixType)
+        {
+            ConstMatrixOpDataRcPtr mat = DynamicPtrCast<const MatrixOpData>(constOp->data());
+            const ArrayDouble::Values & m = mat->getArray().getValues();
+
+            // Strict comparisons intended i.e. the last column & the bottom row.
+            if (m[3] != 0.0 || m[7] != 0.0 || m[11] != 0.0
+                || m[12] != 0.0 || m[13] != 0.0 || m[14] != 0.0)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// The interpolation weights are fixed-point values.
+constexpr unsigned FRACTION_BITS = 15;
+constexpr uint32_t FRACTION_ONE  = 1u << FRACTION_BITS;
+
+// Number of extra fraction bits making the output codes 16-bit values.
+constexpr unsigned GetExtraBits(unsigned maxValue)
+{
+    return maxValue >= 0xFFFF ? 0 : 1 + GetExtraBits(2 * maxValue + 1);
+}
+
+template<BitDepth inBD, BitDepth outBD>
+class IntegerLookupRenderer : public IntegerLookup
+{
+public:
+    typedef typename BitDepthInfo<inBD>::Type InType;
+    typedef typename BitDepthInfo<outBD>::Type OutType;
+
+    static constexpr unsigned inMax  = BitDepthInfo<inBD>::maxValue;
+    static constexpr unsigned outMax = BitDepthInfo<outBD>::maxValue;
+    static constexpr long numCodes   = long(inMax) + 1;
+
+    // The interpolated 3D table nodes are 16-bit values i.e. output codes with extra bits.
+    static constexpr unsigned nodeBits = GetExtraBits(outMax);
+
+    IntegerLookupRenderer(Type type, unsigned long gridSize,
+                          const Evaluator & outEval, const Evaluator & floatEval);
+
+    void apply(const char * const srcChannels[4], ptrdiff_t srcXStrideBytes,
+               char * const dstChannels[4], ptrdiff_t dstXStrideBytes,
+               long numPixels) const override;
+
+    size_t getMemorySize() const override
+    {
+        return sizeof(*this)
+               + m_codes1D.capacity() * sizeof(OutType)
+               + m_codes3D.capacity() * sizeof(OutType)
+               + (m_nodes.capacity() + m_nodeIndices.capacity() + m_nodeFractions.capacity())
+                 * sizeof(uint16_t);
+    }
+
+private:
+    void build1D(const Evaluator & outEval);
+    void buildAlpha(const Evaluator & outEval);
+    void build3D(const Evaluator & outEval, const Evaluator & floatEval);
+    void build3DExact(const Evaluator & outEval);
+
+    // Interpolate the RGB output codes of the RGB input codes.
+    void interpolate(const unsigned * codes, OutType * out) const;
+
+    // Apply the lookup to the codes of each pixel.
+    template<typename Lookup>
+    static void ProcessPixels(const char * const srcChannels[4], ptrdiff_t srcXStrideBytes,
+                              char * const dstChannels[4], ptrdiff_t dstXStrideBytes,
+                              long numPixels, const Lookup & lookup);
+
+    // Output codes of all the input codes i.e. interleaved RGBA codes for the 1D lookup, and
+    // only the alpha codes for the 3D lookups.
+    std::vector<OutType> m_codes1D;
+
+    // Output RGB codes of all the RGB input codes for the exact 3D lookup.
+    std::vector<OutType> m_codes3D;
+
+    // RGB nodes of the interpolated 3D lookup.
+    std::vector<uint16_t> m_nodes;
+    // For all the input codes, the index of the lower node & the fixed-point distance to it.
+    std::vector<uint16_t> m_nodeIndices;
+    std::vector<uint16_t> m_nodeFractions;
+};
+
+template<BitDepth inBD, BitDepth outBD>
+IntegerLookupRenderer<inBD, outBD>::IntegerLookupRenderer(Type type, unsigned long gridSize,
+                                                          const Evaluator & outEval,
+                                                          const Evaluator & floatEval)
+    :   IntegerLookup(type, gridSize)
+{
+    switch (type)
+    {
+        case TYPE_1D:
+            build1D(outEval);
+            break;
+
+        case TYPE_3D:
+            buildAlpha(outEval);
+            build3D(outEval, floatEval);
+            break;
+
+        case TYPE_3D_EXACT:
+            buildAlpha(outEval);
+            build3DExact(outEval);
+            break;
+    }
+}
+
+template<BitDepth inBD, BitDepth outBD>
+void IntegerLookupRenderer<inBD, outBD>::build1D(const Evaluator & outEval)
+{
+    // The channels are independent so all the codes are processed at once.
+    std::vector<InType> in(4 * numCodes);
+    for (long code = 0; code < numCodes; ++code)
+    {
+        std::fill(&in[4 * code], &in[4 * code] + 4, InType(code));
+    }
+
+    m_codes1D.resize(4 * numCodes);
+    outEval(in.data(), m_codes1D.data(), numCodes);
+}
+
+template<BitDepth inBD, BitDepth outBD>
+void IntegerLookupRenderer<inBD, outBD>::buildAlpha(const Evaluator & outEval)
+{
+    // The alpha channel is independent from the RGB ones.
+    std::vector<InType> in(4 * numCodes, InType(0));
+    for (long code = 0; code < numCodes; ++code)
+    {
+        in[4 * code + 3] = InType(code);
+    }
+
+    std::vector<OutType> out(4 * numCodes);
+    outEval(in.data(), out.data(), numCodes);
+
+    m_codes1D.resize(numCodes);
+    for (long code = 0; code < numCodes; ++code)
+    {
+        m_codes1D[code] = out[4 * code + 3];
+    }
+}
+
+template<BitDepth inBD, BitDepth outBD>
+void IntegerLookupRenderer<inBD, outBD>::build3D(const Evaluator & outEval,
+                                                 const Evaluator & floatEval)
+{
+    const long gridSize = long(getGridSize());
+
+    // The nodes are the input codes evenly spread over the input range.
+    std::vector<InType> nodeCodes(gridSize);
+    for (long idx = 0; idx < gridSize; ++idx)
+    {
+        nodeCodes[idx] = InType((idx * inMax + (gridSize - 1) / 2) / (gridSize - 1));
+    }
+
+    m_nodeIndices.resize(numCodes);
+    m_nodeFractions.resize(numCodes);
+
+    long idx = 0;
+    for (long code = 0; code < numCodes; ++code)
+    {
+        // Note that the last code is the upper bound of the last interval.
+        while (idx < gridSize - 2 && nodeCodes[idx + 1] <= code)
+        {
+            ++idx;
+        }
+
+        const uint32_t span = nodeCodes[idx + 1] - nodeCodes[idx];
+        const uint32_t dist = uint32_t(code - nodeCodes[idx]);
+
+        m_nodeIndices[code]   = uint16_t(idx);
+        m_nodeFractions[code] = uint16_t((dist * FRACTION_ONE + span / 2) / span);
+    }
+
+    const float scale = float(outMax << nodeBits);
+
+    m_nodes.resize(3 * gridSize * gridSize * gridSize);
+
+    // Each red slice of the nodes is processed at once.
+    ParallelFor(gridSize, 1, 0, [&](unsigned, long begin, long end)
+    {
+        const long sliceSize = gridSize * gridSize;
+
+        std::vector<InType> in(4 * sliceSize, InType(0));
+        std::vector<float> out(4 * sliceSize);
+
+        for (long r = begin; r < end; ++r)
+        {
+            for (long g = 0; g < gridSize; ++g)
+            {
+                for (long b = 0; b < gridSize; ++b)
+                {
+                    InType * pixel = &in[4 * (g * gridSize + b)];
+                    pixel[0] = nodeCodes[r];
+                    pixel[1] = nodeCodes[g];
+                    pixel[2] = nodeCodes[b];
+                }
+            }
+
+            floatEval(in.data(), out.data(), sliceSize);
+
+            uint16_t * nodes = &m_nodes[3 * r * sliceSize];
+            for (long pix = 0; pix < sliceSize; ++pix)
+            {
+                for (long chan = 0; chan < 3; ++chan)
+                {
+                    const float v = out[4 * pix + chan] * scale + 0.5f;
+                    nodes[3 * pix + chan] = std::isnan(v) ? 0 : uint16_t(CLAMP(v, 0.0f, scale));
+                }
+            }
+        }
+    });
+
+    // Measure the interpolation error at the cell centers i.e. the farthest codes from the nodes.
+
+    const long numCells = gridSize - 1;
+    std::vector<unsigned> sliceErrors(numCells, 0);
+
+    ParallelFor(numCells, 1, 0, [&](unsigned, long begin, long end)
+    {
+        const long sliceSize = numCells * numCells;
+
+        std::vector<InType> in(4 * sliceSize, InType(0));
+        std::vector<OutType> out(4 * sliceSize);
+
+        for (long r = begin; r < end; ++r)
+        {
+            for (long g = 0; g < numCells; ++g)
+            {
+                for (long b = 0; b < numCells; ++b)
+                {
+                    InType * pixel = &in[4 * (g * numCells + b)];
+                    pixel[0] = InType((nodeCodes[r] + nodeCodes[r + 1]) / 2);
+                    pixel[1] = InType((nodeCodes[g] + nodeCodes[g + 1]) / 2);
+                    pixel[2] = InType((nodeCodes[b] + nodeCodes[b + 1]) / 2);
+                }
+            }
+
+            outEval(in.data(), out.data(), sliceSize);
+
+            for (long pix = 0; pix < sliceSize; ++pix)
+            {
+                const unsigned codes[4]{ in[4 * pix + 0], in[4 * pix + 1], in[4 * pix + 2], 0 };
+
+                OutType res[4];
+                interpolate(codes, res);
+
+                for (long chan = 0; chan < 3; ++chan)
+                {
+                    const int diff = int(res[chan]) - int(out[4 * pix + chan]);
+                    sliceErrors[r] = std::max(sliceErrors[r], unsigned(std::abs(diff)));
+                }
+            }
+        }
+    });
+
+    m_maxError = *std::max_element(sliceErrors.begin(), sliceErrors.end());
+}
+
+template<BitDepth inBD, BitDepth outBD>
+void IntegerLookupRenderer<inBD, outBD>::build3DExact(const Evaluator & outEval)
+{
+    // Note that the grid size is the number of input codes.
+    const long gridSize = long(getGridSize());
+
+    m_codes3D.resize(3 * gridSize * gridSize * gridSize);
+
+    ParallelFor(gridSize, 1, 0, [this, gridSize, &outEval](unsigned, long begin, long end)
+    {
+        const long sliceSize = gridSize * gridSize;
+
+        std::vector<InType> in(4 * sliceSize, InType(0));
+        std::vector<OutType> out(4 * sliceSize);
+
+        for (long r = begin; r < end; ++r)
+        {
+            for (long pix = 0; pix < sliceSize; ++pix)
+            {
+                in[4 * pix + 0] = InType(r);
+                in[4 * pix + 1] = InType(pix / gridSize);
+                in[4 * pix + 2] = InType(pix % gridSize);
+            }
+
+            outEval(in.data(), out.data(), sliceSize);
+
+            OutType * codes = &m_codes3D[3 * r * sliceSize];
+            for (long pix = 0; pix < sliceSize; ++pix)
+            {
+                codes[3 * pix + 0] = out[4 * pix + 0];
+                codes[3 * pix + 1] = out[4 * pix + 1];
+                codes[3 * pix + 2] = out[4 * pix + 2];
+            }
+        }
+    });
+}
+
+template<BitDepth inBD, BitDepth outBD>
+inline void IntegerLookupRenderer<inBD, outBD>::interpolate(const unsigned * codes,
+                                                            OutType * out) const
+{
+    const uint32_t fr = m_nodeFractions[codes[0]];
+    const uint32_t fg = m_nodeFractions[codes[1]];
+    const uint32_t fb = m_nodeFractions[codes[2]];
+
+    // Distances between two nodes along each dimension.
+    const unsigned strideB = 3;
+    const unsigned strideG = strideB * unsigned(getGridSize());
+    const unsigned strideR = strideG * unsigned(getGridSize());
+
+    const uint16_t * n0 = m_nodes.data() + m_nodeIndices[codes[0]] * strideR
+                                         + m_nodeIndices[codes[1]] * strideG
+                                         + m_nodeIndices[codes[2]] * strideB;
+
+    // Select the tetrahedron containing the point i.e. walk the cube edges along the dimensions
+    // sorted by decreasing fractions.
+    uint32_t f1, f2, f3;
+    unsigned s1, s2, s3;
+    if (fr > fg)
+    {
+        if (fg > fb)
+        {
+            f1 = fr; f2 = fg; f3 = fb;
+            s1 = strideR; s2 = strideG; s3 = strideB;
+        }
+        else if (fr > fb)
+        {
+            f1 = fr; f2 = fb; f3 = fg;
+            s1 = strideR; s2 = strideB; s3 = strideG;
+        }
+        else
+        {
+            f1 = fb; f2 = fr; f3 = fg;
+            s1 = strideB; s2 = strideR; s3 = strideG;
+        }
+    }
+    else
+    {
+        if (fb > fg)
+        {
+            f1 = fb; f2 = fg; f3 = fr;
+            s1 = strideB; s2 = strideG; s3 = strideR;
+        }
+        else if (fb > fr)
+        {
+            f1 = fg; f2 = fb; f3 = fr;
+            s1 = strideG; s2 = strideB; s3 = strideR;
+        }
+        else
+        {
+            f1 = fg; f2 = fr; f3 = fb;
+            s1 = strideG; s2 = strideR; s3 = strideB;
+        }
+    }
+
+    const uint16_t * n1 = n0 + s1;
+    const uint16_t * n2 = n1 + s2;
+    const uint16_t * n3 = n2 + s3;
+
+    // The weights are positive and their sum is FRACTION_ONE so the weighted sums of the 16-bit
+    // nodes fit in 32 bits.
+    const uint32_t w0 = FRACTION_ONE - f1;
+    const uint32_t w1 = f1 - f2;
+    const uint32_t w2 = f2 - f3;
+    const uint32_t w3 = f3;
+
+    constexpr unsigned shift = FRACTION_BITS + nodeBits;
+    constexpr uint32_t half  = 1u << (shift - 1);
+
+    for (int chan = 0; chan < 3; ++chan)
+    {
+        const uint32_t v = w0 * n0[chan] + w1 * n1[chan] + w2 * n2[chan] + w3 * n3[chan];
+        out[chan] = OutType((v + half) >> shift);
+    }
+}
+
+template<BitDepth inBD, BitDepth outBD>
+template<typename Lookup>
+void IntegerLookupRenderer<inBD, outBD>::ProcessPixels(const char * const srcChannels[4],
+                                                       ptrdiff_t srcXStrideBytes,
+                                                       char * const dstChannels[4],
+                                                       ptrdiff_t dstXStrideBytes,
+                                                       long numPixels,
+                                                       const Lookup & lookup)
+{
+    // Only the 10 and 12-bit codes could be above the maximum of the bit-depth.
+    constexpr bool clampCodes = inMax < std::numeric_limits<InType>::max();
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        unsigned codes[4];
+        for (int chan = 0; chan < 4; ++chan)
+        {
+            if (!srcChannels[chan])
+            {
+                codes[chan] = 0;
+                continue;
+            }
+
+            const InType code
+                = *reinterpret_cast<const InType *>(srcChannels[chan] + idx * srcXStrideBytes);
+            codes[chan] = clampCodes ? std::min<unsigned>(code, inMax) : code;
+        }
+
+        OutType out[4];
+        lookup(codes, out);
+
+        for (int chan = 0; chan < 4; ++chan)
+        {
+            if (dstChannels[chan])
+            {
+                *reinterpret_cast<OutType *>(dstChannels[chan] + idx * dstXStrideBytes)
+                    = out[chan];
+            }
+        }
+    }
+}
+
+template<BitDepth inBD, BitDepth outBD>
+void IntegerLookupRenderer<inBD, outBD>::apply(const char * const srcChannels[4],
+                                               ptrdiff_t srcXStrideBytes,
+                                               char * const dstChannels[4],
+                                               ptrdiff_t dstXStrideBytes,
+                                               long numPixels) const
+{
+    switch (getType())
+    {
+        case TYPE_1D:
+        {
+            const OutType * lut = m_codes1D.data();
+
+            ProcessPixels(srcChannels, srcXStrideBytes, dstChannels, dstXStrideBytes, numPixels,
+                          [lut](const unsigned * codes, OutType * out)
+                          {
+                              out[0] = lut[4 * codes[0] + 0];
+                              out[1] = lut[4 * codes[1] + 1];
+                              out[2] = lut[4 * codes[2] + 2];
+                              out[3] = lut[4 * codes[3] + 3];
+                          });
+            break;
+        }
+
+        case TYPE_3D:
+        {
+            const OutType * alphaLut = m_codes1D.data();
+
+            ProcessPixels(srcChannels, srcXStrideBytes, dstChannels, dstXStrideBytes, numPixels,
+                          [this, alphaLut](const unsigned * codes, OutType * out)
+                          {
+                              interpolate(codes, out);
+                              out[3] = alphaLut[codes[3]];
+                          });
+            break;
+        }
+
+        case TYPE_3D_EXACT:
+        {
+            const OutType * alphaLut = m_codes1D.data();
+            const OutType * lut      = m_codes3D.data();
+
+            const size_t gridSize = getGridSize();
+
+            ProcessPixels(srcChannels, srcXStrideBytes, dstChannels, dstXStrideBytes, numPixels,
+                          [alphaLut, lut, gridSize](const unsigned * codes, OutType * out)
+                          {
+                              const OutType * rgb
+                                  = lut + 3 * ((codes[0] * gridSize + codes[1]) * gridSize
+                                               + codes[2]);
+                              out[0] = rgb[0];
+                              out[1] = rgb[1];
+                              out[2] = rgb[2];
+                              out[3] = alphaLut[codes[3]];
+                          });
+            break;
+        }
+    }
+}
+
+template<BitDepth inBD>
+std::unique_ptr<IntegerLookup> CreateRenderer(BitDepth out,
+                                              IntegerLookup::Type type, unsigned long gridSize,
+                                              const IntegerLookup::Evaluator & outEval,
+                                              const IntegerLookup::Evaluator & floatEval)
+{
+    switch (out)
+    {
+        case BIT_DEPTH_UINT8:
+            return std::unique_ptr<IntegerLookup>(
+                new IntegerLookupRenderer<inBD, BIT_DEPTH_UINT8>(type, gridSize,
+                                                                 outEval, floatEval));
+        case BIT_DEPTH_UINT10:
+            return std::unique_ptr<IntegerLookup>(
+                new IntegerLookupRenderer<inBD, BIT_DEPTH_UINT10>(type, gridSize,
+                                                                  outEval, floatEval));
+        case BIT_DEPTH_UINT12:
+            return std::unique_ptr<IntegerLookup>(
+                new IntegerLookupRenderer<inBD, BIT_DEPTH_UINT12>(type, gridSize,
+                                                                  outEval, floatEval));
+        case BIT_DEPTH_UINT16:
+            return std::unique_ptr<IntegerLookup>(
+                new IntegerLookupRenderer<inBD, BIT_DEPTH_UINT16>(type, gridSize,
+                                                                  outEval, floatEval));
+        case BIT_DEPTH_UINT14:
+        case BIT_DEPTH_UINT32:
+        case BIT_DEPTH_F16:
+        case BIT_DEPTH_F32:
+        case BIT_DEPTH_UNKNOWN:
+        default:
+            throw Exception("Unsupported bit-depth for an integer lookup.");
+    }
+}
+
+} // anon.
+
+IntegerLookup::IntegerLookup(Type type, unsigned long gridSize)
+    :   m_maxError(0)
+    ,   m_type(type)
+    ,   m_gridSize(gridSize)
+{
+}
+
+bool IntegerLookup::GetType(const OpRcPtrVec & ops, BitDepth in, BitDepth out,
+                            OptimizationFlags oFlags, Type & type)
+{
+    // The tables could not follow the changes of the dynamic properties.
+    if (!IsIntegerBitDepth(in) || !IsIntegerBitDepth(out) || ops.isDynamic())
+    {
+        return false;
+    }
+
+    if (!ops.hasChannelCrosstalk())
+    {
+        // Like the separable prefix optimization, the exact 1D tables have the input
+        // bit-depth domain.
+        type = TYPE_1D;
+        return HasFlag(oFlags, OPTIMIZATION_COMP_SEPARABLE_PREFIX);
+    }
+
+    type = TYPE_3D;
+    return HasFlag(oFlags, OPTIMIZATION_INTEGER_LOOKUP) && !HasAlphaCrosstalk(ops);
+}
+
+std::unique_ptr<IntegerLookup> IntegerLookup::Create(BitDepth in, BitDepth out,
+                                                     Type type, unsigned long gridSize,
+                                                     const Evaluator & outEval,
+                                                     const Evaluator & floatEval)
+{
+    if (type == TYPE_1D)
+    {
+        gridSize = 0;
+    }
+    else
+    {
+        const unsigned long numCodes = (unsigned long)GetBitDepthMaxValue(in) + 1;
+        if (gridSize < 2 || gridSize > numCodes)
+        {
+            throw Exception("Invalid grid size for an integer lookup.");
+        }
+
+        type = gridSize == numCodes ? TYPE_3D_EXACT : TYPE_3D;
+    }
+
+    std::unique_ptr<IntegerLookup> lookup;
+    switch (in)
+    {
+        case BIT_DEPTH_UINT8:
+            lookup = CreateRenderer<BIT_DEPTH_UINT8>(out, type, gridSize, outEval, floatEval);
+            break;
+        case BIT_DEPTH_UINT10:
+            lookup = CreateRenderer<BIT_DEPTH_UINT10>(out, type, gridSize, outEval, floatEval);
+            break;
+        case BIT_DEPTH_UINT12:
+            lookup = CreateRenderer<BIT_DEPTH_UINT12>(out, type, gridSize, outEval, floatEval);
+            break;
+        case BIT_DEPTH_UINT16:
+            lookup = CreateRenderer<BIT_DEPTH_UINT16>(out, type, gridSize, outEval, floatEval);
+            break;
+        case BIT_DEPTH_UINT14:
+        case BIT_DEPTH_UINT32:
+        case BIT_DEPTH_F16:
+        case BIT_DEPTH_F32:
+        case BIT_DEPTH_UNKNOWN:
+        default:
+            throw Exception("Unsupported bit-depth for an integer lookup.");
+    }
+
+    // The interpolation must be accurate to one output code (i.e. the rounding error).
+    if (lookup->getMaxError() > 1)
+    {
+        return nullptr;
+    }
+
+    return lookup;
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_INTEGERLOOKUP_H
+#define INCLUDED_OCIO_INTEGERLOOKUP_H
+
+
+#include <functional>
+#include <memory>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Op.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// An integer lookup processes the images of integer bit-depths (i.e. 8, 10, 12 and 16-bit)
+// without any conversion to 32-bit float: the color transformation is precomputed for the input
+// codes and the output codes are directly read from tables.
+//  - When the color transformation has no channel crosstalk, each channel has a 1D table of the
+//    output codes of all the input codes i.e. the lookup is exact.
+//  - Otherwise, the RGB output codes are read from a 3D table whose nodes are input codes, using
+//    a fixed-point tetrahedral interpolation, and the alpha channel has its own 1D table. When
+//    the 3D table holds all the input codes (i.e. 256^3 nodes for 8-bit inputs), there is no
+//    interpolation and the lookup is exact. Like the baked LUTs, an interpolated lookup is only
+//    kept when it is accurate enough.
+// Note that the 10 and 12-bit input codes above the bit-depth maximum are clamped.
+class IntegerLookup
+{
+public:
+    enum Type
+    {
+        TYPE_1D = 0,    // One 1D table per channel.
+        TYPE_3D,        // Interpolated 3D table for the RGB channels.
+        TYPE_3D_EXACT   // 3D table of all the RGB input codes.
+    };
+
+    // Process numPixels packed RGBA pixels of the input bit-depth to packed RGBA pixels of the
+    // output bit-depth, or of 32-bit float.
+    typedef std::function<void(const void * inImg, void * outImg, long numPixels)> Evaluator;
+
+    // Is there an integer lookup for the finalized ops and bit-depths? The type is then set.
+    static bool GetType(const OpRcPtrVec & ops, BitDepth in, BitDepth out,
+                        OptimizationFlags oFlags, Type & type);
+
+    // Build the tables of an integer lookup. The 'outEval' evaluator produces the output codes
+    // of the exact tables and the 'floatEval' one the 32-bit float values of the interpolated
+    // 3D table nodes. A 3D lookup of gridSize nodes per dimension becomes an exact lookup when
+    // gridSize is the number of input codes. Return null when the interpolation error of the 3D
+    // lookup exceeds one output code (e.g. the processing then falls back to float).
+    static std::unique_ptr<IntegerLookup> Create(BitDepth in, BitDepth out,
+                                                 Type type, unsigned long gridSize,
+                                                 const Evaluator & outEval,
+                                                 const Evaluator & floatEval);
+
+    IntegerLookup(const IntegerLookup &) = delete;
+    IntegerLookup & operator=(const IntegerLookup &) = delete;
+
+    virtual ~IntegerLookup() = default;
+
+    Type getType() const noexcept { return m_type; }
+    unsigned long getGridSize() const noexcept { return m_gridSize; }
+
+    // Maximum error in output codes of the interpolated 3D lookup, measured at the cell centers.
+    // It is 0 for the exact lookups.
+    unsigned getMaxError() const noexcept { return m_maxError; }
+
+    // Process numPixels pixels. The channel pointers are the addresses of the R, G, B and A
+    // channels of the first pixel, and the x strides the distances in bytes between two pixels.
+    // A null source alpha is read as 0 and a null destination alpha is not written. Note that
+    // the source and the destination pixels could be the same ones.
+    virtual void apply(const char * const srcChannels[4], ptrdiff_t srcXStrideBytes,
+                       char * const dstChannels[4], ptrdiff_t dstXStrideBytes,
+                       long numPixels) const = 0;
+
+    // Memory used by the tables, in bytes.
+    virtual size_t getMemorySize() const = 0;
+
+protected:
+    IntegerLookup(Type type, unsigned long gridSize);
+
+    unsigned m_maxError;
+
+private:
+    const Type m_type;
+    const unsigned long m_gridSize;
+};
+
+} // namespace OCIO_NAMESPACE
+
+#endif
@@ -10,6 +10,11 @@
 #include <thread>
 #include <assert.h>
 
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+#define OCIO_HAS_SHARED_MUTEX
+#include <shared_mutex>
+#endif
+
 
 /** For internal use only */
 
@@ -62,6 +67,40 @@ typedef std::mutex Mutex;
 // A non-copyable lock guard i.e. no copy and move semantics.
 typedef std::lock_guard<Mutex> AutoMutex;
 
+// A readers-writer mutex i.e. several threads could share its ownership to read some data while
+// only one thread at a time could own it to write them. Note that C++11 has no shared mutex so
+// the shared ownership is then exclusive.
+#if defined(OCIO_HAS_SHARED_MUTEX)
+
+typedef std::shared_timed_mutex SharedMutex;
+
+#else
+
+class SharedMutex : public Mutex
+{
+public:
+    void lock_shared() { lock(); }
+    void unlock_shared() { unlock(); }
+};
+
+#endif
+
+// Lock guards for the exclusive and the shared ownerships of a SharedMutex.
+typedef std::lock_guard<SharedMutex> AutoExclusiveLock;
+
+class AutoSharedLock
+{
+public:
+    explicit AutoSharedLock(SharedMutex & mutex) : m_mutex(mutex) { m_mutex.lock_shared(); }
+    ~AutoSharedLock() { m_mutex.unlock_shared(); }
+
+    AutoSharedLock(const AutoSharedLock &) = delete;
+    AutoSharedLock & operator=(const AutoSharedLock &) = delete;
+
+private:
+    SharedMutex & m_mutex;
+};
+
 } // namespace OCIO_NAMESPACE
 
 #endif
@@ -25,6 +25,28 @@
 
 namespace OCIO_NAMESPACE
 {
+bool OpCPU::hasPlanarApply() const
+{
+    return false;
+}
+
+void OpCPU::applyPlanar(float * /* rPlane */, float * /* gPlane */, float * /* bPlane */,
+                        float * /* aPlane */, long /* numPixels */) const
+{
+    throw Exception("Op does not implement the planar processing.");
+}
+
+bool OpCPU::hasPackedRGBApply() const
+{
+    return false;
+}
+
+void OpCPU::applyPackedRGB(const void * /* inImg */, void * /* outImg */,
+                           long /* numPixels */) const
+{
+    throw Exception("Op does not implement the packed RGB processing.");
+}
+
 bool OpCPU::isDynamic() const
 {
     return false;
@@ -97,6 +119,11 @@ void OpData::setName(const std::string & name)
     return m_metadata.setName(name.c_str());
 }
 
+size_t OpData::getMemorySize() const
+{
+    return sizeof(OpData);
+}
+
 bool operator==(const OpData & lhs, const OpData & rhs)
 {
     return lhs.equals(rhs);
@@ -456,6 +483,16 @@ std::string OpRcPtrVec::getCacheID() const
     return stream.str();
 }
 
+size_t OpRcPtrVec::getMemorySize() const
+{
+    size_t size = 0;
+    for (ConstOpRcPtr op : m_ops)
+    {
+        size += op->data()->getMemorySize();
+    }
+    return size;
+}
+
 std::ostream& operator<< (std::ostream & os, const Op & op)
 {
     os << op.getInfo();
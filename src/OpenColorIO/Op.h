@@ -45,6 +45,22 @@ public:
     // the 1D LUT CPU Op where the finalization depends on input and output bit depths.
     virtual void apply(const void * inImg, void * outImg, long numPixels) const = 0;
 
+    // Renderers which do not depend on the RGBA interleaving of the pixels could also work
+    // in-place on the separate channel planes of a 32-bit float image, which avoids packing the
+    // planes into a RGBA buffer and back. Such renderers return true and implement applyPlanar().
+    virtual bool hasPlanarApply() const;
+    virtual void applyPlanar(float * rPlane, float * gPlane, float * bPlane, float * aPlane,
+                             long numPixels) const;
+
+    // Renderers which compute the color channels without using the alpha channel could also
+    // process packed RGB 32-bit float pixels (i.e. three floats per pixel, the alpha being 0 like
+    // when a RGB image is packed into a RGBA buffer), which saves the memory bandwidth and the
+    // SIMD lanes used by the alpha. Such renderers return true and implement applyPackedRGB().
+    // As the following renderers also expect a zero alpha, a renderer which could output a
+    // non-zero alpha from a zero one (e.g. a matrix with an alpha offset) must return false.
+    virtual bool hasPackedRGBApply() const;
+    virtual void applyPackedRGB(const void * inImg, void * outImg, long numPixels) const;
+
     virtual bool isDynamic() const;
     virtual bool hasDynamicProperty(DynamicPropertyType type) const;
     virtual DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
@@ -158,6 +174,9 @@ public:
     // This should yield a string of not unreasonable length.
     virtual std::string getCacheID() const = 0;
 
+    // Estimate of the memory used by the op data, in bytes (e.g. mostly its LUT arrays).
+    virtual size_t getMemorySize() const;
+
     // FormatMetadata.
     FormatMetadataImpl & getFormatMetadata() { return m_metadata;  }
     const FormatMetadataImpl & getFormatMetadata() const { return m_metadata; }
@@ -384,6 +403,9 @@ public:
 
     std::string getCacheID() const;
 
+    // Estimate of the memory used by the op data, in bytes.
+    size_t getMemorySize() const;
+
     // The method validates and finalizes each op.
     void finalize();
 
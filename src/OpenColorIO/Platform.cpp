@@ -2,6 +2,7 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <codecvt>
+#include <cstdio>
 #include <locale>
 #include <random>
 #include <sstream>
@@ -14,6 +15,7 @@
 
 #ifndef _WIN32
 #include <strings.h>
+#include <unistd.h>
 #endif
 
 
@@ -262,6 +264,45 @@ void OpenInputFileStream(std::ifstream & stream, const char * filename, std::ios
 #endif
 }
 
+void OpenOutputFileStream(std::ofstream & stream, const char * filename, std::ios_base::openmode mode)
+{
+#if defined(_WIN32) && defined(UNICODE)
+    stream.open(Utf8ToUtf16(filename).c_str(), mode);
+#else
+    stream.open(filename, mode);
+#endif
+}
+
+bool RenameFile(const std::string & from, const std::string & to)
+{
+#if defined(_WIN32) && defined(UNICODE)
+    return MoveFileExW(Utf8ToUtf16(from).c_str(), Utf8ToUtf16(to).c_str(),
+                       MOVEFILE_REPLACE_EXISTING) != 0;
+#elif defined(_WIN32)
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+bool RemoveFile(const std::string & filename)
+{
+#if defined(_WIN32) && defined(UNICODE)
+    return _wremove(Utf8ToUtf16(filename).c_str()) == 0;
+#else
+    return std::remove(filename.c_str()) == 0;
+#endif
+}
+
+unsigned long GetProcessId()
+{
+#ifdef _WIN32
+    return static_cast<unsigned long>(::GetCurrentProcessId());
+#else
+    return static_cast<unsigned long>(::getpid());
+#endif
+}
+
 #if defined(_WIN32) && defined(UNICODE)
 const std::wstring filenameToUTF(const std::string & filename)
 {
@@ -95,6 +95,18 @@ std::ifstream CreateInputFileStream(const char * filename, std::ios_base::openmo
 // Open an input file stream (std::ifstream) using a UTF-8 filename on any platform.
 void OpenInputFileStream(std::ifstream & stream, const char * filename, std::ios_base::openmode mode);
 
+// Open an output file stream (std::ofstream) using a UTF-8 filename on any platform.
+void OpenOutputFileStream(std::ofstream & stream, const char * filename, std::ios_base::openmode mode);
+
+// Rename a file provided as a UTF-8 filename, replacing the destination file if it exists.
+bool RenameFile(const std::string & from, const std::string & to);
+
+// Remove a file provided as a UTF-8 filename.
+bool RemoveFile(const std::string & filename);
+
+// Get the identifier of the current process.
+unsigned long GetProcessId();
+
 #if defined(_WIN32) && defined(UNICODE)
     // Returns the specified filename string as a UTF16 wstring for Windows.
     const std::wstring filenameToUTF(const std::string & str);
@@ -218,6 +218,16 @@ ConstCPUProcessorRcPtr Processor::getOptimizedCPUProcessor(BitDepth inBitDepth,
     return getImpl()->getOptimizedCPUProcessor(inBitDepth, outBitDepth, oFlags);
 }
 
+ConstCPUProcessorRcPtr Processor::getOptimizedCPUProcessor(BitDepth inBitDepth,
+                                                            BitDepth outBitDepth,
+                                                            OptimizationFlags oFlags,
+                                                            unsigned bakeLutSize,
+                                                            float bakeLutMaxError) const
+{
+    return getImpl()->getOptimizedCPUProcessor(inBitDepth, outBitDepth, oFlags,
+                                               bakeLutSize, bakeLutMaxError);
+}
+
 
 // Instantiate the cache with the right types.
 template class ProcessorCache<std::size_t, ProcessorRcPtr>;
@@ -228,6 +238,21 @@ template class ProcessorCache<std::size_t, CPUProcessorRcPtr>;
 Processor::Impl::Impl():
     m_metadata(ProcessorMetadata::Create())
 {
+    // The memory sizes of the cached processors are estimated from their ops. The GPU processors
+    // are estimated from the ops of this processor, but the CPU processors report their own
+    // size as they could hold more (e.g. a baked LUT or integer lookup tables).
+    m_optProcessorCache.setSizeFunction([](const ProcessorRcPtr & proc)
+    {
+        return proc->getImpl()->getMemorySize();
+    });
+    m_gpuProcessorCache.setSizeFunction([this](const GPUProcessorRcPtr &)
+    {
+        return getMemorySize();
+    });
+    m_cpuProcessorCache.setSizeFunction([](const CPUProcessorRcPtr & proc)
+    {
+        return proc->getImpl()->getMemorySize();
+    });
 }
 
 Processor::Impl::~Impl()
@@ -390,26 +415,19 @@ ConstProcessorRcPtr Processor::Impl::getOptimizedProcessor(BitDepth inBitDepth,
 
     if (m_optProcessorCache.isEnabled())
     {
-        AutoMutex guard(m_optProcessorCache.lock());
-
         std::ostringstream oss;
         oss << inBitDepth << outBitDepth << oFlags;
 
         const std::size_t key = std::hash<std::string>{}(oss.str());
 
-        // As the entry is a shared pointer instance, having an empty one means that the entry does
-        // not exist in the cache. So, it provides a fast existence check & access in one call.
-        ProcessorRcPtr & processor = m_optProcessorCache[key];
-        if (!processor)
-        {
-            // Note: Some combinations of bit-depth and opt flags will produce identical Processors.
-            // Duplicates could be identified by computing the Processor cacheID, but that is too
-            // slow to attempt here.
-
-            processor = CreateProcessor(*this, inBitDepth, outBitDepth, oFlags);
-        }
+        // Note: Some combinations of bit-depth and opt flags will produce identical Processors.
+        // Duplicates could be identified by computing the Processor cacheID, but that is too
+        // slow to attempt here.
 
-        return processor;
+        return m_optProcessorCache.getOrCreate(key, [&]()
+        {
+            return CreateProcessor(*this, inBitDepth, outBitDepth, oFlags);
+        });
     }
     else
     {
@@ -489,17 +507,10 @@ ConstGPUProcessorRcPtr Processor::Impl::getGPUProcessor(const OpRcPtrVec & gpuOp
 
     if (m_gpuProcessorCache.isEnabled())
     {
-        AutoMutex guard(m_gpuProcessorCache.lock());
-
-        // As the entry is a shared pointer instance, having an empty one means that the entry does
-        // not exist in the cache. So, it provides a fast existence check & access in one call.
-        GPUProcessorRcPtr & processor = m_gpuProcessorCache[oFlags];
-        if (!processor)
+        return m_gpuProcessorCache.getOrCreate(oFlags, [&]()
         {
-            processor = CreateProcessor(gpuOps, oFlags);
-        }
-        
-        return processor;
+            return CreateProcessor(gpuOps, oFlags);
+        });
     }
     else
     {
@@ -522,18 +533,33 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(OptimizationFla
 ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitDepth,
                                                                  BitDepth outBitDepth,
                                                                  OptimizationFlags oFlags) const
+{
+    return getOptimizedCPUProcessor(inBitDepth, outBitDepth, oFlags,
+                                    DefaultBakeLutSize, DefaultBakeLutMaxError);
+}
+
+ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitDepth,
+                                                                 BitDepth outBitDepth,
+                                                                 OptimizationFlags oFlags,
+                                                                 unsigned bakeLutSize,
+                                                                 float bakeLutMaxError) const
 {
     // Helper method.
     auto CreateProcessor = [](const OpRcPtrVec & ops,
                               BitDepth inBitDepth,
                               BitDepth outBitDepth,
-                              OptimizationFlags oFlags) -> CPUProcessorRcPtr
+                              OptimizationFlags oFlags,
+                              unsigned bakeLutSize,
+                              float bakeLutMaxError) -> CPUProcessorRcPtr
     {
         CPUProcessorRcPtr cpu = CPUProcessorRcPtr(new CPUProcessor(), &CPUProcessor::deleter);
-        cpu->getImpl()->finalize(ops, inBitDepth, outBitDepth, oFlags);
+        cpu->getImpl()->finalize(ops, inBitDepth, outBitDepth, oFlags,
+                                 bakeLutSize, bakeLutMaxError);
         return cpu;
     };
 
+    CheckBakeLutParams(bakeLutSize, bakeLutMaxError);
+
     oFlags = EnvironmentOverride(oFlags);
 
     const bool shareDynamicProperties 
@@ -543,26 +569,21 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitD
 
     if (m_cpuProcessorCache.isEnabled() && useCache)
     {
-        AutoMutex guard(m_cpuProcessorCache.lock());
-
         std::ostringstream oss;
-        oss << inBitDepth << outBitDepth << oFlags;
+        oss << inBitDepth << outBitDepth << oFlags << bakeLutSize << bakeLutMaxError;
 
         const std::size_t key = std::hash<std::string>{}(oss.str());
 
-        // As the entry is a shared pointer instance, having an empty one means that the entry does
-        // not exist in the cache. So, it provides a fast existence check & access in one call.
-        CPUProcessorRcPtr & processor = m_cpuProcessorCache[key];
-        if (!processor)
+        return m_cpuProcessorCache.getOrCreate(key, [&]()
         {
-            processor = CreateProcessor(m_ops, inBitDepth, outBitDepth, oFlags);
-        }
-        
-        return processor;
+            return CreateProcessor(m_ops, inBitDepth, outBitDepth, oFlags,
+                                   bakeLutSize, bakeLutMaxError);
+        });
     }
     else
     {
-        return CreateProcessor(m_ops, inBitDepth, outBitDepth, oFlags);
+        return CreateProcessor(m_ops, inBitDepth, outBitDepth, oFlags,
+                               bakeLutSize, bakeLutMaxError);
     }
 }
 
@@ -56,6 +56,9 @@ public:
 
     const char * getCacheID() const;
 
+    // Estimate of the memory used by the processor ops, in bytes.
+    size_t getMemorySize() const { return m_ops.getMemorySize(); }
+
     GroupTransformRcPtr createGroupTransform() const;
 
     ConstProcessorRcPtr getOptimizedProcessor(OptimizationFlags oFlags) const;
@@ -84,6 +87,14 @@ public:
                                                     BitDepth outBitDepth,
                                                     OptimizationFlags oFlags) const;
 
+    // Same as above but with the grid size & maximum error of the OPTIMIZATION_BAKE_LUT
+    // optimization.
+    ConstCPUProcessorRcPtr getOptimizedCPUProcessor(BitDepth inBitDepth,
+                                                    BitDepth outBitDepth,
+                                                    OptimizationFlags oFlags,
+                                                    unsigned bakeLutSize,
+                                                    float bakeLutMaxError) const;
+
     // Enable or disable the internal caches.
     void setProcessorCacheFlags(ProcessorCacheFlags flags) noexcept;
 
@@ -519,6 +519,38 @@ inline float sseAtan2(const float y, const float x)
     return res;
 }
 
+// Cube root function in SSE version 2
+//
+// Algorithm Explanation:
+//
+// The initial estimate is obtained by dividing the float bits (interpreted as an integer)
+// by three, which divides the exponent by three, and then adding back two thirds of the
+// exponent bias. The estimate is within 4% of the cube root and it is then refined using
+// three Newton-Raphson iterations:
+//
+//   y = y - (y - x / y^2) / 3
+//
+// which gives results within one or two ULPs of the precise cube root. The input values
+// must be positive and normalized.
+inline __m128 sseCbrt(const __m128 x)
+{
+    // There is no integer division so the float conversion is used to divide the bits.
+    const __m128 bits = _mm_cvtepi32_ps(_mm_castps_si128(x));
+    __m128i est = _mm_cvttps_epi32(_mm_mul_ps(bits, _mm_set1_ps(1.0f / 3.0f)));
+    est = _mm_add_epi32(est, _mm_set1_epi32(0x2a514067));
+
+    const __m128 one_third = _mm_set1_ps(1.0f / 3.0f);
+
+    __m128 y = _mm_castsi128_ps(est);
+    for (int i = 0; i < 3; ++i)
+    {
+        const __m128 delta = _mm_sub_ps(y, _mm_div_ps(x, _mm_mul_ps(y, y)));
+        y = _mm_sub_ps(y, _mm_mul_ps(delta, one_third));
+    }
+
+    return y;
+}
+
 static const __m128 E_1_PI = _mm_set1_ps( (float) 0.31830988618379067153776752674503 );
 
 // Helper function that computes the cosine of an angle, and that also returns some
@@ -642,6 +674,44 @@ inline void sseSinCos(const float x, float& sin_x, float& cos_x)
     sin_x = buf[1];
 }
 
+// Packed RGB pixels (i.e. three floats per pixel) are processed by groups of four pixels held
+// in three SSE registers i.e. (r0, g0, b0, r1), (g1, b1, r2, g2) and (b2, r3, g3, b3).
+
+// Arrange the per channel values rgb[3] like the channels of the SSE register reg (i.e. 0, 1
+// or 2) of a group of four packed RGB pixels.
+inline __m128 sseRGBChannels(const float * rgb, int reg)
+{
+    return _mm_setr_ps(rgb[reg % 3], rgb[(reg + 1) % 3], rgb[(reg + 2) % 3], rgb[reg % 3]);
+}
+
+// Convert a group of four packed RGB pixels into one register per channel.
+inline void sseDeinterleaveRGB(const __m128 x0, const __m128 x1, const __m128 x2,
+                               __m128 & r, __m128 & g, __m128 & b)
+{
+    r = _mm_shuffle_ps(x0, _mm_shuffle_ps(x1, x2, _MM_SHUFFLE(0, 1, 0, 2)),
+                       _MM_SHUFFLE(2, 0, 3, 0));
+    g = _mm_shuffle_ps(_mm_shuffle_ps(x0, x1, _MM_SHUFFLE(0, 0, 1, 1)),
+                       _mm_shuffle_ps(x1, x2, _MM_SHUFFLE(2, 2, 3, 3)),
+                       _MM_SHUFFLE(2, 0, 2, 0));
+    b = _mm_shuffle_ps(_mm_shuffle_ps(x0, x1, _MM_SHUFFLE(1, 1, 2, 2)), x2,
+                       _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+// Convert one register per channel into a group of four packed RGB pixels.
+inline void sseInterleaveRGB(const __m128 r, const __m128 g, const __m128 b,
+                             __m128 & x0, __m128 & x1, __m128 & x2)
+{
+    x0 = _mm_shuffle_ps(_mm_shuffle_ps(r, g, _MM_SHUFFLE(0, 0, 0, 0)),
+                        _mm_shuffle_ps(b, r, _MM_SHUFFLE(1, 1, 0, 0)),
+                        _MM_SHUFFLE(2, 0, 2, 0));
+    x1 = _mm_shuffle_ps(_mm_shuffle_ps(g, b, _MM_SHUFFLE(1, 1, 1, 1)),
+                        _mm_shuffle_ps(r, g, _MM_SHUFFLE(2, 2, 2, 2)),
+                        _MM_SHUFFLE(2, 0, 2, 0));
+    x2 = _mm_shuffle_ps(_mm_shuffle_ps(b, r, _MM_SHUFFLE(3, 3, 2, 2)),
+                        _mm_shuffle_ps(g, b, _MM_SHUFFLE(3, 3, 3, 3)),
+                        _MM_SHUFFLE(2, 0, 2, 0));
+}
+
 } // namespace OCIO_NAMESPACE
 
 
@@ -6,6 +6,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "ScanlineHelper.h"
 
 
@@ -29,6 +30,26 @@ Optimizations GetOptimizationMode(const GenericImageDesc & imgDesc)
     return optim;
 }
 
+long GetDefaultPixelBlockSize()
+{
+    static const long blockSize = []()
+    {
+        // Assume a 32KB L1 data cache when the size is unknown.
+        const long cacheSize = CPUInfo::instance().l1DataCacheSize > 0
+                                ? long(CPUInfo::instance().l1DataCacheSize) : 32 * 1024;
+
+        // Only use half of the cache for the RGBA F32 buffer to leave room for the
+        // bit-depth buffers and the op parameters (e.g. LUTs).
+        constexpr long pixelSize = 4 * sizeof(float);
+        const long numPixels = cacheSize / 2 / pixelSize;
+
+        // Keep a multiple of the SIMD register widths.
+        return std::min(std::max(numPixels / 64 * 64, 256L), 8192L);
+    }();
+
+    return blockSize;
+}
+
 
 template<typename InType, typename OutType>
 GenericScanlineHelper<InType, OutType>::GenericScanlineHelper(BitDepth inputBitDepth,
@@ -42,7 +63,12 @@ GenericScanlineHelper<InType, OutType>::GenericScanlineHelper(BitDepth inputBitD
     ,   m_outBitDepthOp(outBitDepthOp)
     ,   m_inOptimizedMode(NO_OPTIMIZATION)
     ,   m_outOptimizedMode(NO_OPTIMIZATION)
+    ,   m_blockSize(GetDefaultPixelBlockSize())
+    ,   m_pendingBlockSize(m_blockSize)
+    ,   m_numPixels(0)
+    ,   m_xIndex(0)
     ,   m_yIndex(0)
+    ,   m_yEnd(0)
     ,   m_useDstBuffer(false)
 {
 }
@@ -50,8 +76,6 @@ GenericScanlineHelper<InType, OutType>::GenericScanlineHelper(BitDepth inputBitD
 template<typename InType, typename OutType>
 void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, const ImageDesc & dstImg)
 {
-    m_yIndex = 0;
-
     m_srcImg.init(srcImg, m_inputBitDepth, m_inBitDepthOp);
     m_dstImg.init(dstImg, m_outputBitDepth, m_outBitDepthOp);
 
@@ -60,6 +84,10 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, cons
         throw Exception("Dimension inconsistency between source and destination image buffers.");
     }
 
+    m_xIndex = 0;
+    m_yIndex = 0;
+    m_yEnd   = m_dstImg.m_height;
+
     m_inOptimizedMode  = GetOptimizationMode(m_srcImg);
     m_outOptimizedMode = GetOptimizationMode(m_dstImg);
 
@@ -67,15 +95,17 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, cons
     m_useDstBuffer
         = (m_outOptimizedMode & PACKED_FLOAT_OPTIMIZATION) == PACKED_FLOAT_OPTIMIZATION;
 
+    // The buffers only hold one block of pixels.
+    m_blockSize = m_pendingBlockSize;
+    const long bufferSize = 4 * std::min(m_dstImg.m_width, m_blockSize);
+
     if( (m_inOptimizedMode & PACKED_OPTIMIZATION) != PACKED_OPTIMIZATION)
     {
-        const long bufferSize = 4 * m_dstImg.m_width;
         m_inBitDepthBuffer.resize(bufferSize);
     }
 
     if(!m_useDstBuffer)
     {
-        const long bufferSize = 4 * m_dstImg.m_width;
         m_rgbaFloatBuffer.resize(bufferSize);
         m_outBitDepthBuffer.resize(bufferSize);
     }
@@ -84,24 +114,27 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, cons
 template<typename InType, typename OutType>
 void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
 {
-    m_yIndex = 0;
-
     m_srcImg.init(img, m_inputBitDepth, m_inBitDepthOp);
     m_dstImg.init(img, m_outputBitDepth, m_outBitDepthOp);
 
+    m_xIndex = 0;
+    m_yIndex = 0;
+    m_yEnd   = m_dstImg.m_height;
+
     m_inOptimizedMode  = GetOptimizationMode(m_srcImg);
     m_outOptimizedMode = m_inOptimizedMode;
 
+    m_blockSize = m_pendingBlockSize;
+
     // Can the output buffer be used as the internal RGBA F32 buffer?
     m_useDstBuffer
         = (m_outOptimizedMode & PACKED_FLOAT_OPTIMIZATION) == PACKED_FLOAT_OPTIMIZATION;
 
     if(!m_useDstBuffer)
     {
-        // TODO: Re-use memory from thread-safe memory pool, rather
-        // than doing a new allocation each time.
-
-        const long bufferSize = 4 * m_dstImg.m_width;
+        // Note that the buffers only grow so a re-used helper (refer to ScanlineHelperPool)
+        // does not allocate when processing images of the same or a smaller width.
+        const long bufferSize = 4 * std::min(m_dstImg.m_width, m_blockSize);
 
         m_rgbaFloatBuffer.resize(bufferSize);
         m_inBitDepthBuffer.resize(bufferSize);
@@ -109,6 +142,31 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
     }
 }
 
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::setScanlineRange(long yBegin, long yEnd)
+{
+    if(yBegin<0 || yBegin>yEnd || yEnd>m_dstImg.m_height)
+    {
+        throw Exception("Invalid scanline range.");
+    }
+
+    m_xIndex = 0;
+    m_yIndex = yBegin;
+    m_yEnd   = yEnd;
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::setPixelBlockSize(long numPixels)
+{
+    if(numPixels<=0)
+    {
+        throw Exception("Invalid pixel block size.");
+    }
+
+    // The buffers are sized by init() so the new size cannot be used before the next init().
+    m_pendingBlockSize = numPixels;
+}
+
 template<typename InType, typename OutType>
 GenericScanlineHelper<InType, OutType>::~GenericScanlineHelper()
 {
@@ -118,22 +176,28 @@ GenericScanlineHelper<InType, OutType>::~GenericScanlineHelper()
 template<typename InType, typename OutType>
 void GenericScanlineHelper<InType, OutType>::prepRGBAScanline(float** buffer, long & numPixels)
 {
-    // Note that only a line-by-line processing is done on the image buffer.
+    // Note that the image buffer is processed line-by-line, and each line block-by-block.
 
-    if(m_yIndex >= m_dstImg.m_height)
+    if(m_yIndex >= m_yEnd)
     {
         numPixels = 0;
         return;
     }
 
-    *buffer = m_useDstBuffer ? (float*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex)
+    m_numPixels = std::min(m_blockSize, m_dstImg.m_width - m_xIndex);
+
+    *buffer = m_useDstBuffer ? (float*)(m_dstImg.m_rData
+                                        + m_dstImg.m_yStrideBytes * m_yIndex
+                                        + m_dstImg.m_xStrideBytes * m_xIndex)
                              : &m_rgbaFloatBuffer[0];
 
     if((m_inOptimizedMode&PACKED_OPTIMIZATION)==PACKED_OPTIMIZATION)
     {
-        const void * inBuffer = (void*)(m_srcImg.m_rData + m_srcImg.m_yStrideBytes * m_yIndex);
+        const void * inBuffer = (void*)(m_srcImg.m_rData
+                                        + m_srcImg.m_yStrideBytes * m_yIndex
+                                        + m_srcImg.m_xStrideBytes * m_xIndex);
 
-        m_srcImg.m_bitDepthOp->apply(inBuffer, *buffer, m_dstImg.m_width);
+        m_srcImg.m_bitDepthOp->apply(inBuffer, *buffer, m_numPixels);
     }
     else
     {
@@ -142,26 +206,28 @@ void GenericScanlineHelper<InType, OutType>::prepRGBAScanline(float** buffer, lo
         Generic<InType>::PackRGBAFromImageDesc(m_srcImg,
                                                &m_inBitDepthBuffer[0],
                                                *buffer,
-                                               m_dstImg.m_width,
-                                               m_yIndex * m_dstImg.m_width);
+                                               m_numPixels,
+                                               m_yIndex * m_dstImg.m_width + m_xIndex);
     }
 
-    numPixels = m_dstImg.m_width;
+    numPixels = m_numPixels;
 }
 
 // Write back the result of our work, from the scanline to our destination image.
 template<typename InType, typename OutType>
 void GenericScanlineHelper<InType, OutType>::finishRGBAScanline()
 {
-    // Note that only a line-by-line processing is done on the image buffer.
+    // Note that the image buffer is processed line-by-line, and each line block-by-block.
 
     if((m_outOptimizedMode&PACKED_OPTIMIZATION)==PACKED_OPTIMIZATION)
     {
-        void * out = (void*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex);
+        void * out = (void*)(m_dstImg.m_rData
+                             + m_dstImg.m_yStrideBytes * m_yIndex
+                             + m_dstImg.m_xStrideBytes * m_xIndex);
 
         const void * in  = m_useDstBuffer ? out : (void*)&m_rgbaFloatBuffer[0];
 
-        m_dstImg.m_bitDepthOp->apply(in, out, m_dstImg.m_width);
+        m_dstImg.m_bitDepthOp->apply(in, out, m_numPixels);
     }
     else
     {
@@ -169,11 +235,16 @@ void GenericScanlineHelper<InType, OutType>::finishRGBAScanline()
         Generic<OutType>::UnpackRGBAToImageDesc(m_dstImg,
                                                 &m_rgbaFloatBuffer[0],
                                                 &m_outBitDepthBuffer[0],
-                                                m_dstImg.m_width,
-                                                m_yIndex * m_dstImg.m_width);
+                                                m_numPixels,
+                                                m_yIndex * m_dstImg.m_width + m_xIndex);
     }
 
-    ++m_yIndex;
+    m_xIndex += m_numPixels;
+    if(m_xIndex >= m_dstImg.m_width)
+    {
+        m_xIndex = 0;
+        ++m_yIndex;
+    }
 }
 
 
@@ -24,6 +24,11 @@ enum Optimizations
 
 Optimizations GetOptimizationMode(const GenericImageDesc & imgDesc);
 
+// Default number of pixels processed at once by the CPU ops. All the ops process a block of
+// pixels before moving to the next one so the block size is derived from the L1 data cache size
+// i.e. the intermediate RGBA F32 buffer stays in the cache between the ops.
+long GetDefaultPixelBlockSize();
+
 
 class ScanlineHelper
 {
@@ -37,6 +42,15 @@ public:
     virtual void init(const ImageDesc & srcImg, const ImageDesc & dstImg) = 0;
     virtual void init(const ImageDesc & img) = 0;
 
+    // Restrict the processing to the scanlines [yBegin, yEnd) of the image(s) from the last
+    // init() call. By default, init() selects all the scanlines.
+    virtual void setScanlineRange(long yBegin, long yEnd) = 0;
+
+    // Set the maximum number of pixels returned by prepRGBAScanline() i.e. longer scanlines are
+    // processed by blocks of pixels. The buffers are sized by init() so the new size is only
+    // used from the next init() call.
+    virtual void setPixelBlockSize(long numPixels) = 0;
+
     virtual void prepRGBAScanline(float** buffer, long & numPixels) = 0;
 
     virtual void finishRGBAScanline() = 0;
@@ -56,15 +70,19 @@ public:
     void init(const ImageDesc & srcImg, const ImageDesc & dstImg) override;
     void init(const ImageDesc & img) override;
 
+    void setScanlineRange(long yBegin, long yEnd) override;
+
+    void setPixelBlockSize(long numPixels) override;
+
     ~GenericScanlineHelper() override;
 
-    // Copy from the src image to our scanline, in our preferred
-    // pixel layout. Return the number of pixels to process.
+    // Copy the next block of pixels from the src image to our scanline, in
+    // our preferred pixel layout. Return the number of pixels to process.
 
     void prepRGBAScanline(float** buffer, long & numPixels) override;
 
-    // Write back the result of our work, from the scanline to our
-    // destination image.
+    // Write back the result of our work, from the scanline to the block of
+    // pixels of our destination image.
 
     void finishRGBAScanline() override;
 
@@ -88,8 +106,19 @@ private:
     std::vector<InType> m_inBitDepthBuffer;
     std::vector<OutType> m_outBitDepthBuffer;
 
+    // The maximum number of pixels to process at once.
+    long m_blockSize;
+    // The block size to use from the next init() call.
+    long m_pendingBlockSize;
+    // The number of pixels of the current block.
+    long m_numPixels;
+
+    // The index of the first pixel of the current block in the current line.
+    long m_xIndex;
     // The index of the current line to process.
-    int m_yIndex;
+    long m_yIndex;
+    // The index following the last line to process.
+    long m_yEnd;
 
     // If the destination buffer is packed RGBA F32 it could then be used
     // as the internal processing buffer (i.e. instead of m_rgbaFloatBuffer
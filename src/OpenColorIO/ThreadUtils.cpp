@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Mutex.h"
+#include "ThreadUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+unsigned GetNumWorkerThreads(unsigned requestedThreads)
+{
+    if (requestedThreads == 0)
+    {
+        // Note that hardware_concurrency() could return 0 when the value is not computable.
+        requestedThreads = std::thread::hardware_concurrency();
+    }
+
+    return std::max(requestedThreads, 1u);
+}
+
+void ParallelFor(long numItems, long chunkSize, unsigned numThreads,
+                 const ParallelForFunction & fn)
+{
+    if (numItems <= 0)
+    {
+        return;
+    }
+
+    chunkSize = std::max(chunkSize, 1L);
+
+    const long numChunks = (numItems + chunkSize - 1) / chunkSize;
+
+    numThreads = (unsigned)std::min<long>(GetNumWorkerThreads(numThreads), numChunks);
+
+    std::atomic<long> nextChunk{ 0 };
+    std::atomic<bool> failed{ false };
+
+    Mutex exceptionMutex;
+    std::exception_ptr exception;
+
+    auto worker = [&](unsigned workerIndex)
+    {
+        try
+        {
+            while (!failed)
+            {
+                const long chunk = nextChunk++;
+                if (chunk >= numChunks)
+                {
+                    break;
+                }
+
+                const long begin = chunk * chunkSize;
+                fn(workerIndex, begin, std::min(begin + chunkSize, numItems));
+            }
+        }
+        catch (...)
+        {
+            AutoMutex guard(exceptionMutex);
+            if (!exception)
+            {
+                exception = std::current_exception();
+            }
+            failed = true;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+
+    try
+    {
+        for (unsigned idx = 1; idx < numThreads; ++idx)
+        {
+            threads.emplace_back(worker, idx);
+        }
+    }
+    catch (...)
+    {
+        // Could not start all the requested threads, the started ones and the calling thread
+        // still process all the chunks.
+    }
+
+    // The calling thread is the first worker.
+    worker(0);
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+} // namespace OCIO_NAMESPACE
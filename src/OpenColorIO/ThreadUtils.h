@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_THREADUTILS_H
+#define INCLUDED_OCIO_THREADUTILS_H
+
+#include <functional>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+/** For internal use only */
+
+namespace OCIO_NAMESPACE
+{
+
+// Return the number of worker threads to use for a requested thread count, where 0 means
+// 'use all the hardware threads'. The result is always at least 1.
+unsigned GetNumWorkerThreads(unsigned requestedThreads);
+
+// Signature of the function processing the items [begin, end). The worker index is in
+// [0, numThreads) and is unique among the concurrently running workers, so it could be used to
+// index per-thread resources.
+typedef std::function<void(unsigned workerIndex, long begin, long end)> ParallelForFunction;
+
+// Process the items [0, numItems) using up to numThreads threads (i.e. the calling thread is one
+// of them). The items are split into chunks of chunkSize items which are claimed on demand by
+// the workers, so a worker finishing early keeps picking up the remaining chunks instead of
+// waiting for the slower ones. If a worker throws, the remaining chunks are skipped and the first
+// exception is rethrown on the calling thread once all the workers are done.
+void ParallelFor(long numItems, long chunkSize, unsigned numThreads,
+                 const ParallelForFunction & fn);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_THREADUTILS_H
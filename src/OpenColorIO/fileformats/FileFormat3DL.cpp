@@ -9,6 +9,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "DiskCache.h"
 #include "fileformats/FileFormatUtils.h"
 #include "MathUtils.h"
 #include "ops/lut1d/Lut1DOp.h"
@@ -84,6 +85,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(*this) + GetMemorySize(lut1D) + GetMemorySize(lut3D);
+    }
+
     Lut1DOpDataRcPtr lut1D;
     Lut3DOpDataRcPtr lut3D;
 };
@@ -115,6 +121,11 @@ public:
                         CachedFileRcPtr untypedCachedFile,
                         const FileTransform & fileTransform,
                         TransformDirection dir) const override;
+
+    bool writeCachedFile(DiskCacheWriter & writer,
+                         const CachedFileRcPtr & untypedCachedFile) const override;
+
+    CachedFileRcPtr readCachedFile(DiskCacheReader & reader) const override;
 };
 
 
@@ -634,6 +645,36 @@ LocalFileFormat::buildFileOps(OpRcPtrVec & ops,
         break;
     }
 }
+
+bool LocalFileFormat::writeCachedFile(DiskCacheWriter & writer,
+                                      const CachedFileRcPtr & untypedCachedFile) const
+{
+    LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+    if (!cachedFile || (!cachedFile->lut1D && !cachedFile->lut3D))
+    {
+        return false;
+    }
+
+    writer.writeLut1D(cachedFile->lut1D);
+    writer.writeLut3D(cachedFile->lut3D);
+
+    return true;
+}
+
+CachedFileRcPtr LocalFileFormat::readCachedFile(DiskCacheReader & reader) const
+{
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+
+    cachedFile->lut1D = reader.readLut1D();
+    cachedFile->lut3D = reader.readLut3D();
+
+    if (!cachedFile->lut1D && !cachedFile->lut3D)
+    {
+        throw Exception("The file cache entry has no LUT.");
+    }
+
+    return cachedFile;
+}
 }
 
 FileFormat * CreateFileFormat3DL()
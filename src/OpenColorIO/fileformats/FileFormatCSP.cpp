@@ -297,6 +297,11 @@ public:
     }
     ~CachedFileCSP() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(*this) + GetMemorySize(prelut) + GetMemorySize(lut1D) + GetMemorySize(lut3D);
+    }
+
     std::string metadata;
 
     double prelut_from_min[3] = { 0.0, 0.0, 0.0 };
@@ -107,6 +107,19 @@ public:
     };
     ~LocalCachedFile() {};
 
+    size_t getMemorySize() const override
+    {
+        size_t size = sizeof(*this);
+        if (m_transform)
+        {
+            for (const auto & op : m_transform->getOps())
+            {
+                size += GetMemorySize(op);
+            }
+        }
+        return size;
+    }
+
     CTFReaderTransformPtr m_transform;
     std::string m_filePath;
 
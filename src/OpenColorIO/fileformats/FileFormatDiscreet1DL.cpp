@@ -629,6 +629,11 @@ public:
     };
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(*this) + GetMemorySize(lut1D);
+    }
+
     Lut1DOpDataRcPtr lut1D;
 };
 
@@ -227,6 +227,11 @@ public:
     }
     ~CachedFileHDL() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(*this) + GetMemorySize(lut1D) + GetMemorySize(lut3D);
+    }
+
     void setLUT1D(const std::vector<float> & values, Interpolation interp)
     {
         auto lutSize = static_cast<unsigned long>(values.size());
@@ -40,6 +40,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(*this) + GetMemorySize(lut);
+    }
+
     // The profile description.
     std::string mProfileDescription;
 
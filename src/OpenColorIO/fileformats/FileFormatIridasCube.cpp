@@ -8,6 +8,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "DiskCache.h"
 #include "fileformats/FileFormatUtils.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
@@ -77,6 +78,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(*this) + GetMemorySize(lut1D) + GetMemorySize(lut3D);
+    }
+
     Lut1DOpDataRcPtr lut1D;
     Lut3DOpDataRcPtr lut3D;
     float domain_min[3]{ 0.0f, 0.0f, 0.0f };
@@ -110,6 +116,11 @@ public:
                         CachedFileRcPtr untypedCachedFile,
                         const FileTransform & fileTransform,
                         TransformDirection dir) const override;
+
+    bool writeCachedFile(DiskCacheWriter & writer,
+                         const CachedFileRcPtr & untypedCachedFile) const override;
+
+    CachedFileRcPtr readCachedFile(DiskCacheReader & reader) const override;
 							  
 private:
     static void ThrowErrorMessage(const std::string & error,
@@ -556,6 +567,40 @@ LocalFileFormat::buildFileOps(OpRcPtrVec & ops,
     }
     }
 }
+
+bool LocalFileFormat::writeCachedFile(DiskCacheWriter & writer,
+                                      const CachedFileRcPtr & untypedCachedFile) const
+{
+    LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+    if (!cachedFile || (!cachedFile->lut1D && !cachedFile->lut3D))
+    {
+        return false;
+    }
+
+    writer.writeLut1D(cachedFile->lut1D);
+    writer.writeLut3D(cachedFile->lut3D);
+    writer.writeFloats(cachedFile->domain_min, 3);
+    writer.writeFloats(cachedFile->domain_max, 3);
+
+    return true;
+}
+
+CachedFileRcPtr LocalFileFormat::readCachedFile(DiskCacheReader & reader) const
+{
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+
+    cachedFile->lut1D = reader.readLut1D();
+    cachedFile->lut3D = reader.readLut3D();
+    reader.readFloats(cachedFile->domain_min, 3);
+    reader.readFloats(cachedFile->domain_max, 3);
+
+    if (!cachedFile->lut1D && !cachedFile->lut3D)
+    {
+        throw Exception("The file cache entry has no LUT.");
+    }
+
+    return cachedFile;
+}
 }
 
 FileFormat * CreateFileFormatIridasCube()
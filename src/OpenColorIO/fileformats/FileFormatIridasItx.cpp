@@ -53,6 +53,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(*this) + GetMemorySize(lut3D);
+    }
+
     Lut3DOpDataRcPtr lut3D;
 };
 
@@ -475,6 +475,11 @@ public:
     LocalCachedFile () = default;
     ~LocalCachedFile()  = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(*this) + GetMemorySize(lut3D);
+    }
+
     Lut3DOpDataRcPtr lut3D;
 };
 
@@ -8,6 +8,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "DiskCache.h"
 #include "fileformats/FileFormatUtils.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
@@ -182,6 +183,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(*this) + GetMemorySize(lut1D) + GetMemorySize(lut3D);
+    }
+
     Lut1DOpDataRcPtr lut1D;
     float range1d_min = 0.0f;
     float range1d_max = 1.0f;
@@ -218,6 +224,11 @@ public:
                         CachedFileRcPtr untypedCachedFile,
                         const FileTransform & fileTransform,
                         TransformDirection dir) const override;
+
+    bool writeCachedFile(DiskCacheWriter & writer,
+                         const CachedFileRcPtr & untypedCachedFile) const override;
+
+    CachedFileRcPtr readCachedFile(DiskCacheReader & reader) const override;
 private:
     static void ThrowErrorMessage(const std::string & error,
         const std::string & fileName,
@@ -778,6 +789,44 @@ LocalFileFormat::buildFileOps(OpRcPtrVec & ops,
     }
     }
 }
+
+bool LocalFileFormat::writeCachedFile(DiskCacheWriter & writer,
+                                      const CachedFileRcPtr & untypedCachedFile) const
+{
+    LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+    if (!cachedFile || (!cachedFile->lut1D && !cachedFile->lut3D))
+    {
+        return false;
+    }
+
+    writer.writeLut1D(cachedFile->lut1D);
+    writer.writeFloat(cachedFile->range1d_min);
+    writer.writeFloat(cachedFile->range1d_max);
+    writer.writeLut3D(cachedFile->lut3D);
+    writer.writeFloat(cachedFile->range3d_min);
+    writer.writeFloat(cachedFile->range3d_max);
+
+    return true;
+}
+
+CachedFileRcPtr LocalFileFormat::readCachedFile(DiskCacheReader & reader) const
+{
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+
+    cachedFile->lut1D = reader.readLut1D();
+    cachedFile->range1d_min = reader.readFloat();
+    cachedFile->range1d_max = reader.readFloat();
+    cachedFile->lut3D = reader.readLut3D();
+    cachedFile->range3d_min = reader.readFloat();
+    cachedFile->range3d_max = reader.readFloat();
+
+    if (!cachedFile->lut1D && !cachedFile->lut3D)
+    {
+        throw Exception("The file cache entry has no LUT.");
+    }
+
+    return cachedFile;
+}
 }
 
 FileFormat * CreateFileFormatResolveCube()
@@ -8,6 +8,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "DiskCache.h"
 #include "fileformats/FileFormatUtils.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/matrix/MatrixOp.h"
@@ -43,6 +44,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(*this) + GetMemorySize(lut);
+    }
+
     Lut1DOpDataRcPtr lut;
     float from_min = 0.0f;
     float from_max = 1.0f;
@@ -73,6 +79,11 @@ public:
                         const FileTransform & fileTransform,
                         TransformDirection dir) const override;
 
+    bool writeCachedFile(DiskCacheWriter & writer,
+                         const CachedFileRcPtr & untypedCachedFile) const override;
+
+    CachedFileRcPtr readCachedFile(DiskCacheReader & reader) const override;
+
 private:
     static void ThrowErrorMessage(const std::string & error,
                                   int line,
@@ -451,6 +462,38 @@ void LocalFileFormat::ThrowErrorMessage(const std::string & error,
 
     throw Exception(os.str().c_str());
 }
+
+bool LocalFileFormat::writeCachedFile(DiskCacheWriter & writer,
+                                      const CachedFileRcPtr & untypedCachedFile) const
+{
+    LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+    if (!cachedFile || !cachedFile->lut)
+    {
+        return false;
+    }
+
+    writer.writeLut1D(cachedFile->lut);
+    writer.writeFloat(cachedFile->from_min);
+    writer.writeFloat(cachedFile->from_max);
+
+    return true;
+}
+
+CachedFileRcPtr LocalFileFormat::readCachedFile(DiskCacheReader & reader) const
+{
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+
+    cachedFile->lut = reader.readLut1D();
+    cachedFile->from_min = reader.readFloat();
+    cachedFile->from_max = reader.readFloat();
+
+    if (!cachedFile->lut)
+    {
+        throw Exception("The file cache entry has no LUT.");
+    }
+
+    return cachedFile;
+}
 }
 
 FileFormat * CreateFileFormatSpi1D()
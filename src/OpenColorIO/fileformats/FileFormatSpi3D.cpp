@@ -7,6 +7,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "DiskCache.h"
 #include "fileformats/FileFormatUtils.h"
 #include "ops/lut3d/Lut3DOp.h"
 #include "Platform.h"
@@ -40,6 +41,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(*this) + GetMemorySize(lut);
+    }
+
     Lut3DOpDataRcPtr lut;
 };
 
@@ -67,6 +73,11 @@ public:
                         CachedFileRcPtr untypedCachedFile,
                         const FileTransform & fileTransform,
                         TransformDirection dir) const override;
+
+    bool writeCachedFile(DiskCacheWriter & writer,
+                         const CachedFileRcPtr & untypedCachedFile) const override;
+
+    CachedFileRcPtr readCachedFile(DiskCacheReader & reader) const override;
 };
 
 void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
@@ -330,6 +341,34 @@ void LocalFileFormat::buildFileOps(OpRcPtrVec & ops,
 
     CreateLut3DOp(ops, lut, newDir);
 }
+
+bool LocalFileFormat::writeCachedFile(DiskCacheWriter & writer,
+                                      const CachedFileRcPtr & untypedCachedFile) const
+{
+    LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+    if (!cachedFile || !cachedFile->lut)
+    {
+        return false;
+    }
+
+    writer.writeLut3D(cachedFile->lut);
+
+    return true;
+}
+
+CachedFileRcPtr LocalFileFormat::readCachedFile(DiskCacheReader & reader) const
+{
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+
+    cachedFile->lut = reader.readLut3D();
+
+    if (!cachedFile->lut)
+    {
+        throw Exception("The file cache entry has no LUT.");
+    }
+
+    return cachedFile;
+}
 }
 
 FileFormat * CreateFileFormatSpi3D()
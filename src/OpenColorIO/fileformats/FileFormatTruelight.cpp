@@ -44,6 +44,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(*this) + GetMemorySize(lut1D) + GetMemorySize(lut3D);
+    }
+
     Lut1DOpDataRcPtr lut1D;
     Lut3DOpDataRcPtr lut3D;
 };
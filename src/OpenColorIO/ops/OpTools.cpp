@@ -1,13 +1,129 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "ops/lut1d/Lut1DOp.h"
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOp.h"
+#include "ops/lut3d/Lut3DOpData.h"
 #include "ops/OpTools.h"
+#include "ThreadUtils.h"
 
 namespace OCIO_NAMESPACE
 {
+namespace
+{
+
+// The shaper is a log2 curve, offset to stay finite (and almost linear) close to zero, which
+// maps [0, 2^SHAPER_MAX_STOPS - 2^SHAPER_MIN_STOPS] to [0, 1].
+constexpr float SHAPER_MIN_STOPS = -10.0f;
+constexpr float SHAPER_MAX_STOPS = 14.0f;
+
+inline float ShaperFwd(float in)
+{
+    // Negative values & NaNs are mapped to zero.
+    if (!(in > 0.0f))
+    {
+        return 0.0f;
+    }
+
+    const float out = (std::log2(in + std::exp2(SHAPER_MIN_STOPS)) - SHAPER_MIN_STOPS)
+                          / (SHAPER_MAX_STOPS - SHAPER_MIN_STOPS);
+    return std::min(out, 1.0f);
+}
+
+inline float ShaperInv(float in)
+{
+    return std::exp2(in * (SHAPER_MAX_STOPS - SHAPER_MIN_STOPS) + SHAPER_MIN_STOPS)
+               - std::exp2(SHAPER_MIN_STOPS);
+}
+
+// Only ops which are not already cheap lookups (or simple arithmetic) are worth baking.
+bool IsWorthBaking(const OpRcPtrVec & ops)
+{
+    if (ops.size() > 2)
+    {
+        return true;
+    }
+
+    for (ConstOpRcPtr op : ops)
+    {
+        switch (op->data()->getType())
+        {
+            case OpData::Lut1DType:
+            case OpData::Lut3DType:
+            case OpData::MatrixType:
+            case OpData::RangeType:
+                break;
+
+            case OpData::CDLType:
+            case OpData::ExponentType:
+            case OpData::ExposureContrastType:
+            case OpData::FixedFunctionType:
+            case OpData::GammaType:
+            case OpData::GradingPrimaryType:
+            case OpData::GradingRGBCurveType:
+            case OpData::GradingToneType:
+            case OpData::LogType:
+            case OpData::ReferenceType:
+            case OpData::NoOpType:
+                return true;
+        }
+    }
+
+    return false;
+}
+
+ConstOpCPURcPtrVec GetCPUOps(const OpRcPtrVec & ops, bool fastLogExpPow)
+{
+    ConstOpCPURcPtrVec cpuOps;
+    for (const auto & op : ops)
+    {
+        cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+    }
+    return cpuOps;
+}
+
+// Apply in-place the CPU ops to the RGBA pixels.
+void ApplyCPUOps(const ConstOpCPURcPtrVec & cpuOps, float * rgba, long numPixels)
+{
+    static constexpr long chunkSize = 4096;
+
+    ParallelFor(numPixels, chunkSize, 0, [&](unsigned, long begin, long end)
+    {
+        for (const auto & cpuOp : cpuOps)
+        {
+            cpuOp->apply(rgba + 4 * begin, rgba + 4 * begin, end - begin);
+        }
+    });
+}
+
+// True when the baked RGBA values match the expected ones i.e. the error is the absolute
+// difference for values below 1.0 and the relative one otherwise.
+bool IsBakeAccurate(const std::vector<float> & expected,
+                    const std::vector<float> & baked,
+                    float maxError)
+{
+    for (size_t idx = 0; idx < expected.size(); ++idx)
+    {
+        const float val = expected[idx];
+        if (!std::isfinite(val)
+            || std::abs(val - baked[idx]) > maxError * std::max(1.0f, std::abs(val)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // anon.
+
 void EvalTransform(const float * in,
                     float * out,
                     long numPixels,
@@ -30,10 +146,9 @@ void EvalTransform(const float * in,
     ops.finalize();
     ops.optimize(OPTIMIZATION_NONE);
 
-    for (OpRcPtrVec::size_type i = 0, size = ops.size(); i<size; ++i)
-    {
-        ops[i]->apply(&tmp[0], &tmp[0], numPixels);
-    }
+    // Note that the CPU renderers are only created once (i.e. an inverse LUT renderer could be
+    // expensive to build) and then shared by the threads processing the pixels.
+    ApplyCPUOps(GetCPUOps(ops, false), tmp.data(), numPixels);
 
     float * result = out;
     for (long idx = 0; idx<numPixels; ++idx)
@@ -45,4 +160,156 @@ void EvalTransform(const float * in,
         result += 3;
     }
 }
+
+bool BakeOpsToLut(OpRcPtrVec & ops,
+                  BitDepth inBitDepth,
+                  unsigned long gridSize,
+                  float maxError,
+                  bool fastLogExpPow)
+{
+    if (ops.empty() || ops.isDynamic() || !IsWorthBaking(ops))
+    {
+        return false;
+    }
+
+    const bool useShaper = IsFloatBitDepth(inBitDepth);
+
+    const ConstOpCPURcPtrVec cpuOps = GetCPUOps(ops, fastLogExpPow);
+
+    // Render the 3D LUT nodes (i.e. mapped back to the linear domain) through the ops.
+
+    auto lut3D = std::make_shared<Lut3DOpData>(INTERP_TETRAHEDRAL, gridSize);
+
+    Array::Values & nodes = lut3D->getArray().getValues();
+    const long numNodes = (long)(nodes.size() / 3);
+
+    std::vector<float> rgba(numNodes * 4);
+    for (long idx = 0; idx < numNodes; ++idx)
+    {
+        for (long channel = 0; channel < 3; ++channel)
+        {
+            const float val = nodes[3 * idx + channel];
+            rgba[4 * idx + channel] = useShaper ? ShaperInv(val) : val;
+        }
+        rgba[4 * idx + 3] = 1.0f;
+    }
+
+    ApplyCPUOps(cpuOps, rgba.data(), numNodes);
+
+    for (long idx = 0; idx < numNodes; ++idx)
+    {
+        for (long channel = 0; channel < 3; ++channel)
+        {
+            const float val = rgba[4 * idx + channel];
+            if (!std::isfinite(val))
+            {
+                return false;
+            }
+            nodes[3 * idx + channel] = val;
+        }
+    }
+
+    OpRcPtrVec bakedOps;
+
+    if (useShaper)
+    {
+        auto shaper = std::make_shared<Lut1DOpData>(Lut1DOpData::LUT_INPUT_HALF_CODE, 65536, true);
+
+        for (auto & val : shaper->getArray().getValues())
+        {
+            val = ShaperFwd(val);
+        }
+
+        CreateLut1DOp(bakedOps, shaper, TRANSFORM_DIR_FORWARD);
+    }
+
+    CreateLut3DOp(bakedOps, lut3D, TRANSFORM_DIR_FORWARD);
+
+    bakedOps.finalize();
+
+    // Verify the error at the center of all the 3D LUT cells (i.e. the farthest positions from
+    // the nodes), one slice at a time. The alpha is set to a non-default value to detect the ops
+    // altering it as the LUTs only pass it through.
+
+    const unsigned long numCells = gridSize - 1;
+    const long numPixels = (long)(numCells * numCells);
+
+    std::vector<float> positions(numCells);
+    for (unsigned long idx = 0; idx < numCells; ++idx)
+    {
+        const float pos = (float(idx) + 0.5f) / float(numCells);
+        positions[idx] = useShaper ? ShaperInv(pos) : pos;
+    }
+
+    const ConstOpCPURcPtrVec bakedCPUOps = GetCPUOps(bakedOps, false);
+
+    std::vector<float> expected(numPixels * 4);
+    std::vector<float> baked(numPixels * 4);
+
+    for (unsigned long r = 0; r < numCells; ++r)
+    {
+        float * pixel = expected.data();
+        for (unsigned long g = 0; g < numCells; ++g)
+        {
+            for (unsigned long b = 0; b < numCells; ++b)
+            {
+                pixel[0] = positions[r];
+                pixel[1] = positions[g];
+                pixel[2] = positions[b];
+                pixel[3] = 0.5f;
+                pixel += 4;
+            }
+        }
+
+        baked = expected;
+
+        ApplyCPUOps(cpuOps, expected.data(), numPixels);
+        ApplyCPUOps(bakedCPUOps, baked.data(), numPixels);
+
+        if (!IsBakeAccurate(expected, baked, maxError))
+        {
+            return false;
+        }
+    }
+
+    if (useShaper)
+    {
+        // The shaper clamps the negative values and the values above its domain so also verify
+        // such values, combined with some values of the domain. The bake is then only kept if
+        // the ops are not altered by the clamping (e.g. the ops already clamp these values).
+
+        const float domainMax = ShaperInv(1.0f);
+        const std::vector<float> values{ -1.0f, -0.01f, 2.0f * domainMax, HALF_MAX,
+                                         positions.front(), positions[numCells / 2],
+                                         positions.back() };
+
+        expected.clear();
+        for (float r : values)
+        {
+            for (float g : values)
+            {
+                for (float b : values)
+                {
+                    expected.insert(expected.end(), { r, g, b, 0.5f });
+                }
+            }
+        }
+
+        baked = expected;
+
+        const long numValues = (long)(expected.size() / 4);
+        ApplyCPUOps(cpuOps, expected.data(), numValues);
+        ApplyCPUOps(bakedCPUOps, baked.data(), numValues);
+
+        if (!IsBakeAccurate(expected, baked, maxError))
+        {
+            return false;
+        }
+    }
+
+    ops = bakedOps;
+
+    return true;
+}
+
 } // namespace OCIO_NAMESPACE
@@ -14,10 +14,23 @@
 namespace OCIO_NAMESPACE
 {
 
+// Render the RGB pixels through the ops. The pixels are processed by chunks using all the
+// hardware threads.
 void EvalTransform(const float * in, float * out,
                    long numPixels,
                    OpRcPtrVec & ops);
 
+// Replace the finalized ops by a shaper 1D LUT (only for float input bit-depths) followed by a
+// 3D LUT of gridSize, if the ops contain computationally heavy ops. The bake is only kept if the
+// error measured between the nodes of the 3D LUT, and for the float values clamped by the
+// shaper (i.e. negative values and values above its domain), is below maxError. Return true if
+// the ops were replaced.
+bool BakeOpsToLut(OpRcPtrVec & ops,
+                  BitDepth inBitDepth,
+                  unsigned long gridSize,
+                  float maxError,
+                  bool fastLogExpPow);
+
 } // namespace OCIO_NAMESPACE
 
 #endif
@@ -9,6 +9,9 @@
 
 #include "BitDepthUtils.h"
 #include "CDLOpCPU.h"
+#include "CDLOpCPU_AVX2.h"
+#include "CDLOpCPU_AVX512.h"
+#include "CPUInfo.h"
 #include "SSE.h"
 
 
@@ -323,6 +326,29 @@ public:
 };
 #endif
 
+#if OCIO_USE_AVX2 || OCIO_USE_AVX512
+typedef void (CDLApplyFunc)(const RenderParams & params, const float * src, float * dst, long numPixels);
+
+// Renderer for the AVX2 & AVX-512 implementations, handling all the CDL styles.
+class CDLRendererAVX : public CDLOpCPU
+{
+public:
+    CDLRendererAVX(ConstCDLOpDataRcPtr & cdl, CDLApplyFunc * applyFunc)
+        : CDLOpCPU(cdl)
+        , m_applyFunc(applyFunc)
+    {
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override
+    {
+        m_applyFunc(m_renderParams, (const float *)inImg, (float *)outImg, numPixels);
+    }
+
+private:
+    CDLApplyFunc * m_applyFunc;
+};
+#endif
+
 CDLOpCPU::CDLOpCPU(ConstCDLOpDataRcPtr & cdl)
     :   OpCPU()
 {
@@ -475,6 +501,23 @@ ConstOpCPURcPtr GetCDLCPURenderer(ConstCDLOpDataRcPtr & cdl, bool fastPower)
 #if OCIO_USE_SSE2 == 0
     std::ignore = fastPower;
 #endif
+
+    if (fastPower)
+    {
+#if OCIO_USE_AVX512
+        if (CPUInfo::instance().hasAVX512())
+        {
+            return std::make_shared<CDLRendererAVX>(cdl, applyCDLAVX512);
+        }
+#endif
+#if OCIO_USE_AVX2
+        if (CPUInfo::instance().hasAVX2())
+        {
+            return std::make_shared<CDLRendererAVX>(cdl, applyCDLAVX2);
+        }
+#endif
+    }
+
     switch(cdl->getStyle())
     {
         case CDLOpData::CDL_V1_2_FWD:
@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "CDLOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+struct CDLContextAVX2 {
+    __m256 slope[3];
+    __m256 offset[3];
+    __m256 power[3];
+    __m256 saturation;
+};
+
+// Process eight pixels i.e. one per register element.
+struct rgbvec_avx2 {
+    __m256 c[3];
+};
+
+static inline void clamp_avx2(rgbvec_avx2 & pix)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one  = _mm256_set1_ps(1.0f);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        // NaNs become 0.
+        pix.c[i] = _mm256_min_ps(_mm256_max_ps(pix.c[i], zero), one);
+    }
+}
+
+template<bool CLAMP>
+static inline void power_avx2(const CDLContextAVX2 & ctx, rgbvec_avx2 & pix)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        if (CLAMP)
+        {
+            pix.c[i] = avx2Power(pix.c[i], ctx.power[i]);
+        }
+        else
+        {
+            // Negative values are passed through and NaNs become 0.
+            const __m256 negMask = _mm256_cmp_ps(pix.c[i], _mm256_setzero_ps(), _CMP_LT_OQ);
+            pix.c[i] = _mm256_blendv_ps(avx2Power(pix.c[i], ctx.power[i]), pix.c[i], negMask);
+        }
+    }
+}
+
+static inline void saturation_avx2(const CDLContextAVX2 & ctx, rgbvec_avx2 & pix)
+{
+    // Same luma weights & order of operations as the SSE2 version.
+    const __m256 luma
+        = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(pix.c[0], _mm256_set1_ps(0.2126f)),
+                                      _mm256_mul_ps(pix.c[1], _mm256_set1_ps(0.7152f))),
+                        _mm256_mul_ps(pix.c[2], _mm256_set1_ps(0.0722f)));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        pix.c[i] = _mm256_add_ps(luma, _mm256_mul_ps(ctx.saturation, _mm256_sub_ps(pix.c[i], luma)));
+    }
+}
+
+template<bool CLAMP>
+static inline void cdl_fwd_avx2(const CDLContextAVX2 & ctx, rgbvec_avx2 & pix)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        pix.c[i] = _mm256_add_ps(_mm256_mul_ps(pix.c[i], ctx.slope[i]), ctx.offset[i]);
+    }
+
+    if (CLAMP)
+    {
+        clamp_avx2(pix);
+    }
+    power_avx2<CLAMP>(ctx, pix);
+
+    saturation_avx2(ctx, pix);
+    if (CLAMP)
+    {
+        clamp_avx2(pix);
+    }
+}
+
+template<bool CLAMP>
+static inline void cdl_rev_avx2(const CDLContextAVX2 & ctx, rgbvec_avx2 & pix)
+{
+    if (CLAMP)
+    {
+        clamp_avx2(pix);
+    }
+    saturation_avx2(ctx, pix);
+
+    if (CLAMP)
+    {
+        clamp_avx2(pix);
+    }
+    power_avx2<CLAMP>(ctx, pix);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        pix.c[i] = _mm256_mul_ps(_mm256_add_ps(pix.c[i], ctx.offset[i]), ctx.slope[i]);
+    }
+
+    if (CLAMP)
+    {
+        clamp_avx2(pix);
+    }
+}
+
+template<bool REVERSE, bool CLAMP>
+static inline void cdl_avx2(const CDLContextAVX2 & ctx, const float * src, float * dst, long numPixels)
+{
+    rgbvec_avx2 pix;
+    __m256 alpha;
+
+    const long pixel_count = numPixels / 8 * 8;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 8)
+    {
+        AVX2RGBAPack<BIT_DEPTH_F32>::Load(src, pix.c[0], pix.c[1], pix.c[2], alpha);
+
+        if (REVERSE) cdl_rev_avx2<CLAMP>(ctx, pix);
+        else         cdl_fwd_avx2<CLAMP>(ctx, pix);
+
+        AVX2RGBAPack<BIT_DEPTH_F32>::Store(dst, pix.c[0], pix.c[1], pix.c[2], alpha);
+
+        src += 32;
+        dst += 32;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        float buf[32] = {};
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            buf[i] = src[i];
+        }
+
+        AVX2RGBAPack<BIT_DEPTH_F32>::Load(buf, pix.c[0], pix.c[1], pix.c[2], alpha);
+
+        if (REVERSE) cdl_rev_avx2<CLAMP>(ctx, pix);
+        else         cdl_fwd_avx2<CLAMP>(ctx, pix);
+
+        AVX2RGBAPack<BIT_DEPTH_F32>::Store(buf, pix.c[0], pix.c[1], pix.c[2], alpha);
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            dst[i] = buf[i];
+        }
+    }
+}
+
+} // anonymous namespace
+
+void applyCDLAVX2(const RenderParams & params, const float * src, float * dst, long numPixels)
+{
+    CDLContextAVX2 ctx;
+    for (int i = 0; i < 3; ++i)
+    {
+        ctx.slope[i]  = _mm256_set1_ps(params.getSlope()[i]);
+        ctx.offset[i] = _mm256_set1_ps(params.getOffset()[i]);
+        ctx.power[i]  = _mm256_set1_ps(params.getPower()[i]);
+    }
+    ctx.saturation = _mm256_set1_ps(params.getSaturation());
+
+    if (params.isReverse())
+    {
+        if (params.isNoClamp()) cdl_avx2<true, false>(ctx, src, dst, numPixels);
+        else                    cdl_avx2<true, true >(ctx, src, dst, numPixels);
+    }
+    else
+    {
+        if (params.isNoClamp()) cdl_avx2<false, false>(ctx, src, dst, numPixels);
+        else                    cdl_avx2<false, true >(ctx, src, dst, numPixels);
+    }
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
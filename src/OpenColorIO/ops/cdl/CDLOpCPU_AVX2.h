@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_CDLOP_CPU_AVX2_H
+#define INCLUDED_OCIO_CDLOP_CPU_AVX2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "ops/cdl/CDLOpCPU.h"
+
+#if OCIO_USE_AVX2
+namespace OCIO_NAMESPACE
+{
+
+// Apply the CDL (i.e. forward or reverse, with or without clamping) using the fast power.
+void applyCDLAVX2(const RenderParams & params, const float * src, float * dst, long numPixels);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
+
+#endif /* INCLUDED_OCIO_CDLOP_CPU_AVX2_H */
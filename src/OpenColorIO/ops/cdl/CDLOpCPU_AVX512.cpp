@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "CDLOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+struct CDLContextAVX512 {
+    __m512 slope[3];
+    __m512 offset[3];
+    __m512 power[3];
+    __m512 saturation;
+};
+
+// Process sixteen pixels i.e. one per register element.
+struct rgbvec_avx512 {
+    __m512 c[3];
+};
+
+static inline void clamp_avx512(rgbvec_avx512 & pix)
+{
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 one  = _mm512_set1_ps(1.0f);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        // NaNs become 0.
+        pix.c[i] = _mm512_min_ps(_mm512_max_ps(pix.c[i], zero), one);
+    }
+}
+
+template<bool CLAMP>
+static inline void power_avx512(const CDLContextAVX512 & ctx, rgbvec_avx512 & pix)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        if (CLAMP)
+        {
+            pix.c[i] = avx512Power(pix.c[i], ctx.power[i]);
+        }
+        else
+        {
+            // Negative values are passed through and NaNs become 0.
+            const __mmask16 posMask = _mm512_cmp_ps_mask(pix.c[i], _mm512_setzero_ps(), _CMP_NLT_UQ);
+            pix.c[i] = _mm512_mask_mov_ps(pix.c[i], posMask, avx512Power(pix.c[i], ctx.power[i]));
+        }
+    }
+}
+
+static inline void saturation_avx512(const CDLContextAVX512 & ctx, rgbvec_avx512 & pix)
+{
+    // Same luma weights & order of operations as the SSE2 version.
+    const __m512 luma
+        = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(pix.c[0], _mm512_set1_ps(0.2126f)),
+                                      _mm512_mul_ps(pix.c[1], _mm512_set1_ps(0.7152f))),
+                        _mm512_mul_ps(pix.c[2], _mm512_set1_ps(0.0722f)));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        pix.c[i] = _mm512_add_ps(luma, _mm512_mul_ps(ctx.saturation, _mm512_sub_ps(pix.c[i], luma)));
+    }
+}
+
+template<bool CLAMP>
+static inline void cdl_fwd_avx512(const CDLContextAVX512 & ctx, rgbvec_avx512 & pix)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        pix.c[i] = _mm512_add_ps(_mm512_mul_ps(pix.c[i], ctx.slope[i]), ctx.offset[i]);
+    }
+
+    if (CLAMP)
+    {
+        clamp_avx512(pix);
+    }
+    power_avx512<CLAMP>(ctx, pix);
+
+    saturation_avx512(ctx, pix);
+    if (CLAMP)
+    {
+        clamp_avx512(pix);
+    }
+}
+
+template<bool CLAMP>
+static inline void cdl_rev_avx512(const CDLContextAVX512 & ctx, rgbvec_avx512 & pix)
+{
+    if (CLAMP)
+    {
+        clamp_avx512(pix);
+    }
+    saturation_avx512(ctx, pix);
+
+    if (CLAMP)
+    {
+        clamp_avx512(pix);
+    }
+    power_avx512<CLAMP>(ctx, pix);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        pix.c[i] = _mm512_mul_ps(_mm512_add_ps(pix.c[i], ctx.offset[i]), ctx.slope[i]);
+    }
+
+    if (CLAMP)
+    {
+        clamp_avx512(pix);
+    }
+}
+
+template<bool REVERSE, bool CLAMP>
+static inline void cdl_avx512(const CDLContextAVX512 & ctx, const float * src, float * dst, long numPixels)
+{
+    rgbvec_avx512 pix;
+    __m512 alpha;
+
+    const long pixel_count = numPixels / 16 * 16;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 16)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::Load(src, pix.c[0], pix.c[1], pix.c[2], alpha);
+
+        if (REVERSE) cdl_rev_avx512<CLAMP>(ctx, pix);
+        else         cdl_fwd_avx512<CLAMP>(ctx, pix);
+
+        AVX512RGBAPack<BIT_DEPTH_F32>::Store(dst, pix.c[0], pix.c[1], pix.c[2], alpha);
+
+        src += 64;
+        dst += 64;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::LoadMasked(src, pix.c[0], pix.c[1], pix.c[2], alpha,
+                                                  (uint32_t)remainder);
+
+        if (REVERSE) cdl_rev_avx512<CLAMP>(ctx, pix);
+        else         cdl_fwd_avx512<CLAMP>(ctx, pix);
+
+        AVX512RGBAPack<BIT_DEPTH_F32>::StoreMasked(dst, pix.c[0], pix.c[1], pix.c[2], alpha,
+                                                   (uint32_t)remainder);
+    }
+}
+
+} // anonymous namespace
+
+void applyCDLAVX512(const RenderParams & params, const float * src, float * dst, long numPixels)
+{
+    CDLContextAVX512 ctx;
+    for (int i = 0; i < 3; ++i)
+    {
+        ctx.slope[i]  = _mm512_set1_ps(params.getSlope()[i]);
+        ctx.offset[i] = _mm512_set1_ps(params.getOffset()[i]);
+        ctx.power[i]  = _mm512_set1_ps(params.getPower()[i]);
+    }
+    ctx.saturation = _mm512_set1_ps(params.getSaturation());
+
+    if (params.isReverse())
+    {
+        if (params.isNoClamp()) cdl_avx512<true, false>(ctx, src, dst, numPixels);
+        else                    cdl_avx512<true, true >(ctx, src, dst, numPixels);
+    }
+    else
+    {
+        if (params.isNoClamp()) cdl_avx512<false, false>(ctx, src, dst, numPixels);
+        else                    cdl_avx512<false, true >(ctx, src, dst, numPixels);
+    }
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
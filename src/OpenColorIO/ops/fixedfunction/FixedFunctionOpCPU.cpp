@@ -7,8 +7,12 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "MathUtils.h"
 #include "ops/fixedfunction/FixedFunctionOpCPU.h"
+#include "ops/fixedfunction/FixedFunctionOpCPU_AVX2.h"
+#include "ops/fixedfunction/FixedFunctionOpCPU_AVX512.h"
+#include "ops/fixedfunction/FixedFunctionOpCPU_SSE2.h"
 
 
 namespace OCIO_NAMESPACE
@@ -47,6 +51,8 @@ public:
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
 protected:
+    void fillRenderParams(ACESRenderParams & params) const;
+
     float m_1minusScale;
     float m_pivot;
     float m_inv_width;
@@ -71,6 +77,8 @@ public:
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
 protected:
+    void fillRenderParams(ACESRenderParams & params) const;
+
     float m_glowGain, m_glowMid;
 
     static constexpr float m_noiseLimit = 1e-2f;
@@ -93,6 +101,8 @@ public:
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
 protected:
+    void fillRenderParams(ACESRenderParams & params) const;
+
     float m_gamma;
 };
 
@@ -105,6 +115,8 @@ public:
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
 protected:
+    void fillRenderParams(ACESRenderParams & params) const;
+
     float m_limCyan;
     float m_limMagenta;
     float m_limYellow;
@@ -135,6 +147,8 @@ public:
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
 protected:
+    void fillRenderParams(ACESRenderParams & params) const;
+
     float m_gamma;
 };
 
@@ -408,6 +422,14 @@ Renderer_ACES_RedMod10_Fwd::Renderer_ACES_RedMod10_Fwd(ConstFixedFunctionOpDataR
     m_inv_width = 1.6976527263135504f;
 }
 
+void Renderer_ACES_RedMod10_Fwd::fillRenderParams(ACESRenderParams & params) const
+{
+    params.m_1minusScale = m_1minusScale;
+    params.m_pivot       = m_pivot;
+    params.m_invWidth    = m_inv_width;
+    params.m_noiseLimit  = m_noiseLimit;
+}
+
 void Renderer_ACES_RedMod10_Fwd::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
@@ -493,6 +515,13 @@ Renderer_ACES_Glow03_Fwd::Renderer_ACES_Glow03_Fwd(ConstFixedFunctionOpDataRcPtr
     m_glowMid = glowMid;
 }
 
+void Renderer_ACES_Glow03_Fwd::fillRenderParams(ACESRenderParams & params) const
+{
+    params.m_glowGain   = m_glowGain;
+    params.m_glowMid    = m_glowMid;
+    params.m_noiseLimit = m_noiseLimit;
+}
+
 __inline float rgbToYC(const float red, const float grn, const float blu)
 {
     // Convert RGB to YC (luma + chroma factor).
@@ -623,6 +652,16 @@ Renderer_ACES_DarkToDim10_Fwd::Renderer_ACES_DarkToDim10_Fwd(ConstFixedFunctionO
     m_gamma = gamma - 1.f;  // compute Y^gamma / Y
 }
 
+void Renderer_ACES_DarkToDim10_Fwd::fillRenderParams(ACESRenderParams & params) const
+{
+    // Refer to apply() for the luminance weights & threshold.
+    params.m_gamma          = m_gamma;
+    params.m_lumaWeights[0] = 0.27222871678091454f;
+    params.m_lumaWeights[1] = 0.67408176581114831f;
+    params.m_lumaWeights[2] = 0.053689517407937051f;
+    params.m_minLum         = 1e-10f;
+}
+
 void Renderer_ACES_DarkToDim10_Fwd::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
@@ -738,6 +777,17 @@ Renderer_ACES_GamutComp13_Fwd::Renderer_ACES_GamutComp13_Fwd(ConstFixedFunctionO
     m_scaleYellow    = f_scale(m_limYellow,  m_thrYellow);
 }
 
+void Renderer_ACES_GamutComp13_Fwd::fillRenderParams(ACESRenderParams & params) const
+{
+    params.m_threshold[0] = m_thrCyan;
+    params.m_threshold[1] = m_thrMagenta;
+    params.m_threshold[2] = m_thrYellow;
+    params.m_scale[0]     = m_scaleCyan;
+    params.m_scale[1]     = m_scaleMagenta;
+    params.m_scale[2]     = m_scaleYellow;
+    params.m_power        = m_power;
+}
+
 void Renderer_ACES_GamutComp13_Fwd::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
@@ -800,6 +850,16 @@ Renderer_REC2100_Surround::Renderer_REC2100_Surround(ConstFixedFunctionOpDataRcP
     m_gamma = gamma - 1.f;  // compute Y^gamma / Y
 }
 
+void Renderer_REC2100_Surround::fillRenderParams(ACESRenderParams & params) const
+{
+    // Refer to apply() for the luminance weights & threshold.
+    params.m_gamma          = m_gamma;
+    params.m_lumaWeights[0] = 0.2627f;
+    params.m_lumaWeights[1] = 0.6780f;
+    params.m_lumaWeights[2] = 0.0593f;
+    params.m_minLum         = 1e-4f;
+}
+
 void Renderer_REC2100_Surround::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
@@ -1184,8 +1244,122 @@ void Renderer_LUV_TO_XYZ::apply(const void * inImg, void * outImg, long numPixel
 
 
 
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+typedef void (ACESApplyFunc)(const ACESRenderParams & params, const float * src, float * dst, long numPixels);
+
+// Return the fastest vectorized implementation supported by the CPU, or null if none.
+ACESApplyFunc * GetACESApplyFunc()
+{
+    ACESApplyFunc * func = nullptr;
+
+#if OCIO_USE_SSE2
+    if (CPUInfo::instance().hasSSE2())
+    {
+        func = applyACESSSE2;
+    }
+#endif
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        func = applyACESAVX2;
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        func = applyACESAVX512;
+    }
+#endif
+
+    return func;
+}
+
+// Renderer for the SSE2, AVX2 & AVX-512 implementations i.e. the parameters computed by the
+// renderer are converted into the form used by the vectorized implementations.
+template<typename Renderer, ACESRenderParams::Style STYLE>
+class ACESRendererSIMD : public Renderer
+{
+public:
+    template<typename... Args>
+    ACESRendererSIMD(ACESApplyFunc * applyFunc, ConstFixedFunctionOpDataRcPtr & data, Args... args)
+        : Renderer(data, args...)
+        , m_applyFunc(applyFunc)
+    {
+        this->fillRenderParams(m_params);
+        m_params.m_style = STYLE;
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override
+    {
+        m_applyFunc(m_params, (const float *)inImg, (float *)outImg, numPixels);
+    }
+
+private:
+    ACESRenderParams m_params;
+    ACESApplyFunc * m_applyFunc;
+};
+
+typedef void (ColorModelApplyFunc)(ColorModelStyle style, const float * src, float * dst, long numPixels);
+
+// Return the fastest vectorized implementation supported by the CPU, or null if none.
+ColorModelApplyFunc * GetColorModelApplyFunc()
+{
+    ColorModelApplyFunc * func = nullptr;
+
+#if OCIO_USE_SSE2
+    if (CPUInfo::instance().hasSSE2())
+    {
+        func = applyColorModelSSE2;
+    }
+#endif
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        func = applyColorModelAVX2;
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        func = applyColorModelAVX512;
+    }
+#endif
+
+    return func;
+}
+
+// Renderer for the SSE2, AVX2 & AVX-512 implementations of the colour model conversions.
+template<typename Renderer, ColorModelStyle STYLE>
+class ColorModelRendererSIMD : public Renderer
+{
+public:
+    ColorModelRendererSIMD(ColorModelApplyFunc * applyFunc, ConstFixedFunctionOpDataRcPtr & data)
+        : Renderer(data)
+        , m_applyFunc(applyFunc)
+    {
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override
+    {
+        m_applyFunc(STYLE, (const float *)inImg, (float *)outImg, numPixels);
+    }
+
+private:
+    ColorModelApplyFunc * m_applyFunc;
+};
+#endif
+
 ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func)
 {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+    ACESApplyFunc * applyFunc = GetACESApplyFunc();
+    ColorModelApplyFunc * colorModelFunc = GetColorModelApplyFunc();
+#endif
+
     switch(func->getStyle())
     {
         case FixedFunctionOpData::ACES_RED_MOD_03_FWD:
@@ -1198,38 +1372,101 @@ ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func
         }
         case FixedFunctionOpData::ACES_RED_MOD_10_FWD:
         {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (applyFunc)
+            {
+                return std::make_shared<ACESRendererSIMD<Renderer_ACES_RedMod10_Fwd, ACESRenderParams::RED_MOD_10_FWD>>(
+                    applyFunc, func);
+            }
+#endif
             return std::make_shared<Renderer_ACES_RedMod10_Fwd>(func);
         }
         case FixedFunctionOpData::ACES_RED_MOD_10_INV:
         {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (applyFunc)
+            {
+                return std::make_shared<ACESRendererSIMD<Renderer_ACES_RedMod10_Inv, ACESRenderParams::RED_MOD_10_INV>>(
+                    applyFunc, func);
+            }
+#endif
             return std::make_shared<Renderer_ACES_RedMod10_Inv>(func);
         }
         case FixedFunctionOpData::ACES_GLOW_03_FWD:
         {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (applyFunc)
+            {
+                return std::make_shared<ACESRendererSIMD<Renderer_ACES_Glow03_Fwd, ACESRenderParams::GLOW_03_FWD>>(
+                    applyFunc, func, 0.075f, 0.1f);
+            }
+#endif
             return std::make_shared<Renderer_ACES_Glow03_Fwd>(func, 0.075f, 0.1f);
         }
         case FixedFunctionOpData::ACES_GLOW_03_INV:
         {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (applyFunc)
+            {
+                return std::make_shared<ACESRendererSIMD<Renderer_ACES_Glow03_Inv, ACESRenderParams::GLOW_03_INV>>(
+                    applyFunc, func, 0.075f, 0.1f);
+            }
+#endif
             return std::make_shared<Renderer_ACES_Glow03_Inv>(func, 0.075f, 0.1f);
         }
         case FixedFunctionOpData::ACES_GLOW_10_FWD:
         {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (applyFunc)
+            {
+                return std::make_shared<ACESRendererSIMD<Renderer_ACES_Glow03_Fwd, ACESRenderParams::GLOW_03_FWD>>(
+                    applyFunc, func, 0.05f, 0.08f);
+            }
+#endif
             return std::make_shared<Renderer_ACES_Glow03_Fwd>(func, 0.05f, 0.08f);
         }
         case FixedFunctionOpData::ACES_GLOW_10_INV:
         {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (applyFunc)
+            {
+                return std::make_shared<ACESRendererSIMD<Renderer_ACES_Glow03_Inv, ACESRenderParams::GLOW_03_INV>>(
+                    applyFunc, func, 0.05f, 0.08f);
+            }
+#endif
             return std::make_shared<Renderer_ACES_Glow03_Inv>(func, 0.05f, 0.08f);
         }
         case FixedFunctionOpData::ACES_DARK_TO_DIM_10_FWD:
         {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (applyFunc)
+            {
+                return std::make_shared<ACESRendererSIMD<Renderer_ACES_DarkToDim10_Fwd, ACESRenderParams::SURROUND>>(
+                    applyFunc, func, 0.9811f);
+            }
+#endif
             return std::make_shared<Renderer_ACES_DarkToDim10_Fwd>(func, 0.9811f);
         }
         case FixedFunctionOpData::ACES_DARK_TO_DIM_10_INV:
         {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (applyFunc)
+            {
+                return std::make_shared<ACESRendererSIMD<Renderer_ACES_DarkToDim10_Fwd, ACESRenderParams::SURROUND>>(
+                    applyFunc, func, 1.0192640913260627f);
+            }
+#endif
             return std::make_shared<Renderer_ACES_DarkToDim10_Fwd>(func, 1.0192640913260627f);
         }
         case FixedFunctionOpData::ACES_GAMUT_COMP_13_FWD:
         {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (applyFunc)
+            {
+                return std::make_shared<ACESRendererSIMD<Renderer_ACES_GamutComp13_Fwd, ACESRenderParams::GAMUT_COMP_13_FWD>>(
+                    applyFunc, func);
+            }
+#endif
             return std::make_shared<Renderer_ACES_GamutComp13_Fwd>(func);
         }
         case FixedFunctionOpData::ACES_GAMUT_COMP_13_INV:
@@ -1240,42 +1477,105 @@ ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func
         case FixedFunctionOpData::REC2100_SURROUND_INV:
         {
             // Sharing same renderer (param will be inverted to handle direction).
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (applyFunc)
+            {
+                return std::make_shared<ACESRendererSIMD<Renderer_REC2100_Surround, ACESRenderParams::SURROUND>>(
+                    applyFunc, func);
+            }
+#endif
             return std::make_shared<Renderer_REC2100_Surround>(func);
         }
 
         case FixedFunctionOpData::RGB_TO_HSV:
         {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (colorModelFunc)
+            {
+                return std::make_shared<ColorModelRendererSIMD<Renderer_RGB_TO_HSV, COLOR_MODEL_RGB_TO_HSV>>(
+                    colorModelFunc, func);
+            }
+#endif
             return std::make_shared<Renderer_RGB_TO_HSV>(func);
         }
         case FixedFunctionOpData::HSV_TO_RGB:
         {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (colorModelFunc)
+            {
+                return std::make_shared<ColorModelRendererSIMD<Renderer_HSV_TO_RGB, COLOR_MODEL_HSV_TO_RGB>>(
+                    colorModelFunc, func);
+            }
+#endif
             return std::make_shared<Renderer_HSV_TO_RGB>(func);
         }
 
         case FixedFunctionOpData::XYZ_TO_xyY:
         {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (colorModelFunc)
+            {
+                return std::make_shared<ColorModelRendererSIMD<Renderer_XYZ_TO_xyY, COLOR_MODEL_XYZ_TO_xyY>>(
+                    colorModelFunc, func);
+            }
+#endif
             return std::make_shared<Renderer_XYZ_TO_xyY>(func);
         }
         case FixedFunctionOpData::xyY_TO_XYZ:
         {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (colorModelFunc)
+            {
+                return std::make_shared<ColorModelRendererSIMD<Renderer_xyY_TO_XYZ, COLOR_MODEL_xyY_TO_XYZ>>(
+                    colorModelFunc, func);
+            }
+#endif
             return std::make_shared<Renderer_xyY_TO_XYZ>(func);
         }
 
         case FixedFunctionOpData::XYZ_TO_uvY:
         {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (colorModelFunc)
+            {
+                return std::make_shared<ColorModelRendererSIMD<Renderer_XYZ_TO_uvY, COLOR_MODEL_XYZ_TO_uvY>>(
+                    colorModelFunc, func);
+            }
+#endif
             return std::make_shared<Renderer_XYZ_TO_uvY>(func);
         }
         case FixedFunctionOpData::uvY_TO_XYZ:
         {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (colorModelFunc)
+            {
+                return std::make_shared<ColorModelRendererSIMD<Renderer_uvY_TO_XYZ, COLOR_MODEL_uvY_TO_XYZ>>(
+                    colorModelFunc, func);
+            }
+#endif
             return std::make_shared<Renderer_uvY_TO_XYZ>(func);
         }
 
         case FixedFunctionOpData::XYZ_TO_LUV:
         {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (colorModelFunc)
+            {
+                return std::make_shared<ColorModelRendererSIMD<Renderer_XYZ_TO_LUV, COLOR_MODEL_XYZ_TO_LUV>>(
+                    colorModelFunc, func);
+            }
+#endif
             return std::make_shared<Renderer_XYZ_TO_LUV>(func);
         }
         case FixedFunctionOpData::LUV_TO_XYZ:
         {
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (colorModelFunc)
+            {
+                return std::make_shared<ColorModelRendererSIMD<Renderer_LUV_TO_XYZ, COLOR_MODEL_LUV_TO_XYZ>>(
+                    colorModelFunc, func);
+            }
+#endif
             return std::make_shared<Renderer_LUV_TO_XYZ>(func);
         }
     }
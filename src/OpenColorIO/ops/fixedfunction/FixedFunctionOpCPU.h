@@ -14,6 +14,61 @@
 namespace OCIO_NAMESPACE
 {
 
+// Parameters of the ACES fixed functions having vectorized (i.e. SSE2, AVX2 & AVX-512)
+// implementations. The vectorized implementations produce the same results as the scalar
+// renderers i.e. the power & arc tangent are computed with the standard library.
+struct ACESRenderParams
+{
+    enum Style
+    {
+        RED_MOD_10_FWD = 0,
+        RED_MOD_10_INV,
+        GLOW_03_FWD,       // Also used by the ACES 1.0 glow.
+        GLOW_03_INV,
+        SURROUND,          // Dark to dim & Rec.2100 surround i.e. rgb * pow(luma, gamma).
+        GAMUT_COMP_13_FWD
+    };
+
+    Style m_style{ RED_MOD_10_FWD };
+
+    // Red modifier.
+    float m_1minusScale{ 0.f };
+    float m_pivot{ 0.f };
+    float m_invWidth{ 0.f };
+
+    // Red modifier & glow.
+    float m_noiseLimit{ 0.f };
+
+    // Glow.
+    float m_glowGain{ 0.f };
+    float m_glowMid{ 0.f };
+
+    // Surround.
+    float m_gamma{ 0.f };
+    float m_lumaWeights[3]{ 0.f, 0.f, 0.f };
+    float m_minLum{ 0.f };
+
+    // Gamut compression (i.e. cyan, magenta & yellow).
+    float m_threshold[3]{ 0.f, 0.f, 0.f };
+    float m_scale[3]{ 0.f, 0.f, 0.f };
+    float m_power{ 1.f };
+};
+
+// Colour model conversions having vectorized (i.e. SSE2, AVX2 & AVX-512) implementations.
+// The vectorized implementations produce the same results as the scalar ones except the
+// forward LUV where the cube root is within two ULPs of the one computed using powf().
+enum ColorModelStyle
+{
+    COLOR_MODEL_RGB_TO_HSV = 0,
+    COLOR_MODEL_HSV_TO_RGB,
+    COLOR_MODEL_XYZ_TO_xyY,
+    COLOR_MODEL_xyY_TO_XYZ,
+    COLOR_MODEL_XYZ_TO_uvY,
+    COLOR_MODEL_uvY_TO_XYZ,
+    COLOR_MODEL_XYZ_TO_LUV,
+    COLOR_MODEL_LUV_TO_XYZ
+};
+
 ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func);
 
 } // namespace OCIO_NAMESPACE
@@ -0,0 +1,687 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "FixedFunctionOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <cmath>
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+typedef ACESRenderParams::Style Style;
+
+struct ACESContextAVX2 {
+    __m256 oneMinusScale;
+    __m256 pivot;
+    __m256 invWidth;
+    __m256 noiseLimit;
+    __m256 glowGain;
+    __m256 glowMid;
+    __m256 glowMid2;         // glowMid * 2
+    __m256 glowMid2_3;       // glowMid * 2 / 3
+    float gamma;
+    __m256 lumaWeights[3];
+    __m256 minLum;
+    __m256 threshold[3];
+    __m256 scale[3];
+    float power;
+    float invPower;
+};
+
+// The arc tangent & the power are computed lane by lane using the standard library so the
+// results are the same as the scalar renderers (refer to FixedFunctionOpCPU.cpp).
+
+static inline __m256 atan2_avx2(__m256 y, __m256 x)
+{
+    float ys[8], xs[8];
+    _mm256_storeu_ps(ys, y);
+    _mm256_storeu_ps(xs, x);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        ys[i] = std::atan2(ys[i], xs[i]);
+    }
+
+    return _mm256_loadu_ps(ys);
+}
+
+// Only the lanes selected by the mask are computed, the other ones are null.
+static inline __m256 pow_avx2(__m256 x, float exp, int mask)
+{
+    float vals[8];
+    _mm256_storeu_ps(vals, x);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        vals[i] = ((mask >> i) & 1) ? std::pow(vals[i], exp) : 0.f;
+    }
+
+    return _mm256_loadu_ps(vals);
+}
+
+// Refer to CalcSatWeight() in FixedFunctionOpCPU.cpp.
+static inline __m256 sat_weight_avx2(const ACESContextAVX2 & ctx, __m256 r, __m256 g, __m256 b)
+{
+    const __m256 minVal = _mm256_min_ps(_mm256_min_ps(b, g), r);
+    const __m256 maxVal = _mm256_max_ps(_mm256_max_ps(b, g), r);
+
+    const __m256 tiny = _mm256_set1_ps(1e-10f);
+    return _mm256_div_ps(_mm256_sub_ps(_mm256_max_ps(maxVal, tiny), _mm256_max_ps(minVal, tiny)),
+                         _mm256_max_ps(maxVal, ctx.noiseLimit));
+}
+
+// Refer to CalcHueWeight() in FixedFunctionOpCPU.cpp.
+static inline __m256 hue_weight_avx2(const ACESContextAVX2 & ctx, __m256 r, __m256 g, __m256 b)
+{
+    // Convert RGB to Yab (luma/chroma).
+    const __m256 ya = _mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(2.f), r), _mm256_add_ps(g, b));
+    const __m256 yb = _mm256_mul_ps(_mm256_set1_ps(1.7320508075688772f), _mm256_sub_ps(g, b));
+
+    const __m256 hue = atan2_avx2(yb, ya);
+
+    // Determine normalized input coords to B-spline.
+    const __m256 knot_coord = _mm256_add_ps(_mm256_mul_ps(hue, ctx.invWidth), _mm256_set1_ps(2.f));
+    const __m256i j = _mm256_cvttps_epi32(knot_coord);
+    const __m256 t = _mm256_sub_ps(knot_coord, _mm256_cvtepi32_ps(j));
+
+    // Gather the coefficients of the quadratic B-spline basis function i.e. one column of the
+    // matrix per register, indexed by j.
+    const __m256 m0 = _mm256_permutevar8x32_ps(_mm256_setr_ps( 0.25f, -0.75f,  0.75f, -0.25f, 0.f, 0.f, 0.f, 0.f), j);
+    const __m256 m1 = _mm256_permutevar8x32_ps(_mm256_setr_ps( 0.00f,  0.75f, -1.50f,  0.75f, 0.f, 0.f, 0.f, 0.f), j);
+    const __m256 m2 = _mm256_permutevar8x32_ps(_mm256_setr_ps( 0.00f,  0.75f,  0.00f, -0.75f, 0.f, 0.f, 0.f, 0.f), j);
+    const __m256 m3 = _mm256_permutevar8x32_ps(_mm256_setr_ps( 0.00f,  0.25f,  1.00f,  0.25f, 0.f, 0.f, 0.f, 0.f), j);
+
+    __m256 f_H = _mm256_add_ps(_mm256_mul_ps(t, m0), m1);
+    f_H = _mm256_add_ps(_mm256_mul_ps(t, f_H), m2);
+    f_H = _mm256_add_ps(_mm256_mul_ps(t, f_H), m3);
+
+    // The weight is null outside of the hue window i.e. j not in [0, 4).
+    const __m256i inWindow = _mm256_andnot_si256(_mm256_cmpgt_epi32(_mm256_setzero_si256(), j),
+                                                 _mm256_cmpgt_epi32(_mm256_set1_epi32(4), j));
+
+    return _mm256_and_ps(f_H, _mm256_castsi256_ps(inWindow));
+}
+
+static inline __m256d quadratic_root_avx2(__m256d a2, __m256d b, __m256d discr)
+{
+    return _mm256_div_pd(_mm256_sub_pd(_mm256_sub_pd(_mm256_set1_pd(-0.0), b), _mm256_sqrt_pd(discr)),
+                         a2);
+}
+
+// Refer to Renderer_ACES_RedMod10_Inv::apply() i.e. the root is computed in double precision,
+// like the scalar renderer where sqrt() of a float returns a double.
+static inline __m256 quadratic_root_avx2(__m256 qa, __m256 qb, __m256 discr)
+{
+    const __m256 a2 = _mm256_mul_ps(_mm256_set1_ps(2.f), qa);
+
+    const __m256d lo = quadratic_root_avx2(_mm256_cvtps_pd(_mm256_castps256_ps128(a2)),
+                                           _mm256_cvtps_pd(_mm256_castps256_ps128(qb)),
+                                           _mm256_cvtps_pd(_mm256_castps256_ps128(discr)));
+    const __m256d hi = quadratic_root_avx2(_mm256_cvtps_pd(_mm256_extractf128_ps(a2, 1)),
+                                           _mm256_cvtps_pd(_mm256_extractf128_ps(qb, 1)),
+                                           _mm256_cvtps_pd(_mm256_extractf128_ps(discr, 1)));
+
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(lo)), _mm256_cvtpd_ps(hi), 1);
+}
+
+// Refer to rgbToYC() in FixedFunctionOpCPU.cpp.
+static inline __m256 rgb_to_YC_avx2(__m256 r, __m256 g, __m256 b)
+{
+    __m256 chroma = _mm256_mul_ps(b, _mm256_sub_ps(b, g));
+    chroma = _mm256_add_ps(chroma, _mm256_mul_ps(g, _mm256_sub_ps(g, r)));
+    chroma = _mm256_add_ps(chroma, _mm256_mul_ps(r, _mm256_sub_ps(r, b)));
+    chroma = _mm256_sqrt_ps(chroma);
+
+    const __m256 sum = _mm256_add_ps(_mm256_add_ps(b, g), r);
+    return _mm256_div_ps(_mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(1.75f), chroma)),
+                         _mm256_set1_ps(3.f));
+}
+
+// Refer to SigmoidShaper() in FixedFunctionOpCPU.cpp.
+static inline __m256 sigmoid_shaper_avx2(__m256 sat)
+{
+    const __m256 one  = _mm256_set1_ps(1.f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+
+    const __m256 x = _mm256_mul_ps(_mm256_sub_ps(sat, _mm256_set1_ps(0.4f)), _mm256_set1_ps(5.f));
+    const __m256 sign = _mm256_or_ps(_mm256_and_ps(x, _mm256_set1_ps(-0.0f)), one);
+    const __m256 t = _mm256_max_ps(_mm256_sub_ps(one, _mm256_mul_ps(_mm256_mul_ps(half, sign), x)),
+                                   _mm256_setzero_ps());
+
+    return _mm256_mul_ps(_mm256_add_ps(one, _mm256_mul_ps(sign, _mm256_sub_ps(one, _mm256_mul_ps(t, t)))),
+                         half);
+}
+
+// Refer to gamut_comp() & compress() in FixedFunctionOpCPU.cpp.
+static inline __m256 gamut_comp_avx2(const ACESContextAVX2 & ctx, int i, __m256 val, __m256 ach)
+{
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 abs_ach = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), ach);
+
+    // Distance from the achromatic axis, aka inverse RGB ratios.
+    const __m256 dist = _mm256_div_ps(_mm256_sub_ps(ach, val), abs_ach);
+
+    const __m256 null_ach = _mm256_cmp_ps(ach, _mm256_setzero_ps(), _CMP_EQ_OQ);
+
+    // Only the distances above the threshold are compressed.
+    const int mask = _mm256_movemask_ps(
+        _mm256_andnot_ps(null_ach, _mm256_cmp_ps(dist, ctx.threshold[i], _CMP_NLT_UQ)));
+    if (mask == 0)
+    {
+        return _mm256_andnot_ps(null_ach, val);
+    }
+
+    // Normalize distance outside threshold by scale factor.
+    const __m256 nd = _mm256_div_ps(_mm256_sub_ps(dist, ctx.threshold[i]), ctx.scale[i]);
+    const __m256 p = pow_avx2(nd, ctx.power, mask);
+
+    __m256 comprDist = _mm256_div_ps(_mm256_mul_ps(ctx.scale[i], nd),
+                                     pow_avx2(_mm256_add_ps(one, p), ctx.invPower, mask));
+    comprDist = _mm256_add_ps(ctx.threshold[i], comprDist);
+
+    // Recalculate RGB from compressed distance and achromatic.
+    __m256 res = _mm256_sub_ps(ach, _mm256_mul_ps(comprDist, abs_ach));
+
+    // No compression below threshold.
+    res = _mm256_blendv_ps(res, val, _mm256_cmp_ps(dist, ctx.threshold[i], _CMP_LT_OQ));
+
+    // Null achromatic is mapped to zero.
+    return _mm256_andnot_ps(null_ach, res);
+}
+
+template<Style STYLE>
+static inline void apply_aces_avx2(const ACESContextAVX2 & ctx, __m256 & r, __m256 & g, __m256 & b)
+{
+    switch (STYLE)
+    {
+        case ACESRenderParams::RED_MOD_10_FWD:
+        {
+            const __m256 f_H = hue_weight_avx2(ctx, r, g, b);
+            const __m256 f_S = sat_weight_avx2(ctx, r, g, b);
+
+            __m256 newRed = _mm256_mul_ps(_mm256_mul_ps(f_H, f_S), _mm256_sub_ps(ctx.pivot, r));
+            newRed = _mm256_add_ps(r, _mm256_mul_ps(newRed, ctx.oneMinusScale));
+
+            // Only modify the hues in the range of the window.
+            r = _mm256_blendv_ps(r, newRed, _mm256_cmp_ps(f_H, _mm256_setzero_ps(), _CMP_GT_OQ));
+            break;
+        }
+        case ACESRenderParams::RED_MOD_10_INV:
+        {
+            const __m256 f_H = hue_weight_avx2(ctx, r, g, b);
+            const __m256 minChan = _mm256_min_ps(g, b);
+
+            const __m256 qa = _mm256_sub_ps(_mm256_mul_ps(f_H, ctx.oneMinusScale), _mm256_set1_ps(1.f));
+            const __m256 qb = _mm256_sub_ps(r, _mm256_mul_ps(_mm256_mul_ps(f_H, _mm256_add_ps(ctx.pivot, minChan)),
+                                                             ctx.oneMinusScale));
+            const __m256 qc = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(f_H, ctx.pivot), minChan),
+                                            ctx.oneMinusScale);
+
+            const __m256 discr = _mm256_sub_ps(_mm256_mul_ps(qb, qb),
+                                               _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(4.f), qa), qc));
+            const __m256 newRed = quadratic_root_avx2(qa, qb, discr);
+
+            // Only modify the hues in the range of the window.
+            r = _mm256_blendv_ps(r, newRed, _mm256_cmp_ps(f_H, _mm256_setzero_ps(), _CMP_GT_OQ));
+            break;
+        }
+        case ACESRenderParams::GLOW_03_FWD:
+        case ACESRenderParams::GLOW_03_INV:
+        {
+            const __m256 one = _mm256_set1_ps(1.f);
+
+            // NB: YC is at inScale.
+            const __m256 YC = rgb_to_YC_avx2(r, g, b);
+            const __m256 s = sigmoid_shaper_avx2(sat_weight_avx2(ctx, r, g, b));
+
+            const __m256 glowGain = _mm256_mul_ps(ctx.glowGain, s);
+
+            __m256 glowGainOut = _mm256_mul_ps(glowGain, _mm256_sub_ps(_mm256_div_ps(ctx.glowMid, YC),
+                                                                       _mm256_set1_ps(0.5f)));
+            if (STYLE == ACESRenderParams::GLOW_03_FWD)
+            {
+                glowGainOut = _mm256_blendv_ps(glowGainOut, glowGain,
+                                               _mm256_cmp_ps(YC, ctx.glowMid2_3, _CMP_LE_OQ));
+            }
+            else
+            {
+                glowGainOut = _mm256_div_ps(glowGainOut,
+                                            _mm256_sub_ps(_mm256_mul_ps(glowGain, _mm256_set1_ps(0.5f)), one));
+
+                const __m256 onePlusGain = _mm256_add_ps(one, glowGain);
+                const __m256 lowLimit = _mm256_div_ps(_mm256_mul_ps(_mm256_mul_ps(onePlusGain, ctx.glowMid),
+                                                                    _mm256_set1_ps(2.f)),
+                                                      _mm256_set1_ps(3.f));
+                const __m256 lowGain = _mm256_div_ps(_mm256_sub_ps(_mm256_set1_ps(-0.0f), glowGain), onePlusGain);
+
+                glowGainOut = _mm256_blendv_ps(glowGainOut, lowGain,
+                                               _mm256_cmp_ps(YC, lowLimit, _CMP_LE_OQ));
+            }
+            glowGainOut = _mm256_andnot_ps(_mm256_cmp_ps(YC, ctx.glowMid2, _CMP_GE_OQ), glowGainOut);
+
+            // Calculate glow factor.
+            const __m256 factor = _mm256_add_ps(one, glowGainOut);
+
+            r = _mm256_mul_ps(r, factor);
+            g = _mm256_mul_ps(g, factor);
+            b = _mm256_mul_ps(b, factor);
+            break;
+        }
+        case ACESRenderParams::SURROUND:
+        {
+            __m256 Y = _mm256_mul_ps(ctx.lumaWeights[0], r);
+            Y = _mm256_add_ps(Y, _mm256_mul_ps(ctx.lumaWeights[1], g));
+            Y = _mm256_add_ps(Y, _mm256_mul_ps(ctx.lumaWeights[2], b));
+            Y = _mm256_max_ps(Y, ctx.minLum);
+
+            const __m256 Ypow_over_Y = pow_avx2(Y, ctx.gamma, 0xFF);
+
+            r = _mm256_mul_ps(r, Ypow_over_Y);
+            g = _mm256_mul_ps(g, Ypow_over_Y);
+            b = _mm256_mul_ps(b, Ypow_over_Y);
+            break;
+        }
+        case ACESRenderParams::GAMUT_COMP_13_FWD:
+        {
+            // Achromatic axis.
+            const __m256 ach = _mm256_max_ps(_mm256_max_ps(b, g), r);
+
+            r = gamut_comp_avx2(ctx, 0, r, ach);
+            g = gamut_comp_avx2(ctx, 1, g, ach);
+            b = gamut_comp_avx2(ctx, 2, b, ach);
+            break;
+        }
+    }
+}
+
+template<Style STYLE>
+static inline void aces_avx2(const ACESContextAVX2 & ctx, const float * src, float * dst, long numPixels)
+{
+    __m256 r, g, b, a;
+
+    const long pixel_count = numPixels / 8 * 8;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 8)
+    {
+        AVX2RGBAPack<BIT_DEPTH_F32>::Load(src, r, g, b, a);
+        apply_aces_avx2<STYLE>(ctx, r, g, b);
+        AVX2RGBAPack<BIT_DEPTH_F32>::Store(dst, r, g, b, a);
+
+        src += 32;
+        dst += 32;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        float buf[32] = {};
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            buf[i] = src[i];
+        }
+
+        AVX2RGBAPack<BIT_DEPTH_F32>::Load(buf, r, g, b, a);
+        apply_aces_avx2<STYLE>(ctx, r, g, b);
+        AVX2RGBAPack<BIT_DEPTH_F32>::Store(buf, r, g, b, a);
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            dst[i] = buf[i];
+        }
+    }
+}
+
+// The colour model conversions below produce the same results as the scalar renderers (refer
+// to FixedFunctionOpCPU.cpp) i.e. the operations are performed in the same order, without
+// reciprocal approximations & using selections rather than arithmetic to implement the
+// branches. Note that std::min(a, b) & std::max(a, b) are equivalent to _mm256_min_ps(b, a)
+// & _mm256_max_ps(b, a), including for the signed zeros.
+
+static inline __m256 abs_avx2(__m256 x)
+{
+    return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+}
+
+// Return 0 where the value is 0 and num / value otherwise.
+static inline __m256 safe_div_avx2(__m256 num, __m256 value)
+{
+    return _mm256_andnot_ps(_mm256_cmp_ps(value, _mm256_setzero_ps(), _CMP_EQ_OQ),
+                            _mm256_div_ps(num, value));
+}
+
+static inline void rgb_to_hsv_avx2(__m256 & r, __m256 & g, __m256 & b)
+{
+    const __m256 zero = _mm256_setzero_ps();
+
+    const __m256 rgb_min = _mm256_min_ps(b, _mm256_min_ps(g, r));
+    const __m256 rgb_max = _mm256_max_ps(b, _mm256_max_ps(g, r));
+
+    const __m256 has_chroma = _mm256_cmp_ps(rgb_min, rgb_max, _CMP_NEQ_UQ);
+    const __m256 delta = _mm256_sub_ps(rgb_max, rgb_min);
+
+    // Sat
+    __m256 sat = _mm256_and_ps(_mm256_div_ps(delta, rgb_max),
+                               _mm256_and_ps(has_chroma,
+                                             _mm256_cmp_ps(rgb_max, zero, _CMP_NEQ_UQ)));
+
+    // Hue
+    const __m256 is_red = _mm256_cmp_ps(r, rgb_max, _CMP_EQ_OQ);
+    const __m256 is_grn = _mm256_cmp_ps(g, rgb_max, _CMP_EQ_OQ);
+
+    const __m256 num = _mm256_blendv_ps(_mm256_blendv_ps(_mm256_sub_ps(r, g), _mm256_sub_ps(b, r), is_grn),
+                                        _mm256_sub_ps(g, b),
+                                        is_red);
+    const __m256 offset = _mm256_blendv_ps(_mm256_set1_ps(4.f), _mm256_set1_ps(2.f), is_grn);
+
+    const __m256 ratio = _mm256_div_ps(num, delta);
+    __m256 hue = _mm256_blendv_ps(_mm256_add_ps(offset, ratio), ratio, is_red);
+    hue = _mm256_blendv_ps(hue, _mm256_add_ps(hue, _mm256_set1_ps(6.f)),
+                           _mm256_cmp_ps(hue, zero, _CMP_LT_OS));
+    hue = _mm256_and_ps(_mm256_mul_ps(hue, _mm256_set1_ps(0.16666666666666666f)), has_chroma);
+
+    // Handle extended range inputs.
+    const __m256 val = _mm256_blendv_ps(rgb_max, _mm256_add_ps(rgb_max, rgb_min),
+                                        _mm256_cmp_ps(rgb_min, zero, _CMP_LT_OS));
+
+    const __m256 neg_min = _mm256_xor_ps(rgb_min, _mm256_set1_ps(-0.0f));
+    sat = _mm256_blendv_ps(sat, _mm256_div_ps(delta, neg_min),
+                           _mm256_cmp_ps(neg_min, rgb_max, _CMP_GT_OS));
+
+    r = hue;
+    g = sat;
+    b = val;
+}
+
+static inline void hsv_to_rgb_avx2(__m256 & r, __m256 & g, __m256 & b)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one  = _mm256_set1_ps(1.f);
+    const __m256 two  = _mm256_set1_ps(2.f);
+
+    const __m256 hue = _mm256_mul_ps(_mm256_sub_ps(r, _mm256_floor_ps(r)), _mm256_set1_ps(6.f));
+    const __m256 sat = _mm256_min_ps(_mm256_set1_ps(1.999f), _mm256_max_ps(g, zero));
+    const __m256 val = b;
+
+    const __m256 red = _mm256_min_ps(one, _mm256_max_ps(
+        _mm256_sub_ps(abs_avx2(_mm256_sub_ps(hue, _mm256_set1_ps(3.f))), one), zero));
+    const __m256 grn = _mm256_min_ps(one, _mm256_max_ps(
+        _mm256_sub_ps(two, abs_avx2(_mm256_sub_ps(hue, two))), zero));
+    const __m256 blu = _mm256_min_ps(one, _mm256_max_ps(
+        _mm256_sub_ps(two, abs_avx2(_mm256_sub_ps(hue, _mm256_set1_ps(4.f)))), zero));
+
+    const __m256 one_minus_sat = _mm256_sub_ps(one, sat);
+    const __m256 two_minus_sat = _mm256_sub_ps(two, sat);
+
+    __m256 rgb_max = val;
+    __m256 rgb_min = _mm256_mul_ps(val, one_minus_sat);
+
+    // Handle extended range inputs.
+    const __m256 sat_gt_1 = _mm256_cmp_ps(sat, one, _CMP_GT_OS);
+    rgb_min = _mm256_blendv_ps(rgb_min, _mm256_div_ps(rgb_min, two_minus_sat), sat_gt_1);
+    rgb_max = _mm256_blendv_ps(rgb_max, _mm256_sub_ps(val, rgb_min), sat_gt_1);
+
+    const __m256 val_lt_0 = _mm256_cmp_ps(val, zero, _CMP_LT_OS);
+    rgb_min = _mm256_blendv_ps(rgb_min, _mm256_div_ps(val, two_minus_sat), val_lt_0);
+    rgb_max = _mm256_blendv_ps(rgb_max, _mm256_sub_ps(val, rgb_min), val_lt_0);
+
+    const __m256 delta = _mm256_sub_ps(rgb_max, rgb_min);
+    r = _mm256_add_ps(_mm256_mul_ps(red, delta), rgb_min);
+    g = _mm256_add_ps(_mm256_mul_ps(grn, delta), rgb_min);
+    b = _mm256_add_ps(_mm256_mul_ps(blu, delta), rgb_min);
+}
+
+static inline void xyz_to_xyY_avx2(__m256 & X, __m256 & Y, __m256 & Z)
+{
+    const __m256 d = safe_div_avx2(_mm256_set1_ps(1.f), _mm256_add_ps(_mm256_add_ps(X, Y), Z));
+
+    const __m256 x = _mm256_mul_ps(X, d);
+    const __m256 y = _mm256_mul_ps(Y, d);
+
+    Z = Y;
+    X = x;
+    Y = y;
+}
+
+static inline void xyY_to_xyz_avx2(__m256 & x, __m256 & y, __m256 & Y)
+{
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 d = safe_div_avx2(one, y);
+
+    const __m256 X = _mm256_mul_ps(_mm256_mul_ps(Y, x), d);
+    const __m256 Z = _mm256_mul_ps(_mm256_mul_ps(Y, _mm256_sub_ps(_mm256_sub_ps(one, x), y)), d);
+
+    x = X;
+    y = Y;
+    Y = Z;
+}
+
+// Compute the u & v chromaticity coordinates.
+static inline void xyz_to_uv_avx2(__m256 X, __m256 Y, __m256 Z, __m256 & u, __m256 & v)
+{
+    const __m256 d
+        = safe_div_avx2(_mm256_set1_ps(1.f),
+                        _mm256_add_ps(_mm256_add_ps(X, _mm256_mul_ps(_mm256_set1_ps(15.f), Y)),
+                                      _mm256_mul_ps(_mm256_set1_ps(3.f), Z)));
+
+    u = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(4.f), X), d);
+    v = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(9.f), Y), d);
+}
+
+static inline void xyz_to_uvY_avx2(__m256 & X, __m256 & Y, __m256 & Z)
+{
+    __m256 u, v;
+    xyz_to_uv_avx2(X, Y, Z, u, v);
+
+    Z = Y;
+    X = u;
+    Y = v;
+}
+
+static inline void uvY_to_xyz_avx2(__m256 & u, __m256 & v, __m256 & Y)
+{
+    const __m256 d = safe_div_avx2(_mm256_set1_ps(1.f), v);
+
+    const __m256 X
+        = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(9.f / 4.f), Y), u), d);
+
+    const __m256 t = _mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(4.f), u),
+                                   _mm256_mul_ps(_mm256_set1_ps(6.666666666666667f), v));
+    const __m256 Z = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(3.f / 4.f), Y), t), d);
+
+    u = X;
+    v = Y;
+    Y = Z;
+}
+
+static inline void xyz_to_luv_avx2(__m256 & X, __m256 & Y, __m256 & Z)
+{
+    __m256 u, v;
+    xyz_to_uv_avx2(X, Y, Z, u, v);
+
+    // The cube root is only computed on the values above the break.
+    const __m256 brk = _mm256_set1_ps(0.008856451679f);
+    const __m256 cbrt = avx2Cbrt(_mm256_max_ps(Y, brk));
+
+    const __m256 Lstar
+        = _mm256_blendv_ps(_mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(1.16f), cbrt),
+                                         _mm256_set1_ps(0.16f)),
+                           _mm256_mul_ps(_mm256_set1_ps(9.0329629629629608f), Y),
+                           _mm256_cmp_ps(Y, brk, _CMP_LE_OS));
+
+    const __m256 Lstar13 = _mm256_mul_ps(_mm256_set1_ps(13.f), Lstar);
+
+    X = Lstar;
+    Y = _mm256_mul_ps(Lstar13, _mm256_sub_ps(u, _mm256_set1_ps(0.19783001f)));   // D65 white
+    Z = _mm256_mul_ps(Lstar13, _mm256_sub_ps(v, _mm256_set1_ps(0.46831999f)));   // D65 white
+}
+
+static inline void luv_to_xyz_avx2(__m256 & Lstar, __m256 & ustar, __m256 & vstar)
+{
+    const __m256 d = safe_div_avx2(_mm256_set1_ps(0.076923076923076927f), Lstar);
+    const __m256 u = _mm256_add_ps(_mm256_mul_ps(ustar, d), _mm256_set1_ps(0.19783001f));   // D65 white
+    const __m256 v = _mm256_add_ps(_mm256_mul_ps(vstar, d), _mm256_set1_ps(0.46831999f));   // D65 white
+
+    const __m256 tmp = _mm256_mul_ps(_mm256_add_ps(Lstar, _mm256_set1_ps(0.16f)),
+                                     _mm256_set1_ps(0.86206896551724144f));
+    const __m256 Y = _mm256_blendv_ps(_mm256_mul_ps(_mm256_mul_ps(tmp, tmp), tmp),
+                                      _mm256_mul_ps(_mm256_set1_ps(0.11070564598794539f), Lstar),
+                                      _mm256_cmp_ps(Lstar, _mm256_set1_ps(0.08f), _CMP_LE_OS));
+
+    const __m256 dd = safe_div_avx2(_mm256_set1_ps(0.25f), v);
+
+    const __m256 X = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(9.f), Y), u), dd);
+
+    const __m256 t = _mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(12.f),
+                                                 _mm256_mul_ps(_mm256_set1_ps(3.f), u)),
+                                   _mm256_mul_ps(_mm256_set1_ps(20.f), v));
+    const __m256 Z = _mm256_mul_ps(_mm256_mul_ps(Y, t), dd);
+
+    Lstar = X;
+    ustar = Y;
+    vstar = Z;
+}
+
+template<ColorModelStyle STYLE>
+static inline void apply_color_model_avx2(__m256 & r, __m256 & g, __m256 & b)
+{
+    switch (STYLE)
+    {
+        case COLOR_MODEL_RGB_TO_HSV: rgb_to_hsv_avx2(r, g, b); break;
+        case COLOR_MODEL_HSV_TO_RGB: hsv_to_rgb_avx2(r, g, b); break;
+        case COLOR_MODEL_XYZ_TO_xyY: xyz_to_xyY_avx2(r, g, b); break;
+        case COLOR_MODEL_xyY_TO_XYZ: xyY_to_xyz_avx2(r, g, b); break;
+        case COLOR_MODEL_XYZ_TO_uvY: xyz_to_uvY_avx2(r, g, b); break;
+        case COLOR_MODEL_uvY_TO_XYZ: uvY_to_xyz_avx2(r, g, b); break;
+        case COLOR_MODEL_XYZ_TO_LUV: xyz_to_luv_avx2(r, g, b); break;
+        case COLOR_MODEL_LUV_TO_XYZ: luv_to_xyz_avx2(r, g, b); break;
+    }
+}
+
+template<ColorModelStyle STYLE>
+static inline void color_model_avx2(const float * src, float * dst, long numPixels)
+{
+    __m256 r, g, b, a;
+
+    const long pixel_count = numPixels / 8 * 8;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 8)
+    {
+        AVX2RGBAPack<BIT_DEPTH_F32>::Load(src, r, g, b, a);
+        apply_color_model_avx2<STYLE>(r, g, b);
+        AVX2RGBAPack<BIT_DEPTH_F32>::Store(dst, r, g, b, a);
+
+        src += 32;
+        dst += 32;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        float buf[32] = {};
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            buf[i] = src[i];
+        }
+
+        AVX2RGBAPack<BIT_DEPTH_F32>::Load(buf, r, g, b, a);
+        apply_color_model_avx2<STYLE>(r, g, b);
+        AVX2RGBAPack<BIT_DEPTH_F32>::Store(buf, r, g, b, a);
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            dst[i] = buf[i];
+        }
+    }
+}
+
+} // anonymous namespace
+
+void applyACESAVX2(const ACESRenderParams & params, const float * src, float * dst, long numPixels)
+{
+    ACESContextAVX2 ctx;
+    ctx.oneMinusScale = _mm256_set1_ps(params.m_1minusScale);
+    ctx.pivot         = _mm256_set1_ps(params.m_pivot);
+    ctx.invWidth      = _mm256_set1_ps(params.m_invWidth);
+    ctx.noiseLimit    = _mm256_set1_ps(params.m_noiseLimit);
+    ctx.glowGain      = _mm256_set1_ps(params.m_glowGain);
+    ctx.glowMid       = _mm256_set1_ps(params.m_glowMid);
+    ctx.glowMid2      = _mm256_set1_ps(params.m_glowMid * 2.f);
+    ctx.glowMid2_3    = _mm256_set1_ps(params.m_glowMid * 2.f / 3.f);
+    ctx.gamma         = params.m_gamma;
+    ctx.minLum        = _mm256_set1_ps(params.m_minLum);
+    ctx.power         = params.m_power;
+    ctx.invPower      = 1.f / params.m_power;
+    for (int i = 0; i < 3; ++i)
+    {
+        ctx.lumaWeights[i] = _mm256_set1_ps(params.m_lumaWeights[i]);
+        ctx.threshold[i]   = _mm256_set1_ps(params.m_threshold[i]);
+        ctx.scale[i]       = _mm256_set1_ps(params.m_scale[i]);
+    }
+
+    switch (params.m_style)
+    {
+        case ACESRenderParams::RED_MOD_10_FWD:
+            aces_avx2<ACESRenderParams::RED_MOD_10_FWD>(ctx, src, dst, numPixels);
+            break;
+        case ACESRenderParams::RED_MOD_10_INV:
+            aces_avx2<ACESRenderParams::RED_MOD_10_INV>(ctx, src, dst, numPixels);
+            break;
+        case ACESRenderParams::GLOW_03_FWD:
+            aces_avx2<ACESRenderParams::GLOW_03_FWD>(ctx, src, dst, numPixels);
+            break;
+        case ACESRenderParams::GLOW_03_INV:
+            aces_avx2<ACESRenderParams::GLOW_03_INV>(ctx, src, dst, numPixels);
+            break;
+        case ACESRenderParams::SURROUND:
+            aces_avx2<ACESRenderParams::SURROUND>(ctx, src, dst, numPixels);
+            break;
+        case ACESRenderParams::GAMUT_COMP_13_FWD:
+            aces_avx2<ACESRenderParams::GAMUT_COMP_13_FWD>(ctx, src, dst, numPixels);
+            break;
+    }
+}
+
+void applyColorModelAVX2(ColorModelStyle style, const float * src, float * dst, long numPixels)
+{
+    switch (style)
+    {
+        case COLOR_MODEL_RGB_TO_HSV:
+            color_model_avx2<COLOR_MODEL_RGB_TO_HSV>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_HSV_TO_RGB:
+            color_model_avx2<COLOR_MODEL_HSV_TO_RGB>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_XYZ_TO_xyY:
+            color_model_avx2<COLOR_MODEL_XYZ_TO_xyY>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_xyY_TO_XYZ:
+            color_model_avx2<COLOR_MODEL_xyY_TO_XYZ>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_XYZ_TO_uvY:
+            color_model_avx2<COLOR_MODEL_XYZ_TO_uvY>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_uvY_TO_XYZ:
+            color_model_avx2<COLOR_MODEL_uvY_TO_XYZ>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_XYZ_TO_LUV:
+            color_model_avx2<COLOR_MODEL_XYZ_TO_LUV>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_LUV_TO_XYZ:
+            color_model_avx2<COLOR_MODEL_LUV_TO_XYZ>(src, dst, numPixels);
+            break;
+    }
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
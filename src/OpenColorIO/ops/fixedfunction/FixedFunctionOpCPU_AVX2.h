@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_FIXEDFUNCTIONOP_CPU_AVX2_H
+#define INCLUDED_OCIO_FIXEDFUNCTIONOP_CPU_AVX2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "ops/fixedfunction/FixedFunctionOpCPU.h"
+
+#if OCIO_USE_AVX2
+namespace OCIO_NAMESPACE
+{
+
+// Apply any of the vectorized ACES fixed function styles using the fast power & arc tangent.
+void applyACESAVX2(const ACESRenderParams & params, const float * src, float * dst, long numPixels);
+
+// Apply any of the colour model conversions.
+void applyColorModelAVX2(ColorModelStyle style, const float * src, float * dst, long numPixels);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
+
+#endif /* INCLUDED_OCIO_FIXEDFUNCTIONOP_CPU_AVX2_H */
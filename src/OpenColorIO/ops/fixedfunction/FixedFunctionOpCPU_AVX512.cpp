@@ -0,0 +1,682 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "FixedFunctionOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <cmath>
+
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+typedef ACESRenderParams::Style Style;
+
+struct ACESContextAVX512 {
+    __m512 oneMinusScale;
+    __m512 pivot;
+    __m512 invWidth;
+    __m512 noiseLimit;
+    __m512 glowGain;
+    __m512 glowMid;
+    __m512 glowMid2;         // glowMid * 2
+    __m512 glowMid2_3;       // glowMid * 2 / 3
+    float gamma;
+    __m512 lumaWeights[3];
+    __m512 minLum;
+    __m512 threshold[3];
+    __m512 scale[3];
+    float power;
+    float invPower;
+};
+
+// The arc tangent & the power are computed lane by lane using the standard library so the
+// results are the same as the scalar renderers (refer to FixedFunctionOpCPU.cpp).
+
+static inline __m512 atan2_avx512(__m512 y, __m512 x)
+{
+    float ys[16], xs[16];
+    _mm512_storeu_ps(ys, y);
+    _mm512_storeu_ps(xs, x);
+
+    for (int i = 0; i < 16; ++i)
+    {
+        ys[i] = std::atan2(ys[i], xs[i]);
+    }
+
+    return _mm512_loadu_ps(ys);
+}
+
+// Only the lanes selected by the mask are computed, the other ones are null.
+static inline __m512 pow_avx512(__m512 x, float exp, int mask)
+{
+    float vals[16];
+    _mm512_storeu_ps(vals, x);
+
+    for (int i = 0; i < 16; ++i)
+    {
+        vals[i] = ((mask >> i) & 1) ? std::pow(vals[i], exp) : 0.f;
+    }
+
+    return _mm512_loadu_ps(vals);
+}
+
+// Refer to CalcSatWeight() in FixedFunctionOpCPU.cpp.
+static inline __m512 sat_weight_avx512(const ACESContextAVX512 & ctx, __m512 r, __m512 g, __m512 b)
+{
+    const __m512 minVal = _mm512_min_ps(_mm512_min_ps(b, g), r);
+    const __m512 maxVal = _mm512_max_ps(_mm512_max_ps(b, g), r);
+
+    const __m512 tiny = _mm512_set1_ps(1e-10f);
+    return _mm512_div_ps(_mm512_sub_ps(_mm512_max_ps(maxVal, tiny), _mm512_max_ps(minVal, tiny)),
+                         _mm512_max_ps(maxVal, ctx.noiseLimit));
+}
+
+// Refer to CalcHueWeight() in FixedFunctionOpCPU.cpp.
+static inline __m512 hue_weight_avx512(const ACESContextAVX512 & ctx, __m512 r, __m512 g, __m512 b)
+{
+    // Convert RGB to Yab (luma/chroma).
+    const __m512 ya = _mm512_sub_ps(_mm512_mul_ps(_mm512_set1_ps(2.f), r), _mm512_add_ps(g, b));
+    const __m512 yb = _mm512_mul_ps(_mm512_set1_ps(1.7320508075688772f), _mm512_sub_ps(g, b));
+
+    const __m512 hue = atan2_avx512(yb, ya);
+
+    // Determine normalized input coords to B-spline.
+    const __m512 knot_coord = _mm512_add_ps(_mm512_mul_ps(hue, ctx.invWidth), _mm512_set1_ps(2.f));
+    const __m512i j = _mm512_cvttps_epi32(knot_coord);
+    const __m512 t = _mm512_sub_ps(knot_coord, _mm512_cvtepi32_ps(j));
+
+    // Gather the coefficients of the quadratic B-spline basis function i.e. one column of the
+    // matrix per register, indexed by j.
+    const __m512 m0 = _mm512_permutexvar_ps(j, _mm512_setr_ps( 0.25f, -0.75f,  0.75f, -0.25f,
+                                                               0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f,
+                                                               0.f, 0.f, 0.f, 0.f));
+    const __m512 m1 = _mm512_permutexvar_ps(j, _mm512_setr_ps( 0.00f,  0.75f, -1.50f,  0.75f,
+                                                               0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f,
+                                                               0.f, 0.f, 0.f, 0.f));
+    const __m512 m2 = _mm512_permutexvar_ps(j, _mm512_setr_ps( 0.00f,  0.75f,  0.00f, -0.75f,
+                                                               0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f,
+                                                               0.f, 0.f, 0.f, 0.f));
+    const __m512 m3 = _mm512_permutexvar_ps(j, _mm512_setr_ps( 0.00f,  0.25f,  1.00f,  0.25f,
+                                                               0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f,
+                                                               0.f, 0.f, 0.f, 0.f));
+
+    __m512 f_H = _mm512_add_ps(_mm512_mul_ps(t, m0), m1);
+    f_H = _mm512_add_ps(_mm512_mul_ps(t, f_H), m2);
+    f_H = _mm512_add_ps(_mm512_mul_ps(t, f_H), m3);
+
+    // The weight is null outside of the hue window i.e. j not in [0, 4).
+    const __mmask16 inWindow = _mm512_cmplt_epu32_mask(j, _mm512_set1_epi32(4));
+
+    return _mm512_maskz_mov_ps(inWindow, f_H);
+}
+
+static inline __m512d quadratic_root_avx512(__m512d a2, __m512d b, __m512d discr)
+{
+    return _mm512_div_pd(_mm512_sub_pd(_mm512_sub_pd(_mm512_set1_pd(-0.0), b), _mm512_sqrt_pd(discr)),
+                         a2);
+}
+
+// Return the upper half of the register.
+static inline __m256 high_avx512(__m512 x)
+{
+    return _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(x), 1));
+}
+
+// Refer to Renderer_ACES_RedMod10_Inv::apply() i.e. the root is computed in double precision,
+// like the scalar renderer where sqrt() of a float returns a double.
+static inline __m512 quadratic_root_avx512(__m512 qa, __m512 qb, __m512 discr)
+{
+    const __m512 a2 = _mm512_mul_ps(_mm512_set1_ps(2.f), qa);
+
+    const __m512d lo = quadratic_root_avx512(_mm512_cvtps_pd(_mm512_castps512_ps256(a2)),
+                                             _mm512_cvtps_pd(_mm512_castps512_ps256(qb)),
+                                             _mm512_cvtps_pd(_mm512_castps512_ps256(discr)));
+    const __m512d hi = quadratic_root_avx512(_mm512_cvtps_pd(high_avx512(a2)),
+                                             _mm512_cvtps_pd(high_avx512(qb)),
+                                             _mm512_cvtps_pd(high_avx512(discr)));
+
+    const __m512d res = _mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(_mm512_cvtpd_ps(lo))),
+                                           _mm256_castps_pd(_mm512_cvtpd_ps(hi)), 1);
+    return _mm512_castpd_ps(res);
+}
+
+// Refer to rgbToYC() in FixedFunctionOpCPU.cpp.
+static inline __m512 rgb_to_YC_avx512(__m512 r, __m512 g, __m512 b)
+{
+    __m512 chroma = _mm512_mul_ps(b, _mm512_sub_ps(b, g));
+    chroma = _mm512_add_ps(chroma, _mm512_mul_ps(g, _mm512_sub_ps(g, r)));
+    chroma = _mm512_add_ps(chroma, _mm512_mul_ps(r, _mm512_sub_ps(r, b)));
+    chroma = _mm512_sqrt_ps(chroma);
+
+    const __m512 sum = _mm512_add_ps(_mm512_add_ps(b, g), r);
+    return _mm512_div_ps(_mm512_add_ps(sum, _mm512_mul_ps(_mm512_set1_ps(1.75f), chroma)),
+                         _mm512_set1_ps(3.f));
+}
+
+// Refer to SigmoidShaper() in FixedFunctionOpCPU.cpp.
+static inline __m512 sigmoid_shaper_avx512(__m512 sat)
+{
+    const __m512 one  = _mm512_set1_ps(1.f);
+    const __m512 half = _mm512_set1_ps(0.5f);
+
+    const __m512 x = _mm512_mul_ps(_mm512_sub_ps(sat, _mm512_set1_ps(0.4f)), _mm512_set1_ps(5.f));
+    const __m512 sign
+        = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_and_epi32(_mm512_castps_si512(x),
+                                                               _mm512_set1_epi32(0x80000000)),
+                                              _mm512_castps_si512(one)));
+    const __m512 t = _mm512_max_ps(_mm512_sub_ps(one, _mm512_mul_ps(_mm512_mul_ps(half, sign), x)),
+                                   _mm512_setzero_ps());
+
+    return _mm512_mul_ps(_mm512_add_ps(one, _mm512_mul_ps(sign, _mm512_sub_ps(one, _mm512_mul_ps(t, t)))),
+                         half);
+}
+
+// Refer to gamut_comp() & compress() in FixedFunctionOpCPU.cpp.
+static inline __m512 gamut_comp_avx512(const ACESContextAVX512 & ctx, int i, __m512 val, __m512 ach)
+{
+    const __m512 one = _mm512_set1_ps(1.f);
+    const __m512 abs_ach = _mm512_abs_ps(ach);
+
+    // Distance from the achromatic axis, aka inverse RGB ratios.
+    const __m512 dist = _mm512_div_ps(_mm512_sub_ps(ach, val), abs_ach);
+
+    const __mmask16 valid_ach = _mm512_cmp_ps_mask(ach, _mm512_setzero_ps(), _CMP_NEQ_UQ);
+
+    // Only the distances above the threshold are compressed.
+    const __mmask16 mask = _mm512_mask_cmp_ps_mask(valid_ach, dist, ctx.threshold[i], _CMP_NLT_UQ);
+    if (mask == 0)
+    {
+        return _mm512_maskz_mov_ps(valid_ach, val);
+    }
+
+    // Normalize distance outside threshold by scale factor.
+    const __m512 nd = _mm512_div_ps(_mm512_sub_ps(dist, ctx.threshold[i]), ctx.scale[i]);
+    const __m512 p = pow_avx512(nd, ctx.power, mask);
+
+    __m512 comprDist = _mm512_div_ps(_mm512_mul_ps(ctx.scale[i], nd),
+                                     pow_avx512(_mm512_add_ps(one, p), ctx.invPower, mask));
+    comprDist = _mm512_add_ps(ctx.threshold[i], comprDist);
+
+    // Recalculate RGB from compressed distance and achromatic.
+    __m512 res = _mm512_sub_ps(ach, _mm512_mul_ps(comprDist, abs_ach));
+
+    // No compression below threshold.
+    res = _mm512_mask_mov_ps(res, _mm512_cmp_ps_mask(dist, ctx.threshold[i], _CMP_LT_OQ), val);
+
+    // Null achromatic is mapped to zero.
+    return _mm512_maskz_mov_ps(valid_ach, res);
+}
+
+template<Style STYLE>
+static inline void apply_aces_avx512(const ACESContextAVX512 & ctx, __m512 & r, __m512 & g, __m512 & b)
+{
+    switch (STYLE)
+    {
+        case ACESRenderParams::RED_MOD_10_FWD:
+        {
+            const __m512 f_H = hue_weight_avx512(ctx, r, g, b);
+            const __m512 f_S = sat_weight_avx512(ctx, r, g, b);
+
+            __m512 newRed = _mm512_mul_ps(_mm512_mul_ps(f_H, f_S), _mm512_sub_ps(ctx.pivot, r));
+            newRed = _mm512_add_ps(r, _mm512_mul_ps(newRed, ctx.oneMinusScale));
+
+            // Only modify the hues in the range of the window.
+            r = _mm512_mask_mov_ps(r, _mm512_cmp_ps_mask(f_H, _mm512_setzero_ps(), _CMP_GT_OQ), newRed);
+            break;
+        }
+        case ACESRenderParams::RED_MOD_10_INV:
+        {
+            const __m512 f_H = hue_weight_avx512(ctx, r, g, b);
+            const __m512 minChan = _mm512_min_ps(g, b);
+
+            const __m512 qa = _mm512_sub_ps(_mm512_mul_ps(f_H, ctx.oneMinusScale), _mm512_set1_ps(1.f));
+            const __m512 qb = _mm512_sub_ps(r, _mm512_mul_ps(_mm512_mul_ps(f_H, _mm512_add_ps(ctx.pivot, minChan)),
+                                                             ctx.oneMinusScale));
+            const __m512 qc = _mm512_mul_ps(_mm512_mul_ps(_mm512_mul_ps(f_H, ctx.pivot), minChan),
+                                            ctx.oneMinusScale);
+
+            const __m512 discr = _mm512_sub_ps(_mm512_mul_ps(qb, qb),
+                                               _mm512_mul_ps(_mm512_mul_ps(_mm512_set1_ps(4.f), qa), qc));
+            const __m512 newRed = quadratic_root_avx512(qa, qb, discr);
+
+            // Only modify the hues in the range of the window.
+            r = _mm512_mask_mov_ps(r, _mm512_cmp_ps_mask(f_H, _mm512_setzero_ps(), _CMP_GT_OQ), newRed);
+            break;
+        }
+        case ACESRenderParams::GLOW_03_FWD:
+        case ACESRenderParams::GLOW_03_INV:
+        {
+            const __m512 one = _mm512_set1_ps(1.f);
+
+            // NB: YC is at inScale.
+            const __m512 YC = rgb_to_YC_avx512(r, g, b);
+            const __m512 s = sigmoid_shaper_avx512(sat_weight_avx512(ctx, r, g, b));
+
+            const __m512 glowGain = _mm512_mul_ps(ctx.glowGain, s);
+
+            __m512 glowGainOut = _mm512_mul_ps(glowGain, _mm512_sub_ps(_mm512_div_ps(ctx.glowMid, YC),
+                                                                       _mm512_set1_ps(0.5f)));
+            if (STYLE == ACESRenderParams::GLOW_03_FWD)
+            {
+                glowGainOut = _mm512_mask_mov_ps(glowGainOut,
+                                                 _mm512_cmp_ps_mask(YC, ctx.glowMid2_3, _CMP_LE_OQ),
+                                                 glowGain);
+            }
+            else
+            {
+                glowGainOut = _mm512_div_ps(glowGainOut,
+                                            _mm512_sub_ps(_mm512_mul_ps(glowGain, _mm512_set1_ps(0.5f)), one));
+
+                const __m512 onePlusGain = _mm512_add_ps(one, glowGain);
+                const __m512 lowLimit = _mm512_div_ps(_mm512_mul_ps(_mm512_mul_ps(onePlusGain, ctx.glowMid),
+                                                                    _mm512_set1_ps(2.f)),
+                                                      _mm512_set1_ps(3.f));
+                const __m512 lowGain = _mm512_div_ps(_mm512_sub_ps(_mm512_set1_ps(-0.0f), glowGain), onePlusGain);
+
+                glowGainOut = _mm512_mask_mov_ps(glowGainOut,
+                                                 _mm512_cmp_ps_mask(YC, lowLimit, _CMP_LE_OQ),
+                                                 lowGain);
+            }
+            glowGainOut = _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(YC, ctx.glowMid2, _CMP_NGE_UQ), glowGainOut);
+
+            // Calculate glow factor.
+            const __m512 factor = _mm512_add_ps(one, glowGainOut);
+
+            r = _mm512_mul_ps(r, factor);
+            g = _mm512_mul_ps(g, factor);
+            b = _mm512_mul_ps(b, factor);
+            break;
+        }
+        case ACESRenderParams::SURROUND:
+        {
+            __m512 Y = _mm512_mul_ps(ctx.lumaWeights[0], r);
+            Y = _mm512_add_ps(Y, _mm512_mul_ps(ctx.lumaWeights[1], g));
+            Y = _mm512_add_ps(Y, _mm512_mul_ps(ctx.lumaWeights[2], b));
+            Y = _mm512_max_ps(Y, ctx.minLum);
+
+            const __m512 Ypow_over_Y = pow_avx512(Y, ctx.gamma, 0xFFFF);
+
+            r = _mm512_mul_ps(r, Ypow_over_Y);
+            g = _mm512_mul_ps(g, Ypow_over_Y);
+            b = _mm512_mul_ps(b, Ypow_over_Y);
+            break;
+        }
+        case ACESRenderParams::GAMUT_COMP_13_FWD:
+        {
+            // Achromatic axis.
+            const __m512 ach = _mm512_max_ps(_mm512_max_ps(b, g), r);
+
+            r = gamut_comp_avx512(ctx, 0, r, ach);
+            g = gamut_comp_avx512(ctx, 1, g, ach);
+            b = gamut_comp_avx512(ctx, 2, b, ach);
+            break;
+        }
+    }
+}
+
+template<Style STYLE>
+static inline void aces_avx512(const ACESContextAVX512 & ctx, const float * src, float * dst, long numPixels)
+{
+    __m512 r, g, b, a;
+
+    const long pixel_count = numPixels / 16 * 16;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 16)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::Load(src, r, g, b, a);
+        apply_aces_avx512<STYLE>(ctx, r, g, b);
+        AVX512RGBAPack<BIT_DEPTH_F32>::Store(dst, r, g, b, a);
+
+        src += 64;
+        dst += 64;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::LoadMasked(src, r, g, b, a, (uint32_t)remainder);
+        apply_aces_avx512<STYLE>(ctx, r, g, b);
+        AVX512RGBAPack<BIT_DEPTH_F32>::StoreMasked(dst, r, g, b, a, (uint32_t)remainder);
+    }
+}
+
+// The colour model conversions below produce the same results as the scalar renderers (refer
+// to FixedFunctionOpCPU.cpp) i.e. the operations are performed in the same order, without
+// reciprocal approximations & using selections rather than arithmetic to implement the
+// branches. Note that std::min(a, b) & std::max(a, b) are equivalent to _mm512_min_ps(b, a)
+// & _mm512_max_ps(b, a), including for the signed zeros.
+
+static inline __m512 abs_avx512(__m512 x)
+{
+    return _mm512_castsi512_ps(_mm512_and_epi32(_mm512_castps_si512(x),
+                                                _mm512_set1_epi32(0x7fffffff)));
+}
+
+// Return 0 where the value is 0 and num / value otherwise.
+static inline __m512 safe_div_avx512(__m512 num, __m512 value)
+{
+    const __mmask16 not_zero = _mm512_cmp_ps_mask(value, _mm512_setzero_ps(), _CMP_NEQ_UQ);
+    return _mm512_maskz_div_ps(not_zero, num, value);
+}
+
+static inline void rgb_to_hsv_avx512(__m512 & r, __m512 & g, __m512 & b)
+{
+    const __m512 zero = _mm512_setzero_ps();
+
+    const __m512 rgb_min = _mm512_min_ps(b, _mm512_min_ps(g, r));
+    const __m512 rgb_max = _mm512_max_ps(b, _mm512_max_ps(g, r));
+
+    const __mmask16 has_chroma = _mm512_cmp_ps_mask(rgb_min, rgb_max, _CMP_NEQ_UQ);
+    const __m512 delta = _mm512_sub_ps(rgb_max, rgb_min);
+
+    // Sat
+    __m512 sat = _mm512_maskz_div_ps(has_chroma & _mm512_cmp_ps_mask(rgb_max, zero, _CMP_NEQ_UQ),
+                                     delta, rgb_max);
+
+    // Hue
+    const __mmask16 is_red = _mm512_cmp_ps_mask(r, rgb_max, _CMP_EQ_OQ);
+    const __mmask16 is_grn = _mm512_cmp_ps_mask(g, rgb_max, _CMP_EQ_OQ);
+
+    __m512 num = _mm512_mask_blend_ps(is_grn, _mm512_sub_ps(r, g), _mm512_sub_ps(b, r));
+    num = _mm512_mask_blend_ps(is_red, num, _mm512_sub_ps(g, b));
+    const __m512 offset = _mm512_mask_blend_ps(is_grn, _mm512_set1_ps(4.f), _mm512_set1_ps(2.f));
+
+    const __m512 ratio = _mm512_div_ps(num, delta);
+    __m512 hue = _mm512_mask_blend_ps(is_red, _mm512_add_ps(offset, ratio), ratio);
+    hue = _mm512_mask_add_ps(hue, _mm512_cmp_ps_mask(hue, zero, _CMP_LT_OS),
+                             hue, _mm512_set1_ps(6.f));
+    hue = _mm512_maskz_mul_ps(has_chroma, hue, _mm512_set1_ps(0.16666666666666666f));
+
+    // Handle extended range inputs.
+    const __m512 val = _mm512_mask_add_ps(rgb_max, _mm512_cmp_ps_mask(rgb_min, zero, _CMP_LT_OS),
+                                          rgb_max, rgb_min);
+
+    const __m512 neg_min = _mm512_castsi512_ps(_mm512_xor_epi32(_mm512_castps_si512(rgb_min),
+                                                                _mm512_set1_epi32(0x80000000)));
+    sat = _mm512_mask_div_ps(sat, _mm512_cmp_ps_mask(neg_min, rgb_max, _CMP_GT_OS), delta, neg_min);
+
+    r = hue;
+    g = sat;
+    b = val;
+}
+
+static inline void hsv_to_rgb_avx512(__m512 & r, __m512 & g, __m512 & b)
+{
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 one  = _mm512_set1_ps(1.f);
+    const __m512 two  = _mm512_set1_ps(2.f);
+
+    const __m512 hue = _mm512_mul_ps(_mm512_sub_ps(r, _mm512_roundscale_ps(r, _MM_FROUND_FLOOR)),
+                                     _mm512_set1_ps(6.f));
+    const __m512 sat = _mm512_min_ps(_mm512_set1_ps(1.999f), _mm512_max_ps(g, zero));
+    const __m512 val = b;
+
+    const __m512 red = _mm512_min_ps(one, _mm512_max_ps(
+        _mm512_sub_ps(abs_avx512(_mm512_sub_ps(hue, _mm512_set1_ps(3.f))), one), zero));
+    const __m512 grn = _mm512_min_ps(one, _mm512_max_ps(
+        _mm512_sub_ps(two, abs_avx512(_mm512_sub_ps(hue, two))), zero));
+    const __m512 blu = _mm512_min_ps(one, _mm512_max_ps(
+        _mm512_sub_ps(two, abs_avx512(_mm512_sub_ps(hue, _mm512_set1_ps(4.f)))), zero));
+
+    const __m512 one_minus_sat = _mm512_sub_ps(one, sat);
+    const __m512 two_minus_sat = _mm512_sub_ps(two, sat);
+
+    __m512 rgb_max = val;
+    __m512 rgb_min = _mm512_mul_ps(val, one_minus_sat);
+
+    // Handle extended range inputs.
+    const __mmask16 sat_gt_1 = _mm512_cmp_ps_mask(sat, one, _CMP_GT_OS);
+    rgb_min = _mm512_mask_div_ps(rgb_min, sat_gt_1, rgb_min, two_minus_sat);
+    rgb_max = _mm512_mask_sub_ps(rgb_max, sat_gt_1, val, rgb_min);
+
+    const __mmask16 val_lt_0 = _mm512_cmp_ps_mask(val, zero, _CMP_LT_OS);
+    rgb_min = _mm512_mask_div_ps(rgb_min, val_lt_0, val, two_minus_sat);
+    rgb_max = _mm512_mask_sub_ps(rgb_max, val_lt_0, val, rgb_min);
+
+    const __m512 delta = _mm512_sub_ps(rgb_max, rgb_min);
+    r = _mm512_add_ps(_mm512_mul_ps(red, delta), rgb_min);
+    g = _mm512_add_ps(_mm512_mul_ps(grn, delta), rgb_min);
+    b = _mm512_add_ps(_mm512_mul_ps(blu, delta), rgb_min);
+}
+
+static inline void xyz_to_xyY_avx512(__m512 & X, __m512 & Y, __m512 & Z)
+{
+    const __m512 d = safe_div_avx512(_mm512_set1_ps(1.f), _mm512_add_ps(_mm512_add_ps(X, Y), Z));
+
+    const __m512 x = _mm512_mul_ps(X, d);
+    const __m512 y = _mm512_mul_ps(Y, d);
+
+    Z = Y;
+    X = x;
+    Y = y;
+}
+
+static inline void xyY_to_xyz_avx512(__m512 & x, __m512 & y, __m512 & Y)
+{
+    const __m512 one = _mm512_set1_ps(1.f);
+    const __m512 d = safe_div_avx512(one, y);
+
+    const __m512 X = _mm512_mul_ps(_mm512_mul_ps(Y, x), d);
+    const __m512 Z = _mm512_mul_ps(_mm512_mul_ps(Y, _mm512_sub_ps(_mm512_sub_ps(one, x), y)), d);
+
+    x = X;
+    y = Y;
+    Y = Z;
+}
+
+// Compute the u & v chromaticity coordinates.
+static inline void xyz_to_uv_avx512(__m512 X, __m512 Y, __m512 Z, __m512 & u, __m512 & v)
+{
+    const __m512 d
+        = safe_div_avx512(_mm512_set1_ps(1.f),
+                          _mm512_add_ps(_mm512_add_ps(X, _mm512_mul_ps(_mm512_set1_ps(15.f), Y)),
+                                        _mm512_mul_ps(_mm512_set1_ps(3.f), Z)));
+
+    u = _mm512_mul_ps(_mm512_mul_ps(_mm512_set1_ps(4.f), X), d);
+    v = _mm512_mul_ps(_mm512_mul_ps(_mm512_set1_ps(9.f), Y), d);
+}
+
+static inline void xyz_to_uvY_avx512(__m512 & X, __m512 & Y, __m512 & Z)
+{
+    __m512 u, v;
+    xyz_to_uv_avx512(X, Y, Z, u, v);
+
+    Z = Y;
+    X = u;
+    Y = v;
+}
+
+static inline void uvY_to_xyz_avx512(__m512 & u, __m512 & v, __m512 & Y)
+{
+    const __m512 d = safe_div_avx512(_mm512_set1_ps(1.f), v);
+
+    const __m512 X
+        = _mm512_mul_ps(_mm512_mul_ps(_mm512_mul_ps(_mm512_set1_ps(9.f / 4.f), Y), u), d);
+
+    const __m512 t = _mm512_sub_ps(_mm512_sub_ps(_mm512_set1_ps(4.f), u),
+                                   _mm512_mul_ps(_mm512_set1_ps(6.666666666666667f), v));
+    const __m512 Z = _mm512_mul_ps(_mm512_mul_ps(_mm512_mul_ps(_mm512_set1_ps(3.f / 4.f), Y), t), d);
+
+    u = X;
+    v = Y;
+    Y = Z;
+}
+
+static inline void xyz_to_luv_avx512(__m512 & X, __m512 & Y, __m512 & Z)
+{
+    __m512 u, v;
+    xyz_to_uv_avx512(X, Y, Z, u, v);
+
+    // The cube root is only computed on the values above the break.
+    const __m512 brk = _mm512_set1_ps(0.008856451679f);
+    const __m512 cbrt = avx512Cbrt(_mm512_max_ps(Y, brk));
+
+    const __m512 Lstar
+        = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(Y, brk, _CMP_LE_OS),
+                               _mm512_sub_ps(_mm512_mul_ps(_mm512_set1_ps(1.16f), cbrt),
+                                             _mm512_set1_ps(0.16f)),
+                               _mm512_mul_ps(_mm512_set1_ps(9.0329629629629608f), Y));
+
+    const __m512 Lstar13 = _mm512_mul_ps(_mm512_set1_ps(13.f), Lstar);
+
+    X = Lstar;
+    Y = _mm512_mul_ps(Lstar13, _mm512_sub_ps(u, _mm512_set1_ps(0.19783001f)));   // D65 white
+    Z = _mm512_mul_ps(Lstar13, _mm512_sub_ps(v, _mm512_set1_ps(0.46831999f)));   // D65 white
+}
+
+static inline void luv_to_xyz_avx512(__m512 & Lstar, __m512 & ustar, __m512 & vstar)
+{
+    const __m512 d = safe_div_avx512(_mm512_set1_ps(0.076923076923076927f), Lstar);
+    const __m512 u = _mm512_add_ps(_mm512_mul_ps(ustar, d), _mm512_set1_ps(0.19783001f));   // D65 white
+    const __m512 v = _mm512_add_ps(_mm512_mul_ps(vstar, d), _mm512_set1_ps(0.46831999f));   // D65 white
+
+    const __m512 tmp = _mm512_mul_ps(_mm512_add_ps(Lstar, _mm512_set1_ps(0.16f)),
+                                     _mm512_set1_ps(0.86206896551724144f));
+    const __m512 Y = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(Lstar, _mm512_set1_ps(0.08f), _CMP_LE_OS),
+                                          _mm512_mul_ps(_mm512_mul_ps(tmp, tmp), tmp),
+                                          _mm512_mul_ps(_mm512_set1_ps(0.11070564598794539f), Lstar));
+
+    const __m512 dd = safe_div_avx512(_mm512_set1_ps(0.25f), v);
+
+    const __m512 X = _mm512_mul_ps(_mm512_mul_ps(_mm512_mul_ps(_mm512_set1_ps(9.f), Y), u), dd);
+
+    const __m512 t = _mm512_sub_ps(_mm512_sub_ps(_mm512_set1_ps(12.f),
+                                                 _mm512_mul_ps(_mm512_set1_ps(3.f), u)),
+                                   _mm512_mul_ps(_mm512_set1_ps(20.f), v));
+    const __m512 Z = _mm512_mul_ps(_mm512_mul_ps(Y, t), dd);
+
+    Lstar = X;
+    ustar = Y;
+    vstar = Z;
+}
+
+template<ColorModelStyle STYLE>
+static inline void apply_color_model_avx512(__m512 & r, __m512 & g, __m512 & b)
+{
+    switch (STYLE)
+    {
+        case COLOR_MODEL_RGB_TO_HSV: rgb_to_hsv_avx512(r, g, b); break;
+        case COLOR_MODEL_HSV_TO_RGB: hsv_to_rgb_avx512(r, g, b); break;
+        case COLOR_MODEL_XYZ_TO_xyY: xyz_to_xyY_avx512(r, g, b); break;
+        case COLOR_MODEL_xyY_TO_XYZ: xyY_to_xyz_avx512(r, g, b); break;
+        case COLOR_MODEL_XYZ_TO_uvY: xyz_to_uvY_avx512(r, g, b); break;
+        case COLOR_MODEL_uvY_TO_XYZ: uvY_to_xyz_avx512(r, g, b); break;
+        case COLOR_MODEL_XYZ_TO_LUV: xyz_to_luv_avx512(r, g, b); break;
+        case COLOR_MODEL_LUV_TO_XYZ: luv_to_xyz_avx512(r, g, b); break;
+    }
+}
+
+template<ColorModelStyle STYLE>
+static inline void color_model_avx512(const float * src, float * dst, long numPixels)
+{
+    __m512 r, g, b, a;
+
+    const long pixel_count = numPixels / 16 * 16;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 16)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::Load(src, r, g, b, a);
+        apply_color_model_avx512<STYLE>(r, g, b);
+        AVX512RGBAPack<BIT_DEPTH_F32>::Store(dst, r, g, b, a);
+
+        src += 64;
+        dst += 64;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::LoadMasked(src, r, g, b, a, (uint32_t)remainder);
+        apply_color_model_avx512<STYLE>(r, g, b);
+        AVX512RGBAPack<BIT_DEPTH_F32>::StoreMasked(dst, r, g, b, a, (uint32_t)remainder);
+    }
+}
+
+} // anonymous namespace
+
+void applyACESAVX512(const ACESRenderParams & params, const float * src, float * dst, long numPixels)
+{
+    ACESContextAVX512 ctx;
+    ctx.oneMinusScale = _mm512_set1_ps(params.m_1minusScale);
+    ctx.pivot         = _mm512_set1_ps(params.m_pivot);
+    ctx.invWidth      = _mm512_set1_ps(params.m_invWidth);
+    ctx.noiseLimit    = _mm512_set1_ps(params.m_noiseLimit);
+    ctx.glowGain      = _mm512_set1_ps(params.m_glowGain);
+    ctx.glowMid       = _mm512_set1_ps(params.m_glowMid);
+    ctx.glowMid2      = _mm512_set1_ps(params.m_glowMid * 2.f);
+    ctx.glowMid2_3    = _mm512_set1_ps(params.m_glowMid * 2.f / 3.f);
+    ctx.gamma         = params.m_gamma;
+    ctx.minLum        = _mm512_set1_ps(params.m_minLum);
+    ctx.power         = params.m_power;
+    ctx.invPower      = 1.f / params.m_power;
+    for (int i = 0; i < 3; ++i)
+    {
+        ctx.lumaWeights[i] = _mm512_set1_ps(params.m_lumaWeights[i]);
+        ctx.threshold[i]   = _mm512_set1_ps(params.m_threshold[i]);
+        ctx.scale[i]       = _mm512_set1_ps(params.m_scale[i]);
+    }
+
+    switch (params.m_style)
+    {
+        case ACESRenderParams::RED_MOD_10_FWD:
+            aces_avx512<ACESRenderParams::RED_MOD_10_FWD>(ctx, src, dst, numPixels);
+            break;
+        case ACESRenderParams::RED_MOD_10_INV:
+            aces_avx512<ACESRenderParams::RED_MOD_10_INV>(ctx, src, dst, numPixels);
+            break;
+        case ACESRenderParams::GLOW_03_FWD:
+            aces_avx512<ACESRenderParams::GLOW_03_FWD>(ctx, src, dst, numPixels);
+            break;
+        case ACESRenderParams::GLOW_03_INV:
+            aces_avx512<ACESRenderParams::GLOW_03_INV>(ctx, src, dst, numPixels);
+            break;
+        case ACESRenderParams::SURROUND:
+            aces_avx512<ACESRenderParams::SURROUND>(ctx, src, dst, numPixels);
+            break;
+        case ACESRenderParams::GAMUT_COMP_13_FWD:
+            aces_avx512<ACESRenderParams::GAMUT_COMP_13_FWD>(ctx, src, dst, numPixels);
+            break;
+    }
+}
+
+void applyColorModelAVX512(ColorModelStyle style, const float * src, float * dst, long numPixels)
+{
+    switch (style)
+    {
+        case COLOR_MODEL_RGB_TO_HSV:
+            color_model_avx512<COLOR_MODEL_RGB_TO_HSV>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_HSV_TO_RGB:
+            color_model_avx512<COLOR_MODEL_HSV_TO_RGB>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_XYZ_TO_xyY:
+            color_model_avx512<COLOR_MODEL_XYZ_TO_xyY>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_xyY_TO_XYZ:
+            color_model_avx512<COLOR_MODEL_xyY_TO_XYZ>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_XYZ_TO_uvY:
+            color_model_avx512<COLOR_MODEL_XYZ_TO_uvY>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_uvY_TO_XYZ:
+            color_model_avx512<COLOR_MODEL_uvY_TO_XYZ>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_XYZ_TO_LUV:
+            color_model_avx512<COLOR_MODEL_XYZ_TO_LUV>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_LUV_TO_XYZ:
+            color_model_avx512<COLOR_MODEL_LUV_TO_XYZ>(src, dst, numPixels);
+            break;
+    }
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -0,0 +1,697 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "FixedFunctionOpCPU_SSE2.h"
+#if OCIO_USE_SSE2
+
+#include <cmath>
+#include <limits>
+
+#include "SSE.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+typedef ACESRenderParams::Style Style;
+
+struct ACESContextSSE2 {
+    __m128 oneMinusScale;
+    __m128 pivot;
+    __m128 invWidth;
+    __m128 noiseLimit;
+    __m128 glowGain;
+    __m128 glowMid;
+    __m128 glowMid2;         // glowMid * 2
+    __m128 glowMid2_3;       // glowMid * 2 / 3
+    float gamma;
+    __m128 lumaWeights[3];
+    __m128 minLum;
+    __m128 threshold[3];
+    __m128 scale[3];
+    float power;
+    float invPower;
+};
+
+// The arc tangent & the power are computed lane by lane using the standard library so the
+// results are the same as the scalar renderers (refer to FixedFunctionOpCPU.cpp).
+
+static inline __m128 atan2_sse2(__m128 y, __m128 x)
+{
+    float ys[4], xs[4];
+    _mm_storeu_ps(ys, y);
+    _mm_storeu_ps(xs, x);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        ys[i] = std::atan2(ys[i], xs[i]);
+    }
+
+    return _mm_loadu_ps(ys);
+}
+
+// Only the lanes selected by the mask are computed, the other ones are null.
+static inline __m128 pow_sse2(__m128 x, float exp, int mask)
+{
+    float vals[4];
+    _mm_storeu_ps(vals, x);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        vals[i] = ((mask >> i) & 1) ? std::pow(vals[i], exp) : 0.f;
+    }
+
+    return _mm_loadu_ps(vals);
+}
+
+// Refer to CalcSatWeight() in FixedFunctionOpCPU.cpp.
+static inline __m128 sat_weight_sse2(const ACESContextSSE2 & ctx, __m128 r, __m128 g, __m128 b)
+{
+    const __m128 minVal = _mm_min_ps(_mm_min_ps(b, g), r);
+    const __m128 maxVal = _mm_max_ps(_mm_max_ps(b, g), r);
+
+    const __m128 tiny = _mm_set1_ps(1e-10f);
+    return _mm_div_ps(_mm_sub_ps(_mm_max_ps(maxVal, tiny), _mm_max_ps(minVal, tiny)),
+                      _mm_max_ps(maxVal, ctx.noiseLimit));
+}
+
+// Select the B-spline coefficient of the knot index j (i.e. zero when j is not in [0, 4)).
+static inline __m128 knot_coef_sse2(const __m128 (&inKnot)[4], float c0, float c1, float c2, float c3)
+{
+    __m128 coef = _mm_and_ps(inKnot[0], _mm_set1_ps(c0));
+    coef = _mm_or_ps(coef, _mm_and_ps(inKnot[1], _mm_set1_ps(c1)));
+    coef = _mm_or_ps(coef, _mm_and_ps(inKnot[2], _mm_set1_ps(c2)));
+    return _mm_or_ps(coef, _mm_and_ps(inKnot[3], _mm_set1_ps(c3)));
+}
+
+// Refer to CalcHueWeight() in FixedFunctionOpCPU.cpp.
+static inline __m128 hue_weight_sse2(const ACESContextSSE2 & ctx, __m128 r, __m128 g, __m128 b)
+{
+    // Convert RGB to Yab (luma/chroma).
+    const __m128 ya = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(2.f), r), _mm_add_ps(g, b));
+    const __m128 yb = _mm_mul_ps(_mm_set1_ps(1.7320508075688772f), _mm_sub_ps(g, b));
+
+    const __m128 hue = atan2_sse2(yb, ya);
+
+    // Determine normalized input coords to B-spline.
+    const __m128 knot_coord = _mm_add_ps(_mm_mul_ps(hue, ctx.invWidth), _mm_set1_ps(2.f));
+    const __m128i j = _mm_cvttps_epi32(knot_coord);
+    const __m128 t = _mm_sub_ps(knot_coord, _mm_cvtepi32_ps(j));
+
+    const __m128 inKnot[4] = {
+        _mm_castsi128_ps(_mm_cmpeq_epi32(j, _mm_set1_epi32(0))),
+        _mm_castsi128_ps(_mm_cmpeq_epi32(j, _mm_set1_epi32(1))),
+        _mm_castsi128_ps(_mm_cmpeq_epi32(j, _mm_set1_epi32(2))),
+        _mm_castsi128_ps(_mm_cmpeq_epi32(j, _mm_set1_epi32(3))) };
+
+    // Gather the coefficients of the quadratic B-spline basis function i.e. one column of the
+    // matrix per register, indexed by j.
+    const __m128 m0 = knot_coef_sse2(inKnot,  0.25f, -0.75f,  0.75f, -0.25f);
+    const __m128 m1 = knot_coef_sse2(inKnot,  0.00f,  0.75f, -1.50f,  0.75f);
+    const __m128 m2 = knot_coef_sse2(inKnot,  0.00f,  0.75f,  0.00f, -0.75f);
+    const __m128 m3 = knot_coef_sse2(inKnot,  0.00f,  0.25f,  1.00f,  0.25f);
+
+    // The weight is null outside of the hue window as all the coefficients are null.
+    __m128 f_H = _mm_add_ps(_mm_mul_ps(t, m0), m1);
+    f_H = _mm_add_ps(_mm_mul_ps(t, f_H), m2);
+    return _mm_add_ps(_mm_mul_ps(t, f_H), m3);
+}
+
+static inline __m128d quadratic_root_sse2(__m128d a2, __m128d b, __m128d discr)
+{
+    return _mm_div_pd(_mm_sub_pd(_mm_sub_pd(_mm_set1_pd(-0.0), b), _mm_sqrt_pd(discr)), a2);
+}
+
+// Refer to Renderer_ACES_RedMod10_Inv::apply() i.e. the root is computed in double precision,
+// like the scalar renderer where sqrt() of a float returns a double.
+static inline __m128 quadratic_root_sse2(__m128 qa, __m128 qb, __m128 discr)
+{
+    const __m128 a2 = _mm_mul_ps(_mm_set1_ps(2.f), qa);
+
+    const __m128d lo = quadratic_root_sse2(_mm_cvtps_pd(a2), _mm_cvtps_pd(qb), _mm_cvtps_pd(discr));
+    const __m128d hi = quadratic_root_sse2(_mm_cvtps_pd(_mm_movehl_ps(a2, a2)),
+                                           _mm_cvtps_pd(_mm_movehl_ps(qb, qb)),
+                                           _mm_cvtps_pd(_mm_movehl_ps(discr, discr)));
+
+    return _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi));
+}
+
+// Refer to rgbToYC() in FixedFunctionOpCPU.cpp.
+static inline __m128 rgb_to_YC_sse2(__m128 r, __m128 g, __m128 b)
+{
+    __m128 chroma = _mm_mul_ps(b, _mm_sub_ps(b, g));
+    chroma = _mm_add_ps(chroma, _mm_mul_ps(g, _mm_sub_ps(g, r)));
+    chroma = _mm_add_ps(chroma, _mm_mul_ps(r, _mm_sub_ps(r, b)));
+    chroma = _mm_sqrt_ps(chroma);
+
+    const __m128 sum = _mm_add_ps(_mm_add_ps(b, g), r);
+    return _mm_div_ps(_mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(1.75f), chroma)), _mm_set1_ps(3.f));
+}
+
+// Refer to SigmoidShaper() in FixedFunctionOpCPU.cpp.
+static inline __m128 sigmoid_shaper_sse2(__m128 sat)
+{
+    const __m128 half = _mm_set1_ps(0.5f);
+
+    const __m128 x = _mm_mul_ps(_mm_sub_ps(sat, _mm_set1_ps(0.4f)), _mm_set1_ps(5.f));
+    const __m128 sign = _mm_or_ps(_mm_and_ps(x, ESIGN_MASK), EONE);
+    const __m128 t = _mm_max_ps(_mm_sub_ps(EONE, _mm_mul_ps(_mm_mul_ps(half, sign), x)), EZERO);
+
+    return _mm_mul_ps(_mm_add_ps(EONE, _mm_mul_ps(sign, _mm_sub_ps(EONE, _mm_mul_ps(t, t)))), half);
+}
+
+// Refer to gamut_comp() & compress() in FixedFunctionOpCPU.cpp.
+static inline __m128 gamut_comp_sse2(const ACESContextSSE2 & ctx, int i, __m128 val, __m128 ach)
+{
+    const __m128 abs_ach = _mm_and_ps(ach, EABS_MASK);
+
+    // Distance from the achromatic axis, aka inverse RGB ratios.
+    const __m128 dist = _mm_div_ps(_mm_sub_ps(ach, val), abs_ach);
+
+    const __m128 null_ach = _mm_cmpeq_ps(ach, EZERO);
+
+    // Only the distances above the threshold are compressed.
+    const int mask = _mm_movemask_ps(_mm_andnot_ps(null_ach, _mm_cmpnlt_ps(dist, ctx.threshold[i])));
+    if (mask == 0)
+    {
+        return _mm_andnot_ps(null_ach, val);
+    }
+
+    // Normalize distance outside threshold by scale factor.
+    const __m128 nd = _mm_div_ps(_mm_sub_ps(dist, ctx.threshold[i]), ctx.scale[i]);
+    const __m128 p = pow_sse2(nd, ctx.power, mask);
+
+    __m128 comprDist = _mm_div_ps(_mm_mul_ps(ctx.scale[i], nd),
+                                  pow_sse2(_mm_add_ps(EONE, p), ctx.invPower, mask));
+    comprDist = _mm_add_ps(ctx.threshold[i], comprDist);
+
+    // Recalculate RGB from compressed distance and achromatic.
+    __m128 res = _mm_sub_ps(ach, _mm_mul_ps(comprDist, abs_ach));
+
+    // No compression below threshold.
+    res = sseSelect(_mm_cmplt_ps(dist, ctx.threshold[i]), val, res);
+
+    // Null achromatic is mapped to zero.
+    return _mm_andnot_ps(null_ach, res);
+}
+
+template<Style STYLE>
+static inline void apply_aces_sse2(const ACESContextSSE2 & ctx, __m128 & r, __m128 & g, __m128 & b)
+{
+    switch (STYLE)
+    {
+        case ACESRenderParams::RED_MOD_10_FWD:
+        {
+            const __m128 f_H = hue_weight_sse2(ctx, r, g, b);
+            const __m128 f_S = sat_weight_sse2(ctx, r, g, b);
+
+            __m128 newRed = _mm_mul_ps(_mm_mul_ps(f_H, f_S), _mm_sub_ps(ctx.pivot, r));
+            newRed = _mm_add_ps(r, _mm_mul_ps(newRed, ctx.oneMinusScale));
+
+            // Only modify the hues in the range of the window.
+            r = sseSelect(_mm_cmpgt_ps(f_H, EZERO), newRed, r);
+            break;
+        }
+        case ACESRenderParams::RED_MOD_10_INV:
+        {
+            const __m128 f_H = hue_weight_sse2(ctx, r, g, b);
+            const __m128 minChan = _mm_min_ps(g, b);
+
+            const __m128 qa = _mm_sub_ps(_mm_mul_ps(f_H, ctx.oneMinusScale), EONE);
+            const __m128 qb = _mm_sub_ps(r, _mm_mul_ps(_mm_mul_ps(f_H, _mm_add_ps(ctx.pivot, minChan)),
+                                                       ctx.oneMinusScale));
+            const __m128 qc = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(f_H, ctx.pivot), minChan), ctx.oneMinusScale);
+
+            const __m128 discr = _mm_sub_ps(_mm_mul_ps(qb, qb),
+                                            _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(4.f), qa), qc));
+            const __m128 newRed = quadratic_root_sse2(qa, qb, discr);
+
+            // Only modify the hues in the range of the window.
+            r = sseSelect(_mm_cmpgt_ps(f_H, EZERO), newRed, r);
+            break;
+        }
+        case ACESRenderParams::GLOW_03_FWD:
+        case ACESRenderParams::GLOW_03_INV:
+        {
+            // NB: YC is at inScale.
+            const __m128 YC = rgb_to_YC_sse2(r, g, b);
+            const __m128 s = sigmoid_shaper_sse2(sat_weight_sse2(ctx, r, g, b));
+
+            const __m128 glowGain = _mm_mul_ps(ctx.glowGain, s);
+
+            __m128 glowGainOut = _mm_mul_ps(glowGain, _mm_sub_ps(_mm_div_ps(ctx.glowMid, YC),
+                                                                 _mm_set1_ps(0.5f)));
+            if (STYLE == ACESRenderParams::GLOW_03_FWD)
+            {
+                glowGainOut = sseSelect(_mm_cmple_ps(YC, ctx.glowMid2_3), glowGain, glowGainOut);
+            }
+            else
+            {
+                glowGainOut = _mm_div_ps(glowGainOut,
+                                         _mm_sub_ps(_mm_mul_ps(glowGain, _mm_set1_ps(0.5f)), EONE));
+
+                const __m128 onePlusGain = _mm_add_ps(EONE, glowGain);
+                const __m128 lowLimit = _mm_div_ps(_mm_mul_ps(_mm_mul_ps(onePlusGain, ctx.glowMid),
+                                                              _mm_set1_ps(2.f)),
+                                                   _mm_set1_ps(3.f));
+                const __m128 lowGain = _mm_div_ps(_mm_sub_ps(_mm_set1_ps(-0.0f), glowGain), onePlusGain);
+
+                glowGainOut = sseSelect(_mm_cmple_ps(YC, lowLimit), lowGain, glowGainOut);
+            }
+            glowGainOut = _mm_andnot_ps(_mm_cmpge_ps(YC, ctx.glowMid2), glowGainOut);
+
+            // Calculate glow factor.
+            const __m128 factor = _mm_add_ps(EONE, glowGainOut);
+
+            r = _mm_mul_ps(r, factor);
+            g = _mm_mul_ps(g, factor);
+            b = _mm_mul_ps(b, factor);
+            break;
+        }
+        case ACESRenderParams::SURROUND:
+        {
+            __m128 Y = _mm_mul_ps(ctx.lumaWeights[0], r);
+            Y = _mm_add_ps(Y, _mm_mul_ps(ctx.lumaWeights[1], g));
+            Y = _mm_add_ps(Y, _mm_mul_ps(ctx.lumaWeights[2], b));
+            Y = _mm_max_ps(Y, ctx.minLum);
+
+            const __m128 Ypow_over_Y = pow_sse2(Y, ctx.gamma, 0xF);
+
+            r = _mm_mul_ps(r, Ypow_over_Y);
+            g = _mm_mul_ps(g, Ypow_over_Y);
+            b = _mm_mul_ps(b, Ypow_over_Y);
+            break;
+        }
+        case ACESRenderParams::GAMUT_COMP_13_FWD:
+        {
+            // Achromatic axis.
+            const __m128 ach = _mm_max_ps(_mm_max_ps(b, g), r);
+
+            r = gamut_comp_sse2(ctx, 0, r, ach);
+            g = gamut_comp_sse2(ctx, 1, g, ach);
+            b = gamut_comp_sse2(ctx, 2, b, ach);
+            break;
+        }
+    }
+}
+
+// Process 4 RGBA pixels i.e. the pixels are transposed to process each channel in a register.
+template<Style STYLE>
+static inline void aces_4pixels_sse2(const ACESContextSSE2 & ctx, const float * src, float * dst)
+{
+    __m128 r = _mm_loadu_ps(src);
+    __m128 g = _mm_loadu_ps(src + 4);
+    __m128 b = _mm_loadu_ps(src + 8);
+    __m128 a = _mm_loadu_ps(src + 12);
+
+    _MM_TRANSPOSE4_PS(r, g, b, a);
+    apply_aces_sse2<STYLE>(ctx, r, g, b);
+    _MM_TRANSPOSE4_PS(r, g, b, a);
+
+    _mm_storeu_ps(dst,      r);
+    _mm_storeu_ps(dst + 4,  g);
+    _mm_storeu_ps(dst + 8,  b);
+    _mm_storeu_ps(dst + 12, a);
+}
+
+template<Style STYLE>
+static inline void aces_sse2(const ACESContextSSE2 & ctx, const float * src, float * dst, long numPixels)
+{
+    const long pixel_count = numPixels / 4 * 4;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 4)
+    {
+        aces_4pixels_sse2<STYLE>(ctx, src, dst);
+
+        src += 16;
+        dst += 16;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        float buf[16] = {};
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            buf[i] = src[i];
+        }
+
+        aces_4pixels_sse2<STYLE>(ctx, buf, buf);
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            dst[i] = buf[i];
+        }
+    }
+}
+
+// The colour model conversions below produce the same results as the scalar renderers (refer
+// to FixedFunctionOpCPU.cpp) i.e. the operations are performed in the same order, without
+// reciprocal approximations & using selections rather than arithmetic to implement the
+// branches. Note that std::min(a, b) & std::max(a, b) are equivalent to _mm_min_ps(b, a) &
+// _mm_max_ps(b, a), including for the signed zeros.
+
+// Round toward negative infinity i.e. SSE2 has no floor instruction.
+static inline __m128 floor_sse2(__m128 x)
+{
+    // Values too large to have a fractional part (including Inf & NaN) are unchanged.
+    const __m128 no_frac = _mm_cmpnlt_ps(_mm_and_ps(x, EABS_MASK), _mm_set1_ps(8388608.f));
+
+    __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+    t = _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, x), EONE));
+
+    return sseSelect(no_frac, x, t);
+}
+
+// Return 0 where the value is 0 and num / value otherwise.
+static inline __m128 safe_div_sse2(__m128 num, __m128 value)
+{
+    return _mm_andnot_ps(_mm_cmpeq_ps(value, EZERO), _mm_div_ps(num, value));
+}
+
+static inline void rgb_to_hsv_sse2(__m128 & r, __m128 & g, __m128 & b)
+{
+    const __m128 rgb_min = _mm_min_ps(b, _mm_min_ps(g, r));
+    const __m128 rgb_max = _mm_max_ps(b, _mm_max_ps(g, r));
+
+    const __m128 has_chroma = _mm_cmpneq_ps(rgb_min, rgb_max);
+    const __m128 delta = _mm_sub_ps(rgb_max, rgb_min);
+
+    // Sat
+    __m128 sat = _mm_and_ps(_mm_div_ps(delta, rgb_max),
+                            _mm_and_ps(has_chroma, _mm_cmpneq_ps(rgb_max, EZERO)));
+
+    // Hue
+    const __m128 is_red = _mm_cmpeq_ps(r, rgb_max);
+    const __m128 is_grn = _mm_cmpeq_ps(g, rgb_max);
+
+    const __m128 num = sseSelect(is_red, _mm_sub_ps(g, b),
+                                 sseSelect(is_grn, _mm_sub_ps(b, r), _mm_sub_ps(r, g)));
+    const __m128 offset = sseSelect(is_grn, _mm_set1_ps(2.f), _mm_set1_ps(4.f));
+
+    const __m128 ratio = _mm_div_ps(num, delta);
+    __m128 hue = sseSelect(is_red, ratio, _mm_add_ps(offset, ratio));
+    hue = sseSelect(_mm_cmplt_ps(hue, EZERO), _mm_add_ps(hue, _mm_set1_ps(6.f)), hue);
+    hue = _mm_and_ps(_mm_mul_ps(hue, _mm_set1_ps(0.16666666666666666f)), has_chroma);
+
+    // Handle extended range inputs.
+    const __m128 val = sseSelect(_mm_cmplt_ps(rgb_min, EZERO), _mm_add_ps(rgb_max, rgb_min), rgb_max);
+
+    const __m128 neg_min = _mm_xor_ps(rgb_min, ESIGN_MASK);
+    sat = sseSelect(_mm_cmpgt_ps(neg_min, rgb_max), _mm_div_ps(delta, neg_min), sat);
+
+    r = hue;
+    g = sat;
+    b = val;
+}
+
+static inline void hsv_to_rgb_sse2(__m128 & r, __m128 & g, __m128 & b)
+{
+    const __m128 hue = _mm_mul_ps(_mm_sub_ps(r, floor_sse2(r)), _mm_set1_ps(6.f));
+    const __m128 sat = _mm_min_ps(_mm_set1_ps(1.999f), _mm_max_ps(g, EZERO));
+    const __m128 val = b;
+
+    const __m128 two   = _mm_set1_ps(2.f);
+    const __m128 red = _mm_min_ps(EONE, _mm_max_ps(
+        _mm_sub_ps(_mm_and_ps(_mm_sub_ps(hue, _mm_set1_ps(3.f)), EABS_MASK), EONE), EZERO));
+    const __m128 grn = _mm_min_ps(EONE, _mm_max_ps(
+        _mm_sub_ps(two, _mm_and_ps(_mm_sub_ps(hue, two), EABS_MASK)), EZERO));
+    const __m128 blu = _mm_min_ps(EONE, _mm_max_ps(
+        _mm_sub_ps(two, _mm_and_ps(_mm_sub_ps(hue, _mm_set1_ps(4.f)), EABS_MASK)), EZERO));
+
+    const __m128 one_minus_sat = _mm_sub_ps(EONE, sat);
+    const __m128 two_minus_sat = _mm_sub_ps(two, sat);
+
+    __m128 rgb_max = val;
+    __m128 rgb_min = _mm_mul_ps(val, one_minus_sat);
+
+    // Handle extended range inputs.
+    const __m128 sat_gt_1 = _mm_cmpgt_ps(sat, EONE);
+    rgb_min = sseSelect(sat_gt_1, _mm_div_ps(rgb_min, two_minus_sat), rgb_min);
+    rgb_max = sseSelect(sat_gt_1, _mm_sub_ps(val, rgb_min), rgb_max);
+
+    const __m128 val_lt_0 = _mm_cmplt_ps(val, EZERO);
+    rgb_min = sseSelect(val_lt_0, _mm_div_ps(val, two_minus_sat), rgb_min);
+    rgb_max = sseSelect(val_lt_0, _mm_sub_ps(val, rgb_min), rgb_max);
+
+    const __m128 delta = _mm_sub_ps(rgb_max, rgb_min);
+    r = _mm_add_ps(_mm_mul_ps(red, delta), rgb_min);
+    g = _mm_add_ps(_mm_mul_ps(grn, delta), rgb_min);
+    b = _mm_add_ps(_mm_mul_ps(blu, delta), rgb_min);
+}
+
+static inline void xyz_to_xyY_sse2(__m128 & X, __m128 & Y, __m128 & Z)
+{
+    const __m128 d = safe_div_sse2(EONE, _mm_add_ps(_mm_add_ps(X, Y), Z));
+
+    const __m128 x = _mm_mul_ps(X, d);
+    const __m128 y = _mm_mul_ps(Y, d);
+
+    Z = Y;
+    X = x;
+    Y = y;
+}
+
+static inline void xyY_to_xyz_sse2(__m128 & x, __m128 & y, __m128 & Y)
+{
+    const __m128 d = safe_div_sse2(EONE, y);
+
+    const __m128 X = _mm_mul_ps(_mm_mul_ps(Y, x), d);
+    const __m128 Z = _mm_mul_ps(_mm_mul_ps(Y, _mm_sub_ps(_mm_sub_ps(EONE, x), y)), d);
+
+    x = X;
+    y = Y;
+    Y = Z;
+}
+
+// Compute the u & v chromaticity coordinates.
+static inline void xyz_to_uv_sse2(__m128 X, __m128 Y, __m128 Z, __m128 & u, __m128 & v)
+{
+    const __m128 d = safe_div_sse2(EONE, _mm_add_ps(_mm_add_ps(X, _mm_mul_ps(_mm_set1_ps(15.f), Y)),
+                                                    _mm_mul_ps(_mm_set1_ps(3.f), Z)));
+
+    u = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(4.f), X), d);
+    v = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(9.f), Y), d);
+}
+
+static inline void xyz_to_uvY_sse2(__m128 & X, __m128 & Y, __m128 & Z)
+{
+    __m128 u, v;
+    xyz_to_uv_sse2(X, Y, Z, u, v);
+
+    Z = Y;
+    X = u;
+    Y = v;
+}
+
+static inline void uvY_to_xyz_sse2(__m128 & u, __m128 & v, __m128 & Y)
+{
+    const __m128 d = safe_div_sse2(EONE, v);
+
+    const __m128 X = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(9.f / 4.f), Y), u), d);
+
+    const __m128 t = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(4.f), u),
+                                _mm_mul_ps(_mm_set1_ps(6.666666666666667f), v));
+    const __m128 Z = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(3.f / 4.f), Y), t), d);
+
+    u = X;
+    v = Y;
+    Y = Z;
+}
+
+static inline void xyz_to_luv_sse2(__m128 & X, __m128 & Y, __m128 & Z)
+{
+    __m128 u, v;
+    xyz_to_uv_sse2(X, Y, Z, u, v);
+
+    // The cube root is only computed on the values above the break.
+    const __m128 brk = _mm_set1_ps(0.008856451679f);
+    const __m128 cbrt = sseCbrt(_mm_max_ps(Y, brk));
+
+    const __m128 Lstar
+        = sseSelect(_mm_cmple_ps(Y, brk),
+                    _mm_mul_ps(_mm_set1_ps(9.0329629629629608f), Y),
+                    _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(1.16f), cbrt), _mm_set1_ps(0.16f)));
+
+    const __m128 Lstar13 = _mm_mul_ps(_mm_set1_ps(13.f), Lstar);
+
+    X = Lstar;
+    Y = _mm_mul_ps(Lstar13, _mm_sub_ps(u, _mm_set1_ps(0.19783001f)));   // D65 white
+    Z = _mm_mul_ps(Lstar13, _mm_sub_ps(v, _mm_set1_ps(0.46831999f)));   // D65 white
+}
+
+static inline void luv_to_xyz_sse2(__m128 & Lstar, __m128 & ustar, __m128 & vstar)
+{
+    const __m128 d = safe_div_sse2(_mm_set1_ps(0.076923076923076927f), Lstar);
+    const __m128 u = _mm_add_ps(_mm_mul_ps(ustar, d), _mm_set1_ps(0.19783001f));   // D65 white
+    const __m128 v = _mm_add_ps(_mm_mul_ps(vstar, d), _mm_set1_ps(0.46831999f));   // D65 white
+
+    const __m128 tmp = _mm_mul_ps(_mm_add_ps(Lstar, _mm_set1_ps(0.16f)),
+                                  _mm_set1_ps(0.86206896551724144f));
+    const __m128 Y = sseSelect(_mm_cmple_ps(Lstar, _mm_set1_ps(0.08f)),
+                               _mm_mul_ps(_mm_set1_ps(0.11070564598794539f), Lstar),
+                               _mm_mul_ps(_mm_mul_ps(tmp, tmp), tmp));
+
+    const __m128 dd = safe_div_sse2(_mm_set1_ps(0.25f), v);
+
+    const __m128 X = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(9.f), Y), u), dd);
+
+    const __m128 t = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(12.f), _mm_mul_ps(_mm_set1_ps(3.f), u)),
+                                _mm_mul_ps(_mm_set1_ps(20.f), v));
+    const __m128 Z = _mm_mul_ps(_mm_mul_ps(Y, t), dd);
+
+    Lstar = X;
+    ustar = Y;
+    vstar = Z;
+}
+
+template<ColorModelStyle STYLE>
+static inline void apply_color_model_sse2(__m128 & r, __m128 & g, __m128 & b)
+{
+    switch (STYLE)
+    {
+        case COLOR_MODEL_RGB_TO_HSV: rgb_to_hsv_sse2(r, g, b); break;
+        case COLOR_MODEL_HSV_TO_RGB: hsv_to_rgb_sse2(r, g, b); break;
+        case COLOR_MODEL_XYZ_TO_xyY: xyz_to_xyY_sse2(r, g, b); break;
+        case COLOR_MODEL_xyY_TO_XYZ: xyY_to_xyz_sse2(r, g, b); break;
+        case COLOR_MODEL_XYZ_TO_uvY: xyz_to_uvY_sse2(r, g, b); break;
+        case COLOR_MODEL_uvY_TO_XYZ: uvY_to_xyz_sse2(r, g, b); break;
+        case COLOR_MODEL_XYZ_TO_LUV: xyz_to_luv_sse2(r, g, b); break;
+        case COLOR_MODEL_LUV_TO_XYZ: luv_to_xyz_sse2(r, g, b); break;
+    }
+}
+
+template<ColorModelStyle STYLE>
+static inline void color_model_4pixels_sse2(const float * src, float * dst)
+{
+    __m128 r = _mm_loadu_ps(src);
+    __m128 g = _mm_loadu_ps(src + 4);
+    __m128 b = _mm_loadu_ps(src + 8);
+    __m128 a = _mm_loadu_ps(src + 12);
+
+    _MM_TRANSPOSE4_PS(r, g, b, a);
+    apply_color_model_sse2<STYLE>(r, g, b);
+    _MM_TRANSPOSE4_PS(r, g, b, a);
+
+    _mm_storeu_ps(dst,      r);
+    _mm_storeu_ps(dst + 4,  g);
+    _mm_storeu_ps(dst + 8,  b);
+    _mm_storeu_ps(dst + 12, a);
+}
+
+template<ColorModelStyle STYLE>
+static inline void color_model_sse2(const float * src, float * dst, long numPixels)
+{
+    const long pixel_count = numPixels / 4 * 4;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 4)
+    {
+        color_model_4pixels_sse2<STYLE>(src, dst);
+
+        src += 16;
+        dst += 16;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        float buf[16] = {};
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            buf[i] = src[i];
+        }
+
+        color_model_4pixels_sse2<STYLE>(buf, buf);
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            dst[i] = buf[i];
+        }
+    }
+}
+
+} // anonymous namespace
+
+void applyACESSSE2(const ACESRenderParams & params, const float * src, float * dst, long numPixels)
+{
+    ACESContextSSE2 ctx;
+    ctx.oneMinusScale = _mm_set1_ps(params.m_1minusScale);
+    ctx.pivot         = _mm_set1_ps(params.m_pivot);
+    ctx.invWidth      = _mm_set1_ps(params.m_invWidth);
+    ctx.noiseLimit    = _mm_set1_ps(params.m_noiseLimit);
+    ctx.glowGain      = _mm_set1_ps(params.m_glowGain);
+    ctx.glowMid       = _mm_set1_ps(params.m_glowMid);
+    ctx.glowMid2      = _mm_set1_ps(params.m_glowMid * 2.f);
+    ctx.glowMid2_3    = _mm_set1_ps(params.m_glowMid * 2.f / 3.f);
+    ctx.gamma         = params.m_gamma;
+    ctx.minLum        = _mm_set1_ps(params.m_minLum);
+    ctx.power         = params.m_power;
+    ctx.invPower      = 1.f / params.m_power;
+    for (int i = 0; i < 3; ++i)
+    {
+        ctx.lumaWeights[i] = _mm_set1_ps(params.m_lumaWeights[i]);
+        ctx.threshold[i]   = _mm_set1_ps(params.m_threshold[i]);
+        ctx.scale[i]       = _mm_set1_ps(params.m_scale[i]);
+    }
+
+    switch (params.m_style)
+    {
+        case ACESRenderParams::RED_MOD_10_FWD:
+            aces_sse2<ACESRenderParams::RED_MOD_10_FWD>(ctx, src, dst, numPixels);
+            break;
+        case ACESRenderParams::RED_MOD_10_INV:
+            aces_sse2<ACESRenderParams::RED_MOD_10_INV>(ctx, src, dst, numPixels);
+            break;
+        case ACESRenderParams::GLOW_03_FWD:
+            aces_sse2<ACESRenderParams::GLOW_03_FWD>(ctx, src, dst, numPixels);
+            break;
+        case ACESRenderParams::GLOW_03_INV:
+            aces_sse2<ACESRenderParams::GLOW_03_INV>(ctx, src, dst, numPixels);
+            break;
+        case ACESRenderParams::SURROUND:
+            aces_sse2<ACESRenderParams::SURROUND>(ctx, src, dst, numPixels);
+            break;
+        case ACESRenderParams::GAMUT_COMP_13_FWD:
+            aces_sse2<ACESRenderParams::GAMUT_COMP_13_FWD>(ctx, src, dst, numPixels);
+            break;
+    }
+}
+
+void applyColorModelSSE2(ColorModelStyle style, const float * src, float * dst, long numPixels)
+{
+    switch (style)
+    {
+        case COLOR_MODEL_RGB_TO_HSV:
+            color_model_sse2<COLOR_MODEL_RGB_TO_HSV>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_HSV_TO_RGB:
+            color_model_sse2<COLOR_MODEL_HSV_TO_RGB>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_XYZ_TO_xyY:
+            color_model_sse2<COLOR_MODEL_XYZ_TO_xyY>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_xyY_TO_XYZ:
+            color_model_sse2<COLOR_MODEL_xyY_TO_XYZ>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_XYZ_TO_uvY:
+            color_model_sse2<COLOR_MODEL_XYZ_TO_uvY>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_uvY_TO_XYZ:
+            color_model_sse2<COLOR_MODEL_uvY_TO_XYZ>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_XYZ_TO_LUV:
+            color_model_sse2<COLOR_MODEL_XYZ_TO_LUV>(src, dst, numPixels);
+            break;
+        case COLOR_MODEL_LUV_TO_XYZ:
+            color_model_sse2<COLOR_MODEL_LUV_TO_XYZ>(src, dst, numPixels);
+            break;
+    }
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_SSE2
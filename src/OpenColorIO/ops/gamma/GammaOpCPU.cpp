@@ -7,7 +7,10 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "ops/gamma/GammaOpCPU.h"
+#include "ops/gamma/GammaOpCPU_AVX2.h"
+#include "ops/gamma/GammaOpCPU_AVX512.h"
 #include "ops/gamma/GammaOpUtils.h"
 
 #include "SSE.h"
@@ -20,6 +23,346 @@ namespace OCIO_NAMESPACE
 // math below does not require checks for divide by 0, etc.
 
 
+namespace
+{
+
+GammaRenderParams::Style GetRenderStyle(GammaOpData::Style style)
+{
+    switch (style)
+    {
+        case GammaOpData::BASIC_FWD:
+        case GammaOpData::BASIC_REV:
+            return GammaRenderParams::BASIC;
+        case GammaOpData::BASIC_MIRROR_FWD:
+        case GammaOpData::BASIC_MIRROR_REV:
+            return GammaRenderParams::BASIC_MIRROR;
+        case GammaOpData::BASIC_PASS_THRU_FWD:
+        case GammaOpData::BASIC_PASS_THRU_REV:
+            return GammaRenderParams::BASIC_PASS_THRU;
+        case GammaOpData::MONCURVE_FWD:
+            return GammaRenderParams::MONCURVE_FWD;
+        case GammaOpData::MONCURVE_REV:
+            return GammaRenderParams::MONCURVE_REV;
+        case GammaOpData::MONCURVE_MIRROR_FWD:
+            return GammaRenderParams::MONCURVE_MIRROR_FWD;
+        case GammaOpData::MONCURVE_MIRROR_REV:
+            return GammaRenderParams::MONCURVE_MIRROR_REV;
+    }
+
+    throw Exception("Unsupported Gamma style");
+}
+
+// The scalar computation of one value of the channel chan, shared by the scalar renderers and
+// the planar & packed RGB processing so that they give identical results.
+template<GammaRenderParams::Style STYLE>
+inline float ComputeGamma(const GammaRenderParams & p, int chan, float in)
+{
+    switch (STYLE)
+    {
+        case GammaRenderParams::BASIC:
+            return std::pow(std::max(0.0f, in), p.m_gamma[chan]);
+
+        case GammaRenderParams::BASIC_MIRROR:
+            return std::copysign(1.0f, in) * std::pow(std::fabs(in), p.m_gamma[chan]);
+
+        case GammaRenderParams::BASIC_PASS_THRU:
+            return in > 0.f ? std::pow(in, p.m_gamma[chan]) : in;
+
+        case GammaRenderParams::MONCURVE_FWD:
+            return in <= p.m_breakPnt[chan]
+                ? in * p.m_slope[chan]
+                : std::pow(in * p.m_scale[chan] + p.m_offset[chan], p.m_gamma[chan]);
+
+        case GammaRenderParams::MONCURVE_REV:
+            return in <= p.m_breakPnt[chan]
+                ? in * p.m_slope[chan]
+                : std::pow(in, p.m_gamma[chan]) * p.m_scale[chan] - p.m_offset[chan];
+
+        case GammaRenderParams::MONCURVE_MIRROR_FWD:
+        {
+            const float pixel = std::fabs(in);
+            return std::copysign(1.0f, in)
+                * (pixel <= p.m_breakPnt[chan]
+                    ? pixel * p.m_slope[chan]
+                    : std::pow(pixel * p.m_scale[chan] + p.m_offset[chan], p.m_gamma[chan]));
+        }
+
+        case GammaRenderParams::MONCURVE_MIRROR_REV:
+        {
+            const float pixel = std::fabs(in);
+            return std::copysign(1.0f, in)
+                * (pixel <= p.m_breakPnt[chan]
+                    ? pixel * p.m_slope[chan]
+                    : std::pow(pixel, p.m_gamma[chan]) * p.m_scale[chan] - p.m_offset[chan]);
+        }
+    }
+
+    return in;
+}
+
+// Process packed RGBA pixels with the scalar computations.
+template<GammaRenderParams::Style STYLE>
+void ApplyGammaRGBA(const GammaRenderParams & p, const void * inImg, void * outImg,
+                    long numPixels)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        out[0] = ComputeGamma<STYLE>(p, 0, in[0]);
+        out[1] = ComputeGamma<STYLE>(p, 1, in[1]);
+        out[2] = ComputeGamma<STYLE>(p, 2, in[2]);
+        out[3] = ComputeGamma<STYLE>(p, 3, in[3]);
+
+        in  += 4;
+        out += 4;
+    }
+}
+
+#if OCIO_USE_SSE2
+// Same computations as the SSE renderers for four values of the same channel.
+template<GammaRenderParams::Style STYLE>
+inline __m128 ComputeGammaSSE(__m128 pixel, __m128 gamma, __m128 scale, __m128 offset,
+                              __m128 breakPnt, __m128 slope)
+{
+    switch (STYLE)
+    {
+        case GammaRenderParams::BASIC:
+            return ssePower(pixel, gamma);
+
+        case GammaRenderParams::BASIC_MIRROR:
+            return _mm_or_ps(_mm_and_ps(pixel, ESIGN_MASK),
+                             ssePower(_mm_and_ps(pixel, EABS_MASK), gamma));
+
+        case GammaRenderParams::BASIC_PASS_THRU:
+        {
+            const __m128 data = ssePower(pixel, gamma);
+            const __m128 flag = _mm_cmpgt_ps(pixel, _mm_setzero_ps());
+            return _mm_or_ps(_mm_and_ps(flag, data), _mm_andnot_ps(flag, pixel));
+        }
+
+        case GammaRenderParams::MONCURVE_FWD:
+        {
+            const __m128 data = ssePower(_mm_add_ps(_mm_mul_ps(pixel, scale), offset), gamma);
+            const __m128 flag = _mm_cmpgt_ps(pixel, breakPnt);
+            return _mm_or_ps(_mm_and_ps(flag, data),
+                             _mm_andnot_ps(flag, _mm_mul_ps(pixel, slope)));
+        }
+
+        case GammaRenderParams::MONCURVE_REV:
+        {
+            const __m128 data = _mm_sub_ps(_mm_mul_ps(ssePower(pixel, gamma), scale), offset);
+            const __m128 flag = _mm_cmpgt_ps(pixel, breakPnt);
+            return _mm_or_ps(_mm_and_ps(flag, data),
+                             _mm_andnot_ps(flag, _mm_mul_ps(pixel, slope)));
+        }
+
+        case GammaRenderParams::MONCURVE_MIRROR_FWD:
+        {
+            const __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
+            const __m128 data = ssePower(_mm_add_ps(_mm_mul_ps(abs_pix, scale), offset), gamma);
+            const __m128 flag = _mm_cmpgt_ps(abs_pix, breakPnt);
+            return _mm_or_ps(_mm_and_ps(pixel, ESIGN_MASK),
+                             _mm_or_ps(_mm_and_ps(flag, data),
+                                       _mm_andnot_ps(flag, _mm_mul_ps(abs_pix, slope))));
+        }
+
+        case GammaRenderParams::MONCURVE_MIRROR_REV:
+        {
+            const __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
+            const __m128 data = _mm_sub_ps(_mm_mul_ps(ssePower(abs_pix, gamma), scale), offset);
+            const __m128 flag = _mm_cmpgt_ps(abs_pix, breakPnt);
+            return _mm_or_ps(_mm_and_ps(pixel, ESIGN_MASK),
+                             _mm_or_ps(_mm_and_ps(flag, data),
+                                       _mm_andnot_ps(flag, _mm_mul_ps(abs_pix, slope))));
+        }
+    }
+
+    return pixel;
+}
+#endif
+
+template<GammaRenderParams::Style STYLE, bool fastPower>
+void ApplyGammaPlane(const GammaRenderParams & p, int chan, float * plane, long numPixels)
+{
+#if OCIO_USE_SSE2
+    if (fastPower)
+    {
+        const __m128 gamma    = _mm_set1_ps(p.m_gamma[chan]);
+        const __m128 scale    = _mm_set1_ps(p.m_scale[chan]);
+        const __m128 offset   = _mm_set1_ps(p.m_offset[chan]);
+        const __m128 breakPnt = _mm_set1_ps(p.m_breakPnt[chan]);
+        const __m128 slope    = _mm_set1_ps(p.m_slope[chan]);
+
+        long idx = 0;
+        for (; idx + 4 <= numPixels; idx += 4)
+        {
+            const __m128 pixel = _mm_loadu_ps(plane + idx);
+            _mm_storeu_ps(plane + idx,
+                          ComputeGammaSSE<STYLE>(pixel, gamma, scale, offset, breakPnt, slope));
+        }
+
+        // Use the same computation for the remaining values.
+        if (idx < numPixels)
+        {
+            float tmp[4]{ 0.0f, 0.0f, 0.0f, 0.0f };
+            std::copy(plane + idx, plane + numPixels, tmp);
+
+            const __m128 pixel = _mm_loadu_ps(tmp);
+            _mm_storeu_ps(tmp,
+                          ComputeGammaSSE<STYLE>(pixel, gamma, scale, offset, breakPnt, slope));
+
+            std::copy(tmp, tmp + (numPixels - idx), plane + idx);
+        }
+
+        return;
+    }
+#endif
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        plane[idx] = ComputeGamma<STYLE>(p, chan, plane[idx]);
+    }
+}
+
+// Planar processing of the four channels, the fast power is the one of the SSE renderers.
+template<bool fastPower>
+void ApplyGammaPlanar(const GammaRenderParams & params,
+                      float * rPlane, float * gPlane, float * bPlane, float * aPlane,
+                      long numPixels)
+{
+    float * planes[4] = { rPlane, gPlane, bPlane, aPlane };
+
+    for (int chan = 0; chan < 4; ++chan)
+    {
+        switch (params.m_style)
+        {
+            case GammaRenderParams::BASIC:
+                ApplyGammaPlane<GammaRenderParams::BASIC, fastPower>(
+                    params, chan, planes[chan], numPixels);
+                break;
+            case GammaRenderParams::BASIC_MIRROR:
+                ApplyGammaPlane<GammaRenderParams::BASIC_MIRROR, fastPower>(
+                    params, chan, planes[chan], numPixels);
+                break;
+            case GammaRenderParams::BASIC_PASS_THRU:
+                ApplyGammaPlane<GammaRenderParams::BASIC_PASS_THRU, fastPower>(
+                    params, chan, planes[chan], numPixels);
+                break;
+            case GammaRenderParams::MONCURVE_FWD:
+                ApplyGammaPlane<GammaRenderParams::MONCURVE_FWD, fastPower>(
+                    params, chan, planes[chan], numPixels);
+                break;
+            case GammaRenderParams::MONCURVE_REV:
+                ApplyGammaPlane<GammaRenderParams::MONCURVE_REV, fastPower>(
+                    params, chan, planes[chan], numPixels);
+                break;
+            case GammaRenderParams::MONCURVE_MIRROR_FWD:
+                ApplyGammaPlane<GammaRenderParams::MONCURVE_MIRROR_FWD, fastPower>(
+                    params, chan, planes[chan], numPixels);
+                break;
+            case GammaRenderParams::MONCURVE_MIRROR_REV:
+                ApplyGammaPlane<GammaRenderParams::MONCURVE_MIRROR_REV, fastPower>(
+                    params, chan, planes[chan], numPixels);
+                break;
+        }
+    }
+}
+
+// Packed RGB processing (i.e. three values per pixel) of the color channels.
+template<GammaRenderParams::Style STYLE, bool fastPower>
+void ApplyGammaRGB(const GammaRenderParams & p, const float * in, float * out, long numPixels)
+{
+#if OCIO_USE_SSE2
+    if (fastPower)
+    {
+        __m128 gamma[3], scale[3], offset[3], breakPnt[3], slope[3];
+        for (int reg = 0; reg < 3; ++reg)
+        {
+            gamma[reg]    = sseRGBChannels(p.m_gamma, reg);
+            scale[reg]    = sseRGBChannels(p.m_scale, reg);
+            offset[reg]   = sseRGBChannels(p.m_offset, reg);
+            breakPnt[reg] = sseRGBChannels(p.m_breakPnt, reg);
+            slope[reg]    = sseRGBChannels(p.m_slope, reg);
+        }
+
+        auto computeRGB = [&](const float * src, float * dst)
+        {
+            for (int reg = 0; reg < 3; ++reg)
+            {
+                const __m128 pixel = _mm_loadu_ps(src + 4 * reg);
+                _mm_storeu_ps(dst + 4 * reg,
+                              ComputeGammaSSE<STYLE>(pixel, gamma[reg], scale[reg], offset[reg],
+                                                     breakPnt[reg], slope[reg]));
+            }
+        };
+
+        long idx = 0;
+        for (; idx + 4 <= numPixels; idx += 4)
+        {
+            computeRGB(in + 3 * idx, out + 3 * idx);
+        }
+
+        // Use the same computation for the remaining pixels.
+        if (idx < numPixels)
+        {
+            float tmp[12]{ 0.0f };
+            std::copy(in + 3 * idx, in + 3 * numPixels, tmp);
+
+            computeRGB(tmp, tmp);
+
+            std::copy(tmp, tmp + 3 * (numPixels - idx), out + 3 * idx);
+        }
+
+        return;
+    }
+#endif
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        for (int chan = 0; chan < 3; ++chan)
+        {
+            out[3 * idx + chan] = ComputeGamma<STYLE>(p, chan, in[3 * idx + chan]);
+        }
+    }
+}
+
+template<bool fastPower>
+void ApplyGammaPackedRGB(const GammaRenderParams & params,
+                         const float * in, float * out, long numPixels)
+{
+    switch (params.m_style)
+    {
+        case GammaRenderParams::BASIC:
+            ApplyGammaRGB<GammaRenderParams::BASIC, fastPower>(params, in, out, numPixels);
+            break;
+        case GammaRenderParams::BASIC_MIRROR:
+            ApplyGammaRGB<GammaRenderParams::BASIC_MIRROR, fastPower>(params, in, out, numPixels);
+            break;
+        case GammaRenderParams::BASIC_PASS_THRU:
+            ApplyGammaRGB<GammaRenderParams::BASIC_PASS_THRU, fastPower>(
+                params, in, out, numPixels);
+            break;
+        case GammaRenderParams::MONCURVE_FWD:
+            ApplyGammaRGB<GammaRenderParams::MONCURVE_FWD, fastPower>(params, in, out, numPixels);
+            break;
+        case GammaRenderParams::MONCURVE_REV:
+            ApplyGammaRGB<GammaRenderParams::MONCURVE_REV, fastPower>(params, in, out, numPixels);
+            break;
+        case GammaRenderParams::MONCURVE_MIRROR_FWD:
+            ApplyGammaRGB<GammaRenderParams::MONCURVE_MIRROR_FWD, fastPower>(
+                params, in, out, numPixels);
+            break;
+        case GammaRenderParams::MONCURVE_MIRROR_REV:
+            ApplyGammaRGB<GammaRenderParams::MONCURVE_MIRROR_REV, fastPower>(
+                params, in, out, numPixels);
+            break;
+    }
+}
+
+} // anon.
+
 // Base class for the Gamma (i.e. basic style) operation renderers.
 class GammaBasicOpCPU : public OpCPU
 {
@@ -30,14 +373,28 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * rPlane, float * gPlane, float * bPlane, float * aPlane,
+                     long numPixels) const override;
+
+    bool hasPackedRGBApply() const override { return true; }
+    void applyPackedRGB(const void * inImg, void * outImg, long numPixels) const override;
+
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
 
+    // Fill the parameters of the vectorized implementations.
+    void fillRenderParams(GammaRenderParams & params) const;
+
 protected:
     float m_redGamma;
     float m_grnGamma;
     float m_bluGamma;
     float m_alpGamma;
+
+    GammaRenderParams::Style m_style;
+    // Do the planar & packed RGB processing use the fast power of the SSE renderers?
+    bool m_fastPower = false;
 };
 
 #if OCIO_USE_SSE2
@@ -47,6 +404,7 @@ public:
     explicit GammaBasicOpCPUSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaBasicOpCPU(gamma)
     {
+        m_fastPower = true;
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
@@ -70,6 +428,7 @@ public:
     explicit GammaBasicMirrorOpCPUSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaBasicMirrorOpCPU(gamma)
     {
+        m_fastPower = true;
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
@@ -93,6 +452,7 @@ public:
     explicit GammaBasicPassThruOpCPUSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaBasicPassThruOpCPU(gamma)
     {
+        m_fastPower = true;
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
@@ -101,14 +461,33 @@ public:
 
 class GammaMoncurveOpCPU : public OpCPU
 {
+public:
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * rPlane, float * gPlane, float * bPlane, float * aPlane,
+                     long numPixels) const override;
+
+    bool hasPackedRGBApply() const override { return true; }
+    void applyPackedRGB(const void * inImg, void * outImg, long numPixels) const override;
+
 protected:
-    explicit GammaMoncurveOpCPU(ConstGammaOpDataRcPtr &) : OpCPU() {}
+    explicit GammaMoncurveOpCPU(ConstGammaOpDataRcPtr & gamma)
+        : OpCPU()
+        , m_style(GetRenderStyle(gamma->getStyle()))
+    {
+    }
+
+    // Fill the parameters of the vectorized implementations.
+    void fillRenderParams(GammaRenderParams & params) const;
 
 protected:
     RendererParams m_red;
     RendererParams m_green;
     RendererParams m_blue;
     RendererParams m_alpha;
+
+    GammaRenderParams::Style m_style;
+    // Do the planar & packed RGB processing use the fast power of the SSE renderers?
+    bool m_fastPower = false;
 };
 
 class GammaMoncurveOpCPUFwd : public GammaMoncurveOpCPU
@@ -129,6 +508,7 @@ public:
     explicit GammaMoncurveOpCPUFwdSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaMoncurveOpCPUFwd(gamma)
     {
+        m_fastPower = true;
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
@@ -154,6 +534,7 @@ public:
     explicit GammaMoncurveOpCPURevSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaMoncurveOpCPURev(gamma)
     {
+        m_fastPower = true;
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
@@ -178,6 +559,7 @@ public:
     explicit GammaMoncurveMirrorOpCPUFwdSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaMoncurveMirrorOpCPUFwd(gamma)
     {
+        m_fastPower = true;
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
@@ -202,22 +584,87 @@ public:
     explicit GammaMoncurveMirrorOpCPURevSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaMoncurveMirrorOpCPURev(gamma)
     {
+        m_fastPower = true;
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 };
 #endif
 
+#if OCIO_USE_AVX2 || OCIO_USE_AVX512
+typedef void (GammaApplyFunc)(const GammaRenderParams & params, const float * src, float * dst, long numPixels);
+
+// Return the fastest vectorized implementation supported by the CPU, or null if none.
+GammaApplyFunc * GetGammaApplyFunc()
+{
+    GammaApplyFunc * func = nullptr;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        func = applyGammaAVX2;
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        func = applyGammaAVX512;
+    }
+#endif
+
+    return func;
+}
+
+// Renderer for the AVX2 & AVX-512 implementations i.e. the parameters computed by the renderer
+// are converted into the form used by the vectorized implementations.
+template<typename Renderer, GammaRenderParams::Style STYLE>
+class GammaRendererAVX : public Renderer
+{
+public:
+    GammaRendererAVX(ConstGammaOpDataRcPtr & gamma, GammaApplyFunc * applyFunc)
+        : Renderer(gamma)
+        , m_applyFunc(applyFunc)
+    {
+        this->fillRenderParams(m_params);
+        m_params.m_style = STYLE;
+
+        // The planar & packed RGB processing use the SSE fast power.
+        this->m_fastPower = true;
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override
+    {
+        m_applyFunc(m_params, (const float *)inImg, (float *)outImg, numPixels);
+    }
+
+private:
+    GammaRenderParams m_params;
+    GammaApplyFunc * m_applyFunc;
+};
+#endif
+
 ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
 {
 #if OCIO_USE_SSE2 == 0
     std::ignore = fastPower;
 #endif
 
+#if OCIO_USE_AVX2 || OCIO_USE_AVX512
+    GammaApplyFunc * applyFunc = fastPower ? GetGammaApplyFunc() : nullptr;
+#endif
+
     switch(gamma->getStyle())
     {
         case GammaOpData::MONCURVE_FWD:
         {
+#if OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (applyFunc)
+            {
+                return std::make_shared<GammaRendererAVX<GammaMoncurveOpCPUFwd, GammaRenderParams::MONCURVE_FWD>>(
+                    gamma, applyFunc);
+            }
+#endif
 #if OCIO_USE_SSE2
             if (fastPower) return std::make_shared<GammaMoncurveOpCPUFwdSSE>(gamma);
             else
@@ -228,6 +675,13 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
 
         case GammaOpData::MONCURVE_REV:
         {
+#if OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (applyFunc)
+            {
+                return std::make_shared<GammaRendererAVX<GammaMoncurveOpCPURev, GammaRenderParams::MONCURVE_REV>>(
+                    gamma, applyFunc);
+            }
+#endif
 #if OCIO_USE_SSE2
             if (fastPower) return std::make_shared<GammaMoncurveOpCPURevSSE>(gamma);
             else
@@ -238,6 +692,13 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
 
         case GammaOpData::MONCURVE_MIRROR_FWD:
         {
+#if OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (applyFunc)
+            {
+                return std::make_shared<GammaRendererAVX<GammaMoncurveMirrorOpCPUFwd, GammaRenderParams::MONCURVE_MIRROR_FWD>>(
+                    gamma, applyFunc);
+            }
+#endif
 #if OCIO_USE_SSE2
             if (fastPower) return std::make_shared<GammaMoncurveMirrorOpCPUFwdSSE>(gamma);
             else
@@ -248,6 +709,13 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
 
         case GammaOpData::MONCURVE_MIRROR_REV:
         {
+#if OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (applyFunc)
+            {
+                return std::make_shared<GammaRendererAVX<GammaMoncurveMirrorOpCPURev, GammaRenderParams::MONCURVE_MIRROR_REV>>(
+                    gamma, applyFunc);
+            }
+#endif
 #if OCIO_USE_SSE2
             if (fastPower) return std::make_shared<GammaMoncurveMirrorOpCPURevSSE>(gamma);
             else
@@ -259,6 +727,13 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
         case GammaOpData::BASIC_FWD:
         case GammaOpData::BASIC_REV:
         {
+#if OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (applyFunc)
+            {
+                return std::make_shared<GammaRendererAVX<GammaBasicOpCPU, GammaRenderParams::BASIC>>(
+                    gamma, applyFunc);
+            }
+#endif
 #if OCIO_USE_SSE2
             if (fastPower) return std::make_shared<GammaBasicOpCPUSSE>(gamma);
             else
@@ -269,6 +744,13 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
         case GammaOpData::BASIC_MIRROR_FWD:
         case GammaOpData::BASIC_MIRROR_REV:
         {
+#if OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (applyFunc)
+            {
+                return std::make_shared<GammaRendererAVX<GammaBasicMirrorOpCPU, GammaRenderParams::BASIC_MIRROR>>(
+                    gamma, applyFunc);
+            }
+#endif
 #if OCIO_USE_SSE2
             if (fastPower) return std::make_shared<GammaBasicMirrorOpCPUSSE>(gamma);
             else
@@ -279,6 +761,13 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
         case GammaOpData::BASIC_PASS_THRU_FWD:
         case GammaOpData::BASIC_PASS_THRU_REV:
         {
+#if OCIO_USE_AVX2 || OCIO_USE_AVX512
+            if (applyFunc)
+            {
+                return std::make_shared<GammaRendererAVX<GammaBasicPassThruOpCPU, GammaRenderParams::BASIC_PASS_THRU>>(
+                    gamma, applyFunc);
+            }
+#endif
 #if OCIO_USE_SSE2
             if (fastPower) return std::make_shared<GammaBasicPassThruOpCPUSSE>(gamma);
             else
@@ -298,6 +787,7 @@ GammaBasicOpCPU::GammaBasicOpCPU(ConstGammaOpDataRcPtr & gamma)
     ,   m_grnGamma(0.0f)
     ,   m_bluGamma(0.0f)
     ,   m_alpGamma(0.0f)
+    ,   m_style(GetRenderStyle(gamma->getStyle()))
 {
     update(gamma);
 }
@@ -317,6 +807,47 @@ void GammaBasicOpCPU::update(ConstGammaOpDataRcPtr & gamma)
     m_alpGamma = (float)(forward ? gamma->getAlphaParams()[0] : 1. / gamma->getAlphaParams()[0]);
 }
 
+void GammaBasicOpCPU::fillRenderParams(GammaRenderParams & params) const
+{
+    params.m_gamma[0] = m_redGamma;
+    params.m_gamma[1] = m_grnGamma;
+    params.m_gamma[2] = m_bluGamma;
+    params.m_gamma[3] = m_alpGamma;
+
+    params.m_style = m_style;
+}
+
+void GammaBasicOpCPU::applyPlanar(float * rPlane, float * gPlane, float * bPlane, float * aPlane,
+                                  long numPixels) const
+{
+    GammaRenderParams params;
+    fillRenderParams(params);
+
+    if (m_fastPower)
+    {
+        ApplyGammaPlanar<true>(params, rPlane, gPlane, bPlane, aPlane, numPixels);
+    }
+    else
+    {
+        ApplyGammaPlanar<false>(params, rPlane, gPlane, bPlane, aPlane, numPixels);
+    }
+}
+
+void GammaBasicOpCPU::applyPackedRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    GammaRenderParams params;
+    fillRenderParams(params);
+
+    if (m_fastPower)
+    {
+        ApplyGammaPackedRGB<true>(params, (const float *)inImg, (float *)outImg, numPixels);
+    }
+    else
+    {
+        ApplyGammaPackedRGB<false>(params, (const float *)inImg, (float *)outImg, numPixels);
+    }
+}
+
 #if OCIO_USE_SSE2
 void GammaBasicOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
@@ -341,24 +872,10 @@ void GammaBasicOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels
 
 void GammaBasicOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-    
-    for(long idx=0; idx<numPixels; ++idx)
-    {
-        const float pixel[4] = { std::max(0.0f, in[0]), 
-                                 std::max(0.0f, in[1]), 
-                                 std::max(0.0f, in[2]),
-                                 std::max(0.0f, in[3]) };
+    GammaRenderParams params;
+    fillRenderParams(params);
 
-        out[0] = std::pow(pixel[0], m_redGamma);
-        out[1] = std::pow(pixel[1], m_grnGamma);
-        out[2] = std::pow(pixel[2], m_bluGamma);
-        out[3] = std::pow(pixel[3], m_alpGamma);
-
-        in  += 4;
-        out += 4;
-    }
+    ApplyGammaRGBA<GammaRenderParams::BASIC>(params, inImg, outImg, numPixels);
 }
 
 GammaBasicMirrorOpCPU::GammaBasicMirrorOpCPU(ConstGammaOpDataRcPtr & gamma)
@@ -393,24 +910,10 @@ void GammaBasicMirrorOpCPUSSE::apply(const void * inImg, void * outImg, long num
 
 void GammaBasicMirrorOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    GammaRenderParams params;
+    fillRenderParams(params);
 
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        const float sign[4] = { std::copysign(1.0f, in[0]), std::copysign(1.0f, in[1]),
-                                std::copysign(1.0f, in[2]), std::copysign(1.0f, in[3]) };
-        const float pixel[4] = { std::fabs(in[0]), std::fabs(in[1]),
-                                 std::fabs(in[2]), std::fabs(in[3]) };
-
-        out[0] = sign[0] * std::pow(pixel[0], m_redGamma);
-        out[1] = sign[1] * std::pow(pixel[1], m_grnGamma);
-        out[2] = sign[2] * std::pow(pixel[2], m_bluGamma);
-        out[3] = sign[3] * std::pow(pixel[3], m_alpGamma);
-
-        in += 4;
-        out += 4;
-    }
+    ApplyGammaRGBA<GammaRenderParams::BASIC_MIRROR>(params, inImg, outImg, numPixels);
 }
 
 GammaBasicPassThruOpCPU::GammaBasicPassThruOpCPU(ConstGammaOpDataRcPtr & gamma)
@@ -449,20 +952,56 @@ void GammaBasicPassThruOpCPUSSE::apply(const void * inImg, void * outImg, long n
 
 void GammaBasicPassThruOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    GammaRenderParams params;
+    fillRenderParams(params);
 
-    for (long idx = 0; idx<numPixels; ++idx)
+    ApplyGammaRGBA<GammaRenderParams::BASIC_PASS_THRU>(params, inImg, outImg, numPixels);
+}
+
+void GammaMoncurveOpCPU::fillRenderParams(GammaRenderParams & params) const
+{
+    const RendererParams * channels[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+
+    for (int i = 0; i < 4; ++i)
     {
-        const float pixel[4] = { in[0], in[1], in[2], in[3] };
+        params.m_gamma[i]    = channels[i]->gamma;
+        params.m_scale[i]    = channels[i]->scale;
+        params.m_offset[i]   = channels[i]->offset;
+        params.m_breakPnt[i] = channels[i]->breakPnt;
+        params.m_slope[i]    = channels[i]->slope;
+    }
 
-        out[0] = pixel[0] > 0.f ? std::pow(pixel[0], m_redGamma) : pixel[0];
-        out[1] = pixel[1] > 0.f ? std::pow(pixel[1], m_grnGamma) : pixel[1];
-        out[2] = pixel[2] > 0.f ? std::pow(pixel[2], m_bluGamma) : pixel[2];
-        out[3] = pixel[3] > 0.f ? std::pow(pixel[3], m_alpGamma) : pixel[3];
+    params.m_style = m_style;
+}
 
-        in += 4;
-        out += 4;
+void GammaMoncurveOpCPU::applyPlanar(float * rPlane, float * gPlane, float * bPlane,
+                                     float * aPlane, long numPixels) const
+{
+    GammaRenderParams params;
+    fillRenderParams(params);
+
+    if (m_fastPower)
+    {
+        ApplyGammaPlanar<true>(params, rPlane, gPlane, bPlane, aPlane, numPixels);
+    }
+    else
+    {
+        ApplyGammaPlanar<false>(params, rPlane, gPlane, bPlane, aPlane, numPixels);
+    }
+}
+
+void GammaMoncurveOpCPU::applyPackedRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    GammaRenderParams params;
+    fillRenderParams(params);
+
+    if (m_fastPower)
+    {
+        ApplyGammaPackedRGB<true>(params, (const float *)inImg, (float *)outImg, numPixels);
+    }
+    else
+    {
+        ApplyGammaPackedRGB<false>(params, (const float *)inImg, (float *)outImg, numPixels);
     }
 }
 
@@ -524,35 +1063,10 @@ void GammaMoncurveOpCPUFwdSSE::apply(const void * inImg, void * outImg, long num
 
 void GammaMoncurveOpCPUFwd::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    const float red[5] = { m_red.scale,  m_red.offset,
-                           m_red.gamma,  m_red.breakPnt, m_red.slope };
-    const float grn[5] = { m_green.scale, m_green.offset, 
-                           m_green.gamma, m_green.breakPnt, m_green.slope };
-    const float blu[5] = { m_blue.scale,  m_blue.offset,
-                           m_blue.gamma,  m_blue.breakPnt, m_blue.slope };
-    const float alp[5] = { m_alpha.scale, m_alpha.offset, 
-                           m_alpha.gamma, m_alpha.breakPnt, m_alpha.slope };
-
-    for(long idx=0; idx<numPixels; ++idx)
-    {
-        const float pixel[4] = { in[0], in[1], in[2], in[3] };
+    GammaRenderParams params;
+    fillRenderParams(params);
 
-        const float data[4] = { std::pow(pixel[0] * red[0] + red[1], red[2]),
-                                std::pow(pixel[1] * grn[0] + grn[1], grn[2]),
-                                std::pow(pixel[2] * blu[0] + blu[1], blu[2]),
-                                std::pow(pixel[3] * alp[0] + alp[1], alp[2]) };
-
-        out[0] = pixel[0]<=red[3] ? pixel[0] * red[4] : data[0];
-        out[1] = pixel[1]<=grn[3] ? pixel[1] * grn[4] : data[1];
-        out[2] = pixel[2]<=blu[3] ? pixel[2] * blu[4] : data[2];
-        out[3] = pixel[3]<=alp[3] ? pixel[3] * alp[4] : data[3];
-
-        in  += 4;
-        out += 4;
-    }
+    ApplyGammaRGBA<GammaRenderParams::MONCURVE_FWD>(params, inImg, outImg, numPixels);
 }
 
 GammaMoncurveOpCPURev::GammaMoncurveOpCPURev(ConstGammaOpDataRcPtr & gamma)
@@ -613,35 +1127,10 @@ void GammaMoncurveOpCPURevSSE::apply(const void * inImg, void * outImg, long num
 
 void GammaMoncurveOpCPURev::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    const float red[5] = { m_red.gamma,  m_red.scale,
-                           m_red.offset, m_red.breakPnt, m_red.slope };
-    const float grn[5] = { m_green.gamma, m_green.scale, 
-                           m_green.offset,m_green.breakPnt, m_green.slope };
-    const float blu[5] = { m_blue.gamma,  m_blue.scale,
-                           m_blue.offset, m_blue.breakPnt, m_blue.slope  };
-    const float alp[5] = { m_alpha.gamma,  m_alpha.scale, 
-                           m_alpha.offset, m_alpha.breakPnt, m_alpha.slope };
-
-    for(long idx=0; idx<numPixels; ++idx)
-    {
-        const float pixel[4] = { in[0], in[1], in[2], in[3] };
-
-        const float data[4] = { std::pow(pixel[0], red[0]) * red[1] - red[2],
-                                std::pow(pixel[1], grn[0]) * grn[1] - grn[2],
-                                std::pow(pixel[2], blu[0]) * blu[1] - blu[2],
-                                std::pow(pixel[3], alp[0]) * alp[1] - alp[2] };
-
-        out[0] = pixel[0]<=red[3] ? pixel[0] * red[4] : data[0];
-        out[1] = pixel[1]<=grn[3] ? pixel[1] * grn[4] : data[1];
-        out[2] = pixel[2]<=blu[3] ? pixel[2] * blu[4] : data[2];
-        out[3] = pixel[3]<=alp[3] ? pixel[3] * alp[4] : data[3];
+    GammaRenderParams params;
+    fillRenderParams(params);
 
-        in  += 4;
-        out += 4;
-    }
+    ApplyGammaRGBA<GammaRenderParams::MONCURVE_REV>(params, inImg, outImg, numPixels);
 }
 
 GammaMoncurveMirrorOpCPUFwd::GammaMoncurveMirrorOpCPUFwd(ConstGammaOpDataRcPtr & gamma)
@@ -706,38 +1195,10 @@ void GammaMoncurveMirrorOpCPUFwdSSE::apply(const void * inImg, void * outImg, lo
 
 void GammaMoncurveMirrorOpCPUFwd::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-    const float red[5] = { m_red.scale,  m_red.offset,
-                           m_red.gamma,  m_red.breakPnt, m_red.slope };
-    const float grn[5] = { m_green.scale, m_green.offset,
-                           m_green.gamma, m_green.breakPnt, m_green.slope };
-    const float blu[5] = { m_blue.scale,  m_blue.offset,
-                           m_blue.gamma,  m_blue.breakPnt, m_blue.slope };
-    const float alp[5] = { m_alpha.scale, m_alpha.offset,
-                           m_alpha.gamma, m_alpha.breakPnt, m_alpha.slope };
-
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        const float sign[4] = { std::copysign(1.0f, in[0]), std::copysign(1.0f, in[1]),
-                                std::copysign(1.0f, in[2]), std::copysign(1.0f, in[3]) };
-
-        const float pixel[4] = { std::fabs(in[0]), std::fabs(in[1]),
-                                 std::fabs(in[2]), std::fabs(in[3]) };
+    GammaRenderParams params;
+    fillRenderParams(params);
 
-        const float data[4] = { std::pow(pixel[0] * red[0] + red[1], red[2]),
-                                std::pow(pixel[1] * grn[0] + grn[1], grn[2]),
-                                std::pow(pixel[2] * blu[0] + blu[1], blu[2]),
-                                std::pow(pixel[3] * alp[0] + alp[1], alp[2]) };
-
-        out[0] = sign[0] * (pixel[0] <= red[3] ? pixel[0] * red[4] : data[0]);
-        out[1] = sign[1] * (pixel[1] <= grn[3] ? pixel[1] * grn[4] : data[1]);
-        out[2] = sign[2] * (pixel[2] <= blu[3] ? pixel[2] * blu[4] : data[2]);
-        out[3] = sign[3] * (pixel[3] <= alp[3] ? pixel[3] * alp[4] : data[3]);
-
-        in  += 4;
-        out += 4;
-    }
+    ApplyGammaRGBA<GammaRenderParams::MONCURVE_MIRROR_FWD>(params, inImg, outImg, numPixels);
 }
 
 GammaMoncurveMirrorOpCPURev::GammaMoncurveMirrorOpCPURev(ConstGammaOpDataRcPtr & gamma)
@@ -802,39 +1263,10 @@ void GammaMoncurveMirrorOpCPURevSSE::apply(const void * inImg, void * outImg, lo
 
 void GammaMoncurveMirrorOpCPURev::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    GammaRenderParams params;
+    fillRenderParams(params);
 
-    const float red[5] = { m_red.gamma,  m_red.scale,
-                           m_red.offset, m_red.breakPnt, m_red.slope };
-    const float grn[5] = { m_green.gamma, m_green.scale,
-                           m_green.offset,m_green.breakPnt, m_green.slope };
-    const float blu[5] = { m_blue.gamma,  m_blue.scale,
-                           m_blue.offset, m_blue.breakPnt, m_blue.slope };
-    const float alp[5] = { m_alpha.gamma,  m_alpha.scale,
-                           m_alpha.offset, m_alpha.breakPnt, m_alpha.slope };
-
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        const float sign[4] = { std::copysign(1.0f, in[0]), std::copysign(1.0f, in[1]),
-                                std::copysign(1.0f, in[2]), std::copysign(1.0f, in[3]) };
-
-        const float pixel[4] = { std::fabs(in[0]), std::fabs(in[1]),
-                                 std::fabs(in[2]), std::fabs(in[3]) };
-
-        const float data[4] = { std::pow(pixel[0], red[0]) * red[1] - red[2],
-                                std::pow(pixel[1], grn[0]) * grn[1] - grn[2],
-                                std::pow(pixel[2], blu[0]) * blu[1] - blu[2],
-                                std::pow(pixel[3], alp[0]) * alp[1] - alp[2] };
-
-        out[0] = sign[0] * (pixel[0] <= red[3] ? pixel[0] * red[4] : data[0]);
-        out[1] = sign[1] * (pixel[1] <= grn[3] ? pixel[1] * grn[4] : data[1]);
-        out[2] = sign[2] * (pixel[2] <= blu[3] ? pixel[2] * blu[4] : data[2]);
-        out[3] = sign[3] * (pixel[3] <= alp[3] ? pixel[3] * alp[4] : data[3]);
-
-        in  += 4;
-        out += 4;
-    }
+    ApplyGammaRGBA<GammaRenderParams::MONCURVE_MIRROR_REV>(params, inImg, outImg, numPixels);
 }
 
 } // namespace OCIO_NAMESPACE
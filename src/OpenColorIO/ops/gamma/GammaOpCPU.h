@@ -17,6 +17,34 @@ namespace OCIO_NAMESPACE
 // Get the Gamma dedicated renderer.
 ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower);
 
+// Per channel (i.e. including alpha) parameters of the vectorized (i.e. AVX2 & AVX-512)
+// renderers which use the fast power. The basic styles only use m_gamma, the moncurve styles
+// use the parameters computed by ComputeParamsFwd() & ComputeParamsRev():
+//   Fwd: out = in > m_breakPnt ? pow( in * m_scale + m_offset, m_gamma ) : in * m_slope
+//   Rev: out = in > m_breakPnt ? pow( in, m_gamma ) * m_scale - m_offset : in * m_slope
+// The mirror styles process the absolute value and then restore the sign.
+struct GammaRenderParams
+{
+    enum Style
+    {
+        BASIC = 0,
+        BASIC_MIRROR,
+        BASIC_PASS_THRU,
+        MONCURVE_FWD,
+        MONCURVE_REV,
+        MONCURVE_MIRROR_FWD,
+        MONCURVE_MIRROR_REV
+    };
+
+    Style m_style{ BASIC };
+
+    float m_gamma[4]{ 1.0f, 1.0f, 1.0f, 1.0f };
+    float m_scale[4]{ 1.0f, 1.0f, 1.0f, 1.0f };
+    float m_offset[4]{ 0.0f, 0.0f, 0.0f, 0.0f };
+    float m_breakPnt[4]{ 0.0f, 0.0f, 0.0f, 0.0f };
+    float m_slope[4]{ 1.0f, 1.0f, 1.0f, 1.0f };
+};
+
 } // namespace OCIO_NAMESPACE
 
 
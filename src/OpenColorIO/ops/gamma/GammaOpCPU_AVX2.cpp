@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "GammaOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+typedef GammaRenderParams::Style Style;
+
+struct GammaContextAVX2 {
+    __m256 gamma[4];
+    __m256 scale[4];
+    __m256 offset[4];
+    __m256 breakPnt[4];
+    __m256 slope[4];
+};
+
+template<Style STYLE>
+static inline __m256 gamma_channel_avx2(const GammaContextAVX2 & ctx, int i, __m256 pix)
+{
+    switch (STYLE)
+    {
+        case GammaRenderParams::BASIC:
+        {
+            return avx2Power(pix, ctx.gamma[i]);
+        }
+        case GammaRenderParams::BASIC_PASS_THRU:
+        {
+            // Values smaller or equal to zero (and NaNs) are passed through.
+            const __m256 flag = _mm256_cmp_ps(pix, _mm256_setzero_ps(), _CMP_GT_OQ);
+            return _mm256_blendv_ps(pix, avx2Power(pix, ctx.gamma[i]), flag);
+        }
+        case GammaRenderParams::MONCURVE_FWD:
+        {
+            __m256 data = _mm256_add_ps(_mm256_mul_ps(pix, ctx.scale[i]), ctx.offset[i]);
+            data = avx2Power(data, ctx.gamma[i]);
+
+            const __m256 flag = _mm256_cmp_ps(pix, ctx.breakPnt[i], _CMP_GT_OQ);
+            return _mm256_blendv_ps(_mm256_mul_ps(pix, ctx.slope[i]), data, flag);
+        }
+        case GammaRenderParams::MONCURVE_REV:
+        {
+            __m256 data = avx2Power(pix, ctx.gamma[i]);
+            data = _mm256_sub_ps(_mm256_mul_ps(data, ctx.scale[i]), ctx.offset[i]);
+
+            const __m256 flag = _mm256_cmp_ps(pix, ctx.breakPnt[i], _CMP_GT_OQ);
+            return _mm256_blendv_ps(_mm256_mul_ps(pix, ctx.slope[i]), data, flag);
+        }
+        case GammaRenderParams::BASIC_MIRROR:
+        case GammaRenderParams::MONCURVE_MIRROR_FWD:
+        case GammaRenderParams::MONCURVE_MIRROR_REV:
+        {
+            // Process the absolute value using the non-mirror style and then restore the sign.
+            const __m256 signMask = _mm256_set1_ps(-0.0f);
+            const __m256 sign_pix = _mm256_and_ps(pix, signMask);
+            const __m256 abs_pix  = _mm256_andnot_ps(signMask, pix);
+
+            const __m256 data
+                = STYLE == GammaRenderParams::BASIC_MIRROR
+                    ? gamma_channel_avx2<GammaRenderParams::BASIC>(ctx, i, abs_pix)
+                    : STYLE == GammaRenderParams::MONCURVE_MIRROR_FWD
+                        ? gamma_channel_avx2<GammaRenderParams::MONCURVE_FWD>(ctx, i, abs_pix)
+                        : gamma_channel_avx2<GammaRenderParams::MONCURVE_REV>(ctx, i, abs_pix);
+
+            return _mm256_or_ps(sign_pix, data);
+        }
+    }
+
+    return pix;
+}
+
+template<Style STYLE>
+static inline void apply_gamma_avx2(const GammaContextAVX2 & ctx,
+                                    __m256 & r, __m256 & g, __m256 & b, __m256 & a)
+{
+    r = gamma_channel_avx2<STYLE>(ctx, 0, r);
+    g = gamma_channel_avx2<STYLE>(ctx, 1, g);
+    b = gamma_channel_avx2<STYLE>(ctx, 2, b);
+    a = gamma_channel_avx2<STYLE>(ctx, 3, a);
+}
+
+template<Style STYLE>
+static inline void gamma_avx2(const GammaContextAVX2 & ctx, const float * src, float * dst, long numPixels)
+{
+    __m256 r, g, b, a;
+
+    const long pixel_count = numPixels / 8 * 8;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 8)
+    {
+        AVX2RGBAPack<BIT_DEPTH_F32>::Load(src, r, g, b, a);
+        apply_gamma_avx2<STYLE>(ctx, r, g, b, a);
+        AVX2RGBAPack<BIT_DEPTH_F32>::Store(dst, r, g, b, a);
+
+        src += 32;
+        dst += 32;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        float buf[32] = {};
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            buf[i] = src[i];
+        }
+
+        AVX2RGBAPack<BIT_DEPTH_F32>::Load(buf, r, g, b, a);
+        apply_gamma_avx2<STYLE>(ctx, r, g, b, a);
+        AVX2RGBAPack<BIT_DEPTH_F32>::Store(buf, r, g, b, a);
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            dst[i] = buf[i];
+        }
+    }
+}
+
+} // anonymous namespace
+
+void applyGammaAVX2(const GammaRenderParams & params, const float * src, float * dst, long numPixels)
+{
+    GammaContextAVX2 ctx;
+    for (int i = 0; i < 4; ++i)
+    {
+        ctx.gamma[i]    = _mm256_set1_ps(params.m_gamma[i]);
+        ctx.scale[i]    = _mm256_set1_ps(params.m_scale[i]);
+        ctx.offset[i]   = _mm256_set1_ps(params.m_offset[i]);
+        ctx.breakPnt[i] = _mm256_set1_ps(params.m_breakPnt[i]);
+        ctx.slope[i]    = _mm256_set1_ps(params.m_slope[i]);
+    }
+
+    switch (params.m_style)
+    {
+        case GammaRenderParams::BASIC:
+            gamma_avx2<GammaRenderParams::BASIC>(ctx, src, dst, numPixels);
+            break;
+        case GammaRenderParams::BASIC_MIRROR:
+            gamma_avx2<GammaRenderParams::BASIC_MIRROR>(ctx, src, dst, numPixels);
+            break;
+        case GammaRenderParams::BASIC_PASS_THRU:
+            gamma_avx2<GammaRenderParams::BASIC_PASS_THRU>(ctx, src, dst, numPixels);
+            break;
+        case GammaRenderParams::MONCURVE_FWD:
+            gamma_avx2<GammaRenderParams::MONCURVE_FWD>(ctx, src, dst, numPixels);
+            break;
+        case GammaRenderParams::MONCURVE_REV:
+            gamma_avx2<GammaRenderParams::MONCURVE_REV>(ctx, src, dst, numPixels);
+            break;
+        case GammaRenderParams::MONCURVE_MIRROR_FWD:
+            gamma_avx2<GammaRenderParams::MONCURVE_MIRROR_FWD>(ctx, src, dst, numPixels);
+            break;
+        case GammaRenderParams::MONCURVE_MIRROR_REV:
+            gamma_avx2<GammaRenderParams::MONCURVE_MIRROR_REV>(ctx, src, dst, numPixels);
+            break;
+    }
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
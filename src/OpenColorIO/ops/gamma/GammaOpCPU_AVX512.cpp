@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "GammaOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+typedef GammaRenderParams::Style Style;
+
+struct GammaContextAVX512 {
+    __m512 gamma[4];
+    __m512 scale[4];
+    __m512 offset[4];
+    __m512 breakPnt[4];
+    __m512 slope[4];
+};
+
+template<Style STYLE>
+static inline __m512 gamma_channel_avx512(const GammaContextAVX512 & ctx, int i, __m512 pix)
+{
+    switch (STYLE)
+    {
+        case GammaRenderParams::BASIC:
+        {
+            return avx512Power(pix, ctx.gamma[i]);
+        }
+        case GammaRenderParams::BASIC_PASS_THRU:
+        {
+            // Values smaller or equal to zero (and NaNs) are passed through.
+            const __mmask16 flag = _mm512_cmp_ps_mask(pix, _mm512_setzero_ps(), _CMP_GT_OQ);
+            return _mm512_mask_mov_ps(pix, flag, avx512Power(pix, ctx.gamma[i]));
+        }
+        case GammaRenderParams::MONCURVE_FWD:
+        {
+            __m512 data = _mm512_add_ps(_mm512_mul_ps(pix, ctx.scale[i]), ctx.offset[i]);
+            data = avx512Power(data, ctx.gamma[i]);
+
+            const __mmask16 flag = _mm512_cmp_ps_mask(pix, ctx.breakPnt[i], _CMP_GT_OQ);
+            return _mm512_mask_mov_ps(_mm512_mul_ps(pix, ctx.slope[i]), flag, data);
+        }
+        case GammaRenderParams::MONCURVE_REV:
+        {
+            __m512 data = avx512Power(pix, ctx.gamma[i]);
+            data = _mm512_sub_ps(_mm512_mul_ps(data, ctx.scale[i]), ctx.offset[i]);
+
+            const __mmask16 flag = _mm512_cmp_ps_mask(pix, ctx.breakPnt[i], _CMP_GT_OQ);
+            return _mm512_mask_mov_ps(_mm512_mul_ps(pix, ctx.slope[i]), flag, data);
+        }
+        case GammaRenderParams::BASIC_MIRROR:
+        case GammaRenderParams::MONCURVE_MIRROR_FWD:
+        case GammaRenderParams::MONCURVE_MIRROR_REV:
+        {
+            // Process the absolute value using the non-mirror style and then restore the sign.
+            const __m512i signMask = _mm512_set1_epi32(0x80000000);
+            const __m512i sign_pix = _mm512_and_epi32(_mm512_castps_si512(pix), signMask);
+            const __m512  abs_pix
+                = _mm512_castsi512_ps(_mm512_andnot_epi32(signMask, _mm512_castps_si512(pix)));
+
+            const __m512 data
+                = STYLE == GammaRenderParams::BASIC_MIRROR
+                    ? gamma_channel_avx512<GammaRenderParams::BASIC>(ctx, i, abs_pix)
+                    : STYLE == GammaRenderParams::MONCURVE_MIRROR_FWD
+                        ? gamma_channel_avx512<GammaRenderParams::MONCURVE_FWD>(ctx, i, abs_pix)
+                        : gamma_channel_avx512<GammaRenderParams::MONCURVE_REV>(ctx, i, abs_pix);
+
+            return _mm512_castsi512_ps(_mm512_or_epi32(sign_pix, _mm512_castps_si512(data)));
+        }
+    }
+
+    return pix;
+}
+
+template<Style STYLE>
+static inline void apply_gamma_avx512(const GammaContextAVX512 & ctx,
+                                      __m512 & r, __m512 & g, __m512 & b, __m512 & a)
+{
+    r = gamma_channel_avx512<STYLE>(ctx, 0, r);
+    g = gamma_channel_avx512<STYLE>(ctx, 1, g);
+    b = gamma_channel_avx512<STYLE>(ctx, 2, b);
+    a = gamma_channel_avx512<STYLE>(ctx, 3, a);
+}
+
+template<Style STYLE>
+static inline void gamma_avx512(const GammaContextAVX512 & ctx, const float * src, float * dst, long numPixels)
+{
+    __m512 r, g, b, a;
+
+    const long pixel_count = numPixels / 16 * 16;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 16)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::Load(src, r, g, b, a);
+        apply_gamma_avx512<STYLE>(ctx, r, g, b, a);
+        AVX512RGBAPack<BIT_DEPTH_F32>::Store(dst, r, g, b, a);
+
+        src += 64;
+        dst += 64;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::LoadMasked(src, r, g, b, a, (uint32_t)remainder);
+        apply_gamma_avx512<STYLE>(ctx, r, g, b, a);
+        AVX512RGBAPack<BIT_DEPTH_F32>::StoreMasked(dst, r, g, b, a, (uint32_t)remainder);
+    }
+}
+
+} // anonymous namespace
+
+void applyGammaAVX512(const GammaRenderParams & params, const float * src, float * dst, long numPixels)
+{
+    GammaContextAVX512 ctx;
+    for (int i = 0; i < 4; ++i)
+    {
+        ctx.gamma[i]    = _mm512_set1_ps(params.m_gamma[i]);
+        ctx.scale[i]    = _mm512_set1_ps(params.m_scale[i]);
+        ctx.offset[i]   = _mm512_set1_ps(params.m_offset[i]);
+        ctx.breakPnt[i] = _mm512_set1_ps(params.m_breakPnt[i]);
+        ctx.slope[i]    = _mm512_set1_ps(params.m_slope[i]);
+    }
+
+    switch (params.m_style)
+    {
+        case GammaRenderParams::BASIC:
+            gamma_avx512<GammaRenderParams::BASIC>(ctx, src, dst, numPixels);
+            break;
+        case GammaRenderParams::BASIC_MIRROR:
+            gamma_avx512<GammaRenderParams::BASIC_MIRROR>(ctx, src, dst, numPixels);
+            break;
+        case GammaRenderParams::BASIC_PASS_THRU:
+            gamma_avx512<GammaRenderParams::BASIC_PASS_THRU>(ctx, src, dst, numPixels);
+            break;
+        case GammaRenderParams::MONCURVE_FWD:
+            gamma_avx512<GammaRenderParams::MONCURVE_FWD>(ctx, src, dst, numPixels);
+            break;
+        case GammaRenderParams::MONCURVE_REV:
+            gamma_avx512<GammaRenderParams::MONCURVE_REV>(ctx, src, dst, numPixels);
+            break;
+        case GammaRenderParams::MONCURVE_MIRROR_FWD:
+            gamma_avx512<GammaRenderParams::MONCURVE_MIRROR_FWD>(ctx, src, dst, numPixels);
+            break;
+        case GammaRenderParams::MONCURVE_MIRROR_REV:
+            gamma_avx512<GammaRenderParams::MONCURVE_MIRROR_REV>(ctx, src, dst, numPixels);
+            break;
+    }
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -8,8 +8,12 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "MathUtils.h"
 #include "ops/gradingrgbcurve/GradingRGBCurveOpCPU.h"
+#include "ops/gradingrgbcurve/GradingRGBCurveOpCPU_AVX2.h"
+#include "ops/gradingrgbcurve/GradingRGBCurveOpCPU_AVX512.h"
+#include "ops/gradingrgbcurve/GradingRGBCurveOpCPU_SSE2.h"
 #include "SSE.h"
 
 namespace OCIO_NAMESPACE
@@ -17,6 +21,39 @@ namespace OCIO_NAMESPACE
 
 namespace
 {
+typedef void (GradingRGBCurveApplyFunc)(const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs,
+                                        TransformDirection dir, bool linToLog,
+                                        const float * src, float * dst, long numPixels);
+
+// Return the fastest vectorized implementation supported by the CPU, or null if none.
+GradingRGBCurveApplyFunc * GetGradingRGBCurveApplyFunc()
+{
+    GradingRGBCurveApplyFunc * func = nullptr;
+
+#if OCIO_USE_SSE2
+    if (CPUInfo::instance().hasSSE2())
+    {
+        func = applyGradingRGBCurveSSE2;
+    }
+#endif
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        func = applyGradingRGBCurveAVX2;
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        func = applyGradingRGBCurveAVX512;
+    }
+#endif
+
+    return func;
+}
+
 class GradingRGBCurveOpCPU : public OpCPU
 {
 public:
@@ -52,11 +89,17 @@ protected:
         out[2] = knotsCoefs.evalCurveRev(static_cast<int>(RGB_BLUE), out[2]);
     }
 
+    // Apply the SIMD implementation if any, and return false otherwise.
+    bool applySIMD(TransformDirection dir, bool linToLog,
+                   const void * inImg, void * outImg, long numPixels) const;
+
     DynamicPropertyGradingRGBCurveImplRcPtr m_grgbcurve;
+    GradingRGBCurveApplyFunc * m_applyFunc;
 };
 
 GradingRGBCurveOpCPU::GradingRGBCurveOpCPU(ConstGradingRGBCurveOpDataRcPtr & grgbc)
     : OpCPU()
+    , m_applyFunc(GetGradingRGBCurveApplyFunc())
 {
     m_grgbcurve = grgbc->getDynamicPropertyInternal();
     if (m_grgbcurve->isDynamic())
@@ -97,6 +140,19 @@ DynamicPropertyRcPtr GradingRGBCurveOpCPU::getDynamicProperty(DynamicPropertyTyp
     throw Exception("GradingRGBCurve property is not dynamic.");
 }
 
+bool GradingRGBCurveOpCPU::applySIMD(TransformDirection dir, bool linToLog,
+                                     const void * inImg, void * outImg, long numPixels) const
+{
+    if (!m_applyFunc)
+    {
+        return false;
+    }
+
+    m_applyFunc(m_grgbcurve->getKnotsCoefs(), dir, linToLog,
+                (const float *)inImg, (float *)outImg, numPixels);
+    return true;
+}
+
 class GradingRGBCurveFwdOpCPU : public GradingRGBCurveOpCPU
 {
 public:
@@ -126,6 +182,11 @@ void GradingRGBCurveFwdOpCPU::apply(const void * inImg, void * outImg, long numP
         return;
     }
 
+    if (applySIMD(TRANSFORM_DIR_FORWARD, false, inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
@@ -251,6 +312,11 @@ void GradingRGBCurveLinearFwdOpCPU::apply(const void * inImg, void * outImg, lon
         return;
     }
 
+    if (applySIMD(TRANSFORM_DIR_FORWARD, true, inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
@@ -296,6 +362,11 @@ void GradingRGBCurveRevOpCPU::apply(const void * inImg, void * outImg, long numP
         return;
     }
 
+    if (applySIMD(TRANSFORM_DIR_INVERSE, false, inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
@@ -336,6 +407,11 @@ void GradingRGBCurveLinearRevOpCPU::apply(const void * inImg, void * outImg, lon
         return;
     }
 
+    if (applySIMD(TRANSFORM_DIR_INVERSE, true, inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
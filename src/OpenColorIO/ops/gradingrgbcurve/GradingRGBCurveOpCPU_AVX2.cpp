@@ -0,0 +1,299 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "GradingRGBCurveOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <cmath>
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+// The per-curve values of GradingBSplineCurveImpl::KnotsCoefs::evalCurve() & evalCurveRev()
+// which do not vary per pixel.
+struct CurveAVX2
+{
+    int numSegments;    // Zero for an identity curve.
+    const float * knots;
+    const float * A;
+    const float * B;
+    const float * C;
+
+    __m256 knStart;
+    __m256 knEnd;
+    __m256 knStartY;
+    __m256 knEndY;
+    __m256 endSlope;
+    __m256 endOffs;
+
+    // Inverse extrapolations.
+    bool flatStart;
+    bool flatEnd;
+};
+
+static inline void init_curve_avx2(const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs,
+                                   int c, CurveAVX2 & curve)
+{
+    const int coefsSets = knotsCoefs.m_coefsOffsetsArray[2 * c + 1] / 3;
+    curve.numSegments = coefsSets;
+    if (coefsSets == 0)
+    {
+        return;
+    }
+
+    const int coefsOffs = knotsCoefs.m_coefsOffsetsArray[2 * c];
+    const int knotsCnt = knotsCoefs.m_knotsOffsetsArray[2 * c + 1];
+    const int knotsOffs = knotsCoefs.m_knotsOffsetsArray[2 * c];
+
+    curve.knots = &knotsCoefs.m_knotsArray[knotsOffs];
+    curve.A = &knotsCoefs.m_coefsArray[coefsOffs];
+    curve.B = curve.A + coefsSets;
+    curve.C = curve.B + coefsSets;
+
+    const float knStart = curve.knots[0];
+    const float knEnd = curve.knots[knotsCnt - 1];
+
+    const float A  = curve.A[coefsSets - 1];
+    const float B  = curve.B[coefsSets - 1];
+    const float C  = curve.C[coefsSets - 1];
+    const float kn = curve.knots[knotsCnt - 2];
+    const float t = knEnd - kn;
+    const float slope = 2.f * A * t + B;
+    const float offs = (A * t + B) * t + C;
+
+    curve.knStart  = _mm256_set1_ps(knStart);
+    curve.knEnd    = _mm256_set1_ps(knEnd);
+    curve.knStartY = _mm256_set1_ps(curve.C[0]);
+    curve.knEndY   = _mm256_set1_ps(offs);
+    curve.endSlope = _mm256_set1_ps(slope);
+    curve.endOffs  = _mm256_set1_ps(offs);
+
+    curve.flatStart = std::fabs(curve.B[0]) < 1e-5f;
+    curve.flatEnd   = std::fabs(slope) < 1e-5f;
+}
+
+// Refer to GradingBSplineCurveImpl::KnotsCoefs::evalCurve().
+static inline __m256 eval_curve_avx2(const CurveAVX2 & curve, __m256 x)
+{
+    if (curve.numSegments == 0)
+    {
+        return x;
+    }
+
+    // Find the segment i.e. the last knot (but the end one) smaller or equal to x. Note that NaNs
+    // end up in the last segment like the scalar code.
+    __m256 A  = _mm256_set1_ps(curve.A[0]);
+    __m256 B  = _mm256_set1_ps(curve.B[0]);
+    __m256 C  = _mm256_set1_ps(curve.C[0]);
+    __m256 kn = _mm256_set1_ps(curve.knots[0]);
+    for (int i = 1; i < curve.numSegments; ++i)
+    {
+        const __m256 flag = _mm256_cmp_ps(x, _mm256_set1_ps(curve.knots[i]), _CMP_NLT_UQ);
+        A  = _mm256_blendv_ps(A, _mm256_set1_ps(curve.A[i]), flag);
+        B  = _mm256_blendv_ps(B, _mm256_set1_ps(curve.B[i]), flag);
+        C  = _mm256_blendv_ps(C, _mm256_set1_ps(curve.C[i]), flag);
+        kn = _mm256_blendv_ps(kn, _mm256_set1_ps(curve.knots[i]), flag);
+    }
+
+    const __m256 t = _mm256_sub_ps(x, kn);
+    __m256 res = _mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(A, t), B), t), C);
+
+    // Linear extrapolations.
+    const __m256 resEnd
+        = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(x, curve.knEnd), curve.endSlope),
+                        curve.endOffs);
+    res = _mm256_blendv_ps(res, resEnd, _mm256_cmp_ps(x, curve.knEnd, _CMP_GE_OQ));
+
+    const __m256 resStart
+        = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(x, curve.knStart),
+                                      _mm256_set1_ps(curve.B[0])),
+                        _mm256_set1_ps(curve.C[0]));
+    res = _mm256_blendv_ps(res, resStart, _mm256_cmp_ps(x, curve.knStart, _CMP_LE_OQ));
+
+    return res;
+}
+
+// Refer to GradingBSplineCurveImpl::KnotsCoefs::evalCurveRev().
+static inline __m256 eval_curve_rev_avx2(const CurveAVX2 & curve, __m256 y)
+{
+    if (curve.numSegments == 0)
+    {
+        return y;
+    }
+
+    // Find the segment using the curve values at the knots.
+    __m256 A  = _mm256_set1_ps(curve.A[0]);
+    __m256 B  = _mm256_set1_ps(curve.B[0]);
+    __m256 C  = _mm256_set1_ps(curve.C[0]);
+    __m256 kn = _mm256_set1_ps(curve.knots[0]);
+    for (int i = 1; i < curve.numSegments; ++i)
+    {
+        const __m256 flag = _mm256_cmp_ps(y, _mm256_set1_ps(curve.C[i]), _CMP_NLT_UQ);
+        A  = _mm256_blendv_ps(A, _mm256_set1_ps(curve.A[i]), flag);
+        B  = _mm256_blendv_ps(B, _mm256_set1_ps(curve.B[i]), flag);
+        C  = _mm256_blendv_ps(C, _mm256_set1_ps(curve.C[i]), flag);
+        kn = _mm256_blendv_ps(kn, _mm256_set1_ps(curve.knots[i]), flag);
+    }
+
+    const __m256 C0 = _mm256_sub_ps(C, y);
+    const __m256 discrim
+        = _mm256_sqrt_ps(_mm256_sub_ps(_mm256_mul_ps(B, B),
+                                       _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(4.f), A), C0)));
+    __m256 res = _mm256_add_ps(kn, _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(-2.f), C0),
+                                                 _mm256_add_ps(discrim, B)));
+
+    // Linear extrapolations.
+    const __m256 resEnd
+        = curve.flatEnd ? curve.knEnd
+                        : _mm256_add_ps(_mm256_div_ps(_mm256_sub_ps(y, curve.endOffs),
+                                                      curve.endSlope),
+                                        curve.knEnd);
+    res = _mm256_blendv_ps(res, resEnd, _mm256_cmp_ps(y, curve.knEndY, _CMP_GE_OQ));
+
+    const __m256 resStart
+        = curve.flatStart ? curve.knStart
+                          : _mm256_add_ps(_mm256_div_ps(_mm256_sub_ps(y, curve.knStartY),
+                                                        _mm256_set1_ps(curve.B[0])),
+                                          curve.knStart);
+    res = _mm256_blendv_ps(res, resStart, _mm256_cmp_ps(y, curve.knStartY, _CMP_LE_OQ));
+
+    return res;
+}
+
+// Refer to LinLog() & LogLin() in GradingRGBCurveOpCPU.cpp.
+
+static constexpr float xbrk = 0.0041318374739483946f;
+static constexpr float shift = -0.000157849851665374f;
+static constexpr float gain = 363.034608563f;
+static constexpr float offs = -7.f;
+static constexpr float ybrk = -5.5f;
+
+static inline __m256 lin_log_avx2(__m256 in)
+{
+    const __m256 flag = _mm256_cmp_ps(in, _mm256_set1_ps(xbrk), _CMP_GT_OQ);
+
+    const __m256 pixLin
+        = _mm256_add_ps(_mm256_mul_ps(in, _mm256_set1_ps(gain)), _mm256_set1_ps(offs));
+
+    __m256 pix = _mm256_add_ps(in, _mm256_set1_ps(shift));
+    pix = _mm256_mul_ps(pix, _mm256_set1_ps(1.f / (0.18f + shift)));
+    pix = avx2Log2(pix);
+
+    return _mm256_blendv_ps(pixLin, pix, flag);
+}
+
+static inline __m256 log_lin_avx2(__m256 in)
+{
+    const __m256 flag = _mm256_cmp_ps(in, _mm256_set1_ps(ybrk), _CMP_GT_OQ);
+
+    const __m256 pixLin
+        = _mm256_mul_ps(_mm256_sub_ps(in, _mm256_set1_ps(offs)), _mm256_set1_ps(1.f / gain));
+
+    __m256 pix = avx2Power(_mm256_set1_ps(2.0f), in);
+    pix = _mm256_mul_ps(pix, _mm256_set1_ps(shift + 0.18f));
+    pix = _mm256_sub_ps(pix, _mm256_set1_ps(shift));
+
+    return _mm256_blendv_ps(pixLin, pix, flag);
+}
+
+template<bool FWD>
+static inline void rgb_curve_8pixels_avx2(const CurveAVX2 (&curves)[4], bool linToLog,
+                                          const float * src, float * dst)
+{
+    __m256 r, g, b, a;
+    AVX2RGBAPack<BIT_DEPTH_F32>::Load(src, r, g, b, a);
+
+    if (linToLog)
+    {
+        r = lin_log_avx2(r);
+        g = lin_log_avx2(g);
+        b = lin_log_avx2(b);
+    }
+
+    if (FWD)
+    {
+        r = eval_curve_avx2(curves[RGB_MASTER], eval_curve_avx2(curves[RGB_RED], r));
+        g = eval_curve_avx2(curves[RGB_MASTER], eval_curve_avx2(curves[RGB_GREEN], g));
+        b = eval_curve_avx2(curves[RGB_MASTER], eval_curve_avx2(curves[RGB_BLUE], b));
+    }
+    else
+    {
+        r = eval_curve_rev_avx2(curves[RGB_RED], eval_curve_rev_avx2(curves[RGB_MASTER], r));
+        g = eval_curve_rev_avx2(curves[RGB_GREEN], eval_curve_rev_avx2(curves[RGB_MASTER], g));
+        b = eval_curve_rev_avx2(curves[RGB_BLUE], eval_curve_rev_avx2(curves[RGB_MASTER], b));
+    }
+
+    if (linToLog)
+    {
+        r = log_lin_avx2(r);
+        g = log_lin_avx2(g);
+        b = log_lin_avx2(b);
+    }
+
+    AVX2RGBAPack<BIT_DEPTH_F32>::Store(dst, r, g, b, a);
+}
+
+template<bool FWD>
+static inline void rgb_curve_avx2(const CurveAVX2 (&curves)[4], bool linToLog,
+                                  const float * src, float * dst, long numPixels)
+{
+    const long pixel_count = numPixels / 8 * 8;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 8)
+    {
+        rgb_curve_8pixels_avx2<FWD>(curves, linToLog, src, dst);
+
+        src += 32;
+        dst += 32;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        float buf[32] = {};
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            buf[i] = src[i];
+        }
+
+        rgb_curve_8pixels_avx2<FWD>(curves, linToLog, buf, buf);
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            dst[i] = buf[i];
+        }
+    }
+}
+
+} // anonymous namespace
+
+void applyGradingRGBCurveAVX2(const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs,
+                              TransformDirection dir, bool linToLog,
+                              const float * src, float * dst, long numPixels)
+{
+    CurveAVX2 curves[4];
+    for (int c = 0; c < 4; ++c)
+    {
+        init_curve_avx2(knotsCoefs, c, curves[c]);
+    }
+
+    switch (dir)
+    {
+        case TRANSFORM_DIR_FORWARD:
+            rgb_curve_avx2<true>(curves, linToLog, src, dst, numPixels);
+            break;
+        case TRANSFORM_DIR_INVERSE:
+            rgb_curve_avx2<false>(curves, linToLog, src, dst, numPixels);
+            break;
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,289 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "GradingRGBCurveOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <cmath>
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+// The per-curve values of GradingBSplineCurveImpl::KnotsCoefs::evalCurve() & evalCurveRev()
+// which do not vary per pixel.
+struct CurveAVX512
+{
+    int numSegments;    // Zero for an identity curve.
+    const float * knots;
+    const float * A;
+    const float * B;
+    const float * C;
+
+    __m512 knStart;
+    __m512 knEnd;
+    __m512 knStartY;
+    __m512 knEndY;
+    __m512 endSlope;
+    __m512 endOffs;
+
+    // Inverse extrapolations.
+    bool flatStart;
+    bool flatEnd;
+};
+
+static inline void init_curve_avx512(const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs,
+                                     int c, CurveAVX512 & curve)
+{
+    const int coefsSets = knotsCoefs.m_coefsOffsetsArray[2 * c + 1] / 3;
+    curve.numSegments = coefsSets;
+    if (coefsSets == 0)
+    {
+        return;
+    }
+
+    const int coefsOffs = knotsCoefs.m_coefsOffsetsArray[2 * c];
+    const int knotsCnt = knotsCoefs.m_knotsOffsetsArray[2 * c + 1];
+    const int knotsOffs = knotsCoefs.m_knotsOffsetsArray[2 * c];
+
+    curve.knots = &knotsCoefs.m_knotsArray[knotsOffs];
+    curve.A = &knotsCoefs.m_coefsArray[coefsOffs];
+    curve.B = curve.A + coefsSets;
+    curve.C = curve.B + coefsSets;
+
+    const float knStart = curve.knots[0];
+    const float knEnd = curve.knots[knotsCnt - 1];
+
+    const float A  = curve.A[coefsSets - 1];
+    const float B  = curve.B[coefsSets - 1];
+    const float C  = curve.C[coefsSets - 1];
+    const float kn = curve.knots[knotsCnt - 2];
+    const float t = knEnd - kn;
+    const float slope = 2.f * A * t + B;
+    const float offs = (A * t + B) * t + C;
+
+    curve.knStart  = _mm512_set1_ps(knStart);
+    curve.knEnd    = _mm512_set1_ps(knEnd);
+    curve.knStartY = _mm512_set1_ps(curve.C[0]);
+    curve.knEndY   = _mm512_set1_ps(offs);
+    curve.endSlope = _mm512_set1_ps(slope);
+    curve.endOffs  = _mm512_set1_ps(offs);
+
+    curve.flatStart = std::fabs(curve.B[0]) < 1e-5f;
+    curve.flatEnd   = std::fabs(slope) < 1e-5f;
+}
+
+// Refer to GradingBSplineCurveImpl::KnotsCoefs::evalCurve().
+static inline __m512 eval_curve_avx512(const CurveAVX512 & curve, __m512 x)
+{
+    if (curve.numSegments == 0)
+    {
+        return x;
+    }
+
+    // Find the segment i.e. the last knot (but the end one) smaller or equal to x. Note that NaNs
+    // end up in the last segment like the scalar code.
+    __m512 A  = _mm512_set1_ps(curve.A[0]);
+    __m512 B  = _mm512_set1_ps(curve.B[0]);
+    __m512 C  = _mm512_set1_ps(curve.C[0]);
+    __m512 kn = _mm512_set1_ps(curve.knots[0]);
+    for (int i = 1; i < curve.numSegments; ++i)
+    {
+        const __mmask16 flag = _mm512_cmp_ps_mask(x, _mm512_set1_ps(curve.knots[i]), _CMP_NLT_UQ);
+        A  = _mm512_mask_blend_ps(flag, A, _mm512_set1_ps(curve.A[i]));
+        B  = _mm512_mask_blend_ps(flag, B, _mm512_set1_ps(curve.B[i]));
+        C  = _mm512_mask_blend_ps(flag, C, _mm512_set1_ps(curve.C[i]));
+        kn = _mm512_mask_blend_ps(flag, kn, _mm512_set1_ps(curve.knots[i]));
+    }
+
+    const __m512 t = _mm512_sub_ps(x, kn);
+    __m512 res = _mm512_add_ps(_mm512_mul_ps(_mm512_add_ps(_mm512_mul_ps(A, t), B), t), C);
+
+    // Linear extrapolations.
+    const __m512 resEnd
+        = _mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(x, curve.knEnd), curve.endSlope),
+                        curve.endOffs);
+    res = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, curve.knEnd, _CMP_GE_OQ), res, resEnd);
+
+    const __m512 resStart
+        = _mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(x, curve.knStart),
+                                      _mm512_set1_ps(curve.B[0])),
+                        _mm512_set1_ps(curve.C[0]));
+    res = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, curve.knStart, _CMP_LE_OQ), res, resStart);
+
+    return res;
+}
+
+// Refer to GradingBSplineCurveImpl::KnotsCoefs::evalCurveRev().
+static inline __m512 eval_curve_rev_avx512(const CurveAVX512 & curve, __m512 y)
+{
+    if (curve.numSegments == 0)
+    {
+        return y;
+    }
+
+    // Find the segment using the curve values at the knots.
+    __m512 A  = _mm512_set1_ps(curve.A[0]);
+    __m512 B  = _mm512_set1_ps(curve.B[0]);
+    __m512 C  = _mm512_set1_ps(curve.C[0]);
+    __m512 kn = _mm512_set1_ps(curve.knots[0]);
+    for (int i = 1; i < curve.numSegments; ++i)
+    {
+        const __mmask16 flag = _mm512_cmp_ps_mask(y, _mm512_set1_ps(curve.C[i]), _CMP_NLT_UQ);
+        A  = _mm512_mask_blend_ps(flag, A, _mm512_set1_ps(curve.A[i]));
+        B  = _mm512_mask_blend_ps(flag, B, _mm512_set1_ps(curve.B[i]));
+        C  = _mm512_mask_blend_ps(flag, C, _mm512_set1_ps(curve.C[i]));
+        kn = _mm512_mask_blend_ps(flag, kn, _mm512_set1_ps(curve.knots[i]));
+    }
+
+    const __m512 C0 = _mm512_sub_ps(C, y);
+    const __m512 discrim
+        = _mm512_sqrt_ps(_mm512_sub_ps(_mm512_mul_ps(B, B),
+                                       _mm512_mul_ps(_mm512_mul_ps(_mm512_set1_ps(4.f), A), C0)));
+    __m512 res = _mm512_add_ps(kn, _mm512_div_ps(_mm512_mul_ps(_mm512_set1_ps(-2.f), C0),
+                                                 _mm512_add_ps(discrim, B)));
+
+    // Linear extrapolations.
+    const __m512 resEnd
+        = curve.flatEnd ? curve.knEnd
+                        : _mm512_add_ps(_mm512_div_ps(_mm512_sub_ps(y, curve.endOffs),
+                                                      curve.endSlope),
+                                        curve.knEnd);
+    res = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(y, curve.knEndY, _CMP_GE_OQ), res, resEnd);
+
+    const __m512 resStart
+        = curve.flatStart ? curve.knStart
+                          : _mm512_add_ps(_mm512_div_ps(_mm512_sub_ps(y, curve.knStartY),
+                                                        _mm512_set1_ps(curve.B[0])),
+                                          curve.knStart);
+    res = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(y, curve.knStartY, _CMP_LE_OQ), res, resStart);
+
+    return res;
+}
+
+// Refer to LinLog() & LogLin() in GradingRGBCurveOpCPU.cpp.
+
+static constexpr float xbrk = 0.0041318374739483946f;
+static constexpr float shift = -0.000157849851665374f;
+static constexpr float gain = 363.034608563f;
+static constexpr float offs = -7.f;
+static constexpr float ybrk = -5.5f;
+
+static inline __m512 lin_log_avx512(__m512 in)
+{
+    const __mmask16 flag = _mm512_cmp_ps_mask(in, _mm512_set1_ps(xbrk), _CMP_GT_OQ);
+
+    const __m512 pixLin
+        = _mm512_add_ps(_mm512_mul_ps(in, _mm512_set1_ps(gain)), _mm512_set1_ps(offs));
+
+    __m512 pix = _mm512_add_ps(in, _mm512_set1_ps(shift));
+    pix = _mm512_mul_ps(pix, _mm512_set1_ps(1.f / (0.18f + shift)));
+    pix = avx512Log2(pix);
+
+    return _mm512_mask_blend_ps(flag, pixLin, pix);
+}
+
+static inline __m512 log_lin_avx512(__m512 in)
+{
+    const __mmask16 flag = _mm512_cmp_ps_mask(in, _mm512_set1_ps(ybrk), _CMP_GT_OQ);
+
+    const __m512 pixLin
+        = _mm512_mul_ps(_mm512_sub_ps(in, _mm512_set1_ps(offs)), _mm512_set1_ps(1.f / gain));
+
+    __m512 pix = avx512Power(_mm512_set1_ps(2.0f), in);
+    pix = _mm512_mul_ps(pix, _mm512_set1_ps(shift + 0.18f));
+    pix = _mm512_sub_ps(pix, _mm512_set1_ps(shift));
+
+    return _mm512_mask_blend_ps(flag, pixLin, pix);
+}
+
+template<bool FWD>
+static inline void rgb_curve_apply_avx512(const CurveAVX512 (&curves)[4], bool linToLog,
+                                            __m512 & r, __m512 & g, __m512 & b)
+{
+    if (linToLog)
+    {
+        r = lin_log_avx512(r);
+        g = lin_log_avx512(g);
+        b = lin_log_avx512(b);
+    }
+
+    if (FWD)
+    {
+        r = eval_curve_avx512(curves[RGB_MASTER], eval_curve_avx512(curves[RGB_RED], r));
+        g = eval_curve_avx512(curves[RGB_MASTER], eval_curve_avx512(curves[RGB_GREEN], g));
+        b = eval_curve_avx512(curves[RGB_MASTER], eval_curve_avx512(curves[RGB_BLUE], b));
+    }
+    else
+    {
+        r = eval_curve_rev_avx512(curves[RGB_RED], eval_curve_rev_avx512(curves[RGB_MASTER], r));
+        g = eval_curve_rev_avx512(curves[RGB_GREEN], eval_curve_rev_avx512(curves[RGB_MASTER], g));
+        b = eval_curve_rev_avx512(curves[RGB_BLUE], eval_curve_rev_avx512(curves[RGB_MASTER], b));
+    }
+
+    if (linToLog)
+    {
+        r = log_lin_avx512(r);
+        g = log_lin_avx512(g);
+        b = log_lin_avx512(b);
+    }
+
+}
+
+template<bool FWD>
+static inline void rgb_curve_avx512(const CurveAVX512 (&curves)[4], bool linToLog,
+                                    const float * src, float * dst, long numPixels)
+{
+    __m512 r, g, b, a;
+
+    const long pixel_count = numPixels / 16 * 16;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 16)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::Load(src, r, g, b, a);
+        rgb_curve_apply_avx512<FWD>(curves, linToLog, r, g, b);
+        AVX512RGBAPack<BIT_DEPTH_F32>::Store(dst, r, g, b, a);
+
+        src += 64;
+        dst += 64;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::LoadMasked(src, r, g, b, a, (uint32_t)remainder);
+        rgb_curve_apply_avx512<FWD>(curves, linToLog, r, g, b);
+        AVX512RGBAPack<BIT_DEPTH_F32>::StoreMasked(dst, r, g, b, a, (uint32_t)remainder);
+    }
+}
+
+} // anonymous namespace
+
+void applyGradingRGBCurveAVX512(const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs,
+                                TransformDirection dir, bool linToLog,
+                                const float * src, float * dst, long numPixels)
+{
+    CurveAVX512 curves[4];
+    for (int c = 0; c < 4; ++c)
+    {
+        init_curve_avx512(knotsCoefs, c, curves[c]);
+    }
+
+    switch (dir)
+    {
+        case TRANSFORM_DIR_FORWARD:
+            rgb_curve_avx512<true>(curves, linToLog, src, dst, numPixels);
+            break;
+        case TRANSFORM_DIR_INVERSE:
+            rgb_curve_avx512<false>(curves, linToLog, src, dst, numPixels);
+            break;
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_GRADINGRGBCURVEOP_CPU_AVX512_H
+#define INCLUDED_OCIO_GRADINGRGBCURVEOP_CPU_AVX512_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "ops/gradingrgbcurve/GradingBSplineCurve.h"
+
+#if OCIO_USE_AVX512
+namespace OCIO_NAMESPACE
+{
+
+// Evaluate the RGB & master curves on RGBA F32 pixels. The alpha channel is left untouched.
+void applyGradingRGBCurveAVX512(const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs,
+                                TransformDirection dir, bool linToLog,
+                                const float * src, float * dst, long numPixels);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
+
+#endif /* INCLUDED_OCIO_GRADINGRGBCURVEOP_CPU_AVX512_H */
@@ -0,0 +1,302 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "GradingRGBCurveOpCPU_SSE2.h"
+#if OCIO_USE_SSE2
+
+#include <cmath>
+
+#include "SSE.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+// The per-curve values of GradingBSplineCurveImpl::KnotsCoefs::evalCurve() & evalCurveRev()
+// which do not vary per pixel.
+struct CurveSSE2
+{
+    int numSegments;    // Zero for an identity curve.
+    const float * knots;
+    const float * A;
+    const float * B;
+    const float * C;
+
+    __m128 knStart;
+    __m128 knEnd;
+    __m128 knStartY;
+    __m128 knEndY;
+    __m128 endSlope;
+    __m128 endOffs;
+
+    // Inverse extrapolations.
+    bool flatStart;
+    bool flatEnd;
+};
+
+static inline void init_curve_sse2(const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs,
+                                   int c, CurveSSE2 & curve)
+{
+    const int coefsSets = knotsCoefs.m_coefsOffsetsArray[2 * c + 1] / 3;
+    curve.numSegments = coefsSets;
+    if (coefsSets == 0)
+    {
+        return;
+    }
+
+    const int coefsOffs = knotsCoefs.m_coefsOffsetsArray[2 * c];
+    const int knotsCnt = knotsCoefs.m_knotsOffsetsArray[2 * c + 1];
+    const int knotsOffs = knotsCoefs.m_knotsOffsetsArray[2 * c];
+
+    curve.knots = &knotsCoefs.m_knotsArray[knotsOffs];
+    curve.A = &knotsCoefs.m_coefsArray[coefsOffs];
+    curve.B = curve.A + coefsSets;
+    curve.C = curve.B + coefsSets;
+
+    const float knStart = curve.knots[0];
+    const float knEnd = curve.knots[knotsCnt - 1];
+
+    const float A  = curve.A[coefsSets - 1];
+    const float B  = curve.B[coefsSets - 1];
+    const float C  = curve.C[coefsSets - 1];
+    const float kn = curve.knots[knotsCnt - 2];
+    const float t = knEnd - kn;
+    const float slope = 2.f * A * t + B;
+    const float offs = (A * t + B) * t + C;
+
+    curve.knStart  = _mm_set1_ps(knStart);
+    curve.knEnd    = _mm_set1_ps(knEnd);
+    curve.knStartY = _mm_set1_ps(curve.C[0]);
+    curve.knEndY   = _mm_set1_ps(offs);
+    curve.endSlope = _mm_set1_ps(slope);
+    curve.endOffs  = _mm_set1_ps(offs);
+
+    curve.flatStart = std::fabs(curve.B[0]) < 1e-5f;
+    curve.flatEnd   = std::fabs(slope) < 1e-5f;
+}
+
+// Refer to GradingBSplineCurveImpl::KnotsCoefs::evalCurve().
+static inline __m128 eval_curve_sse2(const CurveSSE2 & curve, __m128 x)
+{
+    if (curve.numSegments == 0)
+    {
+        return x;
+    }
+
+    // Find the segment i.e. the last knot (but the end one) smaller or equal to x. Note that NaNs
+    // end up in the last segment like the scalar code.
+    __m128 A  = _mm_set1_ps(curve.A[0]);
+    __m128 B  = _mm_set1_ps(curve.B[0]);
+    __m128 C  = _mm_set1_ps(curve.C[0]);
+    __m128 kn = _mm_set1_ps(curve.knots[0]);
+    for (int i = 1; i < curve.numSegments; ++i)
+    {
+        const __m128 flag = _mm_cmpnlt_ps(x, _mm_set1_ps(curve.knots[i]));
+        A  = sseSelect(flag, _mm_set1_ps(curve.A[i]), A);
+        B  = sseSelect(flag, _mm_set1_ps(curve.B[i]), B);
+        C  = sseSelect(flag, _mm_set1_ps(curve.C[i]), C);
+        kn = sseSelect(flag, _mm_set1_ps(curve.knots[i]), kn);
+    }
+
+    const __m128 t = _mm_sub_ps(x, kn);
+    __m128 res = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(A, t), B), t), C);
+
+    // Linear extrapolations.
+    const __m128 resEnd = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(x, curve.knEnd), curve.endSlope),
+                                     curve.endOffs);
+    res = sseSelect(_mm_cmpge_ps(x, curve.knEnd), resEnd, res);
+
+    const __m128 resStart = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(x, curve.knStart),
+                                                  _mm_set1_ps(curve.B[0])),
+                                       _mm_set1_ps(curve.C[0]));
+    res = sseSelect(_mm_cmple_ps(x, curve.knStart), resStart, res);
+
+    return res;
+}
+
+// Refer to GradingBSplineCurveImpl::KnotsCoefs::evalCurveRev().
+static inline __m128 eval_curve_rev_sse2(const CurveSSE2 & curve, __m128 y)
+{
+    if (curve.numSegments == 0)
+    {
+        return y;
+    }
+
+    // Find the segment using the curve values at the knots.
+    __m128 A  = _mm_set1_ps(curve.A[0]);
+    __m128 B  = _mm_set1_ps(curve.B[0]);
+    __m128 C  = _mm_set1_ps(curve.C[0]);
+    __m128 kn = _mm_set1_ps(curve.knots[0]);
+    for (int i = 1; i < curve.numSegments; ++i)
+    {
+        const __m128 flag = _mm_cmpnlt_ps(y, _mm_set1_ps(curve.C[i]));
+        A  = sseSelect(flag, _mm_set1_ps(curve.A[i]), A);
+        B  = sseSelect(flag, _mm_set1_ps(curve.B[i]), B);
+        C  = sseSelect(flag, _mm_set1_ps(curve.C[i]), C);
+        kn = sseSelect(flag, _mm_set1_ps(curve.knots[i]), kn);
+    }
+
+    const __m128 C0 = _mm_sub_ps(C, y);
+    const __m128 discrim
+        = _mm_sqrt_ps(_mm_sub_ps(_mm_mul_ps(B, B),
+                                 _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(4.f), A), C0)));
+    __m128 res = _mm_add_ps(kn, _mm_div_ps(_mm_mul_ps(_mm_set1_ps(-2.f), C0),
+                                           _mm_add_ps(discrim, B)));
+
+    // Linear extrapolations.
+    const __m128 resEnd
+        = curve.flatEnd ? curve.knEnd
+                        : _mm_add_ps(_mm_div_ps(_mm_sub_ps(y, curve.endOffs), curve.endSlope),
+                                     curve.knEnd);
+    res = sseSelect(_mm_cmpge_ps(y, curve.knEndY), resEnd, res);
+
+    const __m128 resStart
+        = curve.flatStart ? curve.knStart
+                          : _mm_add_ps(_mm_div_ps(_mm_sub_ps(y, curve.knStartY),
+                                                  _mm_set1_ps(curve.B[0])),
+                                       curve.knStart);
+    res = sseSelect(_mm_cmple_ps(y, curve.knStartY), resStart, res);
+
+    return res;
+}
+
+// Refer to LinLog() & LogLin() in GradingRGBCurveOpCPU.cpp.
+
+static constexpr float xbrk = 0.0041318374739483946f;
+static constexpr float shift = -0.000157849851665374f;
+static constexpr float gain = 363.034608563f;
+static constexpr float offs = -7.f;
+static constexpr float ybrk = -5.5f;
+
+static inline __m128 lin_log_sse2(__m128 in)
+{
+    const __m128 flag = _mm_cmpgt_ps(in, _mm_set1_ps(xbrk));
+
+    const __m128 pixLin = _mm_add_ps(_mm_mul_ps(in, _mm_set1_ps(gain)), _mm_set1_ps(offs));
+
+    __m128 pix = _mm_add_ps(in, _mm_set1_ps(shift));
+    pix = _mm_mul_ps(pix, _mm_set1_ps(1.f / (0.18f + shift)));
+    pix = sseLog2(pix);
+
+    return sseSelect(flag, pix, pixLin);
+}
+
+static inline __m128 log_lin_sse2(__m128 in)
+{
+    const __m128 flag = _mm_cmpgt_ps(in, _mm_set1_ps(ybrk));
+
+    const __m128 pixLin = _mm_mul_ps(_mm_sub_ps(in, _mm_set1_ps(offs)), _mm_set1_ps(1.f / gain));
+
+    __m128 pix = ssePower(_mm_set1_ps(2.0f), in);
+    pix = _mm_mul_ps(pix, _mm_set1_ps(shift + 0.18f));
+    pix = _mm_sub_ps(pix, _mm_set1_ps(shift));
+
+    return sseSelect(flag, pix, pixLin);
+}
+
+template<bool FWD>
+static inline void rgb_curve_4pixels_sse2(const CurveSSE2 (&curves)[4], bool linToLog,
+                                          const float * src, float * dst)
+{
+    __m128 r = _mm_loadu_ps(src);
+    __m128 g = _mm_loadu_ps(src + 4);
+    __m128 b = _mm_loadu_ps(src + 8);
+    __m128 a = _mm_loadu_ps(src + 12);
+
+    _MM_TRANSPOSE4_PS(r, g, b, a);
+
+    if (linToLog)
+    {
+        r = lin_log_sse2(r);
+        g = lin_log_sse2(g);
+        b = lin_log_sse2(b);
+    }
+
+    if (FWD)
+    {
+        r = eval_curve_sse2(curves[RGB_MASTER], eval_curve_sse2(curves[RGB_RED], r));
+        g = eval_curve_sse2(curves[RGB_MASTER], eval_curve_sse2(curves[RGB_GREEN], g));
+        b = eval_curve_sse2(curves[RGB_MASTER], eval_curve_sse2(curves[RGB_BLUE], b));
+    }
+    else
+    {
+        r = eval_curve_rev_sse2(curves[RGB_RED], eval_curve_rev_sse2(curves[RGB_MASTER], r));
+        g = eval_curve_rev_sse2(curves[RGB_GREEN], eval_curve_rev_sse2(curves[RGB_MASTER], g));
+        b = eval_curve_rev_sse2(curves[RGB_BLUE], eval_curve_rev_sse2(curves[RGB_MASTER], b));
+    }
+
+    if (linToLog)
+    {
+        r = log_lin_sse2(r);
+        g = log_lin_sse2(g);
+        b = log_lin_sse2(b);
+    }
+
+    _MM_TRANSPOSE4_PS(r, g, b, a);
+
+    _mm_storeu_ps(dst,      r);
+    _mm_storeu_ps(dst + 4,  g);
+    _mm_storeu_ps(dst + 8,  b);
+    _mm_storeu_ps(dst + 12, a);
+}
+
+template<bool FWD>
+static inline void rgb_curve_sse2(const CurveSSE2 (&curves)[4], bool linToLog,
+                                  const float * src, float * dst, long numPixels)
+{
+    const long pixel_count = numPixels / 4 * 4;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 4)
+    {
+        rgb_curve_4pixels_sse2<FWD>(curves, linToLog, src, dst);
+
+        src += 16;
+        dst += 16;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        float buf[16] = {};
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            buf[i] = src[i];
+        }
+
+        rgb_curve_4pixels_sse2<FWD>(curves, linToLog, buf, buf);
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            dst[i] = buf[i];
+        }
+    }
+}
+
+} // anonymous namespace
+
+void applyGradingRGBCurveSSE2(const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs,
+                              TransformDirection dir, bool linToLog,
+                              const float * src, float * dst, long numPixels)
+{
+    CurveSSE2 curves[4];
+    for (int c = 0; c < 4; ++c)
+    {
+        init_curve_sse2(knotsCoefs, c, curves[c]);
+    }
+
+    switch (dir)
+    {
+        case TRANSFORM_DIR_FORWARD:
+            rgb_curve_sse2<true>(curves, linToLog, src, dst, numPixels);
+            break;
+        case TRANSFORM_DIR_INVERSE:
+            rgb_curve_sse2<false>(curves, linToLog, src, dst, numPixels);
+            break;
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_SSE2
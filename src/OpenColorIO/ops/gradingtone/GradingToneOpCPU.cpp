@@ -8,8 +8,12 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "MathUtils.h"
 #include "ops/gradingtone/GradingToneOpCPU.h"
+#include "ops/gradingtone/GradingToneOpCPU_AVX2.h"
+#include "ops/gradingtone/GradingToneOpCPU_AVX512.h"
+#include "ops/gradingtone/GradingToneOpCPU_SSE2.h"
 #include "SSE.h"
 
 namespace OCIO_NAMESPACE
@@ -17,6 +21,39 @@ namespace OCIO_NAMESPACE
 
 namespace
 {
+typedef void (GradingToneApplyFunc)(const GradingTone & v, const GradingTonePreRender & vpr,
+                                    TransformDirection dir, bool linToLog,
+                                    const float * src, float * dst, long numPixels);
+
+// Return the fastest vectorized implementation supported by the CPU, or null if none.
+GradingToneApplyFunc * GetGradingToneApplyFunc()
+{
+    GradingToneApplyFunc * func = nullptr;
+
+#if OCIO_USE_SSE2
+    if (CPUInfo::instance().hasSSE2())
+    {
+        func = applyGradingToneSSE2;
+    }
+#endif
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        func = applyGradingToneAVX2;
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        func = applyGradingToneAVX512;
+    }
+#endif
+
+    return func;
+}
+
 class GradingToneOpCPU : public OpCPU
 {
 public:
@@ -30,12 +67,18 @@ public:
     DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const override;
 
 protected:
+    // Apply the SIMD implementation if any, and return false otherwise.
+    bool applySIMD(TransformDirection dir, bool linToLog,
+                   const void * inImg, void * outImg, long numPixels) const;
+
     DynamicPropertyGradingToneImplRcPtr m_gt;
     GradingStyle m_style;
+    GradingToneApplyFunc * m_applyFunc;
 };
 
 GradingToneOpCPU::GradingToneOpCPU(ConstGradingToneOpDataRcPtr & gt)
     : OpCPU()
+    , m_applyFunc(GetGradingToneApplyFunc())
 {
     m_gt = gt->getDynamicPropertyInternal();
     m_style = gt->getStyle();
@@ -76,6 +119,19 @@ DynamicPropertyRcPtr GradingToneOpCPU::getDynamicProperty(DynamicPropertyType ty
     throw Exception("Dynamic property type not supported by GradingTone.");
 }
 
+bool GradingToneOpCPU::applySIMD(TransformDirection dir, bool linToLog,
+                                 const void * inImg, void * outImg, long numPixels) const
+{
+    if (!m_applyFunc)
+    {
+        return false;
+    }
+
+    m_applyFunc(m_gt->getValue(), m_gt->getComputedValue(), dir, linToLog,
+                (const float *)inImg, (float *)outImg, numPixels);
+    return true;
+}
+
 class GradingToneFwdOpCPU : public GradingToneOpCPU
 {
 public:
@@ -958,6 +1014,11 @@ void GradingToneFwdOpCPU::apply(const void * inImg, void * outImg, long numPixel
         return;
     }
 
+    if (applySIMD(TRANSFORM_DIR_FORWARD, false, inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
@@ -1015,6 +1076,11 @@ void GradingToneRevOpCPU::apply(const void * inImg, void * outImg, long numPixel
         return;
     }
 
+    if (applySIMD(TRANSFORM_DIR_INVERSE, false, inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
@@ -1155,6 +1221,11 @@ void GradingToneLinearFwdOpCPU::apply(const void * inImg, void * outImg, long nu
         return;
     }
 
+    if (applySIMD(TRANSFORM_DIR_FORWARD, true, inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
@@ -1212,6 +1283,11 @@ void GradingToneLinearRevOpCPU::apply(const void * inImg, void * outImg, long nu
         return;
     }
 
+    if (applySIMD(TRANSFORM_DIR_INVERSE, true, inImg, outImg, numPixels))
+    {
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
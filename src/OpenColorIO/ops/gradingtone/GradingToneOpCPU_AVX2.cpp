@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "GradingToneOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+#include "ops/gradingtone/GradingToneOpCPU_SIMD.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+// Thin wrapper of the AVX2 register used by the GradingToneSIMD kernels.
+struct vfloat_avx2
+{
+    vfloat_avx2() = default;
+    vfloat_avx2(__m256 v) : m_v(v) {}
+
+    __m256 m_v;
+};
+
+typedef vfloat_avx2 V;
+
+inline V operator+(const V & a, const V & b) { return _mm256_add_ps(a.m_v, b.m_v); }
+inline V operator+(const V & a, float b)     { return _mm256_add_ps(a.m_v, _mm256_set1_ps(b)); }
+inline V operator+(float a, const V & b)     { return _mm256_add_ps(_mm256_set1_ps(a), b.m_v); }
+inline V operator-(const V & a, const V & b) { return _mm256_sub_ps(a.m_v, b.m_v); }
+inline V operator-(const V & a, float b)     { return _mm256_sub_ps(a.m_v, _mm256_set1_ps(b)); }
+inline V operator-(float a, const V & b)     { return _mm256_sub_ps(_mm256_set1_ps(a), b.m_v); }
+inline V operator*(const V & a, const V & b) { return _mm256_mul_ps(a.m_v, b.m_v); }
+inline V operator*(const V & a, float b)     { return _mm256_mul_ps(a.m_v, _mm256_set1_ps(b)); }
+inline V operator*(float a, const V & b)     { return _mm256_mul_ps(_mm256_set1_ps(a), b.m_v); }
+inline V operator/(const V & a, const V & b) { return _mm256_div_ps(a.m_v, b.m_v); }
+inline V operator/(const V & a, float b)     { return _mm256_div_ps(a.m_v, _mm256_set1_ps(b)); }
+inline V operator/(float a, const V & b)     { return _mm256_div_ps(_mm256_set1_ps(a), b.m_v); }
+
+inline V Sqrt(const V & a) { return _mm256_sqrt_ps(a.m_v); }
+
+// Same as std::min(a, b).
+inline V Min(const V & a, float b) { return _mm256_min_ps(_mm256_set1_ps(b), a.m_v); }
+
+inline __m256 Less(const V & a, float b)
+{
+    return _mm256_cmp_ps(a.m_v, _mm256_set1_ps(b), _CMP_LT_OQ);
+}
+
+inline __m256 Greater(const V & a, float b)
+{
+    return _mm256_cmp_ps(a.m_v, _mm256_set1_ps(b), _CMP_GT_OQ);
+}
+
+inline __m256 GreaterEqual(const V & a, float b)
+{
+    return _mm256_cmp_ps(a.m_v, _mm256_set1_ps(b), _CMP_GE_OQ);
+}
+
+inline V Select(__m256 mask, const V & a, const V & b)
+{
+    return _mm256_blendv_ps(b.m_v, a.m_v, mask);
+}
+
+// Refer to LinLog() & LogLin() in GradingToneOpCPU.cpp.
+
+static constexpr float xbrk = 0.0041318374739483946f;
+static constexpr float shift = -0.000157849851665374f;
+static constexpr float gain = 363.034608563f;
+static constexpr float offs = -7.f;
+static constexpr float ybrk = -5.5f;
+
+inline V LinLog(const V & in)
+{
+    const __m256 flag = _mm256_cmp_ps(in.m_v, _mm256_set1_ps(xbrk), _CMP_GT_OQ);
+
+    const __m256 pixLin = _mm256_add_ps(_mm256_mul_ps(in.m_v, _mm256_set1_ps(gain)),
+                                        _mm256_set1_ps(offs));
+
+    __m256 pix = _mm256_add_ps(in.m_v, _mm256_set1_ps(shift));
+    pix = _mm256_mul_ps(pix, _mm256_set1_ps(1.f / (0.18f + shift)));
+    pix = avx2Log2(pix);
+
+    return _mm256_blendv_ps(pixLin, pix, flag);
+}
+
+inline V LogLin(const V & in)
+{
+    const __m256 flag = _mm256_cmp_ps(in.m_v, _mm256_set1_ps(ybrk), _CMP_GT_OQ);
+
+    const __m256 pixLin = _mm256_mul_ps(_mm256_sub_ps(in.m_v, _mm256_set1_ps(offs)),
+                                        _mm256_set1_ps(1.f / gain));
+
+    __m256 pix = avx2Power(_mm256_set1_ps(2.0f), in.m_v);
+    pix = _mm256_mul_ps(pix, _mm256_set1_ps(shift + 0.18f));
+    pix = _mm256_sub_ps(pix, _mm256_set1_ps(shift));
+
+    return _mm256_blendv_ps(pixLin, pix, flag);
+}
+
+template<bool FWD>
+static inline void tone_8pixels_avx2(const GradingTone & v, const GradingTonePreRender & vpr,
+                                     bool linToLog, const float * src, float * dst)
+{
+    __m256 r, g, b, a;
+    AVX2RGBAPack<BIT_DEPTH_F32>::Load(src, r, g, b, a);
+
+    V red{ r }, grn{ g }, blu{ b };
+    if (FWD)
+    {
+        GradingToneSIMD::ApplyFwd(v, vpr, linToLog, red, grn, blu);
+    }
+    else
+    {
+        GradingToneSIMD::ApplyRev(v, vpr, linToLog, red, grn, blu);
+    }
+
+    AVX2RGBAPack<BIT_DEPTH_F32>::Store(dst, red.m_v, grn.m_v, blu.m_v, a);
+}
+
+template<bool FWD>
+static inline void tone_avx2(const GradingTone & v, const GradingTonePreRender & vpr,
+                             bool linToLog, const float * src, float * dst, long numPixels)
+{
+    const long pixel_count = numPixels / 8 * 8;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 8)
+    {
+        tone_8pixels_avx2<FWD>(v, vpr, linToLog, src, dst);
+
+        src += 32;
+        dst += 32;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        float buf[32] = {};
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            buf[i] = src[i];
+        }
+
+        tone_8pixels_avx2<FWD>(v, vpr, linToLog, buf, buf);
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            dst[i] = buf[i];
+        }
+    }
+}
+
+} // anonymous namespace
+
+void applyGradingToneAVX2(const GradingTone & v, const GradingTonePreRender & vpr,
+                          TransformDirection dir, bool linToLog,
+                          const float * src, float * dst, long numPixels)
+{
+    switch (dir)
+    {
+        case TRANSFORM_DIR_FORWARD:
+            tone_avx2<true>(v, vpr, linToLog, src, dst, numPixels);
+            break;
+        case TRANSFORM_DIR_INVERSE:
+            tone_avx2<false>(v, vpr, linToLog, src, dst, numPixels);
+            break;
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "GradingToneOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+
+#include "AVX512.h"
+#include "ops/gradingtone/GradingToneOpCPU_SIMD.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+// Thin wrapper of the AVX-512 register used by the GradingToneSIMD kernels.
+struct vfloat_avx512
+{
+    vfloat_avx512() = default;
+    vfloat_avx512(__m512 v) : m_v(v) {}
+
+    __m512 m_v;
+};
+
+typedef vfloat_avx512 V;
+
+inline V operator+(const V & a, const V & b) { return _mm512_add_ps(a.m_v, b.m_v); }
+inline V operator+(const V & a, float b)     { return _mm512_add_ps(a.m_v, _mm512_set1_ps(b)); }
+inline V operator+(float a, const V & b)     { return _mm512_add_ps(_mm512_set1_ps(a), b.m_v); }
+inline V operator-(const V & a, const V & b) { return _mm512_sub_ps(a.m_v, b.m_v); }
+inline V operator-(const V & a, float b)     { return _mm512_sub_ps(a.m_v, _mm512_set1_ps(b)); }
+inline V operator-(float a, const V & b)     { return _mm512_sub_ps(_mm512_set1_ps(a), b.m_v); }
+inline V operator*(const V & a, const V & b) { return _mm512_mul_ps(a.m_v, b.m_v); }
+inline V operator*(const V & a, float b)     { return _mm512_mul_ps(a.m_v, _mm512_set1_ps(b)); }
+inline V operator*(float a, const V & b)     { return _mm512_mul_ps(_mm512_set1_ps(a), b.m_v); }
+inline V operator/(const V & a, const V & b) { return _mm512_div_ps(a.m_v, b.m_v); }
+inline V operator/(const V & a, float b)     { return _mm512_div_ps(a.m_v, _mm512_set1_ps(b)); }
+inline V operator/(float a, const V & b)     { return _mm512_div_ps(_mm512_set1_ps(a), b.m_v); }
+
+inline V Sqrt(const V & a) { return _mm512_sqrt_ps(a.m_v); }
+
+// Same as std::min(a, b).
+inline V Min(const V & a, float b) { return _mm512_min_ps(_mm512_set1_ps(b), a.m_v); }
+
+inline __mmask16 Less(const V & a, float b)
+{
+    return _mm512_cmp_ps_mask(a.m_v, _mm512_set1_ps(b), _CMP_LT_OQ);
+}
+
+inline __mmask16 Greater(const V & a, float b)
+{
+    return _mm512_cmp_ps_mask(a.m_v, _mm512_set1_ps(b), _CMP_GT_OQ);
+}
+
+inline __mmask16 GreaterEqual(const V & a, float b)
+{
+    return _mm512_cmp_ps_mask(a.m_v, _mm512_set1_ps(b), _CMP_GE_OQ);
+}
+
+inline V Select(__mmask16 mask, const V & a, const V & b)
+{
+    return _mm512_mask_blend_ps(mask, b.m_v, a.m_v);
+}
+
+// Refer to LinLog() & LogLin() in GradingToneOpCPU.cpp.
+
+static constexpr float xbrk = 0.0041318374739483946f;
+static constexpr float shift = -0.000157849851665374f;
+static constexpr float gain = 363.034608563f;
+static constexpr float offs = -7.f;
+static constexpr float ybrk = -5.5f;
+
+inline V LinLog(const V & in)
+{
+    const __mmask16 flag = _mm512_cmp_ps_mask(in.m_v, _mm512_set1_ps(xbrk), _CMP_GT_OQ);
+
+    const __m512 pixLin = _mm512_add_ps(_mm512_mul_ps(in.m_v, _mm512_set1_ps(gain)),
+                                        _mm512_set1_ps(offs));
+
+    __m512 pix = _mm512_add_ps(in.m_v, _mm512_set1_ps(shift));
+    pix = _mm512_mul_ps(pix, _mm512_set1_ps(1.f / (0.18f + shift)));
+    pix = avx512Log2(pix);
+
+    return _mm512_mask_blend_ps(flag, pixLin, pix);
+}
+
+inline V LogLin(const V & in)
+{
+    const __mmask16 flag = _mm512_cmp_ps_mask(in.m_v, _mm512_set1_ps(ybrk), _CMP_GT_OQ);
+
+    const __m512 pixLin = _mm512_mul_ps(_mm512_sub_ps(in.m_v, _mm512_set1_ps(offs)),
+                                        _mm512_set1_ps(1.f / gain));
+
+    __m512 pix = avx512Power(_mm512_set1_ps(2.0f), in.m_v);
+    pix = _mm512_mul_ps(pix, _mm512_set1_ps(shift + 0.18f));
+    pix = _mm512_sub_ps(pix, _mm512_set1_ps(shift));
+
+    return _mm512_mask_blend_ps(flag, pixLin, pix);
+}
+
+template<bool FWD>
+static inline void apply_tone_avx512(const GradingTone & v, const GradingTonePreRender & vpr,
+                                     bool linToLog, __m512 & r, __m512 & g, __m512 & b)
+{
+    V red{ r }, grn{ g }, blu{ b };
+    if (FWD)
+    {
+        GradingToneSIMD::ApplyFwd(v, vpr, linToLog, red, grn, blu);
+    }
+    else
+    {
+        GradingToneSIMD::ApplyRev(v, vpr, linToLog, red, grn, blu);
+    }
+    r = red.m_v;
+    g = grn.m_v;
+    b = blu.m_v;
+}
+
+template<bool FWD>
+static inline void tone_avx512(const GradingTone & v, const GradingTonePreRender & vpr,
+                               bool linToLog, const float * src, float * dst, long numPixels)
+{
+    __m512 r, g, b, a;
+
+    const long pixel_count = numPixels / 16 * 16;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 16)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::Load(src, r, g, b, a);
+        apply_tone_avx512<FWD>(v, vpr, linToLog, r, g, b);
+        AVX512RGBAPack<BIT_DEPTH_F32>::Store(dst, r, g, b, a);
+
+        src += 64;
+        dst += 64;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::LoadMasked(src, r, g, b, a, (uint32_t)remainder);
+        apply_tone_avx512<FWD>(v, vpr, linToLog, r, g, b);
+        AVX512RGBAPack<BIT_DEPTH_F32>::StoreMasked(dst, r, g, b, a, (uint32_t)remainder);
+    }
+}
+
+} // anonymous namespace
+
+void applyGradingToneAVX512(const GradingTone & v, const GradingTonePreRender & vpr,
+                            TransformDirection dir, bool linToLog,
+                            const float * src, float * dst, long numPixels)
+{
+    switch (dir)
+    {
+        case TRANSFORM_DIR_FORWARD:
+            tone_avx512<true>(v, vpr, linToLog, src, dst, numPixels);
+            break;
+        case TRANSFORM_DIR_INVERSE:
+            tone_avx512<false>(v, vpr, linToLog, src, dst, numPixels);
+            break;
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -0,0 +1,676 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_GRADINGTONE_CPU_SIMD_H
+#define INCLUDED_OCIO_GRADINGTONE_CPU_SIMD_H
+
+#include <algorithm>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "MathUtils.h"
+#include "ops/gradingtone/GradingTone.h"
+
+// The GradingTone zones shared by the SSE2, AVX2 & AVX-512 renderers. The pixels are processed
+// in planar form, one register per channel. The kernels are templated on a thin wrapper of the
+// register type (refer to GradingToneOpCPU_SSE2.cpp for example) which provides the arithmetic
+// operators, Sqrt, Min, the LinLog & LogLin conversions and the Less, Greater, GreaterEqual &
+// Select mask operations.
+//
+// The expressions intentionally follow the ones from GradingToneOpCPU.cpp operation by operation
+// so that the results are identical to the scalar ones.
+
+namespace OCIO_NAMESPACE
+{
+
+namespace GradingToneSIMD
+{
+
+template<typename V>
+inline V & GetChannel(RGBMChannel channel, V & red, V & grn, V & blu)
+{
+    return channel == R ? red : (channel == G ? grn : blu);
+}
+
+// res = val < limit ? below : above
+template<typename V>
+inline void SetOnLimit(V & res, const V & val, float limit, const V & below, const V & above)
+{
+    res = Select(Less(val, limit), below, above);
+}
+
+template<typename V>
+inline V MidsFwdChannel(const V & t,
+                        float x0, float x1, float x2, float x3, float x4, float x5,
+                        float y0, float y1, float y2, float y3, float y4, float y5,
+                        float m0, float m1, float m2, float m3, float m4, float m5)
+{
+    const V tL  = (t - x0) / (x1 - x0);
+    const V tM  = (t - x1) / (x2 - x1);
+    const V tR  = (t - x2) / (x3 - x2);
+    const V tR2 = (t - x3) / (x4 - x3);
+    const V tR3 = (t - x4) / (x5 - x4);
+
+    const V fL  = tL * (x1 - x0) * ( tL * 0.5f * (m1 - m0) + m0 ) + y0;
+    const V fM  = tM * (x2 - x1) * ( tM * 0.5f * (m2 - m1) + m1 ) + y1;
+    const V fR  = tR * (x3 - x2) * ( tR * 0.5f * (m3 - m2) + m2 ) + y2;
+    const V fR2 = tR2 * (x4 - x3) * ( tR2 * 0.5f * (m4 - m3) + m3 ) + y3;
+    const V fR3 = tR3 * (x5 - x4) * ( tR3 * 0.5f * (m5 - m4) + m4 ) + y4;
+
+    V res = Select(Less(t, x1), fL, fM);
+    res = Select(Greater(t, x2), fR, res);
+    res = Select(Greater(t, x3), fR2, res);
+    res = Select(Greater(t, x4), fR3, res);
+    res = Select(Less(t, x0), y0 + (t - x0) * m0, res);
+    res = Select(Greater(t, x5), y5 + (t - x5) * m5, res);
+    return res;
+}
+
+template<typename V>
+inline V MidsFwdMaster(const V & t,
+                       float x0, float x1, float x2, float x3, float x4, float x5,
+                       float y0, float y1, float y2, float y3, float y4, float y5,
+                       float m0, float m1, float m2, float m3, float m4, float m5)
+{
+    const V tL  = (t - x0) / (x1 - x0);
+    const V tM  = (t - x1) / (x2 - x1);
+    const V tR  = (t - x2) / (x3 - x2);
+    const V tR2 = (t - x3) / (x4 - x3);
+    const V tR3 = (t - x4) / (x5 - x4);
+
+    const V fL  = tL * (x1 - x0) * ( tL * 0.5f * (m1 - m0) + m0 ) + y0;
+    const V fM  = tM * (x2 - x1) * ( tM * 0.5f * (m2 - m1) + m1 ) + y1;
+    const V fR  = tR * (x3 - x2) * ( tR * 0.5f * (m3 - m2) + m2 ) + y2;
+    const V fR2 = tR2 * (x4 - x3) * ( tR2 * 0.5f * (m4 - m3) + m3 ) + y3;
+    const V fR3 = tR3 * (x5 - x4) * ( tR3 * 0.5f * (m5 - m4) + m4 ) + y4;
+
+    const V fR4 = (t - x0) * m0 + y0;
+    const V fR5 = (t - x5) * m5 + y5;
+
+    V res;
+    SetOnLimit(res, t, x1, fL, fM);
+    SetOnLimit(res, t, x2, res, fR);
+    SetOnLimit(res, t, x3, res, fR2);
+    SetOnLimit(res, t, x4, res, fR3);
+    SetOnLimit(res, t, x0, fR4, res);
+    SetOnLimit(res, t, x5, res, fR5);
+    return res;
+}
+
+// Inverse of one quadratic segment of the midtones curve.
+template<typename V>
+inline V MidsRevSegment(const V & t, float xa, float xb, float ya, float ma, float mb)
+{
+    const V c = ya - t;
+    const float b = ma * (xb - xa);
+    const float a = 0.5f * (mb - ma) * (xb - xa);
+    const V discrim = Sqrt( b * b - 4.f * a * c);
+    const V tmp = (2.f * c) / (-b - discrim);
+    return tmp * (xb - xa) + xa;
+}
+
+template<typename V>
+inline V MidsRevChannel(const V & t,
+                        float x0, float x1, float x2, float x3, float x4, float x5,
+                        float y0, float y1, float y2, float y3, float y4, float y5,
+                        float m0, float m1, float m2, float m3, float m4, float m5)
+{
+    // The scalar code is a chain of 'if (t >= y5) ... else if (t >= y4) ...' so the selects are
+    // applied from the lowest to the highest priority.
+    const V outLin = x0 + (t - y0) / m0;
+
+    V res = outLin;
+    res = Select(GreaterEqual(t, y0), MidsRevSegment(t, x0, x1, y0, m0, m1), res);
+    res = Select(GreaterEqual(t, y1), MidsRevSegment(t, x1, x2, y1, m1, m2), res);
+    res = Select(GreaterEqual(t, y2), MidsRevSegment(t, x2, x3, y2, m2, m3), res);
+    res = Select(GreaterEqual(t, y3), MidsRevSegment(t, x3, x4, y3, m3, m4), res);
+    res = Select(GreaterEqual(t, y4), MidsRevSegment(t, x4, x5, y4, m4, m5), res);
+    res = Select(GreaterEqual(t, y5), outLin, res);
+    return res;
+}
+
+template<typename V>
+inline V MidsRevMaster(const V & t,
+                       float x0, float x1, float x2, float x3, float x4, float x5,
+                       float y0, float y1, float y2, float y3, float y4, float y5,
+                       float m0, float m1, float m2, float m3, float m4, float m5)
+{
+    const V outR4 = x5 + (t - y5) / m5;
+    const V outR3 = MidsRevSegment(t, x4, x5, y4, m4, m5);
+    const V outR2 = MidsRevSegment(t, x3, x4, y3, m3, m4);
+    const V outR  = MidsRevSegment(t, x2, x3, y2, m2, m3);
+    const V outM  = MidsRevSegment(t, x1, x2, y1, m1, m2);
+    const V outL  = MidsRevSegment(t, x0, x1, y0, m0, m1);
+    const V outL0 = x0 + (t - y0) / m0;
+
+    V res;
+    SetOnLimit(res, t, y1, outL, outM);
+    SetOnLimit(res, t, y2, res, outR);
+    SetOnLimit(res, t, y3, res, outR2);
+    SetOnLimit(res, t, y4, res, outR3);
+    SetOnLimit(res, t, y0, outL0, res);
+    SetOnLimit(res, t, y5, res, outR4);
+    return res;
+}
+
+template<typename V>
+void Mids(bool isFwd, const GradingTone & v, const GradingTonePreRender & vpr,
+          RGBMChannel channel, V & red, V & grn, V & blu)
+{
+    const float mid_adj = Clamp(GetChannelValue(v.m_midtones, channel), 0.01f, 1.99f);
+    if (mid_adj == 1.f)
+    {
+        return;
+    }
+
+    const float * x = vpr.m_midX[channel];
+    const float * y = vpr.m_midY[channel];
+    const float * m = vpr.m_midM[channel];
+
+#define MIDS_ARGS x[0], x[1], x[2], x[3], x[4], x[5], \
+                  y[0], y[1], y[2], y[3], y[4], y[5], \
+                  m[0], m[1], m[2], m[3], m[4], m[5]
+
+    if (channel != M)
+    {
+        V & t = GetChannel(channel, red, grn, blu);
+        t = isFwd ? MidsFwdChannel(t, MIDS_ARGS) : MidsRevChannel(t, MIDS_ARGS);
+    }
+    else if (isFwd)
+    {
+        red = MidsFwdMaster(red, MIDS_ARGS);
+        grn = MidsFwdMaster(grn, MIDS_ARGS);
+        blu = MidsFwdMaster(blu, MIDS_ARGS);
+    }
+    else
+    {
+        red = MidsRevMaster(red, MIDS_ARGS);
+        grn = MidsRevMaster(grn, MIDS_ARGS);
+        blu = MidsRevMaster(blu, MIDS_ARGS);
+    }
+
+#undef MIDS_ARGS
+}
+
+template<typename V>
+inline V ComputeHSFwd(float x0, float x1, float x2, float y0, float y1, float y2,
+                      float m0, float m2, const V & t)
+{
+    V res{ t };
+
+    const V tL = (t - x0) / (x1 - x0);
+    const V tR = (t - x1) / (x2 - x1);
+    const V fL = y0 * (1.f - tL*tL) + y1 * tL*tL + m0 * (1.f - tL) * tL * (x1 - x0);
+    const V fR = y1 * (1.f - tR)*(1.f - tR) + y2 * (2.f - tR)*tR + m2 * (tR - 1.f)*tR * (x2 - x1);
+
+    SetOnLimit(res, t, x1, fL, fR);
+    const V r0 = (t - x0) * m0 + y0;
+    SetOnLimit(res, t, x0, r0, res);
+    const V r2 = (t - x2) * m2 + y2;
+    SetOnLimit(res, t, x2, res, r2);
+
+    return res;
+}
+
+template<typename V>
+inline V ComputeHSRev(float x0, float x1, float x2, float y0, float y1, float y2,
+                      float m0, float m2, const V & t)
+{
+    V res{ t };
+
+    const float bL = m0 * (x1 - x0);
+    const float aL = y1 - y0 - m0 * (x1 - x0);
+    const V cL = y0 - t;
+    const V discrimL = Sqrt(bL * bL - 4.f * aL * cL);
+    const V outL = (-2.f * cL) / (discrimL + bL) * (x1 - x0) + x0;
+    const float bR = 2.f*y2 - 2.f*y1 - m2 * (x2 - x1);
+    const float aR = y1 - y2 + m2 * (x2 - x1);
+    const V cR = y1 - t;
+    const V discrimR = Sqrt(bR * bR - 4.f * aR * cR);
+    const V outR = (-2.f * cR) / (discrimR + bR) * (x2 - x1) + x1;
+
+    SetOnLimit(res, t, y1, outL, outR);
+    const V r0 = (t - y0) / m0 + x0;
+    SetOnLimit(res, t, y0, r0, res);
+    const V r2 = (t - y2) / m2 + x2;
+    SetOnLimit(res, t, y2, res, r2);
+
+    return res;
+}
+
+template<typename V>
+void HighlightShadow(bool isFwd, const GradingTone & v, const GradingTonePreRender & vpr,
+                     RGBMChannel channel, bool isShadow, V & red, V & grn, V & blu)
+{
+    // The effect of val is symmetric around 1 (<1 uses Fwd algorithm, >1 uses Rev algorithm).
+    float val = isShadow ? GetChannelValue(v.m_shadows, channel) :
+                           GetChannelValue(v.m_highlights, channel);
+    if (!isShadow)
+    {
+        val = 2.f - val;
+    }
+    if (val == 1.) return;
+
+    const int zone = isShadow ? 1 : 0;
+    const float x0 = vpr.m_hsX[zone][channel][0];
+    const float x1 = vpr.m_hsX[zone][channel][1];
+    const float x2 = vpr.m_hsX[zone][channel][2];
+    const float y0 = vpr.m_hsY[zone][channel][0];
+    const float y1 = vpr.m_hsY[zone][channel][1];
+    const float y2 = vpr.m_hsY[zone][channel][2];
+    const float m0 = vpr.m_hsM[zone][channel][0];
+    const float m2 = vpr.m_hsM[zone][channel][1];
+
+    const bool useFwd = (val < 1.) == isFwd;
+
+    auto compute = [&](const V & t)
+    {
+        return useFwd ? ComputeHSFwd(x0, x1, x2, y0, y1, y2, m0, m2, t)
+                      : ComputeHSRev(x0, x1, x2, y0, y1, y2, m0, m2, t);
+    };
+
+    if (channel != M)
+    {
+        V & t = GetChannel(channel, red, grn, blu);
+        t = compute(t);
+    }
+    else
+    {
+        red = compute(red);
+        grn = compute(grn);
+        blu = compute(blu);
+    }
+}
+
+// Parameters of the white & black zones which do not vary per pixel.
+struct WBParams
+{
+    float x0, x1, y0, y1, m0, m1, gain;
+    // Quadratic extrapolation of the whites.
+    float aa, bb, cc;
+};
+
+template<typename V>
+inline V ComputeWBFwd(bool isBlack, float mtest, const WBParams & p, V t)
+{
+    const float x0 = p.x0, x1 = p.x1, y0 = p.y0, y1 = p.y1, m0 = p.m0, m1 = p.m1;
+    const float gain = p.gain;
+
+    if (mtest < 1.f)
+    {
+        // Slope is decreasing case.
+
+        const V tlocal = (t - x0) / (x1 - x0);
+        V res = tlocal * (x1 - x0) * (tlocal * 0.5f * (m1 - m0) + m0) + y0;
+        const V res0 = y0 + (t - x0) * m0;
+        SetOnLimit(res, t, x0, res0, res);
+        const V res1 = y1 + (t - x1) * m1;
+        SetOnLimit(res, t, x1, res, res1);
+
+        return res;
+    }
+
+    // Slope is increasing case.
+
+    t = (!isBlack) ? (t - x0) * gain + x0 : (t - x1) * gain + x1;
+
+    const float a = 0.5f * (m1 - m0) * (x1 - x0);
+    const float b = m0 * (x1 - x0);
+
+    const V c = y0 - t;
+    const V discrim = Sqrt(b * b - 4.f * a * c);
+    const V tmp = (-2.f * c) / (discrim + b);
+    V res = tmp * (x1 - x0) + x0;
+    const V res0 = x0 + (t - y0) / m0;
+    SetOnLimit(res, t, y0, res0, res);
+
+    if (!isBlack)
+    {
+        res = (res - x0) / gain + x0;
+        t = (t - x0) / gain + x0;
+
+        const V res1 = (p.aa * t + p.bb) * t + p.cc;
+        SetOnLimit(res, t, x1, res, res1);
+    }
+    else
+    {
+        const V res1 = x1 + (t - y1) / m1;
+        SetOnLimit(res, t, y1, res, res1);
+        res = (res - x1) / gain + x1;
+    }
+
+    return res;
+}
+
+template<typename V>
+inline V ComputeWBRev(bool isBlack, float mtest, const WBParams & p, V t)
+{
+    const float x0 = p.x0, x1 = p.x1, y0 = p.y0, y1 = p.y1, m0 = p.m0, m1 = p.m1;
+    const float gain = p.gain;
+
+    if (mtest < 1.f)
+    {
+        // Slope is decreasing case.
+
+        const float a = 0.5f * (m1 - m0) * (x1 - x0);
+        const float b = m0 * (x1 - x0);
+
+        const V c = y0 - t;
+        const V discrim = Sqrt(b * b - 4.f * a * c);
+        const V tmp = (-2.f * c) / (discrim + b);
+        V res = tmp * (x1 - x0) + x0;
+        const V res0 = x0 + (t - y0) / m0;
+        SetOnLimit(res, t, y0, res0, res);
+
+        const V res1 = x1 + (t - y1) / m1;
+        SetOnLimit(res, t, y1, res, res1);
+
+        return res;
+    }
+
+    // Slope is increasing case.
+
+    t = (!isBlack) ? (t - x0) * gain + x0 : (t - x1) * gain + x1;
+
+    const V tlocal = (t - x0) / (x1 - x0);
+    V res = tlocal * (x1 - x0) * (tlocal * 0.5f * (m1 - m0) + m0) + y0;
+    const V res0 = y0 + (t - x0) * m0;
+    SetOnLimit(res, t, x0, res0, res);
+
+    if (!isBlack)
+    {
+        const float aa = p.aa, bb = p.bb, cc = p.cc;
+
+        res = (res - x0) / gain + x0;
+        t = (t - x0) / gain + x0;
+
+        const V c = cc - t;
+        const V discrim = Sqrt(bb * bb - 4.f * aa * c);
+        const V res1 = (-2.f * c) / (discrim + bb);
+        const float brk = (aa * x1 + bb) * x1 + cc;
+        SetOnLimit(res, t, brk, res, res1);
+    }
+    else
+    {
+        const V res1 = y1 + (t - x1) * m1;
+        SetOnLimit(res, t, x1, res, res1);
+        res = (res - x1) / gain + x1;
+    }
+
+    return res;
+}
+
+template<typename V>
+void WhiteBlack(bool isFwd, const GradingTone & v, const GradingTonePreRender & vpr,
+                RGBMChannel channel, bool isBlack, V & red, V & grn, V & blu)
+{
+    const float val = isBlack ? GetChannelValue(v.m_blacks, channel) :
+                                GetChannelValue(v.m_whites, channel);
+
+    const float mtest = (!isBlack) ? val : 2.f - val;
+    if (!(mtest < 1.f) && !(mtest > 1.f))
+    {
+        // Identity (or NaN) value.
+        return;
+    }
+
+    const int zone = isBlack ? 1 : 0;
+
+    WBParams p;
+    p.x0   = vpr.m_wbX[zone][channel][0];
+    p.x1   = vpr.m_wbX[zone][channel][1];
+    p.y0   = vpr.m_wbY[zone][channel][0];
+    p.y1   = vpr.m_wbY[zone][channel][1];
+    p.m0   = vpr.m_wbM[zone][channel][0];
+    p.m1   = vpr.m_wbM[zone][channel][1];
+    p.gain = vpr.m_wbGain[zone][channel];
+    p.aa   = 0.f;
+    p.bb   = 0.f;
+    p.cc   = 0.f;
+
+    if (mtest > 1.f && !isBlack)
+    {
+        const float x0 = p.x0, x1 = p.x1, m0 = p.m0, m1 = p.m1, gain = p.gain;
+
+        // Quadratic extrapolation for better HDR control.
+        const float new_y1 = (x1 - x0) / gain + x0;
+        const float xd = x0 + (x1 - x0) * 0.99f;
+        float md = m0 + (xd - x0) * (m1 - m0) / (x1 - x0);
+        md = 1.f / md;
+        p.aa = 0.5f * (1.f / m1 - md) / (x1 - xd);
+        p.bb = 1.f / m1 - 2.f * p.aa * x1;
+        p.cc = new_y1 - p.bb * x1 - p.aa * x1 * x1;
+    }
+
+    auto compute = [&](const V & t)
+    {
+        return isFwd ? ComputeWBFwd(isBlack, mtest, p, t) : ComputeWBRev(isBlack, mtest, p, t);
+    };
+
+    if (channel != M)
+    {
+        V & t = GetChannel(channel, red, grn, blu);
+        t = compute(t);
+    }
+    else
+    {
+        red = compute(red);
+        grn = compute(grn);
+        blu = compute(blu);
+    }
+}
+
+template<typename V>
+inline V SContrastFwd(const GradingTonePreRender & vpr, float contrast, const V & t)
+{
+    V outColor{ (t - vpr.m_pivot) * contrast + vpr.m_pivot };
+
+    // Top end
+    {
+        const float x1 = vpr.m_scX[0][1];
+        const float x2 = vpr.m_scX[0][2];
+        const float y1 = vpr.m_scY[0][1];
+        const float y2 = vpr.m_scY[0][2];
+        const float m0 = vpr.m_scM[0][0];
+        const float m3 = vpr.m_scM[0][1];
+
+        const V tR  = (t - x1) / (x2 - x1);
+        const V res = tR * (x2 - x1) * ( tR * 0.5f * (m3 - m0) + m0 ) + y1;
+
+        SetOnLimit(outColor, t, x1, outColor, res);
+
+        const V res2 = y2 + (t - x2) * m3;
+        SetOnLimit(outColor, t, x2, outColor, res2);
+    }
+
+    // Bottom end
+    {
+        const float x1 = vpr.m_scX[1][1];
+        const float x2 = vpr.m_scX[1][2];
+        const float y1 = vpr.m_scY[1][1];
+        const float m0 = vpr.m_scM[1][0];
+        const float m3 = vpr.m_scM[1][1];
+
+        const V tR = (t - x1) / (x2 - x1);
+        const V res = tR * (x2 - x1) * (tR * 0.5f * (m3 - m0) + m0) + y1;
+
+        SetOnLimit(outColor, t, x2, res, outColor);
+
+        const V res1 = y1 + (t - x1) * m0;
+        SetOnLimit(outColor, t, x1, res1, outColor);
+    }
+
+    return outColor;
+}
+
+template<typename V>
+inline V SContrastRev(const GradingTonePreRender & vpr, float contrast, const V & t)
+{
+    V outColor{ (t - vpr.m_pivot) / contrast + vpr.m_pivot };
+
+    // Top end
+    {
+        const float x1 = vpr.m_scX[0][1];
+        const float x2 = vpr.m_scX[0][2];
+        const float y1 = vpr.m_scY[0][1];
+        const float y2 = vpr.m_scY[0][2];
+        const float m0 = vpr.m_scM[0][0];
+        const float m3 = vpr.m_scM[0][1];
+
+        const float b = m0 * (x2 - x1);
+        const float a = (m3 - m0) * 0.5f * (x2 - x1);
+        const V c = y1 - t;
+        const V discrim = Sqrt(b * b - 4.f * a * c);
+        const V res =  (x2 - x1) * (-2.f * c) / (discrim + b) + x1;
+
+        SetOnLimit(outColor, t, y1, outColor, res);
+        SetOnLimit(outColor, t, y2, outColor, x2 + (t - y2) / m3);
+    }
+
+    // Bottom end
+    {
+        const float x1 = vpr.m_scX[1][1];
+        const float x2 = vpr.m_scX[1][2];
+        const float y1 = vpr.m_scY[1][1];
+        const float y2 = vpr.m_scY[1][2];
+        const float m0 = vpr.m_scM[1][0];
+        const float m3 = vpr.m_scM[1][1];
+
+        const float b = m0 * (x2 - x1);
+        const float a = (m3 - m0) * 0.5f * (x2 - x1);
+        const V c = y1 - t;
+        const V discrim = Sqrt(b * b - 4.f * a * c);
+        const V res =  (x2 - x1) * (-2.f * c) / (discrim + b) + x1;
+
+        SetOnLimit(outColor, t, y2, res, outColor);
+        SetOnLimit(outColor, t, y1, x1 + (t - y1) / m0, outColor);
+    }
+
+    return outColor;
+}
+
+template<typename V>
+void SContrast(bool isFwd, const GradingTone & v, const GradingTonePreRender & vpr,
+               V & red, V & grn, V & blu)
+{
+    float contrast = static_cast<float>(v.m_scontrast);
+    if (contrast != 1.)
+    {
+        // Limit the range of values to prevent reversals.
+        contrast = (contrast > 1.f) ? 1.f / (1.8125f - 0.8125f * std::min(contrast, 1.99f)) :
+                                            0.28125f + 0.71875f * std::max(contrast, 0.01f);
+
+        if (isFwd)
+        {
+            red = SContrastFwd(vpr, contrast, red);
+            grn = SContrastFwd(vpr, contrast, grn);
+            blu = SContrastFwd(vpr, contrast, blu);
+        }
+        else
+        {
+            red = SContrastRev(vpr, contrast, red);
+            grn = SContrastRev(vpr, contrast, grn);
+            blu = SContrastRev(vpr, contrast, blu);
+        }
+    }
+}
+
+// Apply all the zones in the forward direction.
+template<typename V>
+void ApplyFwd(const GradingTone & v, const GradingTonePreRender & vpr,
+              bool linToLog, V & red, V & grn, V & blu)
+{
+    if (linToLog)
+    {
+        red = LinLog(red);
+        grn = LinLog(grn);
+        blu = LinLog(blu);
+    }
+
+    for (const RGBMChannel channel : { R, G, B, M })
+    {
+        Mids(true, v, vpr, channel, red, grn, blu);
+    }
+    for (const RGBMChannel channel : { R, G, B, M })
+    {
+        HighlightShadow(true, v, vpr, channel, false, red, grn, blu);
+    }
+    for (const RGBMChannel channel : { R, G, B, M })
+    {
+        WhiteBlack(true, v, vpr, channel, false, red, grn, blu);
+    }
+    for (const RGBMChannel channel : { R, G, B, M })
+    {
+        HighlightShadow(true, v, vpr, channel, true, red, grn, blu);
+    }
+    for (const RGBMChannel channel : { R, G, B, M })
+    {
+        WhiteBlack(true, v, vpr, channel, true, red, grn, blu);
+    }
+
+    SContrast(true, v, vpr, red, grn, blu);
+
+    if (linToLog)
+    {
+        red = LogLin(red);
+        grn = LogLin(grn);
+        blu = LogLin(blu);
+    }
+
+    red = Min(red, 65504.f);
+    grn = Min(grn, 65504.f);
+    blu = Min(blu, 65504.f);
+}
+
+// Apply all the zones in the inverse direction.
+template<typename V>
+void ApplyRev(const GradingTone & v, const GradingTonePreRender & vpr,
+              bool linToLog, V & red, V & grn, V & blu)
+{
+    if (linToLog)
+    {
+        red = LinLog(red);
+        grn = LinLog(grn);
+        blu = LinLog(blu);
+    }
+
+    SContrast(false, v, vpr, red, grn, blu);
+
+    for (const RGBMChannel channel : { M, R, G, B })
+    {
+        WhiteBlack(false, v, vpr, channel, true, red, grn, blu);
+    }
+    for (const RGBMChannel channel : { M, R, G, B })
+    {
+        HighlightShadow(false, v, vpr, channel, true, red, grn, blu);
+    }
+    for (const RGBMChannel channel : { M, R, G, B })
+    {
+        WhiteBlack(false, v, vpr, channel, false, red, grn, blu);
+    }
+    for (const RGBMChannel channel : { M, R, G, B })
+    {
+        HighlightShadow(false, v, vpr, channel, false, red, grn, blu);
+    }
+    for (const RGBMChannel channel : { M, R, G, B })
+    {
+        Mids(false, v, vpr, channel, red, grn, blu);
+    }
+
+    if (linToLog)
+    {
+        red = LogLin(red);
+        grn = LogLin(grn);
+        blu = LogLin(blu);
+    }
+
+    red = Min(red, 65504.f);
+    grn = Min(grn, 65504.f);
+    blu = Min(blu, 65504.f);
+}
+
+} // namespace GradingToneSIMD
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_GRADINGTONE_CPU_SIMD_H
@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "GradingToneOpCPU_SSE2.h"
+#if OCIO_USE_SSE2
+
+#include "ops/gradingtone/GradingToneOpCPU_SIMD.h"
+#include "SSE.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+// Thin wrapper of the SSE2 register used by the GradingToneSIMD kernels.
+struct vfloat_sse2
+{
+    vfloat_sse2() = default;
+    vfloat_sse2(__m128 v) : m_v(v) {}
+
+    __m128 m_v;
+};
+
+typedef vfloat_sse2 V;
+
+inline V operator+(const V & a, const V & b) { return _mm_add_ps(a.m_v, b.m_v); }
+inline V operator+(const V & a, float b)     { return _mm_add_ps(a.m_v, _mm_set1_ps(b)); }
+inline V operator+(float a, const V & b)     { return _mm_add_ps(_mm_set1_ps(a), b.m_v); }
+inline V operator-(const V & a, const V & b) { return _mm_sub_ps(a.m_v, b.m_v); }
+inline V operator-(const V & a, float b)     { return _mm_sub_ps(a.m_v, _mm_set1_ps(b)); }
+inline V operator-(float a, const V & b)     { return _mm_sub_ps(_mm_set1_ps(a), b.m_v); }
+inline V operator*(const V & a, const V & b) { return _mm_mul_ps(a.m_v, b.m_v); }
+inline V operator*(const V & a, float b)     { return _mm_mul_ps(a.m_v, _mm_set1_ps(b)); }
+inline V operator*(float a, const V & b)     { return _mm_mul_ps(_mm_set1_ps(a), b.m_v); }
+inline V operator/(const V & a, const V & b) { return _mm_div_ps(a.m_v, b.m_v); }
+inline V operator/(const V & a, float b)     { return _mm_div_ps(a.m_v, _mm_set1_ps(b)); }
+inline V operator/(float a, const V & b)     { return _mm_div_ps(_mm_set1_ps(a), b.m_v); }
+
+inline V Sqrt(const V & a) { return _mm_sqrt_ps(a.m_v); }
+
+// Same as std::min(a, b).
+inline V Min(const V & a, float b) { return _mm_min_ps(_mm_set1_ps(b), a.m_v); }
+
+inline __m128 Less(const V & a, float b)         { return _mm_cmplt_ps(a.m_v, _mm_set1_ps(b)); }
+inline __m128 Greater(const V & a, float b)      { return _mm_cmpgt_ps(a.m_v, _mm_set1_ps(b)); }
+inline __m128 GreaterEqual(const V & a, float b) { return _mm_cmpge_ps(a.m_v, _mm_set1_ps(b)); }
+
+inline V Select(__m128 mask, const V & a, const V & b) { return sseSelect(mask, a.m_v, b.m_v); }
+
+// Refer to LinLog() & LogLin() in GradingToneOpCPU.cpp.
+
+static constexpr float xbrk = 0.0041318374739483946f;
+static constexpr float shift = -0.000157849851665374f;
+static constexpr float gain = 363.034608563f;
+static constexpr float offs = -7.f;
+static constexpr float ybrk = -5.5f;
+
+inline V LinLog(const V & in)
+{
+    const __m128 flag = _mm_cmpgt_ps(in.m_v, _mm_set1_ps(xbrk));
+
+    const __m128 pixLin = _mm_add_ps(_mm_mul_ps(in.m_v, _mm_set1_ps(gain)), _mm_set1_ps(offs));
+
+    __m128 pix = _mm_add_ps(in.m_v, _mm_set1_ps(shift));
+    pix = _mm_mul_ps(pix, _mm_set1_ps(1.f / (0.18f + shift)));
+    pix = sseLog2(pix);
+
+    return sseSelect(flag, pix, pixLin);
+}
+
+inline V LogLin(const V & in)
+{
+    const __m128 flag = _mm_cmpgt_ps(in.m_v, _mm_set1_ps(ybrk));
+
+    const __m128 pixLin = _mm_mul_ps(_mm_sub_ps(in.m_v, _mm_set1_ps(offs)),
+                                     _mm_set1_ps(1.f / gain));
+
+    __m128 pix = ssePower(_mm_set1_ps(2.0f), in.m_v);
+    pix = _mm_mul_ps(pix, _mm_set1_ps(shift + 0.18f));
+    pix = _mm_sub_ps(pix, _mm_set1_ps(shift));
+
+    return sseSelect(flag, pix, pixLin);
+}
+
+template<bool FWD>
+static inline void tone_4pixels_sse2(const GradingTone & v, const GradingTonePreRender & vpr,
+                                     bool linToLog, const float * src, float * dst)
+{
+    __m128 r = _mm_loadu_ps(src);
+    __m128 g = _mm_loadu_ps(src + 4);
+    __m128 b = _mm_loadu_ps(src + 8);
+    __m128 a = _mm_loadu_ps(src + 12);
+
+    _MM_TRANSPOSE4_PS(r, g, b, a);
+
+    V red{ r }, grn{ g }, blu{ b };
+    if (FWD)
+    {
+        GradingToneSIMD::ApplyFwd(v, vpr, linToLog, red, grn, blu);
+    }
+    else
+    {
+        GradingToneSIMD::ApplyRev(v, vpr, linToLog, red, grn, blu);
+    }
+    r = red.m_v;
+    g = grn.m_v;
+    b = blu.m_v;
+
+    _MM_TRANSPOSE4_PS(r, g, b, a);
+
+    _mm_storeu_ps(dst,      r);
+    _mm_storeu_ps(dst + 4,  g);
+    _mm_storeu_ps(dst + 8,  b);
+    _mm_storeu_ps(dst + 12, a);
+}
+
+template<bool FWD>
+static inline void tone_sse2(const GradingTone & v, const GradingTonePreRender & vpr,
+                             bool linToLog, const float * src, float * dst, long numPixels)
+{
+    const long pixel_count = numPixels / 4 * 4;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 4)
+    {
+        tone_4pixels_sse2<FWD>(v, vpr, linToLog, src, dst);
+
+        src += 16;
+        dst += 16;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        float buf[16] = {};
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            buf[i] = src[i];
+        }
+
+        tone_4pixels_sse2<FWD>(v, vpr, linToLog, buf, buf);
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            dst[i] = buf[i];
+        }
+    }
+}
+
+} // anonymous namespace
+
+void applyGradingToneSSE2(const GradingTone & v, const GradingTonePreRender & vpr,
+                          TransformDirection dir, bool linToLog,
+                          const float * src, float * dst, long numPixels)
+{
+    switch (dir)
+    {
+        case TRANSFORM_DIR_FORWARD:
+            tone_sse2<true>(v, vpr, linToLog, src, dst, numPixels);
+            break;
+        case TRANSFORM_DIR_INVERSE:
+            tone_sse2<false>(v, vpr, linToLog, src, dst, numPixels);
+            break;
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_SSE2
@@ -2,7 +2,6 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
-#include <cstring>
 #include <cmath>
 #if OCIO_USE_SSE2 == 0
 #include <tuple>
@@ -11,8 +10,11 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "MathUtils.h"
 #include "ops/log/LogOpCPU.h"
+#include "ops/log/LogOpCPU_AVX2.h"
+#include "ops/log/LogOpCPU_AVX512.h"
 #include "ops/log/LogUtils.h"
 #include "ops/OpTools.h"
 #include "Platform.h"
@@ -28,9 +30,24 @@ public:
 
     explicit LogOpCPU(ConstLogOpDataRcPtr & log);
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * rPlane, float * gPlane, float * bPlane, float * aPlane,
+                     long numPixels) const override;
+
+    bool hasPackedRGBApply() const override { return true; }
+    void applyPackedRGB(const void * inImg, void * outImg, long numPixels) const override;
+
 protected:
     // Update renderer parameters.
     virtual void updateData(ConstLogOpDataRcPtr & log);
+
+protected:
+    // The renderer parameters converted into the generic form used by the vectorized, the
+    // planar and the packed RGB implementations.
+    LogRenderParams m_params;
+    bool m_lin2log = true;
+    // Do the planar & packed RGB processing use the fast log & exp of the SSE renderers?
+    bool m_fastExp = false;
 };
 
 // Base class for LogToLin and LinToLog renderers.
@@ -221,6 +238,56 @@ public:
 static constexpr float LOG2_10 = ((float) 3.3219280948873623478703194294894);
 static constexpr float LOG10_2 = ((float) 0.3010299956639811952137388947245);
 
+#if OCIO_USE_AVX2 || OCIO_USE_AVX512
+typedef void (LogApplyFunc)(const LogRenderParams & params, const float * src, float * dst, long numPixels);
+
+// Return the fastest vectorized implementation supported by the CPU, or null if none.
+LogApplyFunc * GetLogApplyFunc(bool lin2log)
+{
+    LogApplyFunc * func = nullptr;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        func = lin2log ? applyLin2LogAVX2 : applyLog2LinAVX2;
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        func = lin2log ? applyLin2LogAVX512 : applyLog2LinAVX512;
+    }
+#endif
+
+    return func;
+}
+
+// Renderer for the AVX2 & AVX-512 implementations i.e. the vectorized implementations directly
+// use the generic form of the parameters computed by the renderer.
+template<typename Renderer>
+class LogRendererAVX : public Renderer
+{
+public:
+    template<typename... Args>
+    explicit LogRendererAVX(ConstLogOpDataRcPtr & log, Args... args)
+        : Renderer(log, args...)
+        , m_applyFunc(GetLogApplyFunc(this->m_lin2log))
+    {
+        // The planar & packed RGB processing use the SSE fast log & exp.
+        this->m_fastExp = true;
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override
+    {
+        m_applyFunc(this->m_params, (const float *)inImg, (float *)outImg, numPixels);
+    }
+
+private:
+    LogApplyFunc * m_applyFunc = nullptr;
+};
+#endif
+
 ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log, bool fastExp)
 {
 #if OCIO_USE_SSE2 == 0
@@ -228,6 +295,35 @@ ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log, bool fastExp)
 #endif
 
     const TransformDirection dir = log->getDirection();
+
+#if OCIO_USE_AVX2 || OCIO_USE_AVX512
+    if (fastExp && GetLogApplyFunc(true))
+    {
+        const bool fwd = dir == TRANSFORM_DIR_FORWARD;
+
+        if (log->isLog2())
+        {
+            if (fwd) return std::make_shared<LogRendererAVX<LogRenderer>>(log, 1.0f);
+            else     return std::make_shared<LogRendererAVX<AntiLogRenderer>>(log, 1.0f);
+        }
+        else if (log->isLog10())
+        {
+            if (fwd) return std::make_shared<LogRendererAVX<LogRenderer>>(log, LOG10_2);
+            else     return std::make_shared<LogRendererAVX<AntiLogRenderer>>(log, LOG2_10);
+        }
+        else if (log->isCamera())
+        {
+            if (fwd) return std::make_shared<LogRendererAVX<CameraLin2LogRenderer>>(log);
+            else     return std::make_shared<LogRendererAVX<CameraLog2LinRenderer>>(log);
+        }
+        else
+        {
+            if (fwd) return std::make_shared<LogRendererAVX<Lin2LogRenderer>>(log);
+            else     return std::make_shared<LogRendererAVX<Log2LinRenderer>>(log);
+        }
+    }
+#endif
+
     if (log->isLog2())
     {
         switch (dir)
@@ -323,100 +419,346 @@ void LogOpCPU::updateData(ConstLogOpDataRcPtr & /* log */)
 {
 }
 
-
-L2LBaseRenderer::L2LBaseRenderer(ConstLogOpDataRcPtr & log)
-    : LogOpCPU(log)
+namespace
 {
-}
 
-void L2LBaseRenderer::updateData(ConstLogOpDataRcPtr & log)
+// The scalar computation of one value of the channel chan, shared by the scalar renderers and
+// the planar & packed RGB processing so that they give identical results.
+template<bool lin2log, bool hasBreak>
+inline float ComputeLog(const LogRenderParams & p, int chan, float in)
 {
-    LogOpCPU::updateData(log);
+    static constexpr float minValue = std::numeric_limits<float>::min();
 
-    m_base = (float)log->getBase();
-    m_paramsR = log->getRedParams();
-    m_paramsG = log->getGreenParams();
-    m_paramsB = log->getBlueParams();
+    if (lin2log)
+    {
+        if (hasBreak && in < p.m_break[chan])
+        {
+            return in * p.m_linearScale[chan] + p.m_linearOffset[chan];
+        }
+
+        float out = in * p.m_scale[chan] + p.m_offset[chan];
+        out = std::max(minValue, out);
+        out = log2(out);
+        return out * p.m_logScale[chan] + p.m_logOffset[chan];
+    }
+    else
+    {
+        if (hasBreak && in < p.m_break[chan])
+        {
+            return (in + p.m_linearOffset[chan]) * p.m_linearScale[chan];
+        }
+
+        float out = (in + p.m_logOffset[chan]) * p.m_logScale[chan];
+        out = exp2(out);
+        return (out + p.m_offset[chan]) * p.m_scale[chan];
+    }
 }
 
-LogRenderer::LogRenderer(ConstLogOpDataRcPtr & log, float logScale)
-    : LogOpCPU(log)
-    , m_logScale(logScale)
+// Process packed RGBA pixels with the scalar computations, the alpha channel is unchanged.
+template<bool lin2log, bool hasBreak>
+void ApplyLogRGBA(const LogRenderParams & p, const void * inImg, void * outImg, long numPixels)
 {
-    LogOpCPU::updateData(log);
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        // NB: 'in' and 'out' could be pointers to the same memory buffer.
+        out[0] = ComputeLog<lin2log, hasBreak>(p, 0, in[0]);
+        out[1] = ComputeLog<lin2log, hasBreak>(p, 1, in[1]);
+        out[2] = ComputeLog<lin2log, hasBreak>(p, 2, in[2]);
+        out[3] = in[3];
+
+        in  += 4;
+        out += 4;
+    }
 }
 
-inline void ApplyScale(float * pix, const float scale)
+#if OCIO_USE_SSE2
+// The parameters of the SSE computations, with the parameter values of each lane.
+struct LogParamsSSE
 {
-    pix[0] = pix[0] * scale;
-    pix[1] = pix[1] * scale;
-    pix[2] = pix[2] * scale;
-}
+    __m128 m_scale;
+    __m128 m_offset;
+    __m128 m_logScale;
+    __m128 m_logOffset;
+    __m128 m_break;
+    __m128 m_linearScale;
+    __m128 m_linearOffset;
+};
 
-inline void ApplyScale(float * pix, const float * scale)
+// Build the SSE parameters where lanes() arranges the three per channel values.
+template<typename Lanes>
+LogParamsSSE GetLogParamsSSE(const LogRenderParams & p, Lanes lanes)
 {
-    pix[0] = pix[0] * scale[0];
-    pix[1] = pix[1] * scale[1];
-    pix[2] = pix[2] * scale[2];
+    LogParamsSSE params;
+    params.m_scale        = lanes(p.m_scale);
+    params.m_offset       = lanes(p.m_offset);
+    params.m_logScale     = lanes(p.m_logScale);
+    params.m_logOffset    = lanes(p.m_logOffset);
+    params.m_break        = lanes(p.m_break);
+    params.m_linearScale  = lanes(p.m_linearScale);
+    params.m_linearOffset = lanes(p.m_linearOffset);
+    return params;
 }
 
-inline void ApplyAdd(float * pix, const float * add)
+// Same computations as the SSE renderers for four values.
+template<bool lin2log, bool hasBreak>
+inline __m128 ComputeLogSSE(const LogParamsSSE & p, __m128 pixel)
 {
-    pix[0] = pix[0] + add[0];
-    pix[1] = pix[1] + add[1];
-    pix[2] = pix[2] + add[2];
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    __m128 data;
+    __m128 lin = pixel;
+
+    if (lin2log)
+    {
+        if (hasBreak)
+        {
+            lin = _mm_mul_ps(pixel, p.m_linearScale);
+            lin = _mm_add_ps(lin, p.m_linearOffset);
+        }
+
+        data = _mm_mul_ps(pixel, p.m_scale);
+        data = _mm_add_ps(data, p.m_offset);
+        data = _mm_max_ps(data, _mm_set1_ps(minValue));
+        data = sseLog2(data);
+        data = _mm_mul_ps(data, p.m_logScale);
+        data = _mm_add_ps(data, p.m_logOffset);
+    }
+    else
+    {
+        if (hasBreak)
+        {
+            lin = _mm_add_ps(pixel, p.m_linearOffset);
+            lin = _mm_mul_ps(lin, p.m_linearScale);
+        }
+
+        data = _mm_add_ps(pixel, p.m_logOffset);
+        data = _mm_mul_ps(data, p.m_logScale);
+        data = sseExp2(data);
+        data = _mm_add_ps(data, p.m_offset);
+        data = _mm_mul_ps(data, p.m_scale);
+    }
+
+    if (hasBreak)
+    {
+        const __m128 flag = _mm_cmpgt_ps(pixel, p.m_break);
+        data = _mm_or_ps(_mm_and_ps(flag, data), _mm_andnot_ps(flag, lin));
+    }
+
+    return data;
 }
+#endif
 
-inline void ApplyMax(float * pix, float minValue)
+// Process the plane of the channel chan, the fast log & exp are the ones of the SSE renderers.
+template<bool lin2log, bool hasBreak, bool fastExp>
+void ApplyLogPlane(const LogRenderParams & p, int chan, float * plane, long numPixels)
 {
-    pix[0] = std::max(minValue, pix[0]);
-    pix[1] = std::max(minValue, pix[1]);
-    pix[2] = std::max(minValue, pix[2]);
+#if OCIO_USE_SSE2
+    if (fastExp)
+    {
+        const LogParamsSSE params
+            = GetLogParamsSSE(p, [chan](const float * v) { return _mm_set1_ps(v[chan]); });
+
+        long idx = 0;
+        for (; idx + 4 <= numPixels; idx += 4)
+        {
+            const __m128 pixel = _mm_loadu_ps(plane + idx);
+            _mm_storeu_ps(plane + idx, ComputeLogSSE<lin2log, hasBreak>(params, pixel));
+        }
+
+        // Use the same computation for the remaining values.
+        if (idx < numPixels)
+        {
+            float tmp[4]{ 0.0f, 0.0f, 0.0f, 0.0f };
+            std::copy(plane + idx, plane + numPixels, tmp);
+
+            const __m128 pixel = _mm_loadu_ps(tmp);
+            _mm_storeu_ps(tmp, ComputeLogSSE<lin2log, hasBreak>(params, pixel));
+
+            std::copy(tmp, tmp + (numPixels - idx), plane + idx);
+        }
+
+        return;
+    }
+#endif
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        plane[idx] = ComputeLog<lin2log, hasBreak>(p, chan, plane[idx]);
+    }
 }
 
-inline void ApplyLog2(float * pix)
+// Process packed RGB pixels (i.e. three values per pixel).
+template<bool lin2log, bool hasBreak, bool fastExp>
+void ApplyLogRGB(const LogRenderParams & p, const float * in, float * out, long numPixels)
 {
-    pix[0] = log2(pix[0]);
-    pix[1] = log2(pix[1]);
-    pix[2] = log2(pix[2]);
+#if OCIO_USE_SSE2
+    if (fastExp)
+    {
+        LogParamsSSE params[3];
+        for (int reg = 0; reg < 3; ++reg)
+        {
+            params[reg]
+                = GetLogParamsSSE(p, [reg](const float * v) { return sseRGBChannels(v, reg); });
+        }
+
+        auto computeRGB = [&params](const float * src, float * dst)
+        {
+            for (int reg = 0; reg < 3; ++reg)
+            {
+                const __m128 pixel = _mm_loadu_ps(src + 4 * reg);
+                _mm_storeu_ps(dst + 4 * reg, ComputeLogSSE<lin2log, hasBreak>(params[reg], pixel));
+            }
+        };
+
+        long idx = 0;
+        for (; idx + 4 <= numPixels; idx += 4)
+        {
+            computeRGB(in + 3 * idx, out + 3 * idx);
+        }
+
+        // Use the same computation for the remaining pixels.
+        if (idx < numPixels)
+        {
+            float tmp[12]{ 0.0f };
+            std::copy(in + 3 * idx, in + 3 * numPixels, tmp);
+
+            computeRGB(tmp, tmp);
+
+            std::copy(tmp, tmp + 3 * (numPixels - idx), out + 3 * idx);
+        }
+
+        return;
+    }
+#endif
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        for (int chan = 0; chan < 3; ++chan)
+        {
+            out[3 * idx + chan] = ComputeLog<lin2log, hasBreak>(p, chan, in[3 * idx + chan]);
+        }
+    }
 }
 
-inline void ApplyExp2(float * pix)
+} // anon.
+
+void LogOpCPU::applyPlanar(float * rPlane, float * gPlane, float * bPlane, float * /* aPlane */,
+                           long numPixels) const
 {
-    pix[0] = exp2(pix[0]);
-    pix[1] = exp2(pix[1]);
-    pix[2] = exp2(pix[2]);
+    // Note that the alpha channel is left unchanged.
+    float * planes[3] = { rPlane, gPlane, bPlane };
+
+    const bool hasBreak = m_params.m_hasBreak;
+
+    for (int chan = 0; chan < 3; ++chan)
+    {
+        float * plane = planes[chan];
+
+        if (m_fastExp)
+        {
+            if (m_lin2log)
+            {
+                if (hasBreak) ApplyLogPlane<true, true, true>(m_params, chan, plane, numPixels);
+                else          ApplyLogPlane<true, false, true>(m_params, chan, plane, numPixels);
+            }
+            else
+            {
+                if (hasBreak) ApplyLogPlane<false, true, true>(m_params, chan, plane, numPixels);
+                else          ApplyLogPlane<false, false, true>(m_params, chan, plane, numPixels);
+            }
+        }
+        else
+        {
+            if (m_lin2log)
+            {
+                if (hasBreak) ApplyLogPlane<true, true, false>(m_params, chan, plane, numPixels);
+                else          ApplyLogPlane<true, false, false>(m_params, chan, plane, numPixels);
+            }
+            else
+            {
+                if (hasBreak) ApplyLogPlane<false, true, false>(m_params, chan, plane, numPixels);
+                else          ApplyLogPlane<false, false, false>(m_params, chan, plane, numPixels);
+            }
+        }
+    }
 }
 
-void LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+void LogOpCPU::applyPackedRGB(const void * inImg, void * outImg, long numPixels) const
 {
-    static constexpr float minValue = std::numeric_limits<float>::min();
-
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for (long idx = 0; idx<numPixels; ++idx)
+    const bool hasBreak = m_params.m_hasBreak;
+
+    if (m_fastExp)
     {
-        const float alphares = in[3];
+        if (m_lin2log)
+        {
+            if (hasBreak) ApplyLogRGB<true, true, true>(m_params, in, out, numPixels);
+            else          ApplyLogRGB<true, false, true>(m_params, in, out, numPixels);
+        }
+        else
+        {
+            if (hasBreak) ApplyLogRGB<false, true, true>(m_params, in, out, numPixels);
+            else          ApplyLogRGB<false, false, true>(m_params, in, out, numPixels);
+        }
+    }
+    else
+    {
+        if (m_lin2log)
+        {
+            if (hasBreak) ApplyLogRGB<true, true, false>(m_params, in, out, numPixels);
+            else          ApplyLogRGB<true, false, false>(m_params, in, out, numPixels);
+        }
+        else
+        {
+            if (hasBreak) ApplyLogRGB<false, true, false>(m_params, in, out, numPixels);
+            else          ApplyLogRGB<false, false, false>(m_params, in, out, numPixels);
+        }
+    }
+}
 
-        // NB: 'in' and 'out' could be pointers to the same memory buffer.
-        std::memcpy(out, in, 4 * sizeof(float));
+L2LBaseRenderer::L2LBaseRenderer(ConstLogOpDataRcPtr & log)
+    : LogOpCPU(log)
+{
+}
 
-        ApplyMax(out, minValue);
-        ApplyLog2(out);
-        ApplyScale(out, m_logScale);
+void L2LBaseRenderer::updateData(ConstLogOpDataRcPtr & log)
+{
+    LogOpCPU::updateData(log);
 
-        out[3] = alphares;
+    m_base = (float)log->getBase();
+    m_paramsR = log->getRedParams();
+    m_paramsG = log->getGreenParams();
+    m_paramsB = log->getBlueParams();
+}
 
-        in  += 4;
-        out += 4;
+LogRenderer::LogRenderer(ConstLogOpDataRcPtr & log, float logScale)
+    : LogOpCPU(log)
+    , m_logScale(logScale)
+{
+    LogOpCPU::updateData(log);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        m_params.m_logScale[i] = m_logScale;
     }
+    m_lin2log = true;
+}
+
+void LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    ApplyLogRGBA<true, false>(m_params, inImg, outImg, numPixels);
 }
 
 #if OCIO_USE_SSE2
 LogRendererSSE::LogRendererSSE(ConstLogOpDataRcPtr & log, float logScale)
     : LogRenderer(log, logScale)
 {
+    m_fastExp = true;
 }
 void LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
@@ -457,34 +799,24 @@ AntiLogRenderer::AntiLogRenderer(ConstLogOpDataRcPtr & log, float log2base)
     , m_log2_base(log2base)
 {
     LogOpCPU::updateData(log);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        m_params.m_logScale[i] = m_log2_base;
+    }
+    m_lin2log = false;
 }
 
 void AntiLogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        const float alphares = in[3];
-
-        // NB: 'in' and 'out' could be pointers to the same memory buffer.
-        std::memcpy(out, in, 4 * sizeof(float));
-
-        ApplyScale(out, m_log2_base);
-        ApplyExp2(out);
-
-        out[3] = alphares;
-
-        in  += 4;
-        out += 4;
-    }
+    ApplyLogRGBA<false, false>(m_params, inImg, outImg, numPixels);
 }
 
 #if OCIO_USE_SSE2
 AntiLogRendererSSE::AntiLogRendererSSE(ConstLogOpDataRcPtr & log, float log2base)
     : AntiLogRenderer(log, log2base)
 {
+    m_fastExp = true;
 }
 
 void AntiLogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
@@ -543,39 +875,28 @@ void Log2LinRenderer::updateData(ConstLogOpDataRcPtr & log)
     m_minv[0] = 1.0f / (float)m_paramsR[LIN_SIDE_SLOPE];
     m_minv[1] = 1.0f / (float)m_paramsG[LIN_SIDE_SLOPE];
     m_minv[2] = 1.0f / (float)m_paramsB[LIN_SIDE_SLOPE];
+
+    for (int i = 0; i < 3; ++i)
+    {
+        m_params.m_scale[i]     = m_minv[i];
+        m_params.m_offset[i]    = m_minusb[i];
+        m_params.m_logScale[i]  = m_kinv[i];
+        m_params.m_logOffset[i] = m_minuskb[i];
+    }
+    m_lin2log = false;
 }
 
 
 void Log2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        const float alphares = in[3];
-
-        // NB: 'in' and 'out' could be pointers to the same memory buffer.
-        std::memcpy(out, in, 4 * sizeof(float));
-
-        ApplyAdd(out, m_minuskb);
-        ApplyScale(out, m_kinv);
-        ApplyExp2(out);
-        ApplyAdd(out, m_minusb);
-        ApplyScale(out, m_minv);
-
-        out[3] = alphares;
-
-        out += 4;
-        in  += 4;
-    }
+    ApplyLogRGBA<false, false>(m_params, inImg, outImg, numPixels);
 }
 
 #if OCIO_USE_SSE2
 Log2LinRendererSSE::Log2LinRendererSSE(ConstLogOpDataRcPtr & log)
     : Log2LinRenderer(log)
 {
-
+    m_fastExp = true;
 }
 
 void Log2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
@@ -643,40 +964,27 @@ void Lin2LogRenderer::updateData(ConstLogOpDataRcPtr & log)
     m_kb[0] = (float)m_paramsR[LOG_SIDE_OFFSET];
     m_kb[1] = (float)m_paramsG[LOG_SIDE_OFFSET];
     m_kb[2] = (float)m_paramsB[LOG_SIDE_OFFSET];
+
+    for (int i = 0; i < 3; ++i)
+    {
+        m_params.m_scale[i]     = m_m[i];
+        m_params.m_offset[i]    = m_b[i];
+        m_params.m_logScale[i]  = m_klog[i];
+        m_params.m_logOffset[i] = m_kb[i];
+    }
+    m_lin2log = true;
 }
 
 void Lin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    static constexpr float minValue = std::numeric_limits<float>::min();
-
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        const float alphares = in[3];
-
-        // NB: 'in' and 'out' could be pointers to the same memory buffer.
-        std::memcpy(out, in, 4 * sizeof(float));
-
-        ApplyScale(out, m_m);
-        ApplyAdd(out, m_b);
-        ApplyMax(out, minValue);
-        ApplyLog2(out);
-        ApplyScale(out, m_klog);
-        ApplyAdd(out, m_kb);
-
-        out[3] = alphares;
-
-        out += 4;
-        in  += 4;
-    }
+    ApplyLogRGBA<true, false>(m_params, inImg, outImg, numPixels);
 }
 
 #if OCIO_USE_SSE2
 Lin2LogRendererSSE::Lin2LogRendererSSE(ConstLogOpDataRcPtr & log)
     : Lin2LogRenderer(log)
 {
+    m_fastExp = true;
 }
 
 void Lin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
@@ -769,42 +1077,31 @@ void CameraLog2LinRenderer::updateData(ConstLogOpDataRcPtr & log)
     m_minuslino[0] = -m_linearOffset[0];
     m_minuslino[1] = -m_linearOffset[1];
     m_minuslino[2] = -m_linearOffset[2];
+
+    m_params.m_hasBreak = true;
+    for (int i = 0; i < 3; ++i)
+    {
+        m_params.m_scale[i]        = m_minv[i];
+        m_params.m_offset[i]       = m_minusb[i];
+        m_params.m_logScale[i]     = m_kinv[i];
+        m_params.m_logOffset[i]    = m_minuskb[i];
+        m_params.m_break[i]        = m_logSideBreak[i];
+        m_params.m_linearScale[i]  = m_linsinv[i];
+        m_params.m_linearOffset[i] = m_minuslino[i];
+    }
+    m_lin2log = false;
 }
 
 void CameraLog2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    for (long idx = 0; idx < numPixels; ++idx)
-    {
-        const float alphares = in[3];
-
-        for (int i = 0; i < 3; ++i)
-        {
-            if (in[i] < m_logSideBreak[i])
-            {
-                out[i] = m_linsinv[i] * (in[i] + m_minuslino[i]);
-            }
-            else
-            {
-                out[i] = (in[i] + m_minuskb[i]) * m_kinv[i];
-                out[i] = exp2(out[i]);
-                out[i] = (out[i] + m_minusb[i]) * m_minv[i];
-            }
-        }
-
-        out[3] = alphares;
-
-        out += 4;
-        in += 4;
-    }
+    ApplyLogRGBA<false, true>(m_params, inImg, outImg, numPixels);
 }
 
 #if OCIO_USE_SSE2
 CameraLog2LinRendererSSE::CameraLog2LinRendererSSE(ConstLogOpDataRcPtr & log)
     : CameraLog2LinRenderer(log)
 {
+    m_fastExp = true;
 }
 
 void CameraLog2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
@@ -884,45 +1181,31 @@ void CameraLin2LogRenderer::updateData(ConstLogOpDataRcPtr & log)
     m_linb[0] = (float)m_paramsR[LIN_SIDE_BREAK];
     m_linb[1] = (float)m_paramsG[LIN_SIDE_BREAK];
     m_linb[2] = (float)m_paramsB[LIN_SIDE_BREAK];
+
+    m_params.m_hasBreak = true;
+    for (int i = 0; i < 3; ++i)
+    {
+        m_params.m_scale[i]        = m_m[i];
+        m_params.m_offset[i]       = m_b[i];
+        m_params.m_logScale[i]     = m_klog[i];
+        m_params.m_logOffset[i]    = m_kb[i];
+        m_params.m_break[i]        = m_linb[i];
+        m_params.m_linearScale[i]  = m_linearSlope[i];
+        m_params.m_linearOffset[i] = m_linearOffset[i];
+    }
+    m_lin2log = true;
 }
 
 void CameraLin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    static constexpr float minValue = std::numeric_limits<float>::min();
-
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        const float alphares = in[3];
-
-        for (int i = 0; i < 3; ++i)
-        {
-            if (in[i] < m_linb[i])
-            {
-                out[i] = m_linearSlope[i] * in[i] + m_linearOffset[i];
-            }
-            else
-            {
-                out[i] = in[i] * m_m[i] + m_b[i];
-                out[i] = std::max(minValue, out[i]);
-                out[i] = log2(out[i]);
-                out[i] = out[i] * m_klog[i] + m_kb[i];
-            }
-        }
-
-        out[3] = alphares;
-
-        out += 4;
-        in += 4;
-    }
+    ApplyLogRGBA<true, true>(m_params, inImg, outImg, numPixels);
 }
 
 #if OCIO_USE_SSE2
 CameraLin2LogRendererSSE::CameraLin2LogRendererSSE(ConstLogOpDataRcPtr & log)
     : CameraLin2LogRenderer(log)
 {
+    m_fastExp = true;
 }
 
 void CameraLin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
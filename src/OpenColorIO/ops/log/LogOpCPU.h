@@ -13,6 +13,27 @@ namespace OCIO_NAMESPACE
 {
 ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log, bool fastExp);
 
+// Per channel parameters of the vectorized (i.e. AVX2 & AVX-512) renderers which use the fast
+// log2 & exp2 approximations, and of the planar & packed RGB processing. All the log styles are
+// expressed using the generic forms:
+//   Lin2Log: out = log2( max(minValue, in * m_scale + m_offset) ) * m_logScale + m_logOffset
+//   Log2Lin: out = ( exp2( (in + m_logOffset) * m_logScale ) + m_offset ) * m_scale
+// For the camera styles, the values not above the break use the linear segment:
+//   Lin2Log: out = in * m_linearScale + m_linearOffset
+//   Log2Lin: out = (in + m_linearOffset) * m_linearScale
+struct LogRenderParams
+{
+    float m_scale[3]{ 1.0f, 1.0f, 1.0f };
+    float m_offset[3]{ 0.0f, 0.0f, 0.0f };
+    float m_logScale[3]{ 1.0f, 1.0f, 1.0f };
+    float m_logOffset[3]{ 0.0f, 0.0f, 0.0f };
+
+    bool m_hasBreak{ false };
+    float m_break[3]{ 0.0f, 0.0f, 0.0f };
+    float m_linearScale[3]{ 1.0f, 1.0f, 1.0f };
+    float m_linearOffset[3]{ 0.0f, 0.0f, 0.0f };
+};
+
 } // namespace OCIO_NAMESPACE
 
 #endif
\ No newline at end of file
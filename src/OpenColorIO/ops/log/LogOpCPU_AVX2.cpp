@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "LogOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+#include <limits>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+struct LogContextAVX2 {
+    __m256 scale[3];
+    __m256 offset[3];
+    __m256 logScale[3];
+    __m256 logOffset[3];
+
+    __m256 breakPnt[3];
+    __m256 linearScale[3];
+    __m256 linearOffset[3];
+};
+
+static inline void load_context_avx2(const LogRenderParams & params, LogContextAVX2 & ctx)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        ctx.scale[i]        = _mm256_set1_ps(params.m_scale[i]);
+        ctx.offset[i]       = _mm256_set1_ps(params.m_offset[i]);
+        ctx.logScale[i]     = _mm256_set1_ps(params.m_logScale[i]);
+        ctx.logOffset[i]    = _mm256_set1_ps(params.m_logOffset[i]);
+        ctx.breakPnt[i]     = _mm256_set1_ps(params.m_break[i]);
+        ctx.linearScale[i]  = _mm256_set1_ps(params.m_linearScale[i]);
+        ctx.linearOffset[i] = _mm256_set1_ps(params.m_linearOffset[i]);
+    }
+}
+
+template<bool HAS_BREAK>
+static inline __m256 lin2log_avx2(const LogContextAVX2 & ctx, int i, __m256 pix)
+{
+    const __m256 minValue = _mm256_set1_ps(std::numeric_limits<float>::min());
+
+    __m256 res = _mm256_add_ps(_mm256_mul_ps(pix, ctx.scale[i]), ctx.offset[i]);
+    res = avx2Log2(_mm256_max_ps(res, minValue));
+    res = _mm256_add_ps(_mm256_mul_ps(res, ctx.logScale[i]), ctx.logOffset[i]);
+
+    if (HAS_BREAK)
+    {
+        const __m256 lin = _mm256_add_ps(_mm256_mul_ps(pix, ctx.linearScale[i]), ctx.linearOffset[i]);
+        res = _mm256_blendv_ps(lin, res, _mm256_cmp_ps(pix, ctx.breakPnt[i], _CMP_GT_OQ));
+    }
+
+    return res;
+}
+
+template<bool HAS_BREAK>
+static inline __m256 log2lin_avx2(const LogContextAVX2 & ctx, int i, __m256 pix)
+{
+    __m256 res = _mm256_mul_ps(_mm256_add_ps(pix, ctx.logOffset[i]), ctx.logScale[i]);
+    res = avx2Exp2(res);
+    res = _mm256_mul_ps(_mm256_add_ps(res, ctx.offset[i]), ctx.scale[i]);
+
+    if (HAS_BREAK)
+    {
+        const __m256 lin = _mm256_mul_ps(_mm256_add_ps(pix, ctx.linearOffset[i]), ctx.linearScale[i]);
+        res = _mm256_blendv_ps(lin, res, _mm256_cmp_ps(pix, ctx.breakPnt[i], _CMP_GT_OQ));
+    }
+
+    return res;
+}
+
+template<bool LIN2LOG, bool HAS_BREAK>
+static inline void apply_log_avx2(const LogContextAVX2 & ctx, __m256 & r, __m256 & g, __m256 & b)
+{
+    if (LIN2LOG)
+    {
+        r = lin2log_avx2<HAS_BREAK>(ctx, 0, r);
+        g = lin2log_avx2<HAS_BREAK>(ctx, 1, g);
+        b = lin2log_avx2<HAS_BREAK>(ctx, 2, b);
+    }
+    else
+    {
+        r = log2lin_avx2<HAS_BREAK>(ctx, 0, r);
+        g = log2lin_avx2<HAS_BREAK>(ctx, 1, g);
+        b = log2lin_avx2<HAS_BREAK>(ctx, 2, b);
+    }
+}
+
+template<bool LIN2LOG, bool HAS_BREAK>
+static inline void log_avx2(const LogRenderParams & params, const float * src, float * dst, long numPixels)
+{
+    LogContextAVX2 ctx;
+    load_context_avx2(params, ctx);
+
+    __m256 r, g, b, a;
+
+    const long pixel_count = numPixels / 8 * 8;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 8)
+    {
+        AVX2RGBAPack<BIT_DEPTH_F32>::Load(src, r, g, b, a);
+        apply_log_avx2<LIN2LOG, HAS_BREAK>(ctx, r, g, b);
+        AVX2RGBAPack<BIT_DEPTH_F32>::Store(dst, r, g, b, a);
+
+        src += 32;
+        dst += 32;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        float buf[32] = {};
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            buf[i] = src[i];
+        }
+
+        AVX2RGBAPack<BIT_DEPTH_F32>::Load(buf, r, g, b, a);
+        apply_log_avx2<LIN2LOG, HAS_BREAK>(ctx, r, g, b);
+        AVX2RGBAPack<BIT_DEPTH_F32>::Store(buf, r, g, b, a);
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            dst[i] = buf[i];
+        }
+    }
+}
+
+} // anonymous namespace
+
+void applyLin2LogAVX2(const LogRenderParams & params, const float * src, float * dst, long numPixels)
+{
+    if (params.m_hasBreak) log_avx2<true, true >(params, src, dst, numPixels);
+    else                   log_avx2<true, false>(params, src, dst, numPixels);
+}
+
+void applyLog2LinAVX2(const LogRenderParams & params, const float * src, float * dst, long numPixels)
+{
+    if (params.m_hasBreak) log_avx2<false, true >(params, src, dst, numPixels);
+    else                   log_avx2<false, false>(params, src, dst, numPixels);
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_LOGOP_CPU_AVX2_H
+#define INCLUDED_OCIO_LOGOP_CPU_AVX2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "ops/log/LogOpCPU.h"
+
+#if OCIO_USE_AVX2
+namespace OCIO_NAMESPACE
+{
+
+void applyLin2LogAVX2(const LogRenderParams & params, const float * src, float * dst, long numPixels);
+void applyLog2LinAVX2(const LogRenderParams & params, const float * src, float * dst, long numPixels);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
+
+#endif /* INCLUDED_OCIO_LOGOP_CPU_AVX2_H */
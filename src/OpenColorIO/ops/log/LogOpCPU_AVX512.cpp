@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "LogOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+#include <limits>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+struct LogContextAVX512 {
+    __m512 scale[3];
+    __m512 offset[3];
+    __m512 logScale[3];
+    __m512 logOffset[3];
+
+    __m512 breakPnt[3];
+    __m512 linearScale[3];
+    __m512 linearOffset[3];
+};
+
+static inline void load_context_avx512(const LogRenderParams & params, LogContextAVX512 & ctx)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        ctx.scale[i]        = _mm512_set1_ps(params.m_scale[i]);
+        ctx.offset[i]       = _mm512_set1_ps(params.m_offset[i]);
+        ctx.logScale[i]     = _mm512_set1_ps(params.m_logScale[i]);
+        ctx.logOffset[i]    = _mm512_set1_ps(params.m_logOffset[i]);
+        ctx.breakPnt[i]     = _mm512_set1_ps(params.m_break[i]);
+        ctx.linearScale[i]  = _mm512_set1_ps(params.m_linearScale[i]);
+        ctx.linearOffset[i] = _mm512_set1_ps(params.m_linearOffset[i]);
+    }
+}
+
+template<bool HAS_BREAK>
+static inline __m512 lin2log_avx512(const LogContextAVX512 & ctx, int i, __m512 pix)
+{
+    const __m512 minValue = _mm512_set1_ps(std::numeric_limits<float>::min());
+
+    __m512 res = _mm512_add_ps(_mm512_mul_ps(pix, ctx.scale[i]), ctx.offset[i]);
+    res = avx512Log2(_mm512_max_ps(res, minValue));
+    res = _mm512_add_ps(_mm512_mul_ps(res, ctx.logScale[i]), ctx.logOffset[i]);
+
+    if (HAS_BREAK)
+    {
+        const __m512 lin = _mm512_add_ps(_mm512_mul_ps(pix, ctx.linearScale[i]), ctx.linearOffset[i]);
+        res = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(pix, ctx.breakPnt[i], _CMP_GT_OQ), lin, res);
+    }
+
+    return res;
+}
+
+template<bool HAS_BREAK>
+static inline __m512 log2lin_avx512(const LogContextAVX512 & ctx, int i, __m512 pix)
+{
+    __m512 res = _mm512_mul_ps(_mm512_add_ps(pix, ctx.logOffset[i]), ctx.logScale[i]);
+    res = avx512Exp2(res);
+    res = _mm512_mul_ps(_mm512_add_ps(res, ctx.offset[i]), ctx.scale[i]);
+
+    if (HAS_BREAK)
+    {
+        const __m512 lin = _mm512_mul_ps(_mm512_add_ps(pix, ctx.linearOffset[i]), ctx.linearScale[i]);
+        res = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(pix, ctx.breakPnt[i], _CMP_GT_OQ), lin, res);
+    }
+
+    return res;
+}
+
+template<bool LIN2LOG, bool HAS_BREAK>
+static inline void apply_log_avx512(const LogContextAVX512 & ctx, __m512 & r, __m512 & g, __m512 & b)
+{
+    if (LIN2LOG)
+    {
+        r = lin2log_avx512<HAS_BREAK>(ctx, 0, r);
+        g = lin2log_avx512<HAS_BREAK>(ctx, 1, g);
+        b = lin2log_avx512<HAS_BREAK>(ctx, 2, b);
+    }
+    else
+    {
+        r = log2lin_avx512<HAS_BREAK>(ctx, 0, r);
+        g = log2lin_avx512<HAS_BREAK>(ctx, 1, g);
+        b = log2lin_avx512<HAS_BREAK>(ctx, 2, b);
+    }
+}
+
+template<bool LIN2LOG, bool HAS_BREAK>
+static inline void log_avx512(const LogRenderParams & params, const float * src, float * dst, long numPixels)
+{
+    LogContextAVX512 ctx;
+    load_context_avx512(params, ctx);
+
+    __m512 r, g, b, a;
+
+    const long pixel_count = numPixels / 16 * 16;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 16)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::Load(src, r, g, b, a);
+        apply_log_avx512<LIN2LOG, HAS_BREAK>(ctx, r, g, b);
+        AVX512RGBAPack<BIT_DEPTH_F32>::Store(dst, r, g, b, a);
+
+        src += 64;
+        dst += 64;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::LoadMasked(src, r, g, b, a, (uint32_t)remainder);
+        apply_log_avx512<LIN2LOG, HAS_BREAK>(ctx, r, g, b);
+        AVX512RGBAPack<BIT_DEPTH_F32>::StoreMasked(dst, r, g, b, a, (uint32_t)remainder);
+    }
+}
+
+} // anonymous namespace
+
+void applyLin2LogAVX512(const LogRenderParams & params, const float * src, float * dst, long numPixels)
+{
+    if (params.m_hasBreak) log_avx512<true, true >(params, src, dst, numPixels);
+    else                   log_avx512<true, false>(params, src, dst, numPixels);
+}
+
+void applyLog2LinAVX512(const LogRenderParams & params, const float * src, float * dst, long numPixels)
+{
+    if (params.m_hasBreak) log_avx512<false, true >(params, src, dst, numPixels);
+    else                   log_avx512<false, false>(params, src, dst, numPixels);
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
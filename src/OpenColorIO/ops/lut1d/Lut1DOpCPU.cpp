@@ -29,6 +29,21 @@
 namespace OCIO_NAMESPACE
 {
 
+void ComponentParams::setComponentParams(ComponentParams & params,
+                                         const Lut1DOpData::ComponentProperties & properties,
+                                         const float * lutPtr,
+                                         float lutZeroEntry)
+{
+    params.flipSign = properties.isIncreasing ? 1.f: -1.f;
+    params.bisectPoint = lutZeroEntry;
+    params.startOffset = (float) properties.startDomain;
+    params.lutStart = lutPtr + properties.startDomain;
+    params.lutEnd   = lutPtr + properties.endDomain;
+    params.negStartOffset = (float) properties.negStartDomain;
+    params.negLutStart = lutPtr + properties.negStartDomain;
+    params.negLutEnd   = lutPtr + properties.negEndDomain;
+}
+
 namespace
 {
 
@@ -150,6 +165,14 @@ public:
         : BaseLut1DRenderer<inBD, outBD>(lut, outBitDepth) {}
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    // Only the float to float interpolation is available on the planar & packed RGB images.
+    bool hasPlanarApply() const override;
+    void applyPlanar(float * rPlane, float * gPlane, float * bPlane, float * aPlane,
+                     long numPixels) const override;
+
+    bool hasPackedRGBApply() const override;
+    void applyPackedRGB(const void * inImg, void * outImg, long numPixels) const override;
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -162,6 +185,11 @@ public:
         :  Lut1DRenderer<inBD, outBD>(lut, BIT_DEPTH_F32) {} // HueAdjust needs float processing.
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    // The hue adjustment needs the three channels of each pixel, and is only implemented on
+    // the RGBA pixels.
+    bool hasPlanarApply() const override { return false; }
+    bool hasPackedRGBApply() const override { return false; }
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -176,36 +204,6 @@ public:
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 };
 
-// Holds the parameters of a color component.
-// Note: The structure does not own any of the pointers.
-struct ComponentParams
-{
-    ComponentParams()
-        :   lutStart(nullptr)
-        ,   startOffset(0.f)
-        ,   lutEnd(nullptr)
-        ,   negLutStart(nullptr)
-        ,   negStartOffset(0.f)
-        ,   negLutEnd(nullptr)
-        ,   flipSign(1.f)
-        ,   bisectPoint(0.f)
-    {}
-
-    const float * lutStart;   // Copy of the pointer to start of effective lutData.
-    float startOffset;        // Difference between real and effective start of lut.
-    const float * lutEnd;     // Copy of the pointer to end of effective lutData.
-    const float * negLutStart;// lutStart for negative part of half domain LUT.
-    float negStartOffset;     // startOffset for negative part of half domain LUT.
-    const float * negLutEnd;  // lutEnd for negative part of half domain LUT.
-    float flipSign;           // Flip the sign of value to handle decreasing luts.
-    float bisectPoint;        // Point of switching from pos to neg of half domain.
-
-    static void setComponentParams(ComponentParams & params,
-                                   const Lut1DOpData::ComponentProperties & properties,
-                                   const float * lutPtr,
-                                   float lutZeroEntry);
-};
-
 template<BitDepth inBD, BitDepth outBD>
 class InvLut1DRenderer : public OpCPU
 {
@@ -223,6 +221,9 @@ public:
     virtual void updateData(ConstLut1DOpDataRcPtr & lut);
 
 protected:
+    // Select the vectorized inverse evaluation (if any) supported by the CPU.
+    void initApplyFunc(bool halfDomain);
+
     float m_scale; // Output scaling for the r, g and b components.
 
     ComponentParams m_paramsR;
@@ -234,6 +235,8 @@ protected:
     std::vector<float> m_tmpLutG;
     std::vector<float> m_tmpLutB;
     float              m_alphaScaling;  // Bit-depth scale factor for alpha channel.
+
+    InvLut1DOpCPUApplyFunc * m_applyInvLutFunc = nullptr;
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -720,6 +723,139 @@ void Lut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, long n
     }
 }
 
+// Interpolate the float values of one channel using the same scalar computations as
+// Lut1DRenderer::apply(), consecutive values being stride floats apart.
+void ApplyLut1DChannel(const float * lut, float step, float dimMinusOne,
+                       const float * in, float * out, long numPixels, long stride)
+{
+    for (long i = 0; i < numPixels * stride; i += stride)
+    {
+        // NaNs become 0
+        const float idx = std::min(std::max(0.f, step * in[i]), dimMinusOne);
+
+        const unsigned int lowIdx  = static_cast<unsigned int>(std::floor(idx));
+        const unsigned int highIdx = static_cast<unsigned int>(std::ceil(idx));
+
+        const float delta = (float)highIdx - idx;
+
+        out[i] = lerpf(lut[highIdx], lut[lowIdx], delta);
+    }
+}
+
+// Interpolate the float values of the RGB channels using the same vectorized implementation as
+// Lut1DRenderer::apply() i.e. the pixels are copied to a small RGBA buffer. The channel chan of
+// the pixel idx is at in[chan][idx * stride] (and out[chan][idx * stride]).
+void ApplyLut1DVectorized(Lut1DOpCPUApplyFunc * applyLutFunc,
+                          const float * lutR, const float * lutG, const float * lutB, int dim,
+                          const float * const in[3], float * const out[3],
+                          long numPixels, long stride)
+{
+    static constexpr long blockSize = 64;
+    float rgba[4 * blockSize];
+
+    for (long start = 0; start < numPixels; start += blockSize)
+    {
+        const long count = std::min(blockSize, numPixels - start);
+
+        for (long idx = 0; idx < count; ++idx)
+        {
+            const long pos = (start + idx) * stride;
+            rgba[4 * idx + 0] = in[0][pos];
+            rgba[4 * idx + 1] = in[1][pos];
+            rgba[4 * idx + 2] = in[2][pos];
+            rgba[4 * idx + 3] = 0.0f;
+        }
+
+        applyLutFunc(lutR, lutG, lutB, dim, rgba, rgba, count);
+
+        for (long idx = 0; idx < count; ++idx)
+        {
+            const long pos = (start + idx) * stride;
+            out[0][pos] = rgba[4 * idx + 0];
+            out[1][pos] = rgba[4 * idx + 1];
+            out[2][pos] = rgba[4 * idx + 2];
+        }
+    }
+}
+
+template<BitDepth inBD, BitDepth outBD>
+bool Lut1DRenderer<inBD, outBD>::hasPlanarApply() const
+{
+    return inBD == BIT_DEPTH_F32 && outBD == BIT_DEPTH_F32;
+}
+
+template<BitDepth inBD, BitDepth outBD>
+void Lut1DRenderer<inBD, outBD>::applyPlanar(float * rPlane, float * gPlane, float * bPlane,
+                                             float * aPlane, long numPixels) const
+{
+    if (!hasPlanarApply())
+    {
+        throw Exception("1D LUT planar processing is only available for 32-bit float images.");
+    }
+
+    const float * lutR = (const float *)this->m_tmpLutR;
+    const float * lutG = (const float *)this->m_tmpLutG;
+    const float * lutB = (const float *)this->m_tmpLutB;
+
+    // Use the same implementation as apply() so that the results are identical.
+    if (this->m_applyLutFunc && numPixels > 1)
+    {
+        const float * const in[3] = { rPlane, gPlane, bPlane };
+        float * const out[3] = { rPlane, gPlane, bPlane };
+        ApplyLut1DVectorized(this->m_applyLutFunc, lutR, lutG, lutB, this->m_dim,
+                             in, out, numPixels, 1);
+    }
+    else
+    {
+        ApplyLut1DChannel(lutR, this->m_step, this->m_dimMinusOne, rPlane, rPlane, numPixels, 1);
+        ApplyLut1DChannel(lutG, this->m_step, this->m_dimMinusOne, gPlane, gPlane, numPixels, 1);
+        ApplyLut1DChannel(lutB, this->m_step, this->m_dimMinusOne, bPlane, bPlane, numPixels, 1);
+    }
+
+    for (long i = 0; i < numPixels; ++i)
+    {
+        aPlane[i] = aPlane[i] * this->m_alphaScaling;
+    }
+}
+
+template<BitDepth inBD, BitDepth outBD>
+bool Lut1DRenderer<inBD, outBD>::hasPackedRGBApply() const
+{
+    return inBD == BIT_DEPTH_F32 && outBD == BIT_DEPTH_F32;
+}
+
+template<BitDepth inBD, BitDepth outBD>
+void Lut1DRenderer<inBD, outBD>::applyPackedRGB(const void * inImg, void * outImg,
+                                                long numPixels) const
+{
+    if (!hasPackedRGBApply())
+    {
+        throw Exception("1D LUT packed RGB processing is only available for 32-bit float images.");
+    }
+
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    const float * lutR = (const float *)this->m_tmpLutR;
+    const float * lutG = (const float *)this->m_tmpLutG;
+    const float * lutB = (const float *)this->m_tmpLutB;
+
+    // Use the same implementation as apply() so that the results are identical.
+    if (this->m_applyLutFunc && numPixels > 1)
+    {
+        const float * const inRGB[3] = { in, in + 1, in + 2 };
+        float * const outRGB[3] = { out, out + 1, out + 2 };
+        ApplyLut1DVectorized(this->m_applyLutFunc, lutR, lutG, lutB, this->m_dim,
+                             inRGB, outRGB, numPixels, 3);
+    }
+    else
+    {
+        ApplyLut1DChannel(lutR, this->m_step, this->m_dimMinusOne, in, out, numPixels, 3);
+        ApplyLut1DChannel(lutG, this->m_step, this->m_dimMinusOne, in + 1, out + 1, numPixels, 3);
+        ApplyLut1DChannel(lutB, this->m_step, this->m_dimMinusOne, in + 2, out + 2, numPixels, 3);
+    }
+}
+
 namespace GamutMapUtils
 {
 // Compute the indices for the smallest, middle, and largest elements of
@@ -1136,6 +1272,7 @@ InvLut1DRenderer<inBD, outBD>::InvLut1DRenderer(ConstLut1DOpDataRcPtr & lut)
     ,   m_alphaScaling(0.0f)
 {
     updateData(lut);
+    initApplyFunc(false);
 }
 
 template<BitDepth inBD, BitDepth outBD>
@@ -1144,19 +1281,33 @@ InvLut1DRenderer<inBD, outBD>::~InvLut1DRenderer()
     resetData();
 }
 
-void ComponentParams::setComponentParams(ComponentParams & params,
-                                         const Lut1DOpData::ComponentProperties & properties,
-                                         const float * lutPtr,
-                                         float lutZeroEntry)
+template<BitDepth inBD, BitDepth outBD>
+void InvLut1DRenderer<inBD, outBD>::initApplyFunc(bool halfDomain)
 {
-    params.flipSign = properties.isIncreasing ? 1.f: -1.f;
-    params.bisectPoint = lutZeroEntry;
-    params.startOffset = (float) properties.startDomain;
-    params.lutStart = lutPtr + properties.startDomain;
-    params.lutEnd   = lutPtr + properties.endDomain;
-    params.negStartOffset = (float) properties.negStartDomain;
-    params.negLutStart = lutPtr + properties.negStartDomain;
-    params.negLutEnd   = lutPtr + properties.negEndDomain;
+    m_applyInvLutFunc = nullptr;
+
+#if OCIO_USE_SSE2
+    if (CPUInfo::instance().hasSSE2())
+    {
+        m_applyInvLutFunc = SSE2GetInvLut1DApplyFunc(inBD, outBD, halfDomain);
+    }
+#endif
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2() && !CPUInfo::instance().AVX2SlowGather())
+    {
+        m_applyInvLutFunc = AVX2GetInvLut1DApplyFunc(inBD, outBD, halfDomain);
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_applyInvLutFunc = AVX512GetInvLut1DApplyFunc(inBD, outBD, halfDomain);
+    }
+#endif
+
+    (void)halfDomain;
 }
 
 template<BitDepth inBD, BitDepth outBD>
@@ -1240,6 +1391,12 @@ void InvLut1DRenderer<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & lut)
 template<BitDepth inBD, BitDepth outBD>
 void InvLut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyInvLutFunc)
+    {
+        m_applyInvLutFunc(m_paramsR, m_paramsG, m_paramsB, m_scale, inImg, outImg, numPixels);
+        return;
+    }
+
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
 
@@ -1288,6 +1445,8 @@ InvLut1DRendererHueAdjust<inBD, outBD>::InvLut1DRendererHueAdjust(ConstLut1DOpDa
     :  InvLut1DRenderer<inBD, outBD>(lut)
 {
     this->updateData(lut);
+    // The hue adjust is not vectorized.
+    this->m_applyInvLutFunc = nullptr;
 }
 
 template<BitDepth inBD, BitDepth outBD>
@@ -1354,6 +1513,7 @@ InvLut1DRendererHalfCode<inBD, outBD>::InvLut1DRendererHalfCode(ConstLut1DOpData
     :  InvLut1DRenderer<inBD, outBD>(lut)
 {
     this->updateData(lut);
+    this->initApplyFunc(true);
 }
 
 template<BitDepth inBD, BitDepth outBD>
@@ -1451,6 +1611,13 @@ void InvLut1DRendererHalfCode<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & l
 template<BitDepth inBD, BitDepth outBD>
 void InvLut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (this->m_applyInvLutFunc)
+    {
+        this->m_applyInvLutFunc(this->m_paramsR, this->m_paramsG, this->m_paramsB,
+                                this->m_scale, inImg, outImg, numPixels);
+        return;
+    }
+
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
 
@@ -1516,7 +1683,7 @@ void InvLut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * out
                 : FindLutInvHalf(this->m_paramsB.negLutStart,
                                  this->m_paramsB.negStartOffset,
                                  this->m_paramsB.negLutEnd,
-                                 -this->m_paramsR.flipSign,
+                                 -this->m_paramsB.flipSign,
                                  this->m_scale,
                                  bluIn);
 
@@ -1535,6 +1702,8 @@ InvLut1DRendererHalfCodeHueAdjust<inBD, outBD>::InvLut1DRendererHalfCodeHueAdjus
     :  InvLut1DRendererHalfCode<inBD, outBD>(lut)
 {
     this->updateData(lut);
+    // The hue adjust is not vectorized.
+    this->m_applyInvLutFunc = nullptr;
 }
 
 template<BitDepth inBD, BitDepth outBD>
@@ -1603,7 +1772,7 @@ void InvLut1DRendererHalfCodeHueAdjust<inBD, outBD>::apply(const void * inImg, v
                 : FindLutInvHalf(this->m_paramsB.negLutStart,
                                  this->m_paramsB.negStartOffset,
                                  this->m_paramsB.negLutEnd,
-                                 -this->m_paramsR.flipSign,
+                                 -this->m_paramsB.flipSign,
                                  this->m_scale,
                                  RGB[2]);
 
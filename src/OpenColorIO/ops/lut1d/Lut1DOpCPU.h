@@ -11,6 +11,47 @@
 namespace OCIO_NAMESPACE
 {
 
+// Holds the parameters of a color component of an inverse 1D LUT.
+// Note: The structure does not own any of the pointers.
+struct ComponentParams
+{
+    ComponentParams()
+        :   lutStart(nullptr)
+        ,   startOffset(0.f)
+        ,   lutEnd(nullptr)
+        ,   negLutStart(nullptr)
+        ,   negStartOffset(0.f)
+        ,   negLutEnd(nullptr)
+        ,   flipSign(1.f)
+        ,   bisectPoint(0.f)
+    {}
+
+    const float * lutStart;   // Copy of the pointer to start of effective lutData.
+    float startOffset;        // Difference between real and effective start of lut.
+    const float * lutEnd;     // Copy of the pointer to end of effective lutData.
+    const float * negLutStart;// lutStart for negative part of half domain LUT.
+    float negStartOffset;     // startOffset for negative part of half domain LUT.
+    const float * negLutEnd;  // lutEnd for negative part of half domain LUT.
+    float flipSign;           // Flip the sign of value to handle decreasing luts.
+    float bisectPoint;        // Point of switching from pos to neg of half domain.
+
+    static void setComponentParams(ComponentParams & params,
+                                   const Lut1DOpData::ComponentProperties & properties,
+                                   const float * lutPtr,
+                                   float lutZeroEntry);
+};
+
+// Vectorized inverse evaluation of the red, green & blue components, refer to the
+// *GetInvLut1DApplyFunc() functions. The scale converts from LUT index units to the output
+// bit-depth.
+typedef void (InvLut1DOpCPUApplyFunc)(const ComponentParams & paramsR,
+                                      const ComponentParams & paramsG,
+                                      const ComponentParams & paramsB,
+                                      float scale,
+                                      const void * inImg,
+                                      void * outImg,
+                                      long numPixels);
+
 ConstOpCPURcPtr GetLut1DRenderer(ConstLut1DOpDataRcPtr & lut, BitDepth in, BitDepth out);
 
 } // namespace OCIO_NAMESPACE
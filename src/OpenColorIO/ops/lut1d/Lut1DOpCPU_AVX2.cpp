@@ -4,6 +4,7 @@
 #include "Lut1DOpCPU_AVX2.h"
 #if OCIO_USE_AVX2
 
+#include <algorithm>
 #include <immintrin.h>
 #include <string.h>
 
@@ -146,6 +147,276 @@ inline Lut1DOpCPUApplyFunc * GetConvertInBitDepth(BitDepth outBD)
     return nullptr;
 }
 
+// Inverse evaluation, refer to FindLutInv() & FindLutInvHalf() in Lut1DOpCPU.cpp.
+
+// The parameters of a LUT component broadcast to all the lanes.
+struct InvLutComponentAVX2
+{
+    const float * lut;      // The effective start of the (positive half of the) LUT.
+    int searchLength;       // Number of entries to search i.e. the longest effective domain.
+    bool isIncreasing;
+    __m256 bisectPoint;
+
+    __m256 flipSign;
+    __m256 indexOffset;     // Effective start of the domain relative to lut.
+    __m256 startOffset;
+    __m256 length;          // Index of the effective end of the domain.
+    __m256 startValue;
+    __m256 endValue;
+
+    // The negative half of a half domain LUT.
+    __m256 negFlipSign;
+    __m256 negIndexOffset;
+    __m256 negStartOffset;
+    __m256 negLength;
+    __m256 negStartValue;
+    __m256 negEndValue;
+};
+
+template<bool HALF_DOMAIN>
+static inline void init_inv_lut_avx2(const ComponentParams & params, InvLutComponentAVX2 & comp)
+{
+    const int length    = (int)(params.lutEnd - params.lutStart);
+    const int negLength = (int)(params.negLutEnd - params.negLutStart);
+
+    comp.lut          = params.lutStart;
+    comp.searchLength = length;
+    comp.isIncreasing = params.flipSign > 0.f;
+    comp.bisectPoint  = _mm256_set1_ps(params.bisectPoint);
+
+    comp.flipSign    = _mm256_set1_ps(params.flipSign);
+    comp.indexOffset = _mm256_setzero_ps();
+    comp.startOffset = _mm256_set1_ps(params.startOffset);
+    comp.length      = _mm256_set1_ps((float)length);
+    comp.startValue  = _mm256_set1_ps(*params.lutStart);
+    comp.endValue    = _mm256_set1_ps(*params.lutEnd);
+
+    if (HALF_DOMAIN)
+    {
+        comp.searchLength = std::max(length, negLength);
+
+        comp.negFlipSign    = _mm256_set1_ps(-params.flipSign);
+        comp.negIndexOffset = _mm256_set1_ps((float)(params.negLutStart - params.lutStart));
+        comp.negStartOffset = _mm256_set1_ps(params.negStartOffset);
+        comp.negLength      = _mm256_set1_ps((float)negLength);
+        comp.negStartValue  = _mm256_set1_ps(*params.negLutStart);
+        comp.negEndValue    = _mm256_set1_ps(*params.negLutEnd);
+    }
+}
+
+static inline __m256 gather_avx2(const float * lut, __m256 idx)
+{
+    return _mm256_i32gather_ps(lut, _mm256_cvttps_epi32(idx), sizeof(float));
+}
+
+// Convert the half float bit patterns held in the 32-bit lanes to float, including the zeros,
+// the denormals & the infinities.
+static inline __m256 half_bits_to_float_avx2(__m256i h)
+{
+    const __m256i expMask = _mm256_set1_epi32(0x7c00 << 13);
+
+    __m256i o = _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x7fff)), 13);
+    const __m256i exp = _mm256_and_si256(o, expMask);
+    o = _mm256_add_epi32(o, _mm256_set1_epi32((127 - 15) << 23));
+
+    // Infinities & NaNs.
+    const __m256i isInfNan = _mm256_cmpeq_epi32(exp, expMask);
+    o = _mm256_add_epi32(o, _mm256_and_si256(isInfNan, _mm256_set1_epi32((128 - 16) << 23)));
+
+    // Zeros & denormals.
+    const __m256i isDenorm = _mm256_cmpeq_epi32(exp, _mm256_setzero_si256());
+    const __m256 magic = _mm256_castsi256_ps(_mm256_set1_epi32(113 << 23));
+    const __m256 renorm = _mm256_sub_ps(
+        _mm256_castsi256_ps(_mm256_add_epi32(o, _mm256_set1_epi32(1 << 23))), magic);
+    o = _mm256_blendv_epi8(o, _mm256_castps_si256(renorm), isDenorm);
+
+    // Sign.
+    o = _mm256_or_si256(o, _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x8000)), 16));
+
+    return _mm256_castsi256_ps(o);
+}
+
+template<bool HALF_DOMAIN>
+static inline __m256 apply_inv_lut_avx2(const InvLutComponentAVX2 & comp, const __m256 & scale,
+                                        __m256 val)
+{
+    const __m256 zero  = _mm256_setzero_ps();
+    const __m256 one_f = _mm256_set1_ps(1.f);
+
+    __m256 flipSign    = comp.flipSign;
+    __m256 indexOffset = comp.indexOffset;
+    __m256 startOffset = comp.startOffset;
+    __m256 length      = comp.length;
+    __m256 startValue  = comp.startValue;
+    __m256 endValue    = comp.endValue;
+
+    if (HALF_DOMAIN)
+    {
+        // Test the values against the bisect point to determine which half of the float
+        // domain to do the inverse eval in.
+        const __m256 isPos = comp.isIncreasing ? _mm256_cmp_ps(val, comp.bisectPoint, _CMP_GE_OQ)
+                                               : _mm256_cmp_ps(val, comp.bisectPoint, _CMP_NGE_UQ);
+
+        flipSign    = _mm256_blendv_ps(comp.negFlipSign,    flipSign,    isPos);
+        indexOffset = _mm256_blendv_ps(comp.negIndexOffset, indexOffset, isPos);
+        startOffset = _mm256_blendv_ps(comp.negStartOffset, startOffset, isPos);
+        length      = _mm256_blendv_ps(comp.negLength,      length,      isPos);
+        startValue  = _mm256_blendv_ps(comp.negStartValue,  startValue,  isPos);
+        endValue    = _mm256_blendv_ps(comp.negEndValue,    endValue,    isPos);
+    }
+
+    // Clamp the value to the range of the LUT (NaNs are preserved).
+    const __m256 cv
+        = _mm256_min_ps(endValue, _mm256_max_ps(startValue, _mm256_mul_ps(val, flipSign)));
+
+    // Branchless std::lower_bound(). As cv is never greater than the end value, probing
+    // past the end of a shorter domain is equivalent to probing its end entry.
+    __m256 base = zero;
+    for (int n = comp.searchLength; n > 1; n -= n / 2)
+    {
+        const __m256 probe
+            = _mm256_min_ps(_mm256_add_ps(base, _mm256_set1_ps((float)(n / 2))), length);
+        const __m256 entry = gather_avx2(comp.lut, _mm256_add_ps(indexOffset, probe));
+        base = _mm256_blendv_ps(base, probe, _mm256_cmp_ps(entry, cv, _CMP_LT_OQ));
+    }
+    const __m256 entry
+        = gather_avx2(comp.lut, _mm256_add_ps(indexOffset, _mm256_min_ps(base, length)));
+    const __m256 lowbound
+        = _mm256_add_ps(base, _mm256_and_ps(_mm256_cmp_ps(entry, cv, _CMP_LT_OQ), one_f));
+
+    // The lower bound is the first entry >= cv so decrement it unless cv is the first entry.
+    const __m256 lowIdx  = _mm256_max_ps(_mm256_sub_ps(lowbound, one_f), zero);
+    const __m256 highIdx = _mm256_min_ps(_mm256_add_ps(lowIdx, one_f), length);
+
+    const __m256 low  = gather_avx2(comp.lut, _mm256_add_ps(indexOffset, lowIdx));
+    const __m256 high = gather_avx2(comp.lut, _mm256_add_ps(indexOffset, highIdx));
+
+    // Delta is the fractional distance of cv between the adjacent LUT entries (zero on the
+    // flat spots).
+    const __m256 delta = _mm256_and_ps(_mm256_cmp_ps(high, low, _CMP_GT_OQ),
+                                       _mm256_div_ps(_mm256_sub_ps(cv, low), _mm256_sub_ps(high, low)));
+
+    const __m256 totalInds = _mm256_add_ps(lowIdx, startOffset);
+
+    if (!HALF_DOMAIN)
+    {
+        return _mm256_mul_ps(_mm256_add_ps(totalInds, delta), scale);
+    }
+
+    // The half domain LUT entries are not a constant distance apart so convert the indices
+    // (which are half floats) into floats.
+    const __m256 base0 = half_bits_to_float_avx2(_mm256_cvttps_epi32(totalInds));
+    const __m256 base1 = half_bits_to_float_avx2(_mm256_cvttps_epi32(_mm256_add_ps(totalInds, one_f)));
+
+    return _mm256_mul_ps(_mm256_add_ps(base0, _mm256_mul_ps(delta, _mm256_sub_ps(base1, base0))), scale);
+}
+
+template <BitDepth inBD, BitDepth outBD, bool HALF_DOMAIN>
+static inline void invLinear1D(const ComponentParams & paramsR,
+                               const ComponentParams & paramsG,
+                               const ComponentParams & paramsB,
+                               float scale,
+                               const void * inImg,
+                               void * outImg,
+                               long numPixels)
+{
+    typedef typename BitDepthInfo<inBD>::Type InType;
+    typedef typename BitDepthInfo<outBD>::Type OutType;
+
+    const InType *src = (const InType*)inImg;
+    OutType *dst = (OutType*)outImg;
+    __m256 r, g, b, a, alpha_scale;
+
+    InvLutComponentAVX2 red, grn, blu;
+    init_inv_lut_avx2<HALF_DOMAIN>(paramsR, red);
+    init_inv_lut_avx2<HALF_DOMAIN>(paramsG, grn);
+    init_inv_lut_avx2<HALF_DOMAIN>(paramsB, blu);
+
+    const __m256 lut_scale = _mm256_set1_ps(scale);
+
+    if (inBD != outBD)
+        alpha_scale = _mm256_set1_ps((float)BitDepthInfo<outBD>::maxValue / (float)BitDepthInfo<inBD>::maxValue);
+
+    const long pixel_count = numPixels / 8 * 8;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 8)
+    {
+        AVX2RGBAPack<inBD>::Load(src, r, g, b, a);
+
+        r = apply_inv_lut_avx2<HALF_DOMAIN>(red, lut_scale, r);
+        g = apply_inv_lut_avx2<HALF_DOMAIN>(grn, lut_scale, g);
+        b = apply_inv_lut_avx2<HALF_DOMAIN>(blu, lut_scale, b);
+
+        if (inBD != outBD)
+            a = _mm256_mul_ps(a, alpha_scale);
+
+        AVX2RGBAPack<outBD>::Store(dst, r, g, b, a);
+
+        src += 32;
+        dst += 32;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        InType in_buf[32] = {};
+        OutType out_buf[32];
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            in_buf[i] = src[i];
+        }
+
+        AVX2RGBAPack<inBD>::Load(in_buf, r, g, b, a);
+
+        r = apply_inv_lut_avx2<HALF_DOMAIN>(red, lut_scale, r);
+        g = apply_inv_lut_avx2<HALF_DOMAIN>(grn, lut_scale, g);
+        b = apply_inv_lut_avx2<HALF_DOMAIN>(blu, lut_scale, b);
+
+        if (inBD != outBD)
+            a = _mm256_mul_ps(a, alpha_scale);
+
+        AVX2RGBAPack<outBD>::Store(out_buf, r, g, b, a);
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            dst[i] = out_buf[i];
+        }
+    }
+}
+
+template<BitDepth inBD, bool HALF_DOMAIN>
+inline InvLut1DOpCPUApplyFunc * GetInvConvertInBitDepth(BitDepth outBD)
+{
+    switch(outBD)
+    {
+        case BIT_DEPTH_UINT8:
+            return invLinear1D<inBD, BIT_DEPTH_UINT8, HALF_DOMAIN>;
+        case BIT_DEPTH_UINT10:
+            return invLinear1D<inBD, BIT_DEPTH_UINT10, HALF_DOMAIN>;
+        case BIT_DEPTH_UINT12:
+            return invLinear1D<inBD, BIT_DEPTH_UINT12, HALF_DOMAIN>;
+        case BIT_DEPTH_UINT16:
+            return invLinear1D<inBD, BIT_DEPTH_UINT16, HALF_DOMAIN>;
+        case BIT_DEPTH_F16:
+#if OCIO_USE_F16C
+            if (CPUInfo::instance().hasF16C())
+                return invLinear1D<inBD, BIT_DEPTH_F16, HALF_DOMAIN>;
+#endif
+            break;
+        case BIT_DEPTH_F32:
+            return invLinear1D<inBD, BIT_DEPTH_F32, HALF_DOMAIN>;
+        case BIT_DEPTH_UINT14:
+        case BIT_DEPTH_UINT32:
+        case BIT_DEPTH_UNKNOWN:
+        default:
+            break;
+    }
+
+    return nullptr;
+}
+
 } // anonymous namespace
 
 Lut1DOpCPUApplyFunc * AVX2GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD)
@@ -172,6 +443,30 @@ Lut1DOpCPUApplyFunc * AVX2GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD)
     return nullptr;
 }
 
+InvLut1DOpCPUApplyFunc * AVX2GetInvLut1DApplyFunc(BitDepth inBD, BitDepth outBD, bool halfDomain)
+{
+    // Only the float input is vectorized, like the forward LUT.
+    switch(inBD)
+    {
+        case BIT_DEPTH_UINT8:
+        case BIT_DEPTH_UINT10:
+        case BIT_DEPTH_UINT12:
+        case BIT_DEPTH_UINT16:
+        case BIT_DEPTH_F16:
+            break;
+        case BIT_DEPTH_F32:
+            return halfDomain ? GetInvConvertInBitDepth<BIT_DEPTH_F32, true>(outBD)
+                              : GetInvConvertInBitDepth<BIT_DEPTH_F32, false>(outBD);
+        case BIT_DEPTH_UINT14:
+        case BIT_DEPTH_UINT32:
+        case BIT_DEPTH_UNKNOWN:
+        default:
+            break;
+    }
+
+    return nullptr;
+}
+
 } // OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX2
\ No newline at end of file
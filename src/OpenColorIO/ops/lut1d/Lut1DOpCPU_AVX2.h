@@ -7,6 +7,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "CPUInfo.h"
+#include "ops/lut1d/Lut1DOpCPU.h"
 
 typedef void (Lut1DOpCPUApplyFunc)(const float *, const float *, const float *, int, const void *, void *, long);
 
@@ -16,6 +17,10 @@ namespace OCIO_NAMESPACE
 
 Lut1DOpCPUApplyFunc * AVX2GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD);
 
+// Return the inverse evaluation of a regular or half domain 1D LUT, or null if the bit-depths
+// are not supported.
+InvLut1DOpCPUApplyFunc * AVX2GetInvLut1DApplyFunc(BitDepth inBD, BitDepth outBD, bool halfDomain);
+
 } // namespace OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX2
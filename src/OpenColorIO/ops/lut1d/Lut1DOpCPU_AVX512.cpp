@@ -4,6 +4,7 @@
 #include "Lut1DOpCPU_AVX512.h"
 #if OCIO_USE_AVX512
 
+#include <algorithm>
 #include <immintrin.h>
 #include <string.h>
 
@@ -119,6 +120,260 @@ inline Lut1DOpCPUApplyFunc * GetConvertInBitDepth(BitDepth outBD)
     return nullptr;
 }
 
+// Inverse evaluation, refer to FindLutInv() & FindLutInvHalf() in Lut1DOpCPU.cpp.
+
+// The parameters of a LUT component broadcast to all the lanes.
+struct InvLutComponentAVX512
+{
+    const float * lut;      // The effective start of the (positive half of the) LUT.
+    int searchLength;       // Number of entries to search i.e. the longest effective domain.
+    bool isIncreasing;
+    __m512 bisectPoint;
+
+    __m512 flipSign;
+    __m512 indexOffset;     // Effective start of the domain relative to lut.
+    __m512 startOffset;
+    __m512 length;          // Index of the effective end of the domain.
+    __m512 startValue;
+    __m512 endValue;
+
+    // The negative half of a half domain LUT.
+    __m512 negFlipSign;
+    __m512 negIndexOffset;
+    __m512 negStartOffset;
+    __m512 negLength;
+    __m512 negStartValue;
+    __m512 negEndValue;
+};
+
+template<bool HALF_DOMAIN>
+static inline void init_inv_lut_avx512(const ComponentParams & params, InvLutComponentAVX512 & comp)
+{
+    const int length    = (int)(params.lutEnd - params.lutStart);
+    const int negLength = (int)(params.negLutEnd - params.negLutStart);
+
+    comp.lut          = params.lutStart;
+    comp.searchLength = length;
+    comp.isIncreasing = params.flipSign > 0.f;
+    comp.bisectPoint  = _mm512_set1_ps(params.bisectPoint);
+
+    comp.flipSign    = _mm512_set1_ps(params.flipSign);
+    comp.indexOffset = _mm512_setzero_ps();
+    comp.startOffset = _mm512_set1_ps(params.startOffset);
+    comp.length      = _mm512_set1_ps((float)length);
+    comp.startValue  = _mm512_set1_ps(*params.lutStart);
+    comp.endValue    = _mm512_set1_ps(*params.lutEnd);
+
+    if (HALF_DOMAIN)
+    {
+        comp.searchLength = std::max(length, negLength);
+
+        comp.negFlipSign    = _mm512_set1_ps(-params.flipSign);
+        comp.negIndexOffset = _mm512_set1_ps((float)(params.negLutStart - params.lutStart));
+        comp.negStartOffset = _mm512_set1_ps(params.negStartOffset);
+        comp.negLength      = _mm512_set1_ps((float)negLength);
+        comp.negStartValue  = _mm512_set1_ps(*params.negLutStart);
+        comp.negEndValue    = _mm512_set1_ps(*params.negLutEnd);
+    }
+}
+
+static inline __m512 gather_avx512(const float * lut, __m512 idx)
+{
+    return _mm512_i32gather_ps(_mm512_cvttps_epi32(idx), lut, sizeof(float));
+}
+
+// Convert the half float bit patterns held in the 32-bit lanes to float, including the zeros,
+// the denormals & the infinities. Unlike _mm512_cvtph_ps(), the signaling NaNs are preserved.
+static inline __m512 half_bits_to_float_avx512(__m512i h)
+{
+    const __m512i expMask = _mm512_set1_epi32(0x7c00 << 13);
+
+    __m512i o = _mm512_slli_epi32(_mm512_and_si512(h, _mm512_set1_epi32(0x7fff)), 13);
+    const __m512i exp = _mm512_and_si512(o, expMask);
+    o = _mm512_add_epi32(o, _mm512_set1_epi32((127 - 15) << 23));
+
+    // Infinities & NaNs.
+    const __mmask16 isInfNan = _mm512_cmpeq_epi32_mask(exp, expMask);
+    o = _mm512_mask_add_epi32(o, isInfNan, o, _mm512_set1_epi32((128 - 16) << 23));
+
+    // Zeros & denormals.
+    const __mmask16 isDenorm = _mm512_cmpeq_epi32_mask(exp, _mm512_setzero_si512());
+    const __m512 magic = _mm512_castsi512_ps(_mm512_set1_epi32(113 << 23));
+    const __m512 renorm = _mm512_sub_ps(
+        _mm512_castsi512_ps(_mm512_add_epi32(o, _mm512_set1_epi32(1 << 23))), magic);
+    o = _mm512_mask_blend_epi32(isDenorm, o, _mm512_castps_si512(renorm));
+
+    // Sign.
+    o = _mm512_or_si512(o, _mm512_slli_epi32(_mm512_and_si512(h, _mm512_set1_epi32(0x8000)), 16));
+
+    return _mm512_castsi512_ps(o);
+}
+
+template<bool HALF_DOMAIN>
+static inline __m512 apply_inv_lut_avx512(const InvLutComponentAVX512 & comp, const __m512 & scale,
+                                          __m512 val)
+{
+    const __m512 zero  = _mm512_setzero_ps();
+    const __m512 one_f = _mm512_set1_ps(1.f);
+
+    __m512 flipSign    = comp.flipSign;
+    __m512 indexOffset = comp.indexOffset;
+    __m512 startOffset = comp.startOffset;
+    __m512 length      = comp.length;
+    __m512 startValue  = comp.startValue;
+    __m512 endValue    = comp.endValue;
+
+    if (HALF_DOMAIN)
+    {
+        // Test the values against the bisect point to determine which half of the float
+        // domain to do the inverse eval in.
+        const __mmask16 isPos
+            = comp.isIncreasing ? _mm512_cmp_ps_mask(val, comp.bisectPoint, _CMP_GE_OQ)
+                                : _mm512_cmp_ps_mask(val, comp.bisectPoint, _CMP_NGE_UQ);
+
+        flipSign    = _mm512_mask_blend_ps(isPos, comp.negFlipSign,    flipSign);
+        indexOffset = _mm512_mask_blend_ps(isPos, comp.negIndexOffset, indexOffset);
+        startOffset = _mm512_mask_blend_ps(isPos, comp.negStartOffset, startOffset);
+        length      = _mm512_mask_blend_ps(isPos, comp.negLength,      length);
+        startValue  = _mm512_mask_blend_ps(isPos, comp.negStartValue,  startValue);
+        endValue    = _mm512_mask_blend_ps(isPos, comp.negEndValue,    endValue);
+    }
+
+    // Clamp the value to the range of the LUT (NaNs are preserved).
+    const __m512 cv
+        = _mm512_min_ps(endValue, _mm512_max_ps(startValue, _mm512_mul_ps(val, flipSign)));
+
+    // Branchless std::lower_bound(). As cv is never greater than the end value, probing
+    // past the end of a shorter domain is equivalent to probing its end entry.
+    __m512 base = zero;
+    for (int n = comp.searchLength; n > 1; n -= n / 2)
+    {
+        const __m512 probe
+            = _mm512_min_ps(_mm512_add_ps(base, _mm512_set1_ps((float)(n / 2))), length);
+        const __m512 entry = gather_avx512(comp.lut, _mm512_add_ps(indexOffset, probe));
+        base = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(entry, cv, _CMP_LT_OQ), base, probe);
+    }
+    const __m512 entry
+        = gather_avx512(comp.lut, _mm512_add_ps(indexOffset, _mm512_min_ps(base, length)));
+    const __m512 lowbound
+        = _mm512_mask_add_ps(base, _mm512_cmp_ps_mask(entry, cv, _CMP_LT_OQ), base, one_f);
+
+    // The lower bound is the first entry >= cv so decrement it unless cv is the first entry.
+    const __m512 lowIdx  = _mm512_max_ps(_mm512_sub_ps(lowbound, one_f), zero);
+    const __m512 highIdx = _mm512_min_ps(_mm512_add_ps(lowIdx, one_f), length);
+
+    const __m512 low  = gather_avx512(comp.lut, _mm512_add_ps(indexOffset, lowIdx));
+    const __m512 high = gather_avx512(comp.lut, _mm512_add_ps(indexOffset, highIdx));
+
+    // Delta is the fractional distance of cv between the adjacent LUT entries (zero on the
+    // flat spots).
+    const __m512 delta = _mm512_maskz_div_ps(_mm512_cmp_ps_mask(high, low, _CMP_GT_OQ),
+                                             _mm512_sub_ps(cv, low), _mm512_sub_ps(high, low));
+
+    const __m512 totalInds = _mm512_add_ps(lowIdx, startOffset);
+
+    if (!HALF_DOMAIN)
+    {
+        return _mm512_mul_ps(_mm512_add_ps(totalInds, delta), scale);
+    }
+
+    // The half domain LUT entries are not a constant distance apart so convert the indices
+    // (which are half floats) into floats.
+    const __m512 base0 = half_bits_to_float_avx512(_mm512_cvttps_epi32(totalInds));
+    const __m512 base1 = half_bits_to_float_avx512(_mm512_cvttps_epi32(_mm512_add_ps(totalInds, one_f)));
+
+    return _mm512_mul_ps(_mm512_add_ps(base0, _mm512_mul_ps(delta, _mm512_sub_ps(base1, base0))), scale);
+}
+
+template <BitDepth inBD, BitDepth outBD, bool HALF_DOMAIN>
+static inline void invLinear1D(const ComponentParams & paramsR,
+                               const ComponentParams & paramsG,
+                               const ComponentParams & paramsB,
+                               float scale,
+                               const void * inImg,
+                               void * outImg,
+                               long numPixels)
+{
+    typedef typename BitDepthInfo<inBD>::Type InType;
+    typedef typename BitDepthInfo<outBD>::Type OutType;
+
+    const InType *src = (const InType*)inImg;
+    OutType *dst = (OutType*)outImg;
+    __m512 r, g, b, a, alpha_scale;
+
+    InvLutComponentAVX512 red, grn, blu;
+    init_inv_lut_avx512<HALF_DOMAIN>(paramsR, red);
+    init_inv_lut_avx512<HALF_DOMAIN>(paramsG, grn);
+    init_inv_lut_avx512<HALF_DOMAIN>(paramsB, blu);
+
+    const __m512 lut_scale = _mm512_set1_ps(scale);
+
+    if (inBD != outBD)
+        alpha_scale = _mm512_set1_ps((float)BitDepthInfo<outBD>::maxValue / (float)BitDepthInfo<inBD>::maxValue);
+
+    const long pixel_count = numPixels / 16 * 16;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 16)
+    {
+        AVX512RGBAPack<inBD>::Load(src, r, g, b, a);
+
+        r = apply_inv_lut_avx512<HALF_DOMAIN>(red, lut_scale, r);
+        g = apply_inv_lut_avx512<HALF_DOMAIN>(grn, lut_scale, g);
+        b = apply_inv_lut_avx512<HALF_DOMAIN>(blu, lut_scale, b);
+
+        if (inBD != outBD)
+            a = _mm512_mul_ps(a, alpha_scale);
+
+        AVX512RGBAPack<outBD>::Store(dst, r, g, b, a);
+
+        src += 64;
+        dst += 64;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        AVX512RGBAPack<inBD>::LoadMasked(src, r, g, b, a, remainder);
+
+        r = apply_inv_lut_avx512<HALF_DOMAIN>(red, lut_scale, r);
+        g = apply_inv_lut_avx512<HALF_DOMAIN>(grn, lut_scale, g);
+        b = apply_inv_lut_avx512<HALF_DOMAIN>(blu, lut_scale, b);
+
+        if (inBD != outBD)
+            a = _mm512_mul_ps(a, alpha_scale);
+
+        AVX512RGBAPack<outBD>::StoreMasked(dst, r, g, b, a, remainder);
+    }
+}
+
+template<BitDepth inBD, bool HALF_DOMAIN>
+inline InvLut1DOpCPUApplyFunc * GetInvConvertInBitDepth(BitDepth outBD)
+{
+    switch(outBD)
+    {
+        case BIT_DEPTH_UINT8:
+            return invLinear1D<inBD, BIT_DEPTH_UINT8, HALF_DOMAIN>;
+        case BIT_DEPTH_UINT10:
+            return invLinear1D<inBD, BIT_DEPTH_UINT10, HALF_DOMAIN>;
+        case BIT_DEPTH_UINT12:
+            return invLinear1D<inBD, BIT_DEPTH_UINT12, HALF_DOMAIN>;
+        case BIT_DEPTH_UINT16:
+            return invLinear1D<inBD, BIT_DEPTH_UINT16, HALF_DOMAIN>;
+        case BIT_DEPTH_F16:
+            return invLinear1D<inBD, BIT_DEPTH_F16, HALF_DOMAIN>;
+        case BIT_DEPTH_F32:
+            return invLinear1D<inBD, BIT_DEPTH_F32, HALF_DOMAIN>;
+        case BIT_DEPTH_UINT14:
+        case BIT_DEPTH_UINT32:
+        case BIT_DEPTH_UNKNOWN:
+        default:
+            break;
+    }
+
+    return nullptr;
+}
+
 } // anonymous namespace
 
 Lut1DOpCPUApplyFunc * AVX512GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD)
@@ -145,6 +400,30 @@ Lut1DOpCPUApplyFunc * AVX512GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD)
     return nullptr;
 }
 
+InvLut1DOpCPUApplyFunc * AVX512GetInvLut1DApplyFunc(BitDepth inBD, BitDepth outBD, bool halfDomain)
+{
+    // Only the float input is vectorized, like the forward LUT.
+    switch(inBD)
+    {
+        case BIT_DEPTH_UINT8:
+        case BIT_DEPTH_UINT10:
+        case BIT_DEPTH_UINT12:
+        case BIT_DEPTH_UINT16:
+        case BIT_DEPTH_F16:
+            break;
+        case BIT_DEPTH_F32:
+            return halfDomain ? GetInvConvertInBitDepth<BIT_DEPTH_F32, true>(outBD)
+                              : GetInvConvertInBitDepth<BIT_DEPTH_F32, false>(outBD);
+        case BIT_DEPTH_UINT14:
+        case BIT_DEPTH_UINT32:
+        case BIT_DEPTH_UNKNOWN:
+        default:
+            break;
+    }
+
+    return nullptr;
+}
+
 } // OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX512
\ No newline at end of file
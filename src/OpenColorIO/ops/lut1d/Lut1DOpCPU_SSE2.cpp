@@ -5,6 +5,7 @@
 
 #if OCIO_USE_SSE2
 
+#include <algorithm>
 #include <string.h>
 
 #include "SSE2.h"
@@ -177,6 +178,280 @@ inline Lut1DOpCPUApplyFunc * GetConvertInBitDepth(BitDepth outBD)
     return nullptr;
 }
 
+// Inverse evaluation, refer to FindLutInv() & FindLutInvHalf() in Lut1DOpCPU.cpp.
+
+// The parameters of a LUT component broadcast to all the lanes.
+struct InvLutComponentSSE2
+{
+    const float * lut;      // The effective start of the (positive half of the) LUT.
+    int searchLength;       // Number of entries to search i.e. the longest effective domain.
+    bool isIncreasing;
+    __m128 bisectPoint;
+
+    __m128 flipSign;
+    __m128 indexOffset;     // Effective start of the domain relative to lut.
+    __m128 startOffset;
+    __m128 length;          // Index of the effective end of the domain.
+    __m128 startValue;
+    __m128 endValue;
+
+    // The negative half of a half domain LUT.
+    __m128 negFlipSign;
+    __m128 negIndexOffset;
+    __m128 negStartOffset;
+    __m128 negLength;
+    __m128 negStartValue;
+    __m128 negEndValue;
+};
+
+template<bool HALF_DOMAIN>
+static inline void init_inv_lut_sse2(const ComponentParams & params, InvLutComponentSSE2 & comp)
+{
+    const int length    = (int)(params.lutEnd - params.lutStart);
+    const int negLength = (int)(params.negLutEnd - params.negLutStart);
+
+    comp.lut          = params.lutStart;
+    comp.searchLength = length;
+    comp.isIncreasing = params.flipSign > 0.f;
+    comp.bisectPoint  = _mm_set1_ps(params.bisectPoint);
+
+    comp.flipSign    = _mm_set1_ps(params.flipSign);
+    comp.indexOffset = _mm_setzero_ps();
+    comp.startOffset = _mm_set1_ps(params.startOffset);
+    comp.length      = _mm_set1_ps((float)length);
+    comp.startValue  = _mm_set1_ps(*params.lutStart);
+    comp.endValue    = _mm_set1_ps(*params.lutEnd);
+
+    if (HALF_DOMAIN)
+    {
+        comp.searchLength = std::max(length, negLength);
+
+        comp.negFlipSign    = _mm_set1_ps(-params.flipSign);
+        comp.negIndexOffset = _mm_set1_ps((float)(params.negLutStart - params.lutStart));
+        comp.negStartOffset = _mm_set1_ps(params.negStartOffset);
+        comp.negLength      = _mm_set1_ps((float)negLength);
+        comp.negStartValue  = _mm_set1_ps(*params.negLutStart);
+        comp.negEndValue    = _mm_set1_ps(*params.negLutEnd);
+    }
+}
+
+static inline __m128 select_sse2(__m128 mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+static inline __m128 gather_sse2(const float * lut, __m128 idx)
+{
+    SSE2_ALIGN(int32_t indices[4]);
+    SSE2_ALIGN(float buffer[4]);
+
+    __m128 res;
+    i32gather_ps_sse2(lut, res, _mm_cvttps_epi32(idx), indices, buffer);
+    return res;
+}
+
+// Convert the half float bit patterns held in the 32-bit lanes to float, including the zeros,
+// the denormals & the infinities.
+static inline __m128 half_bits_to_float_sse2(__m128i h)
+{
+    const __m128i expMask = _mm_set1_epi32(0x7c00 << 13);
+
+    __m128i o = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7fff)), 13);
+    const __m128i exp = _mm_and_si128(o, expMask);
+    o = _mm_add_epi32(o, _mm_set1_epi32((127 - 15) << 23));
+
+    // Infinities & NaNs.
+    const __m128i isInfNan = _mm_cmpeq_epi32(exp, expMask);
+    o = _mm_add_epi32(o, _mm_and_si128(isInfNan, _mm_set1_epi32((128 - 16) << 23)));
+
+    // Zeros & denormals.
+    const __m128i isDenorm = _mm_cmpeq_epi32(exp, _mm_setzero_si128());
+    const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32(113 << 23));
+    const __m128 renorm
+        = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(o, _mm_set1_epi32(1 << 23))), magic);
+    o = _mm_or_si128(_mm_and_si128(isDenorm, _mm_castps_si128(renorm)),
+                     _mm_andnot_si128(isDenorm, o));
+
+    // Sign.
+    o = _mm_or_si128(o, _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16));
+
+    return _mm_castsi128_ps(o);
+}
+
+template<bool HALF_DOMAIN>
+static inline __m128 apply_inv_lut_sse2(const InvLutComponentSSE2 & comp, const __m128 & scale,
+                                        __m128 val)
+{
+    const __m128 zero  = _mm_setzero_ps();
+    const __m128 one_f = _mm_set1_ps(1.f);
+
+    __m128 flipSign    = comp.flipSign;
+    __m128 indexOffset = comp.indexOffset;
+    __m128 startOffset = comp.startOffset;
+    __m128 length      = comp.length;
+    __m128 startValue  = comp.startValue;
+    __m128 endValue    = comp.endValue;
+
+    if (HALF_DOMAIN)
+    {
+        // Test the values against the bisect point to determine which half of the float
+        // domain to do the inverse eval in.
+        const __m128 isPos = comp.isIncreasing ? _mm_cmpge_ps(val, comp.bisectPoint)
+                                               : _mm_cmpnge_ps(val, comp.bisectPoint);
+
+        flipSign    = select_sse2(isPos, flipSign,    comp.negFlipSign);
+        indexOffset = select_sse2(isPos, indexOffset, comp.negIndexOffset);
+        startOffset = select_sse2(isPos, startOffset, comp.negStartOffset);
+        length      = select_sse2(isPos, length,      comp.negLength);
+        startValue  = select_sse2(isPos, startValue,  comp.negStartValue);
+        endValue    = select_sse2(isPos, endValue,    comp.negEndValue);
+    }
+
+    // Clamp the value to the range of the LUT (NaNs are preserved).
+    const __m128 cv = _mm_min_ps(endValue, _mm_max_ps(startValue, _mm_mul_ps(val, flipSign)));
+
+    // Branchless std::lower_bound(). As cv is never greater than the end value, probing
+    // past the end of a shorter domain is equivalent to probing its end entry.
+    __m128 base = zero;
+    for (int n = comp.searchLength; n > 1; n -= n / 2)
+    {
+        const __m128 probe = _mm_min_ps(_mm_add_ps(base, _mm_set1_ps((float)(n / 2))), length);
+        const __m128 isLess = _mm_cmplt_ps(gather_sse2(comp.lut, _mm_add_ps(indexOffset, probe)), cv);
+        base = select_sse2(isLess, probe, base);
+    }
+    const __m128 isLess
+        = _mm_cmplt_ps(gather_sse2(comp.lut, _mm_add_ps(indexOffset, _mm_min_ps(base, length))), cv);
+    const __m128 lowbound = _mm_add_ps(base, _mm_and_ps(isLess, one_f));
+
+    // The lower bound is the first entry >= cv so decrement it unless cv is the first entry.
+    const __m128 lowIdx  = _mm_max_ps(_mm_sub_ps(lowbound, one_f), zero);
+    const __m128 highIdx = _mm_min_ps(_mm_add_ps(lowIdx, one_f), length);
+
+    const __m128 low  = gather_sse2(comp.lut, _mm_add_ps(indexOffset, lowIdx));
+    const __m128 high = gather_sse2(comp.lut, _mm_add_ps(indexOffset, highIdx));
+
+    // Delta is the fractional distance of cv between the adjacent LUT entries (zero on the
+    // flat spots).
+    const __m128 delta = _mm_and_ps(_mm_cmpgt_ps(high, low),
+                                    _mm_div_ps(_mm_sub_ps(cv, low), _mm_sub_ps(high, low)));
+
+    const __m128 totalInds = _mm_add_ps(lowIdx, startOffset);
+
+    if (!HALF_DOMAIN)
+    {
+        return _mm_mul_ps(_mm_add_ps(totalInds, delta), scale);
+    }
+
+    // The half domain LUT entries are not a constant distance apart so convert the indices
+    // (which are half floats) into floats.
+    const __m128 base0 = half_bits_to_float_sse2(_mm_cvttps_epi32(totalInds));
+    const __m128 base1 = half_bits_to_float_sse2(_mm_cvttps_epi32(_mm_add_ps(totalInds, one_f)));
+
+    return _mm_mul_ps(_mm_add_ps(base0, _mm_mul_ps(delta, _mm_sub_ps(base1, base0))), scale);
+}
+
+template <BitDepth inBD, BitDepth outBD, bool HALF_DOMAIN>
+static inline void invLinear1D(const ComponentParams & paramsR,
+                               const ComponentParams & paramsG,
+                               const ComponentParams & paramsB,
+                               float scale,
+                               const void * inImg,
+                               void * outImg,
+                               long numPixels)
+{
+    typedef typename BitDepthInfo<inBD>::Type InType;
+    typedef typename BitDepthInfo<outBD>::Type OutType;
+
+    const InType *src = (const InType*)inImg;
+    OutType *dst = (OutType*)outImg;
+    __m128 r, g, b, a, alpha_scale;
+
+    InvLutComponentSSE2 red, grn, blu;
+    init_inv_lut_sse2<HALF_DOMAIN>(paramsR, red);
+    init_inv_lut_sse2<HALF_DOMAIN>(paramsG, grn);
+    init_inv_lut_sse2<HALF_DOMAIN>(paramsB, blu);
+
+    const __m128 lut_scale = _mm_set1_ps(scale);
+
+    if (inBD != outBD)
+        alpha_scale = _mm_set1_ps((float)BitDepthInfo<outBD>::maxValue / (float)BitDepthInfo<inBD>::maxValue);
+
+    const long pixel_count = numPixels / 4 * 4;
+    const long remainder = numPixels - pixel_count;
+
+    for (long i = 0; i < pixel_count; i += 4)
+    {
+        SSE2RGBAPack<inBD>::Load(src, r, g, b, a);
+
+        r = apply_inv_lut_sse2<HALF_DOMAIN>(red, lut_scale, r);
+        g = apply_inv_lut_sse2<HALF_DOMAIN>(grn, lut_scale, g);
+        b = apply_inv_lut_sse2<HALF_DOMAIN>(blu, lut_scale, b);
+
+        if (inBD != outBD)
+            a = _mm_mul_ps(a, alpha_scale);
+
+        SSE2RGBAPack<outBD>::Store(dst, r, g, b, a);
+
+        src += 16;
+        dst += 16;
+    }
+
+    // Handle the leftover pixels.
+    if (remainder)
+    {
+        InType in_buf[16] = {};
+        OutType out_buf[16];
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            in_buf[i] = src[i];
+        }
+
+        SSE2RGBAPack<inBD>::Load(in_buf, r, g, b, a);
+
+        r = apply_inv_lut_sse2<HALF_DOMAIN>(red, lut_scale, r);
+        g = apply_inv_lut_sse2<HALF_DOMAIN>(grn, lut_scale, g);
+        b = apply_inv_lut_sse2<HALF_DOMAIN>(blu, lut_scale, b);
+
+        if (inBD != outBD)
+            a = _mm_mul_ps(a, alpha_scale);
+
+        SSE2RGBAPack<outBD>::Store(out_buf, r, g, b, a);
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            dst[i] = out_buf[i];
+        }
+    }
+}
+
+template<BitDepth inBD, bool HALF_DOMAIN>
+inline InvLut1DOpCPUApplyFunc * GetInvConvertInBitDepth(BitDepth outBD)
+{
+    switch(outBD)
+    {
+        case BIT_DEPTH_UINT8:
+            return invLinear1D<inBD, BIT_DEPTH_UINT8, HALF_DOMAIN>;
+        case BIT_DEPTH_UINT10:
+            return invLinear1D<inBD, BIT_DEPTH_UINT10, HALF_DOMAIN>;
+        case BIT_DEPTH_UINT12:
+            return invLinear1D<inBD, BIT_DEPTH_UINT12, HALF_DOMAIN>;
+        case BIT_DEPTH_UINT16:
+            return invLinear1D<inBD, BIT_DEPTH_UINT16, HALF_DOMAIN>;
+        case BIT_DEPTH_F16:
+            return invLinear1D<inBD, BIT_DEPTH_F16, HALF_DOMAIN>;
+        case BIT_DEPTH_F32:
+            return invLinear1D<inBD, BIT_DEPTH_F32, HALF_DOMAIN>;
+        case BIT_DEPTH_UINT14:
+        case BIT_DEPTH_UINT32:
+        case BIT_DEPTH_UNKNOWN:
+        default:
+            break;
+    }
+
+    return nullptr;
+}
+
 } // anonymous namespace
 
 Lut1DOpCPUApplyFunc * SSE2GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD)
@@ -203,6 +478,30 @@ Lut1DOpCPUApplyFunc * SSE2GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD)
     return nullptr;
 }
 
+InvLut1DOpCPUApplyFunc * SSE2GetInvLut1DApplyFunc(BitDepth inBD, BitDepth outBD, bool halfDomain)
+{
+    // Only the float input is vectorized, like the forward LUT.
+    switch(inBD)
+    {
+        case BIT_DEPTH_UINT8:
+        case BIT_DEPTH_UINT10:
+        case BIT_DEPTH_UINT12:
+        case BIT_DEPTH_UINT16:
+        case BIT_DEPTH_F16:
+            break;
+        case BIT_DEPTH_F32:
+            return halfDomain ? GetInvConvertInBitDepth<BIT_DEPTH_F32, true>(outBD)
+                              : GetInvConvertInBitDepth<BIT_DEPTH_F32, false>(outBD);
+        case BIT_DEPTH_UINT14:
+        case BIT_DEPTH_UINT32:
+        case BIT_DEPTH_UNKNOWN:
+        default:
+            break;
+    }
+
+    return nullptr;
+}
+
 } // OCIO_NAMESPACE
 
 #endif // OCIO_USE_SSE2
\ No newline at end of file
@@ -651,6 +651,12 @@ std::string Lut1DOpData::getCacheID() const
     return cacheIDStream.str();
 }
 
+size_t Lut1DOpData::getMemorySize() const
+{
+    const Lut3by1DArray::Values & values = getArray().getValues();
+    return sizeof(Lut1DOpData) + values.size() * sizeof(values[0]);
+}
+
 //-----------------------------------------------------------------------------
 //
 // Functional composition is a concept from mathematics where two functions
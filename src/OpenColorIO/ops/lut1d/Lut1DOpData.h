@@ -115,6 +115,8 @@ public:
 
     std::string getCacheID() const override;
 
+    size_t getMemorySize() const override;
+
     // Check if the LUT is using half code indices as its domain.
     // Return returns true if this LUT requires half code indices as input.
     static inline bool IsInputHalfDomain(HalfFlags halfFlags) noexcept
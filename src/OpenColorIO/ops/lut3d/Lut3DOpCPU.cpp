@@ -15,6 +15,7 @@
 #include "Platform.h"
 #include "SSE.h"
 #include "CPUInfo.h"
+#include "ThreadUtils.h"
 #include "Lut3DOpCPU_SSE2.h"
 #include "Lut3DOpCPU_AVX.h"
 #include "Lut3DOpCPU_AVX2.h"
@@ -75,6 +76,13 @@ public:
 
 };
 
+// Number of floats stored per element of a RangeTree level i.e. the min and the max LUT values
+// of the sub-tree, each padded to 4 channels.
+constexpr unsigned long RANGE_STRIDE = 8;
+
+// Number of RangeTree elements processed at once by a thread when building the tree.
+constexpr long RANGE_CHUNK_SIZE = 4096;
+
 class InvLut3DRenderer : public OpCPU
 {
     typedef std::vector<unsigned long> ulongVector;
@@ -83,8 +91,7 @@ class InvLut3DRenderer : public OpCPU
     {
         unsigned long      elems;         // number of elements on this level
         unsigned long      chans;         // in/out channels of the LUT
-        std::vector<float> minVals;       // min LUT value for the sub-tree
-        std::vector<float> maxVals;       // max LUT value for the sub-tree
+        std::vector<float> ranges;        // min & max LUT values for each sub-tree
         ulongVector        child0offsets; // offsets to the first children
         ulongVector        numChildren;   // number of children in the subtree
 
@@ -1089,8 +1096,8 @@ void InvLut3DRenderer::RangeTree::initRanges(float *grvec)
 {
     const unsigned long depthm1 = m_depth - 1;
     const unsigned long N = m_levels[depthm1].elems;
-    m_levels[depthm1].minVals.resize(N * m_chans);
-    m_levels[depthm1].maxVals.resize(N * m_chans);
+    m_levels[depthm1].ranges.assign(N * RANGE_STRIDE, 0.0f);
+    float * ranges = m_levels[depthm1].ranges.data();
     // Our 3d-LUTs are stored with the blue chan varying most rapidly.
     const unsigned long ind0scale = m_gsz[2] * m_gsz[1];
     const unsigned long ind1scale = m_gsz[2];
@@ -1122,38 +1129,43 @@ void InvLut3DRenderer::RangeTree::initRanges(float *grvec)
         throw Exception("Unsupported channel number.");
     }
 
-    float minVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
-    float maxVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
-    for (unsigned long i = 0; i < N; i++)
+    // The LUT cubes are independent so they are processed in parallel.
+    ParallelFor(N, RANGE_CHUNK_SIZE, 0, [&](unsigned, long begin, long end)
     {
-        const unsigned long baseOffset = m_baseInds[i].inds[0] * ind0scale +
-            m_baseInds[i].inds[1] * ind1scale + m_baseInds[i].inds[2];
-
-        for (unsigned long k = 0; k < m_chans; k++)
+        float minVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float maxVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        for (long i = begin; i < end; i++)
         {
-            minVal[k] = grvec[baseOffset * m_chans + k];
-            maxVal[k] = minVal[k];
-        }
+            const unsigned long baseOffset = m_baseInds[i].inds[0] * ind0scale +
+                m_baseInds[i].inds[1] * ind1scale + m_baseInds[i].inds[2];
 
-        for (unsigned long j = 1; j < corners; j++)
-        {
-            const unsigned long index = (baseOffset + cornerOffsets[j]) * m_chans;
             for (unsigned long k = 0; k < m_chans; k++)
             {
-                minVal[k] = std::min(minVal[k], grvec[index + k]);
-                maxVal[k] = std::max(maxVal[k], grvec[index + k]);
+                minVal[k] = grvec[baseOffset * m_chans + k];
+                maxVal[k] = minVal[k];
+            }
+
+            for (unsigned long j = 1; j < corners; j++)
+            {
+                const unsigned long index = (baseOffset + cornerOffsets[j]) * m_chans;
+                for (unsigned long k = 0; k < m_chans; k++)
+                {
+                    minVal[k] = std::min(minVal[k], grvec[index + k]);
+                    maxVal[k] = std::max(maxVal[k], grvec[index + k]);
+                }
             }
-        }
 
-        // Expand the ranges slightly to allow for error in forward evaluation.
-        const float TOL = 1e-6f;
+            // Expand the ranges slightly to allow for error in forward evaluation.
+            const float TOL = 1e-6f;
 
-        for (unsigned long k = 0; k < m_chans; k++)
-        {
-            m_levels[depthm1].minVals[i * m_chans + k] = minVal[k] - TOL;
-            m_levels[depthm1].maxVals[i * m_chans + k] = maxVal[k] + TOL;
+            float * range = ranges + i * RANGE_STRIDE;
+            for (unsigned long k = 0; k < m_chans; k++)
+            {
+                range[k]     = minVal[k] - TOL;
+                range[k + 4] = maxVal[k] + TOL;
+            }
         }
-    }
+    });
 }
 
 void InvLut3DRenderer::RangeTree::initInds()
@@ -1263,44 +1275,46 @@ void InvLut3DRenderer::RangeTree::updateRanges(const unsigned long level)
     const unsigned long maxChildren = 1 << m_chans;
     const unsigned long levelSize = m_levels[level].elems;
 
-    m_levels[level].minVals.resize(levelSize * m_chans);
-    m_levels[level].maxVals.resize(levelSize * m_chans);
+    m_levels[level].ranges.assign(levelSize * RANGE_STRIDE, 0.0f);
 
-    for (unsigned long i = 0; i < levelSize; i++)
+    float * ranges = m_levels[level].ranges.data();
+    const float * childRanges = m_levels[level + 1].ranges.data();
+    const ulongVector & child0offsets = m_levels[level].child0offsets;
+    const ulongVector & numChildren = m_levels[level].numChildren;
+
+    ParallelFor(levelSize, RANGE_CHUNK_SIZE, 0, [&](unsigned, long begin, long end)
     {
-        const unsigned long index = m_levels[level].child0offsets[i];
-        for (unsigned long k = 0; k < m_chans; k++)
+        for (long i = begin; i < end; i++)
         {
-            m_levels[level].minVals[i * m_chans + k] =
-                m_levels[level + 1].minVals[index * m_chans + k];
-            m_levels[level].maxVals[i * m_chans + k] =
-                m_levels[level + 1].maxVals[index * m_chans + k];
-        }
+            float * range = ranges + i * RANGE_STRIDE;
 
-        // New min/max combine the min/max for all children from next lower level.
-        for (unsigned long j = 2; j <= maxChildren; j++)
-        {
-            if (m_levels[level].numChildren[i] >= j)
+            const unsigned long index = child0offsets[i];
+            for (unsigned long k = 0; k < RANGE_STRIDE; k++)
             {
-                const unsigned long ind = index + j - 1;
-                for (unsigned long k = 0; k < m_chans; k++)
+                range[k] = childRanges[index * RANGE_STRIDE + k];
+            }
+
+            // New min/max combine the min/max for all children from next lower level.
+            for (unsigned long j = 2; j <= maxChildren; j++)
+            {
+                if (numChildren[i] >= j)
                 {
-                    const float minVal = m_levels[level].minVals[i * m_chans + k];
-                    const float childMinVal = m_levels[level + 1].minVals[ind * m_chans + k];
-                    if (childMinVal < minVal)
-                    {
-                        m_levels[level].minVals[i * m_chans + k] = childMinVal;
-                    }
-                    const float maxVal = m_levels[level].maxVals[i * m_chans + k];
-                    const float childMaxVal = m_levels[level + 1].maxVals[ind * m_chans + k];
-                    if (childMaxVal > maxVal)
+                    const float * childRange = childRanges + (index + j - 1) * RANGE_STRIDE;
+                    for (unsigned long k = 0; k < m_chans; k++)
                     {
-                        m_levels[level].maxVals[i * m_chans + k] = childMaxVal;
+                        if (childRange[k] < range[k])
+                        {
+                            range[k] = childRange[k];
+                        }
+                        if (childRange[k + 4] > range[k + 4])
+                        {
+                            range[k + 4] = childRange[k + 4];
+                        }
                     }
                 }
             }
         }
-    }
+    });
 }
 
 void InvLut3DRenderer::RangeTree::initialize(float *grvec, unsigned long gsz)
@@ -1351,10 +1365,13 @@ void InvLut3DRenderer::RangeTree::initialize(float *grvec, unsigned long gsz)
     // Calculate hash for indices.
 
     const unsigned long cnt = static_cast<unsigned long>(m_baseInds.size());
-    for (unsigned long i = 0; i < cnt; i++)
+    ParallelFor(cnt, RANGE_CHUNK_SIZE, 0, [this](unsigned, long begin, long end)
     {
-        indsToHash(i);
-    }
+        for (long i = begin; i < end; i++)
+        {
+            indsToHash(i);
+        }
+    });
 
     // Sort indices based on hash.
     std::sort(m_baseInds.begin(), m_baseInds.end());
@@ -1414,8 +1431,8 @@ void InvLut3DRenderer::RangeTree::initialize(float *grvec, unsigned long gsz)
     {
         for (unsigned long k = 0; k < chans; k++)
         {
-            std::cout << "  " << _levels[level].minVals[i * chans + k];
-            std::cout << " / " << _levels[level].maxVals[i * chans + k] << ",";
+            std::cout << "  " << _levels[level].ranges[i * RANGE_STRIDE + k];
+            std::cout << " / " << _levels[level].ranges[i * RANGE_STRIDE + 4 + k] << ",";
         }
         std::cout << "\n";
     }
@@ -1662,6 +1679,11 @@ void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels)
         const float G = Clamp(in[1], 0.f, inMax);
         const float B = Clamp(in[2], 0.f, inMax);
 
+#if OCIO_USE_SSE2
+        // The padding channel of the ranges is 0 so it always passes the range test.
+        const __m128 rgb = _mm_set_ps(0.f, B, G, R);
+#endif
+
         const long depthm1 = depth - 1;
         unsigned long baseIndx[3] = {0, 0, 0};
 
@@ -1678,13 +1700,16 @@ void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels)
             while (currentChild[level] < currentNumChildren[level])
             {
                 const unsigned long node = currentChildInd[level];
+                const float * range = &levels[level].ranges[node * RANGE_STRIDE];
+#if OCIO_USE_SSE2
+                const __m128 inside = _mm_and_ps(_mm_cmpge_ps(rgb, _mm_loadu_ps(range)),
+                                                 _mm_cmple_ps(rgb, _mm_loadu_ps(range + 4)));
+                const bool inRange = _mm_movemask_ps(inside) == 0xF;
+#else
                 const bool inRange =
-                    R >= levels[level].minVals[node * chans] &&
-                    G >= levels[level].minVals[node * chans + 1] &&
-                    B >= levels[level].minVals[node * chans + 2] &&
-                    R <= levels[level].maxVals[node * chans] &&
-                    G <= levels[level].maxVals[node * chans + 1] &&
-                    B <= levels[level].maxVals[node * chans + 2];
+                    R >= range[0] && G >= range[1] && B >= range[2] &&
+                    R <= range[4] && G <= range[5] && B <= range[6];
+#endif
                 currentChild[level]++;
                 currentChildInd[level]++;
 
@@ -1720,14 +1745,14 @@ void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels)
                 }
             }
             level--;
-
-            // Need to subtract 1 since the indices include the extrapolation.
-            out[0] = Clamp(result[0] - 1.f, 0.f, maxDim) * m_scale;
-            out[1] = Clamp(result[1] - 1.f, 0.f, maxDim) * m_scale;
-            out[2] = Clamp(result[2] - 1.f, 0.f, maxDim) * m_scale;
-            out[3] = in[3];
         }
 
+        // Need to subtract 1 since the indices include the extrapolation.
+        out[0] = Clamp(result[0] - 1.f, 0.f, maxDim) * m_scale;
+        out[1] = Clamp(result[1] - 1.f, 0.f, maxDim) * m_scale;
+        out[2] = Clamp(result[2] - 1.f, 0.f, maxDim) * m_scale;
+        out[3] = in[3];
+
         in  += 4;
         out += 4;
     }
@@ -489,6 +489,12 @@ std::string Lut3DOpData::getCacheID() const
     return cacheIDStream.str();
 }
 
+size_t Lut3DOpData::getMemorySize() const
+{
+    const Lut3DArray::Values & values = getArray().getValues();
+    return sizeof(Lut3DOpData) + values.size() * sizeof(values[0]);
+}
+
 void Lut3DOpData::scale(float scale)
 {
     getArray().scale(scale);
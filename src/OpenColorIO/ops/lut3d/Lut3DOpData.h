@@ -85,6 +85,8 @@ public:
 
     std::string getCacheID() const override;
 
+    size_t getMemorySize() const override;
+
     inline BitDepth getFileOutputBitDepth() const { return m_fileOutBitDepth; }
     inline void setFileOutputBitDepth(BitDepth out) { m_fileOutBitDepth = out; }
 
@@ -4,8 +4,11 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "MathUtils.h"
 #include "ops/matrix/MatrixOpCPU.h"
+#include "ops/matrix/MatrixOpCPU_AVX2.h"
+#include "ops/matrix/MatrixOpCPU_AVX512.h"
 #include "Platform.h"
 #include "SSE.h"
 
@@ -14,6 +17,193 @@ namespace OCIO_NAMESPACE
 namespace
 {
 
+// Planar processing of a diagonal matrix i.e. each channel plane is only scaled (and offset).
+template<bool hasOffset>
+void ApplyScalePlanar(float * plane, float scale, float offset, long numPixels)
+{
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        plane[idx] = hasOffset ? plane[idx] * scale + offset : plane[idx] * scale;
+    }
+}
+
+// Planar processing of a matrix stored per column (i.e. the red, green, blue and then alpha
+// multipliers) with an optional offset. The additions are done in the same order as the SSE
+// packed implementation.
+void ApplyMatrixPlanar(const float * m, const float * o,
+                       float * rPlane, float * gPlane, float * bPlane, float * aPlane,
+                       long numPixels)
+{
+    long idx = 0;
+
+#if OCIO_USE_SSE2
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        const __m128 r = _mm_loadu_ps(rPlane + idx);
+        const __m128 g = _mm_loadu_ps(gPlane + idx);
+        const __m128 b = _mm_loadu_ps(bPlane + idx);
+        const __m128 a = _mm_loadu_ps(aPlane + idx);
+
+        __m128 res[4];
+        for (int chan = 0; chan < 4; ++chan)
+        {
+            const __m128 rm = _mm_mul_ps(r, _mm_set1_ps(m[chan]));
+            const __m128 gm = _mm_mul_ps(g, _mm_set1_ps(m[4 + chan]));
+            const __m128 bm = _mm_mul_ps(b, _mm_set1_ps(m[8 + chan]));
+            const __m128 am = _mm_mul_ps(a, _mm_set1_ps(m[12 + chan]));
+
+            res[chan] = _mm_add_ps(_mm_add_ps(rm, gm), _mm_add_ps(bm, am));
+            if (o)
+            {
+                res[chan] = _mm_add_ps(res[chan], _mm_set1_ps(o[chan]));
+            }
+        }
+
+        _mm_storeu_ps(rPlane + idx, res[0]);
+        _mm_storeu_ps(gPlane + idx, res[1]);
+        _mm_storeu_ps(bPlane + idx, res[2]);
+        _mm_storeu_ps(aPlane + idx, res[3]);
+    }
+#endif
+
+    for (; idx < numPixels; ++idx)
+    {
+        const float r = rPlane[idx];
+        const float g = gPlane[idx];
+        const float b = bPlane[idx];
+        const float a = aPlane[idx];
+
+        float res[4];
+        for (int chan = 0; chan < 4; ++chan)
+        {
+#if OCIO_USE_SSE2
+            res[chan] = (r * m[chan] + g * m[4 + chan]) + (b * m[8 + chan] + a * m[12 + chan]);
+#else
+            res[chan] = r * m[chan] + g * m[4 + chan] + b * m[8 + chan] + a * m[12 + chan];
+#endif
+            if (o)
+            {
+                res[chan] += o[chan];
+            }
+        }
+
+        rPlane[idx] = res[0];
+        gPlane[idx] = res[1];
+        bPlane[idx] = res[2];
+        aPlane[idx] = res[3];
+    }
+}
+
+// Packed RGB processing of a diagonal matrix i.e. each channel is only scaled (and offset).
+template<bool hasOffset>
+void ApplyScaleRGB(const float * scale, const float * offset,
+                   const float * in, float * out, long numPixels)
+{
+    long idx = 0;
+
+#if OCIO_USE_SSE2
+    __m128 s[3];
+    __m128 o[3];
+    for (int reg = 0; reg < 3; ++reg)
+    {
+        s[reg] = sseRGBChannels(scale, reg);
+        o[reg] = hasOffset ? sseRGBChannels(offset, reg) : _mm_setzero_ps();
+    }
+
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        for (int reg = 0; reg < 3; ++reg)
+        {
+            __m128 pix = _mm_mul_ps(_mm_loadu_ps(in + 3 * idx + 4 * reg), s[reg]);
+            if (hasOffset)
+            {
+                pix = _mm_add_ps(pix, o[reg]);
+            }
+            _mm_storeu_ps(out + 3 * idx + 4 * reg, pix);
+        }
+    }
+#endif
+
+    for (; idx < numPixels; ++idx)
+    {
+        for (int chan = 0; chan < 3; ++chan)
+        {
+            const float pix = in[3 * idx + chan];
+            out[3 * idx + chan] = hasOffset ? pix * scale[chan] + offset[chan]
+                                            : pix * scale[chan];
+        }
+    }
+}
+
+// Packed RGB processing of a matrix stored per column with an optional offset. The alpha is 0
+// so the alpha multipliers are ignored, and the additions are done in the same order as the
+// planar processing.
+void ApplyMatrixRGB(const float * m, const float * o,
+                    const float * in, float * out, long numPixels)
+{
+    long idx = 0;
+
+#if OCIO_USE_SSE2
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 rgb[3];
+        sseDeinterleaveRGB(_mm_loadu_ps(in + 3 * idx),
+                           _mm_loadu_ps(in + 3 * idx + 4),
+                           _mm_loadu_ps(in + 3 * idx + 8),
+                           rgb[0], rgb[1], rgb[2]);
+
+        __m128 res[3];
+        for (int chan = 0; chan < 3; ++chan)
+        {
+            const __m128 rm = _mm_mul_ps(rgb[0], _mm_set1_ps(m[chan]));
+            const __m128 gm = _mm_mul_ps(rgb[1], _mm_set1_ps(m[4 + chan]));
+            const __m128 bm = _mm_mul_ps(rgb[2], _mm_set1_ps(m[8 + chan]));
+
+            res[chan] = _mm_add_ps(_mm_add_ps(rm, gm), bm);
+            if (o)
+            {
+                res[chan] = _mm_add_ps(res[chan], _mm_set1_ps(o[chan]));
+            }
+        }
+
+        __m128 pix[3];
+        sseInterleaveRGB(res[0], res[1], res[2], pix[0], pix[1], pix[2]);
+
+        _mm_storeu_ps(out + 3 * idx,     pix[0]);
+        _mm_storeu_ps(out + 3 * idx + 4, pix[1]);
+        _mm_storeu_ps(out + 3 * idx + 8, pix[2]);
+    }
+#endif
+
+    for (; idx < numPixels; ++idx)
+    {
+        const float r = in[3 * idx];
+        const float g = in[3 * idx + 1];
+        const float b = in[3 * idx + 2];
+
+        float res[3];
+        for (int chan = 0; chan < 3; ++chan)
+        {
+            res[chan] = (r * m[chan] + g * m[4 + chan]) + b * m[8 + chan];
+            if (o)
+            {
+                res[chan] += o[chan];
+            }
+        }
+
+        out[3 * idx]     = res[0];
+        out[3 * idx + 1] = res[1];
+        out[3 * idx + 2] = res[2];
+    }
+}
+
+// The packed RGB processing needs the alpha to stay 0 (refer to OpCPU::hasPackedRGBApply())
+// i.e. the alpha must not be computed from the color channels or offset.
+bool KeepsZeroAlpha(const float * m, const float * o)
+{
+    return (!m || (m[3] == 0.0f && m[7] == 0.0f && m[11] == 0.0f)) && (!o || o[3] == 0.0f);
+}
+
 class ScaleRenderer : public OpCPU
 {
 public:
@@ -23,8 +213,17 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * rPlane, float * gPlane, float * bPlane, float * aPlane,
+                     long numPixels) const override;
+
+    bool hasPackedRGBApply() const override { return true; }
+    void applyPackedRGB(const void * inImg, void * outImg, long numPixels) const override;
+
 private:
     float m_scale[4];
+
+    MatrixApplyFunc * m_applyFunc;
 };
 
 class ScaleWithOffsetRenderer : public OpCPU
@@ -36,9 +235,18 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * rPlane, float * gPlane, float * bPlane, float * aPlane,
+                     long numPixels) const override;
+
+    bool hasPackedRGBApply() const override { return KeepsZeroAlpha(nullptr, m_offset); }
+    void applyPackedRGB(const void * inImg, void * outImg, long numPixels) const override;
+
 private:
     float m_scale[4];
     float m_offset[4];
+
+    MatrixApplyFunc * m_applyFunc;
 };
 
 class MatrixWithOffsetRenderer : public OpCPU
@@ -50,14 +258,19 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
-private:
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * rPlane, float * gPlane, float * bPlane, float * aPlane,
+                     long numPixels) const override;
 
-    float m_column1[4];
-    float m_column2[4];
-    float m_column3[4];
-    float m_column4[4];
+    bool hasPackedRGBApply() const override { return KeepsZeroAlpha(m_matrix, m_offset); }
+    void applyPackedRGB(const void * inImg, void * outImg, long numPixels) const override;
 
+private:
+    // The matrix per column i.e. the red, green, blue and then alpha multipliers.
+    float m_matrix[16];
     float m_offset[4];
+
+    MatrixApplyFunc * m_applyFunc;
 };
 
 class MatrixRenderer : public OpCPU
@@ -69,15 +282,23 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * rPlane, float * gPlane, float * bPlane, float * aPlane,
+                     long numPixels) const override;
+
+    bool hasPackedRGBApply() const override { return KeepsZeroAlpha(m_matrix, nullptr); }
+    void applyPackedRGB(const void * inImg, void * outImg, long numPixels) const override;
+
 private:
-    float m_column1[4];
-    float m_column2[4];
-    float m_column3[4];
-    float m_column4[4];
+    // The matrix per column i.e. the red, green, blue and then alpha multipliers.
+    float m_matrix[16];
+
+    MatrixApplyFunc * m_applyFunc;
 };
 
 ScaleRenderer::ScaleRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
+    , m_applyFunc(GetScaleApplyFunc())
 {
     const ArrayDouble::Values & m = mat->getArray().getValues();
 
@@ -92,6 +313,12 @@ void ScaleRenderer::apply(const void * inImg, void * outImg, long numPixels) con
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_scale, nullptr, in, out, numPixels);
+        return;
+    }
+
     for (long idx = 0; idx < numPixels; ++idx)
     {
         out[0] = in[0] * m_scale[0];
@@ -104,8 +331,23 @@ void ScaleRenderer::apply(const void * inImg, void * outImg, long numPixels) con
     }
 }
 
+void ScaleRenderer::applyPlanar(float * rPlane, float * gPlane, float * bPlane, float * aPlane,
+                                long numPixels) const
+{
+    ApplyScalePlanar<false>(rPlane, m_scale[0], 0.0f, numPixels);
+    ApplyScalePlanar<false>(gPlane, m_scale[1], 0.0f, numPixels);
+    ApplyScalePlanar<false>(bPlane, m_scale[2], 0.0f, numPixels);
+    ApplyScalePlanar<false>(aPlane, m_scale[3], 0.0f, numPixels);
+}
+
+void ScaleRenderer::applyPackedRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    ApplyScaleRGB<false>(m_scale, nullptr, (const float *)inImg, (float *)outImg, numPixels);
+}
+
 ScaleWithOffsetRenderer::ScaleWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
+    , m_applyFunc(GetScaleApplyFunc())
 {
     const ArrayDouble::Values & m = mat->getArray().getValues();
 
@@ -127,6 +369,12 @@ void ScaleWithOffsetRenderer::apply(const void * inImg, void * outImg, long numP
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_scale, m_offset, in, out, numPixels);
+        return;
+    }
+
     for (long idx = 0; idx < numPixels; ++idx)
     {
         out[0] = in[0] * m_scale[0] + m_offset[0];
@@ -139,8 +387,24 @@ void ScaleWithOffsetRenderer::apply(const void * inImg, void * outImg, long numP
     }
 }
 
+void ScaleWithOffsetRenderer::applyPlanar(float * rPlane, float * gPlane, float * bPlane,
+                                          float * aPlane, long numPixels) const
+{
+    ApplyScalePlanar<true>(rPlane, m_scale[0], m_offset[0], numPixels);
+    ApplyScalePlanar<true>(gPlane, m_scale[1], m_offset[1], numPixels);
+    ApplyScalePlanar<true>(bPlane, m_scale[2], m_offset[2], numPixels);
+    ApplyScalePlanar<true>(aPlane, m_scale[3], m_offset[3], numPixels);
+}
+
+void ScaleWithOffsetRenderer::applyPackedRGB(const void * inImg, void * outImg,
+                                             long numPixels) const
+{
+    ApplyScaleRGB<true>(m_scale, m_offset, (const float *)inImg, (float *)outImg, numPixels);
+}
+
 MatrixWithOffsetRenderer::MatrixWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
+    , m_applyFunc(GetMatrixApplyFunc())
 {
     const unsigned long dim = mat->getArray().getLength();
     const unsigned long twoDim = 2 * dim;
@@ -148,28 +412,28 @@ MatrixWithOffsetRenderer::MatrixWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     const ArrayDouble::Values & m = mat->getArray().getValues();
 
     // Red multipliers.
-    m_column1[0] = (float)m[0];
-    m_column1[1] = (float)m[dim];
-    m_column1[2] = (float)m[twoDim];
-    m_column1[3] = (float)m[threeDim];
+    m_matrix[0] = (float)m[0];
+    m_matrix[1] = (float)m[dim];
+    m_matrix[2] = (float)m[twoDim];
+    m_matrix[3] = (float)m[threeDim];
 
     // Green multipliers.
-    m_column2[0] = (float)m[1];
-    m_column2[1] = (float)m[dim + 1];
-    m_column2[2] = (float)m[twoDim + 1];
-    m_column2[3] = (float)m[threeDim + 1];
+    m_matrix[4] = (float)m[1];
+    m_matrix[5] = (float)m[dim + 1];
+    m_matrix[6] = (float)m[twoDim + 1];
+    m_matrix[7] = (float)m[threeDim + 1];
 
     // Blue multipliers.
-    m_column3[0] = (float)m[2];
-    m_column3[1] = (float)m[dim + 2];
-    m_column3[2] = (float)m[twoDim + 2];
-    m_column3[3] = (float)m[threeDim + 2];
+    m_matrix[8] = (float)m[2];
+    m_matrix[9] = (float)m[dim + 2];
+    m_matrix[10] = (float)m[twoDim + 2];
+    m_matrix[11] = (float)m[threeDim + 2];
 
     // Alpha multipliers.
-    m_column4[0] = (float)m[3];
-    m_column4[1] = (float)m[dim + 3];
-    m_column4[2] = (float)m[twoDim + 3];
-    m_column4[3] = (float)m[threeDim + 3];
+    m_matrix[12] = (float)m[3];
+    m_matrix[13] = (float)m[dim + 3];
+    m_matrix[14] = (float)m[twoDim + 3];
+    m_matrix[15] = (float)m[threeDim + 3];
 
     const MatrixOpData::Offsets & o = mat->getOffsets();
 
@@ -211,24 +475,30 @@ void MatrixWithOffsetRenderer::apply(const void * inImg, void * outImg, long num
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_matrix, m_offset, in, out, numPixels);
+        return;
+    }
+
 #if OCIO_USE_SSE2
     // Matrix decomposition per _column.
-    __m128 m0 = _mm_set_ps(m_column1[3],
-                           m_column1[2],
-                           m_column1[1],
-                           m_column1[0]);
-    __m128 m1 = _mm_set_ps(m_column2[3],
-                           m_column2[2],
-                           m_column2[1],
-                           m_column2[0]);
-    __m128 m2 = _mm_set_ps(m_column3[3],
-                           m_column3[2],
-                           m_column3[1],
-                           m_column3[0]);
-    __m128 m3 = _mm_set_ps(m_column4[3],
-                           m_column4[2],
-                           m_column4[1],
-                           m_column4[0]);
+    __m128 m0 = _mm_set_ps(m_matrix[3],
+                           m_matrix[2],
+                           m_matrix[1],
+                           m_matrix[0]);
+    __m128 m1 = _mm_set_ps(m_matrix[7],
+                           m_matrix[6],
+                           m_matrix[5],
+                           m_matrix[4]);
+    __m128 m2 = _mm_set_ps(m_matrix[11],
+                           m_matrix[10],
+                           m_matrix[9],
+                           m_matrix[8]);
+    __m128 m3 = _mm_set_ps(m_matrix[15],
+                           m_matrix[14],
+                           m_matrix[13],
+                           m_matrix[12]);
     __m128 o = _mm_set_ps(m_offset[3], m_offset[2], m_offset[1], m_offset[0]);
 
     for (long idx = 0; idx < numPixels; ++idx)
@@ -259,25 +529,25 @@ void MatrixWithOffsetRenderer::apply(const void * inImg, void * outImg, long num
         const float b = in[2];
         const float a = in[3];
 
-        out[0] = r*m_column1[0]
-                + g*m_column2[0]
-                + b*m_column3[0]
-                + a*m_column4[0]
+        out[0] = r*m_matrix[0]
+                + g*m_matrix[4]
+                + b*m_matrix[8]
+                + a*m_matrix[12]
                 + m_offset[0];
-        out[1] = r*m_column1[1]
-                + g*m_column2[1]
-                + b*m_column3[1]
-                + a*m_column4[1]
+        out[1] = r*m_matrix[1]
+                + g*m_matrix[5]
+                + b*m_matrix[9]
+                + a*m_matrix[13]
                 + m_offset[1];
-        out[2] = r*m_column1[2]
-                + g*m_column2[2]
-                + b*m_column3[2]
-                + a*m_column4[2]
+        out[2] = r*m_matrix[2]
+                + g*m_matrix[6]
+                + b*m_matrix[10]
+                + a*m_matrix[14]
                 + m_offset[2];
-        out[3] = r*m_column1[3]
-                + g*m_column2[3]
-                + b*m_column3[3]
-                + a*m_column4[3]
+        out[3] = r*m_matrix[3]
+                + g*m_matrix[7]
+                + b*m_matrix[11]
+                + a*m_matrix[15]
                 + m_offset[3];
 
         in  += 4;
@@ -287,8 +557,21 @@ void MatrixWithOffsetRenderer::apply(const void * inImg, void * outImg, long num
 
 }
 
+void MatrixWithOffsetRenderer::applyPlanar(float * rPlane, float * gPlane, float * bPlane,
+                                           float * aPlane, long numPixels) const
+{
+    ApplyMatrixPlanar(m_matrix, m_offset, rPlane, gPlane, bPlane, aPlane, numPixels);
+}
+
+void MatrixWithOffsetRenderer::applyPackedRGB(const void * inImg, void * outImg,
+                                              long numPixels) const
+{
+    ApplyMatrixRGB(m_matrix, m_offset, (const float *)inImg, (float *)outImg, numPixels);
+}
+
 MatrixRenderer::MatrixRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
+    , m_applyFunc(GetMatrixApplyFunc())
 {
     const unsigned long dim = mat->getArray().getLength();
     const unsigned long twoDim = 2 * dim;
@@ -296,28 +579,28 @@ MatrixRenderer::MatrixRenderer(ConstMatrixOpDataRcPtr & mat)
     const ArrayDouble::Values & m = mat->getArray().getValues();
 
     // Red multipliers.
-    m_column1[0] = (float)m[0];
-    m_column1[1] = (float)m[dim];
-    m_column1[2] = (float)m[twoDim];
-    m_column1[3] = (float)m[threeDim];
+    m_matrix[0] = (float)m[0];
+    m_matrix[1] = (float)m[dim];
+    m_matrix[2] = (float)m[twoDim];
+    m_matrix[3] = (float)m[threeDim];
 
     // Green multipliers.
-    m_column2[0] = (float)m[1];
-    m_column2[1] = (float)m[dim + 1];
-    m_column2[2] = (float)m[twoDim + 1];
-    m_column2[3] = (float)m[threeDim + 1];
+    m_matrix[4] = (float)m[1];
+    m_matrix[5] = (float)m[dim + 1];
+    m_matrix[6] = (float)m[twoDim + 1];
+    m_matrix[7] = (float)m[threeDim + 1];
 
     // Blue multipliers.
-    m_column3[0] = (float)m[2];
-    m_column3[1] = (float)m[dim + 2];
-    m_column3[2] = (float)m[twoDim + 2];
-    m_column3[3] = (float)m[threeDim + 2];
+    m_matrix[8] = (float)m[2];
+    m_matrix[9] = (float)m[dim + 2];
+    m_matrix[10] = (float)m[twoDim + 2];
+    m_matrix[11] = (float)m[threeDim + 2];
 
     // Alpha multipliers.
-    m_column4[0] = (float)m[3];
-    m_column4[1] = (float)m[dim + 3];
-    m_column4[2] = (float)m[twoDim + 3];
-    m_column4[3] = (float)m[threeDim + 3];
+    m_matrix[12] = (float)m[3];
+    m_matrix[13] = (float)m[dim + 3];
+    m_matrix[14] = (float)m[twoDim + 3];
+    m_matrix[15] = (float)m[threeDim + 3];
 }
 
 void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) const
@@ -325,24 +608,30 @@ void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) co
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_matrix, nullptr, in, out, numPixels);
+        return;
+    }
+
 #if OCIO_USE_SSE2
     // Matrix decomposition per _column.
-    __m128 m0 = _mm_set_ps(m_column1[3],
-                           m_column1[2],
-                           m_column1[1],
-                           m_column1[0]);
-    __m128 m1 = _mm_set_ps(m_column2[3],
-                           m_column2[2],
-                           m_column2[1],
-                           m_column2[0]);
-    __m128 m2 = _mm_set_ps(m_column3[3],
-                           m_column3[2],
-                           m_column3[1],
-                           m_column3[0]);
-    __m128 m3 = _mm_set_ps(m_column4[3],
-                           m_column4[2],
-                           m_column4[1],
-                           m_column4[0]);
+    __m128 m0 = _mm_set_ps(m_matrix[3],
+                           m_matrix[2],
+                           m_matrix[1],
+                           m_matrix[0]);
+    __m128 m1 = _mm_set_ps(m_matrix[7],
+                           m_matrix[6],
+                           m_matrix[5],
+                           m_matrix[4]);
+    __m128 m2 = _mm_set_ps(m_matrix[11],
+                           m_matrix[10],
+                           m_matrix[9],
+                           m_matrix[8]);
+    __m128 m3 = _mm_set_ps(m_matrix[15],
+                           m_matrix[14],
+                           m_matrix[13],
+                           m_matrix[12]);
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
@@ -371,22 +660,22 @@ void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) co
         const float b = in[2];
         const float a = in[3];
 
-        out[0] = r*m_column1[0]
-               + g*m_column2[0]
-               + b*m_column3[0]
-               + a*m_column4[0];
-        out[1] = r*m_column1[1]
-               + g*m_column2[1]
-               + b*m_column3[1]
-               + a*m_column4[1];
-        out[2] = r*m_column1[2]
-               + g*m_column2[2]
-               + b*m_column3[2]
-               + a*m_column4[2];
-        out[3] = r*m_column1[3]
-               + g*m_column2[3]
-               + b*m_column3[3]
-               + a*m_column4[3];
+        out[0] = r*m_matrix[0]
+               + g*m_matrix[4]
+               + b*m_matrix[8]
+               + a*m_matrix[12];
+        out[1] = r*m_matrix[1]
+               + g*m_matrix[5]
+               + b*m_matrix[9]
+               + a*m_matrix[13];
+        out[2] = r*m_matrix[2]
+               + g*m_matrix[6]
+               + b*m_matrix[10]
+               + a*m_matrix[14];
+        out[3] = r*m_matrix[3]
+               + g*m_matrix[7]
+               + b*m_matrix[11]
+               + a*m_matrix[15];
 
         in  += 4;
         out += 4;
@@ -395,6 +684,59 @@ void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) co
 #endif
 }
 
+void MatrixRenderer::applyPlanar(float * rPlane, float * gPlane, float * bPlane, float * aPlane,
+                                 long numPixels) const
+{
+    ApplyMatrixPlanar(m_matrix, nullptr, rPlane, gPlane, bPlane, aPlane, numPixels);
+}
+
+void MatrixRenderer::applyPackedRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    ApplyMatrixRGB(m_matrix, nullptr, (const float *)inImg, (float *)outImg, numPixels);
+}
+
+}
+
+MatrixApplyFunc * GetMatrixApplyFunc()
+{
+    MatrixApplyFunc * func = nullptr;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        func = applyMatrixAVX2;
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        func = applyMatrixAVX512;
+    }
+#endif
+
+    return func;
+}
+
+MatrixApplyFunc * GetScaleApplyFunc()
+{
+    MatrixApplyFunc * func = nullptr;
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        func = applyScaleAVX2;
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        func = applyScaleAVX512;
+    }
+#endif
+
+    return func;
 }
 
 ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat)
@@ -14,6 +14,16 @@ namespace OCIO_NAMESPACE
 
 ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat);
 
+// Optimized implementation processing packed RGBA float pixels i.e. the matrix is stored per
+// column (the red, green, blue and then alpha multipliers) or holds the four scale values, and
+// the offsets could be null.
+typedef void (MatrixApplyFunc)(const float * params, const float * offsets,
+                               const float * src, float * dst, long numPixels);
+
+// Return the fastest implementation supported by the CPU, or null if none.
+MatrixApplyFunc * GetMatrixApplyFunc();
+MatrixApplyFunc * GetScaleApplyFunc();
+
 } // namespace OCIO_NAMESPACE
 
 #endif
\ No newline at end of file
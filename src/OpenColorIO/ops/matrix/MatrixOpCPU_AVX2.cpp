@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "MatrixOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+// Both 128-bit lanes hold the four values i.e. the same parameters for two RGBA pixels.
+static inline __m256 load_lanes_avx2(const float * values)
+{
+    const __m128 v = _mm_loadu_ps(values);
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(v), v, 1);
+}
+
+struct MatrixContextAVX2 {
+    __m256 m0, m1, m2, m3;
+    __m256 offsets;
+};
+
+// Process two RGBA pixels i.e. one per 128-bit lane.
+template<bool hasOffsets>
+static inline __m256 apply_matrix_avx2(const MatrixContextAVX2 & ctx, __m256 pixels)
+{
+    const __m256 r = _mm256_permute_ps(pixels, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m256 g = _mm256_permute_ps(pixels, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m256 b = _mm256_permute_ps(pixels, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m256 a = _mm256_permute_ps(pixels, _MM_SHUFFLE(3, 3, 3, 3));
+
+    // Same arithmetic as the SSE implementation (i.e. no fused multiply-add) so the results do
+    // not depend on the instruction set nor on the pixel layout (refer to ApplyMatrixPlanar()).
+    const __m256 rm0 = _mm256_mul_ps(ctx.m0, r);
+    const __m256 gm1 = _mm256_mul_ps(ctx.m1, g);
+    const __m256 bm2 = _mm256_mul_ps(ctx.m2, b);
+    const __m256 am3 = _mm256_mul_ps(ctx.m3, a);
+
+    const __m256 img = _mm256_add_ps(_mm256_add_ps(rm0, gm1), _mm256_add_ps(bm2, am3));
+    return hasOffsets ? _mm256_add_ps(img, ctx.offsets) : img;
+}
+
+// The last pixel (if any) uses the same arithmetic with a 128-bit register so that the result
+// does not depend on the position of the pixel in the buffer.
+template<bool hasOffsets>
+static inline __m128 apply_matrix_single_avx2(const MatrixContextAVX2 & ctx, __m128 pixel)
+{
+    const __m128 r = _mm_permute_ps(pixel, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 g = _mm_permute_ps(pixel, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 b = _mm_permute_ps(pixel, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m128 a = _mm_permute_ps(pixel, _MM_SHUFFLE(3, 3, 3, 3));
+
+    const __m128 m0 = _mm256_castps256_ps128(ctx.m0);
+    const __m128 m1 = _mm256_castps256_ps128(ctx.m1);
+    const __m128 m2 = _mm256_castps256_ps128(ctx.m2);
+    const __m128 m3 = _mm256_castps256_ps128(ctx.m3);
+
+    const __m128 rm0 = _mm_mul_ps(m0, r);
+    const __m128 gm1 = _mm_mul_ps(m1, g);
+    const __m128 bm2 = _mm_mul_ps(m2, b);
+    const __m128 am3 = _mm_mul_ps(m3, a);
+
+    const __m128 img = _mm_add_ps(_mm_add_ps(rm0, gm1), _mm_add_ps(bm2, am3));
+    return hasOffsets ? _mm_add_ps(img, _mm256_castps256_ps128(ctx.offsets)) : img;
+}
+
+template<bool hasOffsets>
+static inline void matrix_avx2(const float * matrix, const float * offsets,
+                               const float * src, float * dst, long numPixels)
+{
+    MatrixContextAVX2 ctx;
+    ctx.m0 = load_lanes_avx2(matrix);
+    ctx.m1 = load_lanes_avx2(matrix + 4);
+    ctx.m2 = load_lanes_avx2(matrix + 8);
+    ctx.m3 = load_lanes_avx2(matrix + 12);
+    ctx.offsets = hasOffsets ? load_lanes_avx2(offsets) : _mm256_setzero_ps();
+
+    const long pixel_count = numPixels / 4 * 4;
+
+    // Four pixels per iteration to hide the latency of the multiplications and additions.
+    for (long i = 0; i < pixel_count; i += 4)
+    {
+        const __m256 p0 = _mm256_loadu_ps(src);
+        const __m256 p1 = _mm256_loadu_ps(src + 8);
+
+        _mm256_storeu_ps(dst,     apply_matrix_avx2<hasOffsets>(ctx, p0));
+        _mm256_storeu_ps(dst + 8, apply_matrix_avx2<hasOffsets>(ctx, p1));
+
+        src += 16;
+        dst += 16;
+    }
+
+    long remainder = numPixels - pixel_count;
+
+    if (remainder >= 2)
+    {
+        _mm256_storeu_ps(dst, apply_matrix_avx2<hasOffsets>(ctx, _mm256_loadu_ps(src)));
+
+        src += 8;
+        dst += 8;
+        remainder -= 2;
+    }
+
+    if (remainder == 1)
+    {
+        _mm_storeu_ps(dst, apply_matrix_single_avx2<hasOffsets>(ctx, _mm_loadu_ps(src)));
+    }
+}
+
+template<bool hasOffsets>
+static inline void scale_avx2(const float * scales, const float * offsets,
+                              const float * src, float * dst, long numPixels)
+{
+    const __m256 s = load_lanes_avx2(scales);
+    const __m256 o = hasOffsets ? load_lanes_avx2(offsets) : _mm256_setzero_ps();
+
+    const long pixel_count = numPixels / 2 * 2;
+
+    for (long i = 0; i < pixel_count; i += 2)
+    {
+        const __m256 pixels = _mm256_loadu_ps(src);
+
+        _mm256_storeu_ps(dst, hasOffsets ? _mm256_add_ps(_mm256_mul_ps(pixels, s), o)
+                                         : _mm256_mul_ps(pixels, s));
+
+        src += 8;
+        dst += 8;
+    }
+
+    if (numPixels != pixel_count)
+    {
+        const __m128 pixel = _mm_loadu_ps(src);
+        const __m128 s4 = _mm256_castps256_ps128(s);
+
+        _mm_storeu_ps(dst, hasOffsets ? _mm_add_ps(_mm_mul_ps(pixel, s4),
+                                                   _mm256_castps256_ps128(o))
+                                      : _mm_mul_ps(pixel, s4));
+    }
+}
+
+} // anonymous namespace
+
+void applyMatrixAVX2(const float * matrix, const float * offsets,
+                     const float * src, float * dst, long numPixels)
+{
+    if (offsets)
+    {
+        matrix_avx2<true>(matrix, offsets, src, dst, numPixels);
+    }
+    else
+    {
+        matrix_avx2<false>(matrix, offsets, src, dst, numPixels);
+    }
+}
+
+void applyScaleAVX2(const float * scales, const float * offsets,
+                    const float * src, float * dst, long numPixels)
+{
+    if (offsets)
+    {
+        scale_avx2<true>(scales, offsets, src, dst, numPixels);
+    }
+    else
+    {
+        scale_avx2<false>(scales, offsets, src, dst, numPixels);
+    }
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_MATRIXOP_CPU_AVX2_H
+#define INCLUDED_OCIO_MATRIXOP_CPU_AVX2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+#if OCIO_USE_AVX2
+namespace OCIO_NAMESPACE
+{
+
+// The matrix is stored per column i.e. the red, green, blue and then alpha multipliers. The
+// offsets could be null.
+void applyMatrixAVX2(const float * matrix, const float * offsets,
+                     const float * src, float * dst, long numPixels);
+
+// The offsets could be null.
+void applyScaleAVX2(const float * scales, const float * offsets,
+                    const float * src, float * dst, long numPixels);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
+
+#endif /* INCLUDED_OCIO_MATRIXOP_CPU_AVX2_H */
@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "MatrixOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+// All the 128-bit lanes hold the four values i.e. the same parameters for four RGBA pixels.
+static inline __m512 load_lanes_avx512(const float * values)
+{
+    return _mm512_broadcast_f32x4(_mm_loadu_ps(values));
+}
+
+struct MatrixContextAVX512 {
+    __m512 m0, m1, m2, m3;
+    __m512 offsets;
+};
+
+// Process four RGBA pixels i.e. one per 128-bit lane.
+template<bool hasOffsets>
+static inline __m512 apply_matrix_avx512(const MatrixContextAVX512 & ctx, __m512 pixels)
+{
+    const __m512 r = _mm512_permute_ps(pixels, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m512 g = _mm512_permute_ps(pixels, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m512 b = _mm512_permute_ps(pixels, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m512 a = _mm512_permute_ps(pixels, _MM_SHUFFLE(3, 3, 3, 3));
+
+    // Same arithmetic as the SSE implementation (i.e. no fused multiply-add) so the results do
+    // not depend on the instruction set nor on the pixel layout (refer to ApplyMatrixPlanar()).
+    const __m512 rm0 = _mm512_mul_ps(ctx.m0, r);
+    const __m512 gm1 = _mm512_mul_ps(ctx.m1, g);
+    const __m512 bm2 = _mm512_mul_ps(ctx.m2, b);
+    const __m512 am3 = _mm512_mul_ps(ctx.m3, a);
+
+    const __m512 img = _mm512_add_ps(_mm512_add_ps(rm0, gm1), _mm512_add_ps(bm2, am3));
+    return hasOffsets ? _mm512_add_ps(img, ctx.offsets) : img;
+}
+
+// Mask of the channels of the first numPixels pixels (i.e. at most three).
+static inline __mmask16 pixel_mask_avx512(long numPixels)
+{
+    return (__mmask16)((1u << (4 * numPixels)) - 1u);
+}
+
+template<bool hasOffsets>
+static inline void matrix_avx512(const float * matrix, const float * offsets,
+                                 const float * src, float * dst, long numPixels)
+{
+    MatrixContextAVX512 ctx;
+    ctx.m0 = load_lanes_avx512(matrix);
+    ctx.m1 = load_lanes_avx512(matrix + 4);
+    ctx.m2 = load_lanes_avx512(matrix + 8);
+    ctx.m3 = load_lanes_avx512(matrix + 12);
+    ctx.offsets = hasOffsets ? load_lanes_avx512(offsets) : _mm512_setzero_ps();
+
+    const long pixel_count = numPixels / 8 * 8;
+
+    // Eight pixels per iteration to hide the latency of the multiplications and additions.
+    for (long i = 0; i < pixel_count; i += 8)
+    {
+        const __m512 p0 = _mm512_loadu_ps(src);
+        const __m512 p1 = _mm512_loadu_ps(src + 16);
+
+        _mm512_storeu_ps(dst,      apply_matrix_avx512<hasOffsets>(ctx, p0));
+        _mm512_storeu_ps(dst + 16, apply_matrix_avx512<hasOffsets>(ctx, p1));
+
+        src += 32;
+        dst += 32;
+    }
+
+    long remainder = numPixels - pixel_count;
+
+    if (remainder >= 4)
+    {
+        _mm512_storeu_ps(dst, apply_matrix_avx512<hasOffsets>(ctx, _mm512_loadu_ps(src)));
+
+        src += 16;
+        dst += 16;
+        remainder -= 4;
+    }
+
+    if (remainder > 0)
+    {
+        const __mmask16 mask = pixel_mask_avx512(remainder);
+        const __m512 pixels = _mm512_maskz_loadu_ps(mask, src);
+
+        _mm512_mask_storeu_ps(dst, mask, apply_matrix_avx512<hasOffsets>(ctx, pixels));
+    }
+}
+
+template<bool hasOffsets>
+static inline void scale_avx512(const float * scales, const float * offsets,
+                                const float * src, float * dst, long numPixels)
+{
+    const __m512 s = load_lanes_avx512(scales);
+    const __m512 o = hasOffsets ? load_lanes_avx512(offsets) : _mm512_setzero_ps();
+
+    const long pixel_count = numPixels / 4 * 4;
+
+    for (long i = 0; i < pixel_count; i += 4)
+    {
+        const __m512 pixels = _mm512_loadu_ps(src);
+
+        _mm512_storeu_ps(dst, hasOffsets ? _mm512_add_ps(_mm512_mul_ps(pixels, s), o)
+                                         : _mm512_mul_ps(pixels, s));
+
+        src += 16;
+        dst += 16;
+    }
+
+    const long remainder = numPixels - pixel_count;
+
+    if (remainder > 0)
+    {
+        const __mmask16 mask = pixel_mask_avx512(remainder);
+        const __m512 pixels = _mm512_maskz_loadu_ps(mask, src);
+
+        _mm512_mask_storeu_ps(dst, mask, hasOffsets ? _mm512_add_ps(_mm512_mul_ps(pixels, s), o)
+                                                    : _mm512_mul_ps(pixels, s));
+    }
+}
+
+} // anonymous namespace
+
+void applyMatrixAVX512(const float * matrix, const float * offsets,
+                       const float * src, float * dst, long numPixels)
+{
+    if (offsets)
+    {
+        matrix_avx512<true>(matrix, offsets, src, dst, numPixels);
+    }
+    else
+    {
+        matrix_avx512<false>(matrix, offsets, src, dst, numPixels);
+    }
+}
+
+void applyScaleAVX512(const float * scales, const float * offsets,
+                      const float * src, float * dst, long numPixels)
+{
+    if (offsets)
+    {
+        scale_avx512<true>(scales, offsets, src, dst, numPixels);
+    }
+    else
+    {
+        scale_avx512<false>(scales, offsets, src, dst, numPixels);
+    }
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -14,6 +14,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Caching.h"
+#include "DiskCache.h"
 #include "FileTransform.h"
 #include "Logging.h"
 #include "Mutex.h"
@@ -791,15 +792,13 @@ void LoadFileUncached(FileFormat * & returnFormat,
     throw Exception(os.str().c_str());
 }
 
-// We mutex both the main map and each item individually, so that
-// the potentially slow file access wont block other lookups to already
-// existing items. (Loads of the *same* file will mutually block though)
+// The files are loaded without locking the cache, so that the potentially slow file accesses
+// wont block other lookups to already existing items. (Loads of the *same* file wait for the
+// first one though.) Note that the load errors are cached too.
 
 struct FileCacheResult
 {
-    Mutex mutex;
     FileFormat * format = nullptr;
-    bool ready = false;
     bool error = false;
     CachedFileRcPtr cachedFile;
     std::string exceptionText;
@@ -809,12 +808,18 @@ struct FileCacheResult
 
 typedef OCIO_SHARED_PTR<FileCacheResult> FileCacheResultPtr;
 
+size_t GetFileCacheResultSize(const FileCacheResultPtr & result)
+{
+    return sizeof(FileCacheResult) + result->exceptionText.size()
+           + (result->cachedFile ? result->cachedFile->getMemorySize() : 0);
+}
+
 } // namespace
 
 
 // A global file content cache.
 template class GenericCache<std::string, FileCacheResultPtr>;
-GenericCache<std::string, FileCacheResultPtr> g_fileCache;
+GenericCache<std::string, FileCacheResultPtr> g_fileCache(GetFileCacheResultSize);
 
 void GetCachedFileAndFormat(FileFormat * & format,
                             CachedFileRcPtr & cachedFile,
@@ -822,59 +827,42 @@ void GetCachedFileAndFormat(FileFormat * & format,
                             Interpolation interp,
                             const Config& config)
 {
-    // Have a two-mutex approach to decouple the cache entry creation from
-    // the data creation. It was originally done to improve the multi-threaded
-    // file lookup.  Refer to PR #309 for details.
-
-    // Load the file cache ptr from the global map
-    FileCacheResultPtr result;
-    {
-        AutoMutex guard(g_fileCache.lock());
-    
-        if (g_fileCache.isEnabled())
-        {
-            // As the entry is a shared pointer instance, having an empty one
-            // means that the entry does not exist in the cache. So, it provides
-            // a fast existence check.
-            result = g_fileCache[filepath];
-            if (!result)
-            {
-                result = std::make_shared<FileCacheResult>();
-                g_fileCache[filepath] = result;
-            }
-        }
-        else
-        {
-            result = std::make_shared<FileCacheResult>();
-        }
-    }
-
-    // If this file has already been loaded, return the result immediately.
-
-    AutoMutex lock(result->mutex);
-    if (!result->ready)
+    // Load the file, or get the already loaded one.
+    const FileCacheResultPtr result = g_fileCache.getOrCreate(filepath, [&]()
     {
-        result->ready = true;
-        result->error = false;
+        FileCacheResultPtr res = std::make_shared<FileCacheResult>();
 
         try
         {
-            LoadFileUncached(result->format, result->cachedFile, filepath, interp, config);
+            // Try the persistent file cache before parsing the file.
+            DiskCacheEntry diskEntry;
+            const bool useDiskCache = GetDiskCacheEntry(diskEntry, filepath, interp, config);
+            if (!useDiskCache || !LoadDiskCachedFile(res->format, res->cachedFile, diskEntry))
+            {
+                LoadFileUncached(res->format, res->cachedFile, filepath, interp, config);
+
+                if (useDiskCache)
+                {
+                    SaveDiskCachedFile(diskEntry, res->format, res->cachedFile);
+                }
+            }
         }
         catch (std::exception & e)
         {
-            result->error = true;
-            result->exceptionText = e.what();
+            res->error = true;
+            res->exceptionText = e.what();
         }
         catch (...)
         {
-            result->error = true;
+            res->error = true;
             std::ostringstream os;
             os << "An unknown error occurred in LoadFileUncached, ";
             os << filepath;
-            result->exceptionText = os.str();
+            res->exceptionText = os.str();
         }
-    }
+
+        return res;
+    });
 
     if (result->error)
     {
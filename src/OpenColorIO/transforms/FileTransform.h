@@ -20,6 +20,9 @@ namespace OCIO_NAMESPACE
 {
 void ClearFileTransformCaches();
 
+class DiskCacheReader;
+class DiskCacheWriter;
+
 class CachedFile
 {
 public:
@@ -30,6 +33,15 @@ public:
     {
         throw Exception("Not a CDL file format.");
     }
+
+    // Estimate of the memory used by the file content, in bytes (e.g. mostly its LUT arrays).
+    virtual size_t getMemorySize() const { return sizeof(CachedFile); }
+
+protected:
+    static size_t GetMemorySize(const ConstOpDataRcPtr & data)
+    {
+        return data ? data->getMemorySize() : 0;
+    }
 };
 
 typedef OCIO_SHARED_PTR<CachedFile> CachedFileRcPtr;
@@ -102,6 +114,20 @@ public:
         return false;
     }
 
+    // Write the content of a cached file to the persistent file cache (see DiskCache.h). Return
+    // false if the format does not support the persistent file cache.
+    virtual bool writeCachedFile(DiskCacheWriter & /* writer */,
+                                 const CachedFileRcPtr & /* cachedFile */) const
+    {
+        return false;
+    }
+
+    // Read back the content written by writeCachedFile().
+    virtual CachedFileRcPtr readCachedFile(DiskCacheReader & /* reader */) const
+    {
+        return CachedFileRcPtr();
+    }
+
     // For logging purposes.
     std::string getName() const;
 private:
@@ -11,6 +11,8 @@
 #include <cmath>
 #include <limits>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 
 namespace OCIO = OCIO_NAMESPACE;
@@ -173,10 +175,11 @@ int main(int argc, const char **argv)
     bool help = false;
     bool verbose = false;
     signed int testType = -1;
-    std::string transformFile;
+    std::string transformFile, gammaStyle;
     std::string inColorSpace, outColorSpace, display, view;
     std::string inBitDepthStr("f32"), outBitDepthStr("f32");
     unsigned iterations = 50;
+    unsigned numThreads = 0;
     bool nocache = false, nooptim = false;
 
     bool useColorspaces = false;
@@ -198,6 +201,9 @@ int main(int argc, const char **argv)
                                             "2 is pixel-per-pixel and -1 performs all the test types",
                "--transform %s",            &transformFile, 
                                             "Provide the transform file to apply on the image",
+               "--gamma %s",                &gammaStyle,
+                                            "Apply a 2.4 gamma of the given style on the image "\
+                                            "(i.e. basic or moncurve)",
                "--colorspaces %s %s",       &inColorSpace, &outColorSpace,
                                             "Provide the input and output color spaces to apply on the image",
                "--view %s %s %s",           &inColorSpace, &display, &view,
@@ -209,6 +215,9 @@ int main(int argc, const char **argv)
                "--iter %d",                 &iterations, "Provide the number of iterations on the processing. Default is 50",
                "--bitdepths %s %s",         &inBitDepthStr, &outBitDepthStr,
                                             "Provide input and output bit-depths (i.e. ui16, f32). Default is f32",
+               "--threads %d",              &numThreads,
+                                            "Measure the processor cache hits from concurrent threads. "\
+                                            "Default is 0 (i.e. no measure)",
                "--nocache",                 &nocache, 
                                             "Bypass all caches. Default is false",
                "--nooptim",                 &nooptim, 
@@ -293,6 +302,51 @@ int main(int argc, const char **argv)
                 }
             }
         }
+        // Checking for a gamma style i.e. to measure the gamma processing.
+        else if (!gammaStyle.empty())
+        {
+            OCIO::ConfigRcPtr config  = OCIO::Config::CreateRaw()->createEditableCopy();
+            config->setProcessorCacheFlags(nocache ? OCIO::PROCESSOR_CACHE_OFF
+                                                   : OCIO::PROCESSOR_CACHE_DEFAULT);
+
+            OCIO::ConstTransformRcPtr transform;
+            if (gammaStyle == "basic")
+            {
+                OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+                exponent->setValue({ 2.4, 2.4, 2.4, 1.0 });
+                transform = exponent;
+            }
+            else if (gammaStyle == "moncurve")
+            {
+                OCIO::ExponentWithLinearTransformRcPtr exponent
+                    = OCIO::ExponentWithLinearTransform::Create();
+                exponent->setGamma({ 2.4, 2.4, 2.4, 1.0 });
+                exponent->setOffset({ 0.055, 0.055, 0.055, 0.0 });
+                transform = exponent;
+            }
+            else
+            {
+                std::string err("Unsupported gamma style: ");
+                err += gammaStyle;
+                throw OCIO::Exception(err.c_str());
+            }
+
+            std::cout << std::endl;
+            std::cout << "Processing using a " << gammaStyle << " gamma" << std::endl << std::endl;
+
+            CustomMeasure m("Create the processor:\t\t\t", iterations);
+            for (unsigned iter = 0; iter < iterations; ++iter)
+            {
+                if (nocache)
+                {
+                    OCIO::ClearAllCaches();
+                }
+
+                m.resume();
+                processor = config->getProcessor(transform, OCIO::TRANSFORM_DIR_FORWARD);
+                m.pause();
+            }
+        }
         // Checking for an input colorspace or input (display, view) pair.
         else if (!inColorSpace.empty() || (!display.empty() && !view.empty()))
         {
@@ -512,6 +566,44 @@ int main(int argc, const char **argv)
             }
         }
 
+        // Get the CPU & GPU processors from concurrent threads i.e. measure the contention on
+        // the processor caches.
+        if (numThreads > 0)
+        {
+            static constexpr unsigned numCalls = 1000;
+
+            const std::string msg = "Get the processors (" + std::to_string(numThreads)
+                                  + " threads x " + std::to_string(numCalls) + " calls):\t";
+
+            CustomMeasure m(msg.c_str(), iterations);
+
+            for(unsigned iter=0; iter<iterations; ++iter)
+            {
+                std::vector<std::thread> threads;
+                threads.reserve(numThreads);
+
+                m.resume();
+                for (unsigned idx = 0; idx < numThreads; ++idx)
+                {
+                    threads.emplace_back([&]()
+                    {
+                        for (unsigned call = 0; call < numCalls; ++call)
+                        {
+                            optProcessor->getOptimizedCPUProcessor(inBitDepth,
+                                                                   outBitDepth,
+                                                                   optimFlags);
+                            optProcessor->getOptimizedGPUProcessor(optimFlags);
+                        }
+                    });
+                }
+                for (auto & thread : threads)
+                {
+                    thread.join();
+                }
+                m.pause();
+            }
+        }
+
         std::cout << std::endl << std::endl;
         std::cout << "Image processing statistics:" << std::endl << std::endl;
 
@@ -90,6 +90,42 @@ written to the dstImgDesc image, leaving srcImgDesc unchanged.
     pointer. The dedicated packed ``apply*`` methods utilize 
     ``ImageDesc`` on the C++ side so avoid the copy.
 
+)doc")
+        .def("apply", [](CPUProcessorRcPtr & self, PyImageDesc & imgDesc, unsigned numThreads) 
+            {
+                self->apply((*imgDesc.m_img), numThreads);
+            },
+             "imgDesc"_a, "numThreads"_a,
+             py::call_guard<py::gil_scoped_release>(), 
+             R"doc(
+Apply to an image using several threads. The image is split in bands 
+of scanlines processed concurrently by numThreads threads. A value of 0 
+uses all the hardware threads. Image values are modified in place.
+
+.. note::
+    The GIL is released during processing, freeing up Python to execute 
+    other threads concurrently.
+
+)doc")
+        .def("apply", [](CPUProcessorRcPtr & self, 
+                         PyImageDesc & srcImgDesc, 
+                         PyImageDesc & dstImgDesc,
+                         unsigned numThreads)
+            {
+                self->apply((*srcImgDesc.m_img), (*dstImgDesc.m_img), numThreads);
+            },
+             "srcImgDesc"_a, "dstImgDesc"_a, "numThreads"_a,
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+Apply to an image using several threads. The image is split in bands 
+of scanlines processed concurrently by numThreads threads. A value of 0 
+uses all the hardware threads. Modified srcImgDesc image values are 
+written to the dstImgDesc image, leaving srcImgDesc unchanged.
+
+.. note::
+    The GIL is released during processing, freeing up Python to execute 
+    other threads concurrently.
+
 )doc")
         .def("applyRGB", [](CPUProcessorRcPtr & self, py::buffer & data) 
             {
@@ -40,6 +40,18 @@ PYBIND11_MODULE(PyOpenColorIO, m)
     // Global functions
     m.def("ClearAllCaches", &ClearAllCaches,
           DOC(PyOpenColorIO, ClearAllCaches));
+    m.def("SetCacheMaxEntries", &SetCacheMaxEntries, "maxEntries"_a,
+          DOC(PyOpenColorIO, SetCacheMaxEntries));
+    m.def("GetCacheMaxEntries", &GetCacheMaxEntries,
+          DOC(PyOpenColorIO, GetCacheMaxEntries));
+    m.def("SetCacheMaxMemorySize", &SetCacheMaxMemorySize, "maxMemorySize"_a,
+          DOC(PyOpenColorIO, SetCacheMaxMemorySize));
+    m.def("GetCacheMaxMemorySize", &GetCacheMaxMemorySize,
+          DOC(PyOpenColorIO, GetCacheMaxMemorySize));
+    m.def("SetFileCacheDirectory", &SetFileCacheDirectory, "directory"_a,
+          DOC(PyOpenColorIO, SetFileCacheDirectory));
+    m.def("GetFileCacheDirectory", &GetFileCacheDirectory,
+          DOC(PyOpenColorIO, GetFileCacheDirectory));
     m.def("GetVersion", &GetVersion,
           DOC(PyOpenColorIO, GetVersion));
     m.def("GetVersionHex", &GetVersionHex,
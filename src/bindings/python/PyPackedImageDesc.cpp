@@ -6,6 +6,28 @@
 namespace OCIO_NAMESPACE
 {
 
+namespace
+{
+
+// The words of the packed formats are either 32-bit (i.e. one per pixel) or 16-bit ones (i.e.
+// one per channel).
+void checkPackedFormatBuffer(const py::buffer_info & info, PackedFormat packedFormat,
+                             py::ssize_t numPixels)
+{
+    if (packedFormat == PACKED_FORMAT_DPX_RGB12)
+    {
+        checkBufferType(info, py::dtype("uint16"));
+        checkBufferSize(info, numPixels*3);
+    }
+    else
+    {
+        checkBufferType(info, py::dtype("uint32"));
+        checkBufferSize(info, numPixels);
+    }
+}
+
+} // namespace
+
 void bindPyPackedImageDesc(py::module & m)
 {
     auto clsPackedImageDesc = 
@@ -98,10 +120,56 @@ void bindPyPackedImageDesc(py::module & m)
              "data"_a, "width"_a, "height"_a, "chanOrder"_a, "bitDepth"_a, "chanStrideBytes"_a, 
              "xStrideBytes"_a, "yStrideBytes"_a,
              DOC(PackedImageDesc, PackedImageDesc, 4))
+        .def(py::init([](py::buffer & data,
+                         long width, long height,
+                         PackedFormat packedFormat)
+            {
+                PyPackedImageDesc * p = new PyPackedImageDesc();
+                p->m_data[0] = data;
+
+                py::buffer_info info = p->m_data[0].request();
+                checkPackedFormatBuffer(info, packedFormat, width*height);
+
+                p->m_img = std::make_shared<PackedImageDesc>(info.ptr, width, height, packedFormat);
+
+                return p;
+            }),
+             "data"_a, "width"_a, "height"_a, "packedFormat"_a,
+             DOC(PackedImageDesc, PackedImageDesc, 5))
+        .def(py::init([](py::buffer & data,
+                         long width, long height,
+                         PackedFormat packedFormat,
+                         ptrdiff_t xStrideBytes,
+                         ptrdiff_t yStrideBytes)
+            {
+                PyPackedImageDesc * p = new PyPackedImageDesc();
+                p->m_data[0] = data;
+
+                py::buffer_info info = p->m_data[0].request();
+                checkPackedFormatBuffer(info, packedFormat, width*height);
+
+                p->m_img = std::make_shared<PackedImageDesc>(info.ptr,
+                                                             width, height,
+                                                             packedFormat,
+                                                             xStrideBytes,
+                                                             yStrideBytes);
+                return p;
+            }),
+             "data"_a, "width"_a, "height"_a, "packedFormat"_a, "xStrideBytes"_a,
+             "yStrideBytes"_a,
+             DOC(PackedImageDesc, PackedImageDesc, 6))
         
         .def("getData", [](const PyPackedImageDesc & self) 
             {
                 PackedImageDescRcPtr p = self.getImg();
+                if (p->getChanStrideBytes() == 0)
+                {
+                    // The channels are packed in 32-bit words.
+                    return py::array(py::dtype("uint32"),
+                                     { p->getHeight() * p->getWidth() },
+                                     { p->getXStrideBytes() },
+                                     p->getData());
+                }
                 return py::array(bitDepthToDtype(p->getBitDepth()), 
                                  { p->getHeight() * p->getWidth() * p->getNumChannels() },
                                  { p->getChanStrideBytes() },
@@ -113,6 +181,11 @@ void bindPyPackedImageDesc(py::module & m)
                 return self.getImg()->getChannelOrder();
             },
              DOC(PackedImageDesc, getChannelOrder))
+        .def("getPackedFormat", [](const PyPackedImageDesc & self)
+            {
+                return self.getImg()->getPackedFormat();
+            },
+             DOC(PackedImageDesc, getPackedFormat))
         .def("getNumChannels", [](const PyPackedImageDesc & self) 
             {
                 return self.getImg()->getNumChannels();
@@ -89,6 +89,12 @@ void bindPyProcessor(py::module & m)
              (ConstCPUProcessorRcPtr (Processor::*)(BitDepth, BitDepth, OptimizationFlags) const) 
              &Processor::getOptimizedCPUProcessor, 
              "inBitDepth"_a, "outBitDepth"_a, "oFlags"_a,
+             DOC(Processor, getOptimizedCPUProcessor))
+        .def("getOptimizedCPUProcessor", 
+             (ConstCPUProcessorRcPtr (Processor::*)(BitDepth, BitDepth, OptimizationFlags,
+                                                    unsigned, float) const) 
+             &Processor::getOptimizedCPUProcessor, 
+             "inBitDepth"_a, "outBitDepth"_a, "oFlags"_a, "bakeLutSize"_a, "bakeLutMaxError"_a,
              DOC(Processor, getOptimizedCPUProcessor));
 
     clsTransformFormatMetadataIterator
@@ -495,6 +495,20 @@ void bindPyTypes(py::module & m)
                DOC(PyOpenColorIO, ChannelOrdering, CHANNEL_ORDERING_BGR))
         .export_values();
 
+    py::enum_<PackedFormat>(
+        m, "PackedFormat",
+        DOC(PyOpenColorIO, PackedFormat))
+
+        .value("PACKED_FORMAT_NONE", PACKED_FORMAT_NONE,
+               DOC(PyOpenColorIO, PackedFormat, PACKED_FORMAT_NONE))
+        .value("PACKED_FORMAT_RGB10_A2", PACKED_FORMAT_RGB10_A2,
+               DOC(PyOpenColorIO, PackedFormat, PACKED_FORMAT_RGB10_A2))
+        .value("PACKED_FORMAT_DPX_RGB10", PACKED_FORMAT_DPX_RGB10,
+               DOC(PyOpenColorIO, PackedFormat, PACKED_FORMAT_DPX_RGB10))
+        .value("PACKED_FORMAT_DPX_RGB12", PACKED_FORMAT_DPX_RGB12,
+               DOC(PyOpenColorIO, PackedFormat, PACKED_FORMAT_DPX_RGB12))
+        .export_values();
+
     py::enum_<Allocation>(
         m, "Allocation", 
         DOC(PyOpenColorIO, Allocation))
@@ -737,6 +751,10 @@ void bindPyTypes(py::module & m)
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_SIMPLIFY_OPS))
         .value("OPTIMIZATION_NO_DYNAMIC_PROPERTIES", OPTIMIZATION_NO_DYNAMIC_PROPERTIES, 
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_NO_DYNAMIC_PROPERTIES))
+        .value("OPTIMIZATION_BAKE_LUT", OPTIMIZATION_BAKE_LUT, 
+               DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_BAKE_LUT))
+        .value("OPTIMIZATION_INTEGER_LOOKUP", OPTIMIZATION_INTEGER_LOOKUP, 
+               DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_INTEGER_LOOKUP))
         .value("OPTIMIZATION_ALL", OPTIMIZATION_ALL, 
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_ALL))
         .value("OPTIMIZATION_LOSSLESS", OPTIMIZATION_LOSSLESS, 
@@ -851,6 +869,9 @@ void bindPyTypes(py::module & m)
     m.attr("OCIO_ACTIVE_VIEWS_ENVVAR") = OCIO_ACTIVE_VIEWS_ENVVAR;
     m.attr("OCIO_INACTIVE_COLORSPACES_ENVVAR") = OCIO_INACTIVE_COLORSPACES_ENVVAR;
     m.attr("OCIO_OPTIMIZATION_FLAGS_ENVVAR") = OCIO_OPTIMIZATION_FLAGS_ENVVAR;
+    m.attr("OCIO_BAKE_LUT_SIZE_ENVVAR") = OCIO_BAKE_LUT_SIZE_ENVVAR;
+    m.attr("OCIO_BAKE_LUT_MAX_ERROR_ENVVAR") = OCIO_BAKE_LUT_MAX_ERROR_ENVVAR;
+    m.attr("OCIO_INTEGER_LOOKUP_SIZE_ENVVAR") = OCIO_INTEGER_LOOKUP_SIZE_ENVVAR;
     m.attr("OCIO_USER_CATEGORIES_ENVVAR") = OCIO_USER_CATEGORIES_ENVVAR;
 
     // Roles
@@ -882,6 +903,9 @@ void bindPyTypes(py::module & m)
     m.attr("OCIO_DISABLE_ALL_CACHES") = OCIO_DISABLE_ALL_CACHES;
     m.attr("OCIO_DISABLE_PROCESSOR_CACHES") = OCIO_DISABLE_PROCESSOR_CACHES;
     m.attr("OCIO_DISABLE_CACHE_FALLBACK") = OCIO_DISABLE_CACHE_FALLBACK;
+    m.attr("OCIO_CACHE_MAX_ENTRIES") = OCIO_CACHE_MAX_ENTRIES;
+    m.attr("OCIO_CACHE_MAX_MEMORY_SIZE") = OCIO_CACHE_MAX_MEMORY_SIZE;
+    m.attr("OCIO_FILE_CACHE_DIR") = OCIO_FILE_CACHE_DIR;
 
     m.attr("OCIO_CONFIG_DEFAULT_NAME") = OCIO_CONFIG_DEFAULT_NAME;
     m.attr("OCIO_CONFIG_DEFAULT_FILE_EXT") = OCIO_CONFIG_DEFAULT_FILE_EXT;
@@ -6,6 +6,7 @@
 #if OCIO_USE_AVX2
 
 #include <sstream>
+#include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -13,6 +14,11 @@
 #include "MathUtils.h"
 #include "BitDepthUtils.h"
 #include "AVX2.h"
+#include "ops/cdl/CDLOpCPU_AVX2.h"
+#include "ops/gamma/GammaOpCPU_AVX2.h"
+#include "ops/gamma/GammaOpUtils.h"
+#include "ops/log/LogOpCPU_AVX2.h"
+#include "ops/matrix/MatrixOpCPU_AVX2.h"
 #include "testutils/UnitTest.h"
 
 namespace OCIO = OCIO_NAMESPACE;
@@ -458,4 +464,318 @@ DEFINE_SIMD_TEST(packed_all_test)
     }
 }
 
+namespace
+{
+
+// Reference implementation i.e. the matrix is stored per column.
+void ApplyMatrixRef(const float * matrix, const float * offsets,
+                    const float * src, float * dst, long numPixels)
+{
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        for (int channel = 0; channel < 4; ++channel)
+        {
+            dst[channel] = src[0] * matrix[channel]
+                         + src[1] * matrix[4 + channel]
+                         + src[2] * matrix[8 + channel]
+                         + src[3] * matrix[12 + channel]
+                         + (offsets ? offsets[channel] : 0.0f);
+        }
+
+        src += 4;
+        dst += 4;
+    }
+}
+
+void ApplyScaleRef(const float * scales, const float * offsets,
+                   const float * src, float * dst, long numPixels)
+{
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        for (int channel = 0; channel < 4; ++channel)
+        {
+            dst[channel] = src[channel] * scales[channel] + (offsets ? offsets[channel] : 0.0f);
+        }
+
+        src += 4;
+        dst += 4;
+    }
+}
+
+typedef void (ApplyFunc)(const float *, const float *, const float *, float *, long);
+
+void TestMatrixFunc(ApplyFunc * func, ApplyFunc * ref, const float * params)
+{
+    const float offsets[4] = { 0.1f, -0.2f, 0.3f, 0.05f };
+
+    // Cover all the remainders of the unrolled loops.
+    for (long numPixels = 1; numPixels <= 19; ++numPixels)
+    {
+        std::vector<float> src(numPixels * 4);
+        for (size_t idx = 0; idx < src.size(); ++idx)
+        {
+            src[idx] = -0.5f + float(idx % 23) * 0.25f;
+        }
+
+        for (const float * o : { (const float *)nullptr, offsets })
+        {
+            std::vector<float> expected(src.size());
+            ref(params, o, src.data(), expected.data(), numPixels);
+
+            // The values after the last pixel must not be modified.
+            std::vector<float> dst(src.size() + 4, -1.0f);
+            func(params, o, src.data(), dst.data(), numPixels);
+
+            for (size_t idx = 0; idx < expected.size(); ++idx)
+            {
+                OCIO_CHECK_CLOSE(dst[idx], expected[idx], 1e-5f);
+            }
+            for (size_t idx = expected.size(); idx < dst.size(); ++idx)
+            {
+                OCIO_CHECK_EQUAL(dst[idx], -1.0f);
+            }
+
+            // In-place processing.
+            std::vector<float> img(src);
+            func(params, o, img.data(), img.data(), numPixels);
+
+            for (size_t idx = 0; idx < expected.size(); ++idx)
+            {
+                OCIO_CHECK_EQUAL(img[idx], dst[idx]);
+            }
+        }
+    }
+}
+
+} // anon.
+
+DEFINE_SIMD_TEST(matrix_test)
+{
+    const float matrix[16] = { 1.1f,  0.2f, -0.3f, 0.0f,
+                               0.4f,  0.9f,  0.1f, 0.0f,
+                              -0.2f,  0.3f,  1.2f, 0.0f,
+                               0.0f,  0.0f,  0.1f, 1.0f };
+
+    TestMatrixFunc(OCIO::applyMatrixAVX2, ApplyMatrixRef, matrix);
+}
+
+DEFINE_SIMD_TEST(scale_test)
+{
+    const float scales[4] = { 1.5f, 0.5f, -2.0f, 0.75f };
+
+    TestMatrixFunc(OCIO::applyScaleAVX2, ApplyScaleRef, scales);
+}
+
+DEFINE_SIMD_TEST(cdl_test)
+{
+    const OCIO::CDLOpData::ChannelParams slope(1.35, 1.1, 0.71);
+    const OCIO::CDLOpData::ChannelParams offset(0.05, -0.23, 0.11);
+    const OCIO::CDLOpData::ChannelParams power(0.93, 0.81, 1.27);
+
+    for (auto style : { OCIO::CDLOpData::CDL_V1_2_FWD, OCIO::CDLOpData::CDL_V1_2_REV,
+                        OCIO::CDLOpData::CDL_NO_CLAMP_FWD, OCIO::CDLOpData::CDL_NO_CLAMP_REV })
+    {
+        OCIO::ConstCDLOpDataRcPtr cdl
+            = std::make_shared<OCIO::CDLOpData>(style, slope, offset, power, 1.23);
+
+        OCIO::RenderParams params;
+        params.update(cdl);
+
+        // The reference uses the precise power function.
+        OCIO::ConstOpCPURcPtr ref = OCIO::GetCDLCPURenderer(cdl, false);
+
+        // Cover all the remainders of the main loop.
+        for (long numPixels = 1; numPixels <= 37; ++numPixels)
+        {
+            std::vector<float> src(numPixels * 4);
+            for (size_t idx = 0; idx < src.size(); ++idx)
+            {
+                src[idx] = -0.2f + float(idx % 29) * 0.05f;
+            }
+
+            std::vector<float> expected(src.size());
+            ref->apply(src.data(), expected.data(), numPixels);
+
+            std::vector<float> dst(src.size());
+            OCIO::applyCDLAVX2(params, src.data(), dst.data(), numPixels);
+
+            for (size_t idx = 0; idx < expected.size(); ++idx)
+            {
+                OCIO_CHECK_CLOSE(dst[idx], expected[idx], 1e-4f);
+            }
+
+            // In-place processing.
+            OCIO::applyCDLAVX2(params, src.data(), src.data(), numPixels);
+
+            for (size_t idx = 0; idx < expected.size(); ++idx)
+            {
+                OCIO_CHECK_EQUAL(src[idx], dst[idx]);
+            }
+        }
+    }
+}
+
+DEFINE_SIMD_TEST(log_test)
+{
+    OCIO::LogRenderParams params;
+    for (int i = 0; i < 3; ++i)
+    {
+        params.m_scale[i]        = 0.9f + 0.1f * i;
+        params.m_offset[i]       = 0.01f * (i + 1);
+        params.m_logScale[i]     = 0.25f - 0.02f * i;
+        params.m_logOffset[i]    = 0.6f + 0.05f * i;
+        params.m_break[i]        = 0.1f + 0.02f * i;
+        params.m_linearScale[i]  = 3.1f + 0.2f * i;
+        params.m_linearOffset[i] = 0.07f * (i + 1);
+    }
+
+    // Scalar version of the generic forms documented by LogRenderParams.
+    auto ref = [&params](bool lin2log, int i, float in)
+    {
+        if (params.m_hasBreak && !(in > params.m_break[i]))
+        {
+            return lin2log ? in * params.m_linearScale[i] + params.m_linearOffset[i]
+                           : (in + params.m_linearOffset[i]) * params.m_linearScale[i];
+        }
+
+        if (lin2log)
+        {
+            const float val = std::max(std::numeric_limits<float>::min(),
+                                       in * params.m_scale[i] + params.m_offset[i]);
+            return std::log2(val) * params.m_logScale[i] + params.m_logOffset[i];
+        }
+
+        return (std::exp2((in + params.m_logOffset[i]) * params.m_logScale[i])
+                + params.m_offset[i]) * params.m_scale[i];
+    };
+
+    for (bool hasBreak : { false, true })
+    {
+        params.m_hasBreak = hasBreak;
+
+        for (bool lin2log : { true, false })
+        {
+            // Cover all the remainders of the main loop.
+            for (long numPixels = 1; numPixels <= 37; ++numPixels)
+            {
+                std::vector<float> src(numPixels * 4);
+                for (size_t idx = 0; idx < src.size(); ++idx)
+                {
+                    src[idx] = -0.2f + float(idx % 29) * 0.05f;
+                }
+
+                std::vector<float> dst(src.size());
+                if (lin2log)
+                {
+                    OCIO::applyLin2LogAVX2(params, src.data(), dst.data(), numPixels);
+                }
+                else
+                {
+                    OCIO::applyLog2LinAVX2(params, src.data(), dst.data(), numPixels);
+                }
+
+                for (size_t idx = 0; idx < src.size(); ++idx)
+                {
+                    const int channel = int(idx % 4);
+                    const float expected
+                        = channel == 3 ? src[idx] : ref(lin2log, channel, src[idx]);
+
+                    OCIO_CHECK_CLOSE(dst[idx], expected, 1e-4f);
+                }
+            }
+        }
+    }
+}
+
+DEFINE_SIMD_TEST(gamma_test)
+{
+    typedef OCIO::GammaRenderParams RP;
+
+    const OCIO::GammaOpData::Params red{ 2.4, 0.055 };
+    const OCIO::GammaOpData::Params grn{ 2.2, 0.099 };
+    const OCIO::GammaOpData::Params blu{ 1.8, 0.02 };
+    const OCIO::GammaOpData::Params alp{ 2.6, 0.04 };
+
+    const std::vector<std::pair<OCIO::GammaOpData::Style, RP::Style>> styles{
+        { OCIO::GammaOpData::BASIC_FWD,           RP::BASIC },
+        { OCIO::GammaOpData::BASIC_REV,           RP::BASIC },
+        { OCIO::GammaOpData::BASIC_MIRROR_FWD,    RP::BASIC_MIRROR },
+        { OCIO::GammaOpData::BASIC_PASS_THRU_REV, RP::BASIC_PASS_THRU },
+        { OCIO::GammaOpData::MONCURVE_FWD,        RP::MONCURVE_FWD },
+        { OCIO::GammaOpData::MONCURVE_REV,        RP::MONCURVE_REV },
+        { OCIO::GammaOpData::MONCURVE_MIRROR_FWD, RP::MONCURVE_MIRROR_FWD },
+        { OCIO::GammaOpData::MONCURVE_MIRROR_REV, RP::MONCURVE_MIRROR_REV } };
+
+    for (const auto & style : styles)
+    {
+        const bool moncurve = style.second >= RP::MONCURVE_FWD;
+        const bool fwd = style.first == OCIO::GammaOpData::BASIC_FWD
+                         || style.first == OCIO::GammaOpData::BASIC_MIRROR_FWD
+                         || style.first == OCIO::GammaOpData::MONCURVE_FWD
+                         || style.first == OCIO::GammaOpData::MONCURVE_MIRROR_FWD;
+
+        OCIO::ConstGammaOpDataRcPtr gamma
+            = moncurve ? std::make_shared<OCIO::GammaOpData>(style.first, red, grn, blu, alp)
+                       : std::make_shared<OCIO::GammaOpData>(style.first,
+                                                             OCIO::GammaOpData::Params{ red[0] },
+                                                             OCIO::GammaOpData::Params{ grn[0] },
+                                                             OCIO::GammaOpData::Params{ blu[0] },
+                                                             OCIO::GammaOpData::Params{ alp[0] });
+
+        const OCIO::GammaOpData::Params * channels[4] = { &red, &grn, &blu, &alp };
+
+        RP params;
+        params.m_style = style.second;
+        for (int i = 0; i < 4; ++i)
+        {
+            if (moncurve)
+            {
+                OCIO::RendererParams rParams;
+                if (fwd)
+                {
+                    OCIO::ComputeParamsFwd(*channels[i], rParams);
+                }
+                else
+                {
+                    OCIO::ComputeParamsRev(*channels[i], rParams);
+                }
+
+                params.m_gamma[i]    = rParams.gamma;
+                params.m_scale[i]    = rParams.scale;
+                params.m_offset[i]   = rParams.offset;
+                params.m_breakPnt[i] = rParams.breakPnt;
+                params.m_slope[i]    = rParams.slope;
+            }
+            else
+            {
+                params.m_gamma[i] = float(fwd ? (*channels[i])[0] : 1. / (*channels[i])[0]);
+            }
+        }
+
+        // The reference uses the precise power function.
+        OCIO::ConstOpCPURcPtr ref = OCIO::GetGammaRenderer(gamma, false);
+
+        // Cover all the remainders of the main loop.
+        for (long numPixels = 1; numPixels <= 37; ++numPixels)
+        {
+            std::vector<float> src(numPixels * 4);
+            for (size_t idx = 0; idx < src.size(); ++idx)
+            {
+                src[idx] = -0.2f + float(idx % 29) * 0.05f;
+            }
+
+            std::vector<float> expected(src.size());
+            ref->apply(src.data(), expected.data(), numPixels);
+
+            std::vector<float> dst(src.size());
+            OCIO::applyGammaAVX2(params, src.data(), dst.data(), numPixels);
+
+            for (size_t idx = 0; idx < expected.size(); ++idx)
+            {
+                OCIO_CHECK_CLOSE(dst[idx], expected[idx], 1e-4f);
+            }
+        }
+    }
+}
+
 #endif // OCIO_USE_AVX
\ No newline at end of file
@@ -6,8 +6,11 @@
 
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut1d/Lut1DOpData.h"
+#include "ops/exponent/ExponentOp.h"
+#include "ops/range/RangeOp.h"
 #include "ScanlineHelper.h"
 #include "testutils/UnitTest.h"
+#include "UnitTestLogUtils.h"
 #include "UnitTestUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
@@ -2908,3 +2911,1736 @@ OCIO_ADD_TEST(CPUProcessor, optimizations)
                                                                __LINE__);
     }
 }
+
+OCIO_ADD_TEST(CPUProcessor, apply_multithreaded)
+{
+    // Validate that the multi-threaded apply gives the same results than the single-threaded one.
+
+    constexpr long width  = 317;
+    constexpr long height = 121;
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double offset4[4] = { 0.1, 0.2, 0.3, 0.4 };
+    matrix->setOffset(offset4);
+    group->appendTransform(matrix);
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double exp4[4] = { 2.2, 2.4, 2.6, 1.0 };
+    exponent->setValue(exp4);
+    group->appendTransform(exponent);
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+
+    {
+        // In-place processing of a packed RGBA F32 image.
+
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+        OCIO_CHECK_NO_THROW(cpuProcessor = processor->getDefaultCPUProcessor());
+
+        std::vector<float> img(width * height * 4);
+        for (size_t idx = 0; idx < img.size(); ++idx)
+        {
+            img[idx] = float(idx % 1031) / 1031.0f;
+        }
+
+        std::vector<float> refImg = img;
+        OCIO::PackedImageDesc refImgDesc(&refImg[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(refImgDesc));
+
+        for (unsigned numThreads : { 0u, 1u, 3u, 16u, 1000u })
+        {
+            std::vector<float> resImg = img;
+            OCIO::PackedImageDesc resImgDesc(&resImg[0], width, height, 4);
+            OCIO_CHECK_NO_THROW(cpuProcessor->apply(resImgDesc, numThreads));
+
+            OCIO_CHECK_ASSERT(refImg == resImg);
+        }
+    }
+
+    {
+        // Processing from a packed RGB uint16 image to a planar F32 image.
+
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+        OCIO_CHECK_NO_THROW(cpuProcessor
+            = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT16,
+                                                  OCIO::BIT_DEPTH_F32,
+                                                  OCIO::OPTIMIZATION_DEFAULT));
+
+        std::vector<uint16_t> img(width * height * 3);
+        for (size_t idx = 0; idx < img.size(); ++idx)
+        {
+            img[idx] = uint16_t((idx * 37) % 65536);
+        }
+
+        OCIO::PackedImageDesc srcImgDesc(&img[0], width, height, 3, OCIO::BIT_DEPTH_UINT16,
+                                         OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+
+        std::vector<float> refImg(width * height * 3);
+        OCIO::PlanarImageDesc refImgDesc(&refImg[0],
+                                         &refImg[width * height],
+                                         &refImg[2 * width * height],
+                                         nullptr,
+                                         width, height);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcImgDesc, refImgDesc));
+
+        for (unsigned numThreads : { 0u, 1u, 4u })
+        {
+            std::vector<float> resImg(width * height * 3);
+            OCIO::PlanarImageDesc resImgDesc(&resImg[0],
+                                             &resImg[width * height],
+                                             &resImg[2 * width * height],
+                                             nullptr,
+                                             width, height);
+            OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcImgDesc, resImgDesc, numThreads));
+
+            OCIO_CHECK_ASSERT(refImg == resImg);
+        }
+    }
+
+    {
+        // The source and destination images must have the same dimensions.
+
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+        OCIO_CHECK_NO_THROW(cpuProcessor = processor->getDefaultCPUProcessor());
+
+        std::vector<float> src(width * height * 4);
+        std::vector<float> dst(width * (height - 1) * 4);
+
+        OCIO::PackedImageDesc srcImgDesc(&src[0], width, height, 4);
+        OCIO::PackedImageDesc dstImgDesc(&dst[0], width, height - 1, 4);
+
+        OCIO_CHECK_THROW_WHAT(cpuProcessor->apply(srcImgDesc, dstImgDesc, 4),
+                              OCIO::Exception,
+                              "Dimension inconsistency between source and destination image "
+                              "buffers.");
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, scanline_helper_pool)
+{
+    OCIO::ConstOpCPURcPtr inBitDepthOp
+        = OCIO::CreateGenericBitDepthHelper(OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_F32);
+    OCIO::ConstOpCPURcPtr outBitDepthOp
+        = OCIO::CreateGenericBitDepthHelper(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_UINT8);
+
+    // Note that the pool keeps at most one helper per hardware thread.
+    const size_t maxHelpers = OCIO::GetNumWorkerThreads(0);
+
+    OCIO::ScanlineHelperPool pool;
+    pool.reset(OCIO::BIT_DEPTH_UINT8, inBitDepthOp, OCIO::BIT_DEPTH_UINT8, outBitDepthOp);
+    OCIO_CHECK_EQUAL(pool.size(), 0);
+
+    // A released helper is re-used.
+
+    std::unique_ptr<OCIO::ScanlineHelper> helper1 = pool.acquire();
+    std::unique_ptr<OCIO::ScanlineHelper> helper2 = pool.acquire();
+    OCIO_REQUIRE_ASSERT(helper1 && helper2);
+    OCIO_CHECK_NE(helper1.get(), helper2.get());
+
+    const OCIO::ScanlineHelper * ptr = helper1.get();
+    pool.release(std::move(helper1));
+    OCIO_CHECK_EQUAL(pool.size(), 1);
+
+    helper1 = pool.acquire();
+    OCIO_CHECK_EQUAL(helper1.get(), ptr);
+    OCIO_CHECK_EQUAL(pool.size(), 0);
+
+    pool.release(std::move(helper1));
+    pool.release(std::move(helper2));
+    OCIO_CHECK_EQUAL(pool.size(), std::min<size_t>(2, maxHelpers));
+
+    // The pool size is bounded.
+
+    OCIO::ScanlineHelperVec helpers;
+    for (size_t idx = 0; idx < maxHelpers + 2; ++idx)
+    {
+        helpers.push_back(pool.acquire());
+    }
+    OCIO_CHECK_EQUAL(pool.size(), 0);
+
+    for (auto & helper : helpers)
+    {
+        pool.release(std::move(helper));
+    }
+    OCIO_CHECK_EQUAL(pool.size(), maxHelpers);
+
+    // A reset discards the pooled helpers.
+
+    pool.reset(OCIO::BIT_DEPTH_UINT8, inBitDepthOp, OCIO::BIT_DEPTH_UINT8, outBitDepthOp);
+    OCIO_CHECK_EQUAL(pool.size(), 0);
+}
+
+OCIO_ADD_TEST(CPUProcessor, scanline_helper_reuse)
+{
+    // Validate that re-using the scanline helpers (and their buffers) of a processor between
+    // apply calls with different image layouts gives the expected results.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double exp4[4] = { 2.2, 2.4, 2.6, 1.0 };
+    exponent->setValue(exp4);
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(exponent));
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW(cpuProcessor
+        = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT8,
+                                              OCIO::BIT_DEPTH_F32,
+                                              OCIO::OPTIMIZATION_DEFAULT));
+
+    auto processImage = [&cpuProcessor](long width, long height, long numChannels)
+    {
+        std::vector<uint8_t> img(width * height * numChannels);
+        for (size_t idx = 0; idx < img.size(); ++idx)
+        {
+            img[idx] = uint8_t((idx * 7) % 256);
+        }
+
+        std::vector<float> res(width * height * numChannels, -1.0f);
+
+        OCIO::PackedImageDesc srcImgDesc(&img[0], width, height, numChannels,
+                                         OCIO::BIT_DEPTH_UINT8,
+                                         OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        OCIO::PackedImageDesc dstImgDesc(&res[0], width, height, numChannels);
+
+        cpuProcessor->apply(srcImgDesc, dstImgDesc);
+
+        return res;
+    };
+
+    std::vector<float> ref, res;
+    OCIO_CHECK_NO_THROW(ref = processImage(64, 3, 3));
+
+    // Use the pooled helper with a smaller and then a wider image.
+    OCIO_CHECK_NO_THROW(res = processImage(16, 5, 4));
+    OCIO_CHECK_NO_THROW(res = processImage(128, 2, 4));
+
+    OCIO_CHECK_NO_THROW(res = processImage(64, 3, 3));
+    OCIO_CHECK_ASSERT(ref == res);
+}
+
+OCIO_ADD_TEST(CPUProcessor, apply_by_pixel_blocks)
+{
+    // Validate that processing the scanlines by blocks of pixels gives the same results
+    // whatever the block size is.
+
+    OCIO_CHECK_GE(OCIO::GetDefaultPixelBlockSize(), 256);
+
+    constexpr long width  = 67;
+    constexpr long height = 5;
+
+    OCIO::OpRcPtrVec rawOps;
+    constexpr double m44[16] = { 1.1, 0.2, 0.3, 0.0,
+                                 0.1, 0.9, 0.0, 0.0,
+                                 0.0, 0.1, 1.2, 0.0,
+                                 0.0, 0.0, 0.0, 1.0 };
+    constexpr double offset4[4] = { 0.1, 0.2, 0.3, 0.0 };
+    OCIO::CreateMatrixOffsetOp(rawOps, m44, offset4, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::CreateExponentOp(rawOps, { 2.2, 2.4, 2.6, 1.0 }, OCIO::TRANSFORM_DIR_FORWARD);
+
+    auto processImage = [&rawOps](OCIO::BitDepth inBD, OCIO::BitDepth outBD,
+                                  const OCIO::ImageDesc & srcImgDesc,
+                                  OCIO::ImageDesc & dstImgDesc,
+                                  long blockSize)
+    {
+        OCIO::OpRcPtrVec ops;
+        OCIO::FinalizeOpsForCPU(ops, rawOps, inBD, outBD, OCIO::OPTIMIZATION_NONE);
+
+        OCIO::ConstOpCPURcPtr inBitDepthOp, outBitDepthOp;
+        OCIO::ConstOpCPURcPtrVec cpuOps;
+        OCIO::CPUProgram program;
+        OCIO::CreateCPUEngine(ops, inBD, outBD, OCIO::OPTIMIZATION_NONE,
+                              inBitDepthOp, cpuOps, outBitDepthOp, program);
+
+        std::unique_ptr<OCIO::ScanlineHelper>
+            scanlineBuilder(OCIO::CreateScanlineHelper(inBD, inBitDepthOp, outBD, outBitDepthOp));
+
+        scanlineBuilder->setPixelBlockSize(blockSize);
+        scanlineBuilder->init(srcImgDesc, dstImgDesc);
+
+        OCIO::ProcessScanlines(*scanlineBuilder, cpuOps);
+    };
+
+    {
+        // From a planar RGB uint16 image to a packed RGBA F32 image.
+
+        std::vector<uint16_t> img(width * height * 3);
+        for (size_t idx = 0; idx < img.size(); ++idx)
+        {
+            img[idx] = uint16_t((idx * 37) % 65536);
+        }
+
+        OCIO::PlanarImageDesc srcImgDesc(&img[0],
+                                         &img[width * height],
+                                         &img[2 * width * height],
+                                         nullptr,
+                                         width, height,
+                                         OCIO::BIT_DEPTH_UINT16,
+                                         OCIO::AutoStride, OCIO::AutoStride);
+
+        std::vector<float> refImg(width * height * 4, -1.0f);
+        OCIO::PackedImageDesc refImgDesc(&refImg[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(processImage(OCIO::BIT_DEPTH_UINT16, OCIO::BIT_DEPTH_F32,
+                                         srcImgDesc, refImgDesc, width));
+
+        for (long blockSize : { 1L, 4L, 16L, 66L, 1000L })
+        {
+            std::vector<float> resImg(width * height * 4, -1.0f);
+            OCIO::PackedImageDesc resImgDesc(&resImg[0], width, height, 4);
+            OCIO_CHECK_NO_THROW(processImage(OCIO::BIT_DEPTH_UINT16, OCIO::BIT_DEPTH_F32,
+                                             srcImgDesc, resImgDesc, blockSize));
+
+            OCIO_CHECK_ASSERT(refImg == resImg);
+        }
+    }
+
+    {
+        // From a packed RGBA F32 image to a packed BGR uint8 image.
+
+        std::vector<float> img(width * height * 4);
+        for (size_t idx = 0; idx < img.size(); ++idx)
+        {
+            img[idx] = float(idx % 1031) / 1031.0f;
+        }
+
+        OCIO::PackedImageDesc srcImgDesc(&img[0], width, height, 4);
+
+        std::vector<uint8_t> refImg(width * height * 3, 0);
+        OCIO::PackedImageDesc refImgDesc(&refImg[0], width, height, OCIO::CHANNEL_ORDERING_BGR,
+                                         OCIO::BIT_DEPTH_UINT8,
+                                         OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        OCIO_CHECK_NO_THROW(processImage(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_UINT8,
+                                         srcImgDesc, refImgDesc, width));
+
+        for (long blockSize : { 1L, 4L, 16L, 66L, 1000L })
+        {
+            std::vector<uint8_t> resImg(width * height * 3, 0);
+            OCIO::PackedImageDesc resImgDesc(&resImg[0], width, height,
+                                             OCIO::CHANNEL_ORDERING_BGR,
+                                             OCIO::BIT_DEPTH_UINT8,
+                                             OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+            OCIO_CHECK_NO_THROW(processImage(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_UINT8,
+                                             srcImgDesc, resImgDesc, blockSize));
+
+            OCIO_CHECK_ASSERT(refImg == resImg);
+        }
+    }
+
+    {
+        // In-place processing of a packed RGBA F32 image.
+
+        std::vector<float> img(width * height * 4);
+        for (size_t idx = 0; idx < img.size(); ++idx)
+        {
+            img[idx] = float(idx % 1031) / 1031.0f;
+        }
+
+        std::vector<float> refImg = img;
+        OCIO::PackedImageDesc refImgDesc(&refImg[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(processImage(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                         refImgDesc, refImgDesc, width));
+
+        for (long blockSize : { 1L, 4L, 16L, 66L, 1000L })
+        {
+            std::vector<float> resImg = img;
+            OCIO::PackedImageDesc resImgDesc(&resImg[0], width, height, 4);
+            OCIO_CHECK_NO_THROW(processImage(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                             resImgDesc, resImgDesc, blockSize));
+
+            OCIO_CHECK_ASSERT(refImg == resImg);
+        }
+    }
+
+    {
+        // A block size changed after init() is only used by the next init() call i.e. the
+        // buffers sized by init() must not be overflowed.
+
+        std::vector<float> img(width * height * 4);
+        for (size_t idx = 0; idx < img.size(); ++idx)
+        {
+            img[idx] = float(idx % 1031) / 1031.0f;
+        }
+
+        OCIO::PackedImageDesc srcImgDesc(&img[0], width, height, 4);
+
+        std::vector<uint8_t> refImg(width * height * 3, 0);
+        OCIO::PackedImageDesc refImgDesc(&refImg[0], width, height, OCIO::CHANNEL_ORDERING_BGR,
+                                         OCIO::BIT_DEPTH_UINT8,
+                                         OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        OCIO_CHECK_NO_THROW(processImage(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_UINT8,
+                                         srcImgDesc, refImgDesc, width));
+
+        OCIO::OpRcPtrVec ops;
+        OCIO::FinalizeOpsForCPU(ops, rawOps, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_UINT8,
+                                OCIO::OPTIMIZATION_NONE);
+
+        OCIO::ConstOpCPURcPtr inBitDepthOp, outBitDepthOp;
+        OCIO::ConstOpCPURcPtrVec cpuOps;
+        OCIO::CPUProgram program;
+        OCIO::CreateCPUEngine(ops, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_UINT8,
+                              OCIO::OPTIMIZATION_NONE,
+                              inBitDepthOp, cpuOps, outBitDepthOp, program);
+
+        std::unique_ptr<OCIO::ScanlineHelper>
+            scanlineBuilder(OCIO::CreateScanlineHelper(OCIO::BIT_DEPTH_F32, inBitDepthOp,
+                                                       OCIO::BIT_DEPTH_UINT8, outBitDepthOp));
+
+        std::vector<uint8_t> resImg(width * height * 3, 0);
+        OCIO::PackedImageDesc resImgDesc(&resImg[0], width, height, OCIO::CHANNEL_ORDERING_BGR,
+                                         OCIO::BIT_DEPTH_UINT8,
+                                         OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+
+        scanlineBuilder->setPixelBlockSize(4);
+        scanlineBuilder->init(srcImgDesc, resImgDesc);
+        scanlineBuilder->setPixelBlockSize(width);
+
+        float * buffer = nullptr;
+        long numPixels = 0;
+        scanlineBuilder->prepRGBAScanline(&buffer, numPixels);
+        OCIO_CHECK_EQUAL(numPixels, 4);
+        for (const auto & op : cpuOps)
+        {
+            op->apply(buffer, buffer, numPixels);
+        }
+        scanlineBuilder->finishRGBAScanline();
+
+        OCIO_CHECK_NO_THROW(OCIO::ProcessScanlines(*scanlineBuilder, cpuOps));
+        OCIO_CHECK_ASSERT(refImg == resImg);
+
+        // The new size is now used.
+        std::fill(resImg.begin(), resImg.end(), uint8_t(0));
+        scanlineBuilder->init(srcImgDesc, resImgDesc);
+        scanlineBuilder->prepRGBAScanline(&buffer, numPixels);
+        OCIO_CHECK_EQUAL(numPixels, width);
+    }
+
+    OCIO::ConstOpCPURcPtr bitDepthOp
+        = OCIO::CreateGenericBitDepthHelper(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32);
+
+    std::unique_ptr<OCIO::ScanlineHelper>
+        scanlineBuilder(OCIO::CreateScanlineHelper(OCIO::BIT_DEPTH_F32, bitDepthOp,
+                                                   OCIO::BIT_DEPTH_F32, bitDepthOp));
+    OCIO_CHECK_THROW_WHAT(scanlineBuilder->setPixelBlockSize(0),
+                          OCIO::Exception,
+                          "Invalid pixel block size.");
+}
+
+namespace
+{
+
+// Restore the default bake settings when going out of scope.
+class BakeLutEnvGuard
+{
+public:
+    BakeLutEnvGuard(const char * size, const char * maxError)
+    {
+        OCIO::SetEnvVariable(OCIO::OCIO_BAKE_LUT_SIZE_ENVVAR, size);
+        OCIO::SetEnvVariable(OCIO::OCIO_BAKE_LUT_MAX_ERROR_ENVVAR, maxError);
+    }
+    ~BakeLutEnvGuard()
+    {
+        OCIO::UnsetEnvVariable(OCIO::OCIO_BAKE_LUT_SIZE_ENVVAR);
+        OCIO::UnsetEnvVariable(OCIO::OCIO_BAKE_LUT_MAX_ERROR_ENVVAR);
+    }
+};
+
+} // anon.
+
+OCIO_ADD_TEST(CPUProcessor, bake_lut)
+{
+    BakeLutEnvGuard guard("", "");
+
+    OCIO::OpRcPtrVec rawOps;
+    OCIO::CreateExponentOp(rawOps, { 1.0 / 2.4, 1.0 / 2.4, 1.0 / 2.4, 1.0 }, OCIO::TRANSFORM_DIR_FORWARD);
+
+    // The same ops but clamping the values outside of the shaper domain.
+    OCIO::OpRcPtrVec clampedOps;
+    OCIO::CreateRangeOp(clampedOps, 0.0, 16384.0, 0.0, 16384.0, OCIO::TRANSFORM_DIR_FORWARD);
+    clampedOps += rawOps;
+
+    const OCIO::OptimizationFlags oFlags
+        = OCIO::OptimizationFlags(OCIO::OPTIMIZATION_DEFAULT | OCIO::OPTIMIZATION_BAKE_LUT);
+
+    {
+        // A float input bit-depth needs a shaper.
+
+        OCIO::OpRcPtrVec ops;
+        OCIO_CHECK_NO_THROW(OCIO::FinalizeOpsForCPU(ops, clampedOps, OCIO::BIT_DEPTH_F32,
+                                                    OCIO::BIT_DEPTH_F32, oFlags));
+        OCIO_REQUIRE_EQUAL(ops.size(), 2);
+        OCIO::ConstOpRcPtr op0 = ops[0];
+        OCIO::ConstOpRcPtr op1 = ops[1];
+        OCIO_CHECK_EQUAL(op0->data()->getType(), OCIO::OpData::Lut1DType);
+        OCIO_CHECK_EQUAL(op1->data()->getType(), OCIO::OpData::Lut3DType);
+
+        auto lut = OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(op1->data());
+        OCIO_REQUIRE_ASSERT(lut);
+        OCIO_CHECK_EQUAL(lut->getGridSize(), 65);
+
+        const std::vector<float> pixels{ 0.0f,    0.001f, 0.01f,  0.5f,
+                                         0.18f,   0.5f,   0.9f,   1.0f,
+                                         -1.0f,   2.5f,   10.0f,  0.0f,
+                                         1e5f,    0.3f,   0.02f,  0.25f };
+
+        std::vector<float> expected(pixels);
+        clampedOps[0]->apply(expected.data(), 4);
+        clampedOps[1]->apply(expected.data(), 4);
+
+        std::vector<float> baked(pixels);
+        ops[0]->apply(baked.data(), 4);
+        ops[1]->apply(baked.data(), 4);
+
+        for (size_t idx = 0; idx < pixels.size(); ++idx)
+        {
+            OCIO_CHECK_CLOSE(expected[idx], baked[idx], 1e-2f * std::max(1.0f, expected[idx]));
+        }
+    }
+
+    {
+        // An integer input bit-depth only needs a 3D LUT (i.e. the power function is steep
+        // near zero without a shaper).
+
+        BakeLutEnvGuard sizeGuard("33", "0.1");
+
+        OCIO::OpRcPtrVec ops;
+        OCIO_CHECK_NO_THROW(OCIO::FinalizeOpsForCPU(ops, rawOps, OCIO::BIT_DEPTH_UINT10,
+                                                    OCIO::BIT_DEPTH_F32,
+                                                    OCIO::OPTIMIZATION_BAKE_LUT));
+        OCIO_REQUIRE_EQUAL(ops.size(), 1);
+        OCIO::ConstOpRcPtr op0 = ops[0];
+
+        auto lut = OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(op0->data());
+        OCIO_REQUIRE_ASSERT(lut);
+        OCIO_CHECK_EQUAL(lut->getGridSize(), 33);
+    }
+
+    {
+        // The bake is discarded when the highlights clamped by the shaper are not clamped by
+        // the ops.
+
+        OCIO::OpRcPtrVec ops;
+        OCIO_CHECK_NO_THROW(OCIO::FinalizeOpsForCPU(ops, rawOps, OCIO::BIT_DEPTH_F32,
+                                                    OCIO::BIT_DEPTH_F32, oFlags));
+        OCIO_REQUIRE_EQUAL(ops.size(), 1);
+        OCIO::ConstOpRcPtr op0 = ops[0];
+        OCIO_CHECK_EQUAL(op0->data()->getType(), OCIO::OpData::ExponentType);
+    }
+
+    {
+        // The bake is discarded when the negative values clamped by the shaper are not clamped
+        // by the ops.
+
+        OCIO::OpRcPtrVec offsetOps;
+        constexpr double offset4[4] = { 0.1, 0.1, 0.1, 0.0 };
+        OCIO::CreateOffsetOp(offsetOps, offset4, OCIO::TRANSFORM_DIR_FORWARD);
+        offsetOps += clampedOps;
+
+        OCIO::OpRcPtrVec ops;
+        OCIO_CHECK_NO_THROW(OCIO::FinalizeOpsForCPU(ops, offsetOps, OCIO::BIT_DEPTH_F32,
+                                                    OCIO::BIT_DEPTH_F32, oFlags));
+        OCIO_REQUIRE_EQUAL(ops.size(), 3);
+        OCIO::ConstOpRcPtr op0 = ops[0];
+        OCIO_CHECK_EQUAL(op0->data()->getType(), OCIO::OpData::MatrixType);
+    }
+
+    {
+        // The bake is discarded when the error is too large.
+
+        BakeLutEnvGuard errorGuard("", "1e-7");
+
+        OCIO::OpRcPtrVec ops;
+        OCIO_CHECK_NO_THROW(OCIO::FinalizeOpsForCPU(ops, rawOps, OCIO::BIT_DEPTH_F32,
+                                                    OCIO::BIT_DEPTH_F32, oFlags));
+        OCIO_REQUIRE_EQUAL(ops.size(), 1);
+        OCIO::ConstOpRcPtr op0 = ops[0];
+        OCIO_CHECK_EQUAL(op0->data()->getType(), OCIO::OpData::ExponentType);
+    }
+
+    {
+        // The bake is discarded when the alpha is modified as the LUTs only pass it through.
+
+        OCIO::OpRcPtrVec alphaOps(rawOps);
+        constexpr double m44[16] = { 1.0, 0.0, 0.0, 0.0,
+                                     0.0, 1.0, 0.0, 0.0,
+                                     0.0, 0.0, 1.0, 0.0,
+                                     0.0, 0.0, 0.0, 0.5 };
+        constexpr double offset4[4] = { 0.0, 0.0, 0.0, 0.0 };
+        OCIO::CreateMatrixOffsetOp(alphaOps, m44, offset4, OCIO::TRANSFORM_DIR_FORWARD);
+
+        OCIO::OpRcPtrVec ops;
+        OCIO_CHECK_NO_THROW(OCIO::FinalizeOpsForCPU(ops, alphaOps, OCIO::BIT_DEPTH_F32,
+                                                    OCIO::BIT_DEPTH_F32, oFlags));
+        OCIO_REQUIRE_EQUAL(ops.size(), 2);
+        OCIO::ConstOpRcPtr op0 = ops[0];
+        OCIO::ConstOpRcPtr op1 = ops[1];
+        OCIO_CHECK_EQUAL(op0->data()->getType(), OCIO::OpData::ExponentType);
+        OCIO_CHECK_EQUAL(op1->data()->getType(), OCIO::OpData::MatrixType);
+    }
+
+    {
+        // A matrix is not worth baking.
+
+        OCIO::OpRcPtrVec matrixOps;
+        constexpr double m44[16] = { 1.1, 0.2, 0.3, 0.0,
+                                     0.1, 0.9, 0.0, 0.0,
+                                     0.0, 0.1, 1.2, 0.0,
+                                     0.0, 0.0, 0.0, 1.0 };
+        constexpr double offset4[4] = { 0.1, 0.2, 0.3, 0.0 };
+        OCIO::CreateMatrixOffsetOp(matrixOps, m44, offset4, OCIO::TRANSFORM_DIR_FORWARD);
+
+        OCIO::OpRcPtrVec ops;
+        OCIO_CHECK_NO_THROW(OCIO::FinalizeOpsForCPU(ops, matrixOps, OCIO::BIT_DEPTH_F32,
+                                                    OCIO::BIT_DEPTH_F32, oFlags));
+        OCIO_REQUIRE_EQUAL(ops.size(), 1);
+        OCIO::ConstOpRcPtr op0 = ops[0];
+        OCIO_CHECK_EQUAL(op0->data()->getType(), OCIO::OpData::MatrixType);
+    }
+
+    {
+        // The settings provided by the API are overridden by the env. variables.
+
+        OCIO::OpRcPtrVec ops;
+        OCIO_CHECK_NO_THROW(OCIO::FinalizeOpsForCPU(ops, rawOps, OCIO::BIT_DEPTH_UINT10,
+                                                    OCIO::BIT_DEPTH_F32,
+                                                    OCIO::OPTIMIZATION_BAKE_LUT, 33, 0.1f));
+        OCIO_REQUIRE_EQUAL(ops.size(), 1);
+        OCIO::ConstOpRcPtr op0 = ops[0];
+        auto lut = OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(op0->data());
+        OCIO_REQUIRE_ASSERT(lut);
+        OCIO_CHECK_EQUAL(lut->getGridSize(), 33);
+
+        BakeLutEnvGuard sizeGuard("17", "");
+
+        OCIO_CHECK_NO_THROW(OCIO::FinalizeOpsForCPU(ops, rawOps, OCIO::BIT_DEPTH_UINT10,
+                                                    OCIO::BIT_DEPTH_F32,
+                                                    OCIO::OPTIMIZATION_BAKE_LUT, 33, 0.1f));
+        OCIO_REQUIRE_EQUAL(ops.size(), 1);
+        op0 = ops[0];
+        lut = OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(op0->data());
+        OCIO_REQUIRE_ASSERT(lut);
+        OCIO_CHECK_EQUAL(lut->getGridSize(), 17);
+    }
+
+    {
+        // Invalid env. variables are ignored.
+
+        OCIO::LogGuard logGuard;
+
+        BakeLutEnvGuard invalidGuard("130", "-1");
+
+        OCIO::OpRcPtrVec ops;
+        OCIO_CHECK_NO_THROW(OCIO::FinalizeOpsForCPU(ops, clampedOps, OCIO::BIT_DEPTH_F32,
+                                                    OCIO::BIT_DEPTH_F32, oFlags));
+        OCIO_REQUIRE_EQUAL(ops.size(), 2);
+        OCIO::ConstOpRcPtr op1 = ops[1];
+
+        auto lut = OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(op1->data());
+        OCIO_REQUIRE_ASSERT(lut);
+        OCIO_CHECK_EQUAL(lut->getGridSize(), 65);
+
+        OCIO_CHECK_ASSERT(logGuard.findAndRemove(
+            "Invalid value '130' for the env. variable 'OCIO_BAKE_LUT_SIZE', it must be in "
+            "[2, 129]. The value 65 is used."));
+        OCIO_CHECK_ASSERT(logGuard.findAndRemove(
+            "Invalid value '-1' for the env. variable 'OCIO_BAKE_LUT_MAX_ERROR', it must be a "
+            "positive number. The value 0.01 is used."));
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, bake_lut_settings)
+{
+    BakeLutEnvGuard guard("", "");
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    // A color transformation with channel crosstalk i.e. not replaced by a 1D LUT for integer
+    // input bit-depths.
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m44[16] = { 0.8, 0.1, 0.1, 0.0,
+                                 0.1, 0.8, 0.1, 0.0,
+                                 0.1, 0.1, 0.8, 0.0,
+                                 0.0, 0.0, 0.0, 1.0 };
+    matrix->setMatrix(m44);
+    group->appendTransform(matrix);
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double exp4[4] = { 1.0 / 2.4, 1.0 / 2.4, 1.0 / 2.4, 1.0 };
+    exponent->setValue(exp4);
+    group->appendTransform(exponent);
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+
+    OCIO::ConstCPUProcessorRcPtr cpu33;
+    OCIO_CHECK_NO_THROW(cpu33 = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT10,
+                                                                    OCIO::BIT_DEPTH_F32,
+                                                                    OCIO::OPTIMIZATION_DRAFT,
+                                                                    33, 0.1f));
+    OCIO::ConstCPUProcessorRcPtr cpu17;
+    OCIO_CHECK_NO_THROW(cpu17 = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT10,
+                                                                    OCIO::BIT_DEPTH_F32,
+                                                                    OCIO::OPTIMIZATION_DRAFT,
+                                                                    17, 0.1f));
+
+    // The settings are part of the processor cache key.
+    OCIO_CHECK_NE(std::string(cpu33->getCacheID()), std::string(cpu17->getCacheID()));
+
+    {
+        // The env. variable overrides the grid size provided by the API.
+
+        BakeLutEnvGuard sizeGuard("17", "");
+
+        OCIO::ConstCPUProcessorRcPtr cpu;
+        OCIO_CHECK_NO_THROW(cpu = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT10,
+                                                                      OCIO::BIT_DEPTH_F32,
+                                                                      OCIO::OPTIMIZATION_DRAFT,
+                                                                      65, 0.1f));
+        OCIO_CHECK_EQUAL(std::string(cpu->getCacheID()), std::string(cpu17->getCacheID()));
+    }
+
+    OCIO_CHECK_THROW_WHAT(processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT10,
+                                                              OCIO::BIT_DEPTH_F32,
+                                                              OCIO::OPTIMIZATION_DRAFT,
+                                                              1, 0.1f),
+                          OCIO::Exception,
+                          "Invalid bake LUT size '1', it must be in [2, 129].");
+    OCIO_CHECK_THROW_WHAT(processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT10,
+                                                              OCIO::BIT_DEPTH_F32,
+                                                              OCIO::OPTIMIZATION_DRAFT,
+                                                              130, 0.1f),
+                          OCIO::Exception,
+                          "Invalid bake LUT size '130', it must be in [2, 129].");
+    OCIO_CHECK_THROW_WHAT(processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT10,
+                                                              OCIO::BIT_DEPTH_F32,
+                                                              OCIO::OPTIMIZATION_DRAFT,
+                                                              33, 0.0f),
+                          OCIO::Exception,
+                          "Invalid bake LUT maximum error '0', it must be a positive number.");
+}
+
+OCIO_ADD_TEST(CPUProcessor, bit_depth_cast_half)
+{
+    // Whatever the implementation selected for the CPU, the half to float conversions must be
+    // identical to the half class ones.
+
+    OCIO::ConstOpCPURcPtr halfToFloat
+        = OCIO::CreateGenericBitDepthHelper(OCIO::BIT_DEPTH_F16, OCIO::BIT_DEPTH_F32);
+    OCIO::ConstOpCPURcPtr floatToHalf
+        = OCIO::CreateGenericBitDepthHelper(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F16);
+
+    // All the half values.
+    constexpr long numValues = 65536;
+    std::vector<half> halfValues(numValues);
+    for (long idx = 0; idx < numValues; ++idx)
+    {
+        halfValues[idx].setBits((unsigned short)idx);
+    }
+
+    // Some pixel counts are not a multiple of the vector sizes.
+    for (long numPixels : { 1L, 3L, 5L, 7L, 9L, numValues / 4 - 1, numValues / 4 })
+    {
+        const long count = 4 * numPixels;
+
+        // Check for out of bounds writes.
+        std::vector<float> floatValues(count + 4, -1.0f);
+        halfToFloat->apply(halfValues.data(), floatValues.data(), numPixels);
+
+        for (long idx = 0; idx < count; ++idx)
+        {
+            if (halfValues[idx].isNan())
+            {
+                OCIO_CHECK_ASSERT(OCIO::IsNan(floatValues[idx]));
+            }
+            else
+            {
+                OCIO_CHECK_EQUAL(floatValues[idx], float(halfValues[idx]));
+            }
+        }
+        for (long idx = count; idx < count + 4; ++idx)
+        {
+            OCIO_CHECK_EQUAL(floatValues[idx], -1.0f);
+        }
+    }
+
+    // Float values exactly representable by half, the mid-points between consecutive half
+    // values (i.e. to check the rounding) and out of range values.
+    std::vector<float> floatValues;
+    for (long idx = 0; idx < numValues; ++idx)
+    {
+        floatValues.push_back(float(halfValues[idx]));
+        if (idx < numValues - 1)
+        {
+            floatValues.push_back(0.5f * (float(halfValues[idx]) + float(halfValues[idx + 1])));
+        }
+    }
+    floatValues.push_back(1.0e10f);
+    floatValues.push_back(-1.0e10f);
+    floatValues.push_back(1.0e-10f);
+    floatValues.push_back(std::numeric_limits<float>::infinity());
+    floatValues.push_back(std::numeric_limits<float>::quiet_NaN());
+    floatValues.resize(floatValues.size() / 4 * 4);
+
+    const long numFloatPixels = (long)floatValues.size() / 4;
+    for (long numPixels : { 1L, 3L, 5L, 7L, 9L, numFloatPixels - 1, numFloatPixels })
+    {
+        const long count = 4 * numPixels;
+
+        std::vector<half> results(count + 4, half(-1.0f));
+        floatToHalf->apply(floatValues.data(), results.data(), numPixels);
+
+        for (long idx = 0; idx < count; ++idx)
+        {
+            const half expected(floatValues[idx]);
+            if (expected.isNan())
+            {
+                OCIO_CHECK_ASSERT(results[idx].isNan());
+            }
+            else
+            {
+                OCIO_CHECK_EQUAL(results[idx].bits(), expected.bits());
+            }
+        }
+        for (long idx = count; idx < count + 4; ++idx)
+        {
+            OCIO_CHECK_EQUAL(results[idx].bits(), half(-1.0f).bits());
+        }
+    }
+}
+
+namespace
+{
+
+template<OCIO::BitDepth bd>
+void ValidateBitDepthCastInteger()
+{
+    typedef typename OCIO::BitDepthInfo<bd>::Type Type;
+
+    const unsigned maxValue = OCIO::BitDepthInfo<bd>::maxValue;
+
+    OCIO::ConstOpCPURcPtr intToFloat = OCIO::CreateGenericBitDepthHelper(bd, OCIO::BIT_DEPTH_F32);
+    OCIO::ConstOpCPURcPtr floatToInt = OCIO::CreateGenericBitDepthHelper(OCIO::BIT_DEPTH_F32, bd);
+
+    // All the integer values.
+    std::vector<Type> intValues((maxValue + 1 + 3) / 4 * 4);
+    for (size_t idx = 0; idx < intValues.size(); ++idx)
+    {
+        intValues[idx] = Type(idx % (maxValue + 1));
+    }
+
+    const float toFloat = 1.0f / float(maxValue);
+
+    // Some pixel counts are not a multiple of the vector sizes.
+    const long numIntPixels = (long)intValues.size() / 4;
+    for (long numPixels : { 1L, 2L, 3L, 5L, numIntPixels - 1, numIntPixels })
+    {
+        const long count = 4 * numPixels;
+
+        // Check for out of bounds writes.
+        std::vector<float> results(count + 4, -1.0f);
+        intToFloat->apply(intValues.data(), results.data(), numPixels);
+
+        for (long idx = 0; idx < count; ++idx)
+        {
+            OCIO_CHECK_EQUAL(results[idx], float(intValues[idx]) * toFloat);
+        }
+        for (long idx = count; idx < count + 4; ++idx)
+        {
+            OCIO_CHECK_EQUAL(results[idx], -1.0f);
+        }
+    }
+
+    // The float values around all the integer values (i.e. to check the rounding) and some out
+    // of range values.
+    std::vector<float> floatValues;
+    for (unsigned value = 0; value <= maxValue; ++value)
+    {
+        const float f = float(value) / float(maxValue);
+        floatValues.push_back(f);
+        floatValues.push_back(std::nextafter(f, 2.0f));
+        floatValues.push_back((float(value) + 0.5f) / float(maxValue));
+        floatValues.push_back((float(value) - 0.5f) / float(maxValue));
+    }
+    floatValues.push_back(1.0e10f);
+    floatValues.push_back(-1.0e10f);
+    floatValues.push_back(std::numeric_limits<float>::infinity());
+    floatValues.push_back(-std::numeric_limits<float>::infinity());
+    floatValues.push_back(std::numeric_limits<float>::quiet_NaN());
+    floatValues.resize((floatValues.size() + 3) / 4 * 4, 0.25f);
+
+    const long numFloatPixels = (long)floatValues.size() / 4;
+    for (long numPixels : { 1L, 2L, 3L, 5L, numFloatPixels - 1, numFloatPixels })
+    {
+        const long count = 4 * numPixels;
+
+        std::vector<Type> results(count + 4, Type(7));
+        floatToInt->apply(floatValues.data(), results.data(), numPixels);
+
+        for (long idx = 0; idx < count; ++idx)
+        {
+            const float v = floatValues[idx];
+            // A NaN becomes zero.
+            const Type expected
+                = OCIO::IsNan(v) ? Type(0) : OCIO::Converter<bd>::CastValue(v * float(maxValue));
+            OCIO_CHECK_EQUAL(results[idx], expected);
+        }
+        for (long idx = count; idx < count + 4; ++idx)
+        {
+            OCIO_CHECK_EQUAL(results[idx], Type(7));
+        }
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(CPUProcessor, bit_depth_cast_integer)
+{
+    // Whatever the implementation selected for the CPU, the integer to float conversions must be
+    // identical to the scalar ones.
+
+    ValidateBitDepthCastInteger<OCIO::BIT_DEPTH_UINT8>();
+    ValidateBitDepthCastInteger<OCIO::BIT_DEPTH_UINT10>();
+    ValidateBitDepthCastInteger<OCIO::BIT_DEPTH_UINT12>();
+    ValidateBitDepthCastInteger<OCIO::BIT_DEPTH_UINT16>();
+}
+
+namespace
+{
+
+template<OCIO::BitDepth bd>
+void ValidateInterleavedPacking(OCIO::ChannelOrdering chanOrder)
+{
+    typedef typename OCIO::BitDepthInfo<bd>::Type Type;
+
+    // Position of the R, G, B & A channels in a pixel.
+    int chanIndex[4] = { 0, 1, 2, 3 };
+    switch (chanOrder)
+    {
+        case OCIO::CHANNEL_ORDERING_RGBA: break;
+        case OCIO::CHANNEL_ORDERING_BGRA: chanIndex[0] = 2; chanIndex[2] = 0; break;
+        case OCIO::CHANNEL_ORDERING_ABGR: chanIndex[0] = 3; chanIndex[1] = 2;
+                                          chanIndex[2] = 1; chanIndex[3] = 0; break;
+        case OCIO::CHANNEL_ORDERING_RGB:  chanIndex[3] = -1; break;
+        case OCIO::CHANNEL_ORDERING_BGR:  chanIndex[0] = 2; chanIndex[2] = 0;
+                                          chanIndex[3] = -1; break;
+    }
+
+    const long numChannels = chanIndex[3] < 0 ? 3 : 4;
+    const float toFloat = 1.0f / float(OCIO::BitDepthInfo<bd>::maxValue);
+    const Type sentinel = Type(7);
+
+    OCIO::ConstOpCPURcPtr inBitDepthOp  = OCIO::CreateGenericBitDepthHelper(bd, OCIO::BIT_DEPTH_F32);
+    OCIO::ConstOpCPURcPtr outBitDepthOp = OCIO::CreateGenericBitDepthHelper(OCIO::BIT_DEPTH_F32, bd);
+
+    // Some widths are not a multiple of the vector sizes.
+    for (long width : { 1L, 2L, 3L, 5L, 8L, 11L, 37L })
+    {
+        static constexpr long height = 2;
+
+        // Add some padding at the end of the lines to check for out of bounds writes.
+        const long lineValues = width * numChannels + 3;
+        const ptrdiff_t yStrideBytes = lineValues * sizeof(Type);
+
+        std::vector<Type> src(height * lineValues, sentinel);
+        for (long y = 0; y < height; ++y)
+        {
+            for (long idx = 0; idx < width * numChannels; ++idx)
+            {
+                src[y * lineValues + idx] = Type(float((y * 97 + idx * 13) % 251) / 256.0f
+                                                   / toFloat);
+            }
+        }
+
+        OCIO::PackedImageDesc srcImg(src.data(), width, height, chanOrder, bd,
+                                     OCIO::AutoStride, OCIO::AutoStride, yStrideBytes);
+        OCIO::GenericImageDesc srcDesc;
+        srcDesc.init(srcImg, bd, inBitDepthOp);
+
+        std::vector<Type> dst(height * lineValues, sentinel);
+        OCIO::PackedImageDesc dstImg(dst.data(), width, height, chanOrder, bd,
+                                     OCIO::AutoStride, OCIO::AutoStride, yStrideBytes);
+        OCIO::GenericImageDesc dstDesc;
+        dstDesc.init(dstImg, bd, outBitDepthOp);
+
+        std::vector<Type> bitDepthBuffer(4 * width);
+        std::vector<float> rgbaBuffer(4 * width);
+
+        for (long y = 0; y < height; ++y)
+        {
+            // Also start from the middle of the lines.
+            for (long x : { 0L, width / 2 })
+            {
+                const long numPixels = width - x;
+
+                OCIO::Generic<Type>::PackRGBAFromImageDesc(srcDesc,
+                                                           bitDepthBuffer.data(),
+                                                           rgbaBuffer.data(),
+                                                           (int)numPixels,
+                                                           y * width + x);
+
+                for (long pxl = 0; pxl < numPixels; ++pxl)
+                {
+                    for (int chan = 0; chan < 4; ++chan)
+                    {
+                        const float expected
+                            = chanIndex[chan] < 0
+                                ? 0.0f
+                                : float(src[y * lineValues + (x + pxl) * numChannels + chanIndex[chan]])
+                                    * toFloat;
+                        OCIO_CHECK_EQUAL(rgbaBuffer[4 * pxl + chan], expected);
+                    }
+                }
+
+                OCIO::Generic<Type>::UnpackRGBAToImageDesc(dstDesc,
+                                                           rgbaBuffer.data(),
+                                                           bitDepthBuffer.data(),
+                                                           (int)numPixels,
+                                                           y * width + x);
+            }
+        }
+
+        // The channels & the line padding are unchanged.
+        for (size_t idx = 0; idx < src.size(); ++idx)
+        {
+            OCIO_CHECK_EQUAL(float(dst[idx]), float(src[idx]));
+        }
+    }
+}
+
+template<OCIO::BitDepth bd>
+void ValidateInterleavedPacking()
+{
+    ValidateInterleavedPacking<bd>(OCIO::CHANNEL_ORDERING_RGBA);
+    ValidateInterleavedPacking<bd>(OCIO::CHANNEL_ORDERING_BGRA);
+    ValidateInterleavedPacking<bd>(OCIO::CHANNEL_ORDERING_ABGR);
+    ValidateInterleavedPacking<bd>(OCIO::CHANNEL_ORDERING_RGB);
+    ValidateInterleavedPacking<bd>(OCIO::CHANNEL_ORDERING_BGR);
+}
+
+} // anon.
+
+OCIO_ADD_TEST(CPUProcessor, image_packing_interleaved)
+{
+    // Whatever the implementation selected for the CPU, the packing & unpacking of the
+    // interleaved channel orderings must reorder the channels like the generic copy.
+
+    ValidateInterleavedPacking<OCIO::BIT_DEPTH_UINT8>();
+    ValidateInterleavedPacking<OCIO::BIT_DEPTH_UINT10>();
+    ValidateInterleavedPacking<OCIO::BIT_DEPTH_UINT16>();
+    ValidateInterleavedPacking<OCIO::BIT_DEPTH_F16>();
+    ValidateInterleavedPacking<OCIO::BIT_DEPTH_F32>();
+}
+
+namespace
+{
+
+// Build a processor where all the ops could directly process the planar & packed RGB images.
+OCIO::ConstProcessorRcPtr BuildDirectApplyProcessor()
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m44[16] = {  1.10, 0.20, -0.10, 0.05,
+                                  0.10, 0.90,  0.05, 0.00,
+                                 -0.05, 0.10,  1.20, 0.00,
+                                  0.00, 0.00,  0.00, 1.00 };
+    constexpr double offset4[4] = { 0.01, -0.02, 0.03, 0.10 };
+    matrix->setMatrix(m44);
+    matrix->setOffset(offset4);
+    group->appendTransform(matrix);
+
+    constexpr double linSideBreak[3] = { 0.01, 0.01, 0.01 };
+    OCIO::LogCameraTransformRcPtr camLog = OCIO::LogCameraTransform::Create(linSideBreak);
+    camLog->setBase(2.0);
+    camLog->setLogSideSlopeValue({ 0.25, 0.25, 0.25 });
+    camLog->setLogSideOffsetValue({ 0.6, 0.6, 0.6 });
+    camLog->setLinSideSlopeValue({ 1.1, 1.1, 1.1 });
+    camLog->setLinSideOffsetValue({ 0.05, 0.05, 0.05 });
+    group->appendTransform(camLog);
+
+    OCIO::Lut1DTransformRcPtr lut = OCIO::Lut1DTransform::Create(33, false);
+    for (unsigned long idx = 0; idx < 33; ++idx)
+    {
+        const float x = float(idx) / 32.0f;
+        lut->setValue(idx, std::pow(x, 0.8f), std::pow(x, 0.9f), std::pow(x, 1.0f));
+    }
+    group->appendTransform(lut);
+
+    OCIO::LogAffineTransformRcPtr log = OCIO::LogAffineTransform::Create();
+    log->setBase(10.0);
+    log->setLogSideSlopeValue({ 0.5, 0.45, 0.4 });
+    log->setLogSideOffsetValue({ 0.1, 0.12, 0.14 });
+    log->setLinSideSlopeValue({ 1.0, 1.1, 1.2 });
+    log->setLinSideOffsetValue({ 0.02, 0.03, 0.04 });
+    log->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    group->appendTransform(log);
+
+    OCIO::ExponentWithLinearTransformRcPtr moncurve = OCIO::ExponentWithLinearTransform::Create();
+    moncurve->setGamma({ 2.4, 2.2, 2.0, 1.0 });
+    moncurve->setOffset({ 0.055, 0.099, 0.05, 0.0 });
+    moncurve->setNegativeStyle(OCIO::NEGATIVE_MIRROR);
+    group->appendTransform(moncurve);
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    exponent->setValue({ 2.6, 2.2, 1.8, 1.2 });
+    exponent->setNegativeStyle(OCIO::NEGATIVE_PASS_THRU);
+    exponent->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    group->appendTransform(exponent);
+
+    OCIO::MatrixTransformRcPtr scale = OCIO::MatrixTransform::Create();
+    constexpr double scale4[16] = { 0.9, 0.0,  0.0,  0.0,
+                                    0.0, 1.1,  0.0,  0.0,
+                                    0.0, 0.0,  1.05, 0.0,
+                                    0.0, 0.0,  0.0,  0.5 };
+    scale->setMatrix(scale4);
+    group->appendTransform(scale);
+
+    return config->getProcessor(group);
+}
+
+} // anon.
+
+OCIO_ADD_TEST(CPUProcessor, planar_processing)
+{
+    // The 32-bit float planar images are directly processed on their channel planes when all the
+    // ops support it. Validate that the results match the processing of the packed RGBA images.
+
+    constexpr long width     = 37;
+    constexpr long height    = 23;
+    constexpr long numPixels = width * height;
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = BuildDirectApplyProcessor());
+
+    std::vector<float> img(numPixels * 4);
+    for (size_t idx = 0; idx < img.size(); ++idx)
+    {
+        img[idx] = -0.1f + 1.2f * float((idx * 7) % 1031) / 1031.0f;
+    }
+
+    // The planes of the image, followed by the RGBA pixels.
+    auto toPlanes = [](const std::vector<float> & packed)
+    {
+        std::vector<float> planes(packed.size());
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            for (long c = 0; c < 4; ++c)
+            {
+                planes[c * numPixels + idx] = packed[4 * idx + c];
+            }
+        }
+        return planes;
+    };
+
+    for (auto flags : { OCIO::OPTIMIZATION_NONE, OCIO::OPTIMIZATION_FAST_LOG_EXP_POW })
+    {
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+        OCIO_CHECK_NO_THROW(cpuProcessor
+            = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32, flags));
+
+        std::vector<float> ref = img;
+        OCIO::PackedImageDesc refDesc(&ref[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(refDesc));
+
+        // The processing of the RGB planes without alpha processes a zero alpha.
+        std::vector<float> refNoAlpha = img;
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            refNoAlpha[4 * idx + 3] = 0.0f;
+        }
+        OCIO::PackedImageDesc refNoAlphaDesc(&refNoAlpha[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(refNoAlphaDesc));
+
+        auto check = [&](const std::vector<float> & planes, const std::vector<float> & expected,
+                         long numChannels, unsigned lineNo)
+        {
+            for (long idx = 0; idx < numPixels; ++idx)
+            {
+                for (long c = 0; c < numChannels; ++c)
+                {
+                    // Without the fast log & exp, the same computations are done.
+                    if (flags == OCIO::OPTIMIZATION_NONE)
+                    {
+                        OCIO_CHECK_EQUAL_FROM(planes[c * numPixels + idx],
+                                              expected[4 * idx + c], lineNo);
+                    }
+                    else
+                    {
+                        OCIO_CHECK_ASSERT_FROM(
+                            OCIO::EqualWithSafeRelError(planes[c * numPixels + idx],
+                                                        expected[4 * idx + c], 1e-4f, 1.0f),
+                            lineNo);
+                    }
+                }
+            }
+        };
+
+        {
+            // In-place processing.
+
+            std::vector<float> planes = toPlanes(img);
+            OCIO::PlanarImageDesc desc(&planes[0], &planes[numPixels],
+                                       &planes[2 * numPixels], &planes[3 * numPixels],
+                                       width, height);
+            OCIO_CHECK_NO_THROW(cpuProcessor->apply(desc));
+            check(planes, ref, 4, __LINE__);
+        }
+
+        {
+            // Processing from a planar image to another one, using several threads.
+
+            const std::vector<float> src = toPlanes(img);
+            OCIO::PlanarImageDesc srcDesc((void *)&src[0], (void *)&src[numPixels],
+                                          (void *)&src[2 * numPixels], (void *)&src[3 * numPixels],
+                                          width, height);
+
+            for (unsigned numThreads : { 1u, 4u })
+            {
+                std::vector<float> dst(src.size(), -1.0f);
+                OCIO::PlanarImageDesc dstDesc(&dst[0], &dst[numPixels],
+                                              &dst[2 * numPixels], &dst[3 * numPixels],
+                                              width, height);
+                OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcDesc, dstDesc, numThreads));
+                check(dst, ref, 4, __LINE__);
+                OCIO_CHECK_ASSERT(src == toPlanes(img));
+            }
+        }
+
+        {
+            // In-place processing of the RGB planes only.
+
+            std::vector<float> planes = toPlanes(img);
+            OCIO::PlanarImageDesc desc(&planes[0], &planes[numPixels], &planes[2 * numPixels],
+                                       nullptr, width, height);
+            OCIO_CHECK_NO_THROW(cpuProcessor->apply(desc, 3));
+            check(planes, refNoAlpha, 3, __LINE__);
+        }
+
+        {
+            // Processing from RGBA planes to RGB planes.
+
+            const std::vector<float> src = toPlanes(img);
+            OCIO::PlanarImageDesc srcDesc((void *)&src[0], (void *)&src[numPixels],
+                                          (void *)&src[2 * numPixels], (void *)&src[3 * numPixels],
+                                          width, height);
+
+            std::vector<float> dst(src.size(), -1.0f);
+            OCIO::PlanarImageDesc dstDesc(&dst[0], &dst[numPixels], &dst[2 * numPixels],
+                                          nullptr, width, height);
+            OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcDesc, dstDesc));
+            check(dst, ref, 3, __LINE__);
+        }
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, packed_rgb_processing)
+{
+    // The packed RGB 32-bit float images are directly processed (i.e. three floats per pixel)
+    // when all the ops support it. Validate that the results match the processing of the RGBA
+    // images where the alpha is 0 (i.e. like the packing of the RGB pixels in RGBA buffers).
+
+    constexpr long width     = 37;
+    constexpr long height    = 23;
+    constexpr long numPixels = width * height;
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = BuildDirectApplyProcessor());
+
+    std::vector<float> img(numPixels * 3);
+    for (size_t idx = 0; idx < img.size(); ++idx)
+    {
+        img[idx] = -0.1f + 1.2f * float((idx * 7) % 1031) / 1031.0f;
+    }
+
+    for (auto flags : { OCIO::OPTIMIZATION_NONE, OCIO::OPTIMIZATION_FAST_LOG_EXP_POW })
+    {
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+        OCIO_CHECK_NO_THROW(cpuProcessor
+            = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32, flags));
+
+        std::vector<float> ref(numPixels * 4, 0.0f);
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            std::copy(&img[3 * idx], &img[3 * idx + 3], &ref[4 * idx]);
+        }
+        OCIO::PackedImageDesc refDesc(&ref[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(refDesc));
+
+        // Check the pixels of the rows starting every rowSize floats.
+        auto check = [&](const std::vector<float> & res, long rowSize, unsigned lineNo)
+        {
+            for (long y = 0; y < height; ++y)
+            {
+                for (long x = 0; x < width; ++x)
+                {
+                    for (long c = 0; c < 3; ++c)
+                    {
+                        // Without the fast log & exp, the same computations are done.
+                        if (flags == OCIO::OPTIMIZATION_NONE)
+                        {
+                            OCIO_CHECK_EQUAL_FROM(res[y * rowSize + 3 * x + c],
+                                                  ref[4 * (y * width + x) + c], lineNo);
+                        }
+                        else
+                        {
+                            OCIO_CHECK_ASSERT_FROM(
+                                OCIO::EqualWithSafeRelError(res[y * rowSize + 3 * x + c],
+                                                            ref[4 * (y * width + x) + c],
+                                                            1e-4f, 1.0f),
+                                lineNo);
+                        }
+                    }
+                }
+            }
+        };
+
+        {
+            // In-place processing.
+
+            std::vector<float> res = img;
+            OCIO::PackedImageDesc desc(&res[0], width, height, 3);
+            OCIO_CHECK_NO_THROW(cpuProcessor->apply(desc));
+            check(res, 3 * width, __LINE__);
+        }
+
+        {
+            // Processing from an image to another one, using several threads.
+
+            OCIO::PackedImageDesc srcDesc(&img[0], width, height, 3);
+
+            for (unsigned numThreads : { 1u, 4u })
+            {
+                std::vector<float> res(img.size(), -1.0f);
+                OCIO::PackedImageDesc dstDesc(&res[0], width, height, 3);
+                OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcDesc, dstDesc, numThreads));
+                check(res, 3 * width, __LINE__);
+            }
+        }
+
+        {
+            // Processing of an image with padded rows.
+
+            constexpr long rowSize = 3 * width + 5;
+
+            std::vector<float> res(rowSize * height, -1.0f);
+            for (long y = 0; y < height; ++y)
+            {
+                std::copy(&img[y * 3 * width], &img[(y + 1) * 3 * width], &res[y * rowSize]);
+            }
+
+            OCIO::PackedImageDesc desc(&res[0], width, height, 3, OCIO::BIT_DEPTH_F32,
+                                       OCIO::AutoStride, OCIO::AutoStride,
+                                       rowSize * sizeof(float));
+            OCIO_CHECK_NO_THROW(cpuProcessor->apply(desc, 2));
+            check(res, rowSize, __LINE__);
+
+            // The padding is unchanged.
+            for (long y = 0; y < height; ++y)
+            {
+                for (long idx = 3 * width; idx < rowSize; ++idx)
+                {
+                    OCIO_CHECK_EQUAL(res[y * rowSize + idx], -1.0f);
+                }
+            }
+        }
+
+        {
+            // The BGR images are still processed through RGBA buffers.
+
+            std::vector<float> res(img.size());
+            for (long idx = 0; idx < numPixels; ++idx)
+            {
+                res[3 * idx + 0] = img[3 * idx + 2];
+                res[3 * idx + 1] = img[3 * idx + 1];
+                res[3 * idx + 2] = img[3 * idx + 0];
+            }
+
+            OCIO::PackedImageDesc desc(&res[0], width, height, OCIO::CHANNEL_ORDERING_BGR);
+            OCIO_CHECK_NO_THROW(cpuProcessor->apply(desc));
+
+            for (long idx = 0; idx < numPixels; ++idx)
+            {
+                std::swap(res[3 * idx + 0], res[3 * idx + 2]);
+            }
+            check(res, 3 * width, __LINE__);
+        }
+    }
+
+    // The packed RGB processing relies on the alpha staying 0 so the ops which could output a
+    // non-zero alpha disable it when a following op uses the alpha to compute the colors.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::MatrixTransformRcPtr alphaOffset = OCIO::MatrixTransform::Create();
+    constexpr double offset[4] = { 0.0, 0.0, 0.0, 0.5 };
+    alphaOffset->setOffset(offset);
+
+    OCIO::MatrixTransformRcPtr alphaFromRGB = OCIO::MatrixTransform::Create();
+    constexpr double toAlpha[16] = { 1.0, 0.0, 0.0, 0.0,
+                                     0.0, 1.0, 0.0, 0.0,
+                                     0.0, 0.0, 1.0, 0.0,
+                                     0.3, 0.4, 0.3, 1.0 };
+    alphaFromRGB->setMatrix(toAlpha);
+
+    OCIO::MatrixTransformRcPtr rgbFromAlpha = OCIO::MatrixTransform::Create();
+    constexpr double fromAlpha[16] = { 1.0, 0.0, 0.0, 0.2,
+                                       0.0, 1.0, 0.0, 0.1,
+                                       0.0, 0.0, 1.0, 0.3,
+                                       0.0, 0.0, 0.0, 1.0 };
+    rgbFromAlpha->setMatrix(fromAlpha);
+
+    for (const auto & alphaWriter : { alphaOffset, alphaFromRGB })
+    {
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+        group->appendTransform(alphaWriter);
+        group->appendTransform(rgbFromAlpha);
+
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+        OCIO_CHECK_NO_THROW(cpuProcessor = config->getProcessor(group)->getOptimizedCPUProcessor(
+            OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32, OCIO::OPTIMIZATION_NONE));
+
+        std::vector<float> ref(numPixels * 4, 0.0f);
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            std::copy(&img[3 * idx], &img[3 * idx + 3], &ref[4 * idx]);
+        }
+        OCIO::PackedImageDesc refDesc(&ref[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(refDesc));
+
+        std::vector<float> res = img;
+        OCIO::PackedImageDesc desc(&res[0], width, height, 3);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(desc));
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            for (long c = 0; c < 3; ++c)
+            {
+                OCIO_CHECK_EQUAL(res[3 * idx + c], ref[4 * idx + c]);
+            }
+        }
+    }
+}
+
+namespace
+{
+
+// Restore the default integer lookup size when going out of scope.
+class IntegerLookupEnvGuard
+{
+public:
+    explicit IntegerLookupEnvGuard(const char * size)
+    {
+        OCIO::SetEnvVariable(OCIO::OCIO_INTEGER_LOOKUP_SIZE_ENVVAR, size);
+    }
+    ~IntegerLookupEnvGuard()
+    {
+        OCIO::UnsetEnvVariable(OCIO::OCIO_INTEGER_LOOKUP_SIZE_ENVVAR);
+    }
+};
+
+} // anon.
+
+OCIO_ADD_TEST(CPUProcessor, integer_lookup)
+{
+    // The 8-bit images are processed with integer lookups. Validate that the results match the
+    // processing of the same values in 32-bit float, within one output code.
+
+    constexpr long numPixels = 256;
+
+    std::vector<uint8_t> img(numPixels * 4);
+    std::vector<float> ref(numPixels * 4);
+    for (size_t idx = 0; idx < img.size(); ++idx)
+    {
+        img[idx] = uint8_t((idx * 37 + idx / 4) % 256);
+        ref[idx] = float(img[idx]) / 255.0f;
+    }
+
+    // The processors must follow the changes of the integer lookup settings.
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    config->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
+
+    // A color transformation without crosstalk, using 1D lookups.
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    exponent->setValue({ 2.2, 2.0, 1.8, 1.0 });
+    exponent->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+    OCIO::ConstProcessorRcPtr separable;
+    OCIO_CHECK_NO_THROW(separable = config->getProcessor(exponent));
+
+    // A color transformation with crosstalk, using 3D lookups. Note that the alpha channel must
+    // not be mixed with the RGB channels.
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m44[16] = { 0.80, 0.15, 0.05, 0.00,
+                                 0.10, 0.85, 0.05, 0.00,
+                                 0.05, 0.10, 0.85, 0.00,
+                                 0.00, 0.00, 0.00, 0.90 };
+    matrix->setMatrix(m44);
+    group->appendTransform(matrix);
+    group->appendTransform(exponent);
+
+    OCIO::ConstProcessorRcPtr crosstalk;
+    OCIO_CHECK_NO_THROW(crosstalk = config->getProcessor(group));
+
+    const OCIO::OptimizationFlags oFlags
+        = OCIO::OptimizationFlags(OCIO::OPTIMIZATION_DEFAULT | OCIO::OPTIMIZATION_INTEGER_LOOKUP);
+
+    auto validate = [&](const OCIO::ConstProcessorRcPtr & processor, unsigned lineNo)
+    {
+        OCIO::ConstCPUProcessorRcPtr floatProcessor;
+        OCIO_CHECK_NO_THROW_FROM(floatProcessor
+            = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                  OCIO::OPTIMIZATION_DEFAULT), lineNo);
+        std::vector<float> expected(ref);
+        OCIO::PackedImageDesc refDesc(&expected[0], numPixels, 1, 4);
+        OCIO_CHECK_NO_THROW_FROM(floatProcessor->apply(refDesc), lineNo);
+
+        for (OCIO::BitDepth outBD : { OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_UINT16 })
+        {
+            OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+            OCIO_CHECK_NO_THROW_FROM(cpuProcessor
+                = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT8, outBD, oFlags),
+                lineNo);
+
+            std::vector<uint16_t> res(img.size());
+            OCIO::PackedImageDesc srcDesc(&img[0], numPixels, 1, 4, OCIO::BIT_DEPTH_UINT8,
+                                          OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+            OCIO::PackedImageDesc dstDesc(&res[0], numPixels, 1, 4, outBD,
+                                          OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+            OCIO_CHECK_NO_THROW_FROM(cpuProcessor->apply(srcDesc, dstDesc), lineNo);
+
+            // One output code of interpolation error in addition to the rounding.
+            const float scale = float(OCIO::GetBitDepthMaxValue(outBD));
+            const uint8_t * res8 = reinterpret_cast<const uint8_t *>(res.data());
+            for (size_t idx = 0; idx < res.size(); ++idx)
+            {
+                const float code = outBD == OCIO::BIT_DEPTH_UINT8 ? res8[idx] : res[idx];
+                const float value = std::min(std::max(expected[idx], 0.0f), 1.0f) * scale;
+                OCIO_CHECK_ASSERT_FROM(std::abs(code - value) <= 1.5f, lineNo);
+            }
+        }
+    };
+
+    validate(separable, __LINE__);
+    validate(crosstalk, __LINE__);
+
+    {
+        // All the 8-bit RGB codes are in the 3D table.
+
+        IntegerLookupEnvGuard guard("256");
+        OCIO_CHECK_NO_THROW(crosstalk = config->getProcessor(group));
+        validate(crosstalk, __LINE__);
+    }
+
+    {
+        // Invalid settings are replaced by the default ones.
+
+        OCIO::LogGuard logGuard;
+
+        IntegerLookupEnvGuard guard("300");
+        OCIO_CHECK_NO_THROW(crosstalk = config->getProcessor(group));
+        validate(crosstalk, __LINE__);
+
+        OCIO_CHECK_ASSERT(logGuard.findAndRemove(
+            "Invalid value '300' for the env. variable 'OCIO_INTEGER_LOOKUP_SIZE', it must be "
+            "in [2, 256]. The default value 65 is used."));
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, memory_size)
+{
+    // The memory size of a cached CPU processor includes its integer lookup tables (or baked
+    // LUT) i.e. such a processor is evicted from the processor cache by the memory limit.
+
+    IntegerLookupEnvGuard lookupGuard("");
+
+    struct CacheLimitGuard
+    {
+        ~CacheLimitGuard() { OCIO::SetCacheMaxMemorySize(0); }
+    } limitGuard;
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    // The 65^3 RGB 16-bit nodes of the interpolated 3D lookup need about 1.6MB.
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m44[16] = { 0.80, 0.15, 0.05, 0.00,
+                                 0.10, 0.85, 0.05, 0.00,
+                                 0.05, 0.10, 0.85, 0.00,
+                                 0.00, 0.00, 0.00, 1.00 };
+    matrix->setMatrix(m44);
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(matrix));
+
+    const OCIO::OptimizationFlags oFlags
+        = OCIO::OptimizationFlags(OCIO::OPTIMIZATION_DEFAULT | OCIO::OPTIMIZATION_INTEGER_LOOKUP);
+
+    auto getCPUProcessor = [&processor, oFlags](OCIO::BitDepth bitDepth)
+    {
+        return processor->getOptimizedCPUProcessor(bitDepth, bitDepth, oFlags);
+    };
+
+    OCIO::SetCacheMaxMemorySize(1024 * 1024);
+
+    // The float processors are small so they are both kept.
+    OCIO::ConstCPUProcessorRcPtr cpu16f = getCPUProcessor(OCIO::BIT_DEPTH_F16);
+    OCIO::ConstCPUProcessorRcPtr cpuF32 = getCPUProcessor(OCIO::BIT_DEPTH_F32);
+    OCIO_CHECK_EQUAL(getCPUProcessor(OCIO::BIT_DEPTH_F16).get(), cpu16f.get());
+
+    // The 8-bit processor exceeds the memory limit by itself so it evicts the other processors,
+    // and it is evicted as soon as another processor is cached.
+    OCIO::ConstCPUProcessorRcPtr cpu8 = getCPUProcessor(OCIO::BIT_DEPTH_UINT8);
+    OCIO_CHECK_EQUAL(getCPUProcessor(OCIO::BIT_DEPTH_UINT8).get(), cpu8.get());
+
+    OCIO_CHECK_NE(getCPUProcessor(OCIO::BIT_DEPTH_F32).get(), cpuF32.get());
+    OCIO_CHECK_NE(getCPUProcessor(OCIO::BIT_DEPTH_UINT8).get(), cpu8.get());
+}
+
+OCIO_ADD_TEST(CPUProcessor, packed_formats)
+{
+    // The pixels packed in words (e.g. the 10-bit DPX files) are directly processed. Validate
+    // that the results match the processing of the same codes in the bit-depth containers.
+
+    constexpr long width     = 37;
+    constexpr long height    = 5;
+    constexpr long numPixels = width * height;
+
+    {
+        std::vector<uint32_t> img(numPixels);
+        OCIO::PackedImageDesc desc(&img[0], width, height, OCIO::PACKED_FORMAT_RGB10_A2);
+        OCIO_CHECK_EQUAL(desc.getPackedFormat(), OCIO::PACKED_FORMAT_RGB10_A2);
+        OCIO_CHECK_EQUAL(desc.getBitDepth(), OCIO::BIT_DEPTH_UINT10);
+        OCIO_CHECK_EQUAL(desc.getChannelOrder(), OCIO::CHANNEL_ORDERING_RGBA);
+        OCIO_CHECK_EQUAL(desc.getChanStrideBytes(), 0);
+        OCIO_CHECK_EQUAL(desc.getXStrideBytes(), 4);
+        OCIO_CHECK_EQUAL(desc.getYStrideBytes(), 4 * width);
+        OCIO_CHECK_ASSERT(!desc.isRGBAPacked());
+
+        OCIO_CHECK_THROW_WHAT(OCIO::PackedImageDesc(&img[0], width, height,
+                                                    OCIO::PACKED_FORMAT_NONE),
+                              OCIO::Exception,
+                              "PackedImageDesc Error: Invalid packed format.");
+
+        OCIO_CHECK_THROW_WHAT(OCIO::PackedImageDesc(&img[0], width, height,
+                                                    OCIO::PACKED_FORMAT_DPX_RGB12,
+                                                    4, OCIO::AutoStride),
+                              OCIO::Exception,
+                              "PackedImageDesc Error: The packed format and x stride are "
+                              "inconsistent.");
+    }
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = BuildDirectApplyProcessor());
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW(cpuProcessor
+        = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT10, OCIO::BIT_DEPTH_UINT10,
+                                              OCIO::OPTIMIZATION_DEFAULT));
+
+    {
+        // The RGB10_A2 pixels have the R code in the low bits and a 2-bit alpha.
+
+        std::vector<uint32_t> img(numPixels);
+        std::vector<uint16_t> ref(numPixels * 4);
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            img[idx] = uint32_t(idx) * 2654435761u;
+
+            ref[4 * idx + 0] = uint16_t(img[idx] & 0x3FF);
+            ref[4 * idx + 1] = uint16_t((img[idx] >> 10) & 0x3FF);
+            ref[4 * idx + 2] = uint16_t((img[idx] >> 20) & 0x3FF);
+            ref[4 * idx + 3] = uint16_t((img[idx] >> 30) * 341);
+        }
+
+        OCIO::PackedImageDesc refDesc(&ref[0], width, height, 4, OCIO::BIT_DEPTH_UINT10,
+                                      OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(refDesc));
+
+        OCIO::PackedImageDesc desc(&img[0], width, height, OCIO::PACKED_FORMAT_RGB10_A2);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(desc, 2));
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const uint16_t * pixel = &ref[4 * idx];
+            const uint32_t alpha = uint32_t(pixel[3] * 3 + 511) / 1023;
+            OCIO_CHECK_EQUAL(img[idx], uint32_t(pixel[0]) | uint32_t(pixel[1]) << 10
+                                       | uint32_t(pixel[2]) << 20 | alpha << 30);
+        }
+    }
+
+    {
+        // The DPX method A pixels have the R code in the high bits.
+
+        std::vector<uint32_t> img(numPixels);
+        std::vector<uint16_t> ref(numPixels * 3);
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            img[idx] = uint32_t(idx) * 2654435761u & ~0x3u;
+
+            ref[3 * idx + 0] = uint16_t((img[idx] >> 22) & 0x3FF);
+            ref[3 * idx + 1] = uint16_t((img[idx] >> 12) & 0x3FF);
+            ref[3 * idx + 2] = uint16_t((img[idx] >> 2) & 0x3FF);
+        }
+
+        OCIO::ConstCPUProcessorRcPtr floatProcessor;
+        OCIO_CHECK_NO_THROW(floatProcessor
+            = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT10, OCIO::BIT_DEPTH_F32,
+                                                  OCIO::OPTIMIZATION_DEFAULT));
+
+        std::vector<float> expected(numPixels * 3);
+        OCIO::PackedImageDesc refDesc(&ref[0], width, height, 3, OCIO::BIT_DEPTH_UINT10,
+                                      OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        OCIO::PackedImageDesc expectedDesc(&expected[0], width, height, 3);
+        OCIO_CHECK_NO_THROW(floatProcessor->apply(refDesc, expectedDesc));
+
+        std::vector<float> res(numPixels * 3);
+        OCIO::PackedImageDesc srcDesc(&img[0], width, height, OCIO::PACKED_FORMAT_DPX_RGB10);
+        OCIO::PackedImageDesc dstDesc(&res[0], width, height, 3);
+        OCIO_CHECK_NO_THROW(floatProcessor->apply(srcDesc, dstDesc));
+
+        for (size_t idx = 0; idx < res.size(); ++idx)
+        {
+            OCIO_CHECK_EQUAL(res[idx], expected[idx]);
+        }
+    }
+
+    {
+        // The 12-bit DPX method A pixels have the codes in the high bits of 16-bit words.
+
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor12;
+        OCIO_CHECK_NO_THROW(cpuProcessor12
+            = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT12, OCIO::BIT_DEPTH_UINT12,
+                                                  OCIO::OPTIMIZATION_DEFAULT));
+
+        std::vector<uint16_t> img(numPixels * 3);
+        std::vector<uint16_t> ref(numPixels * 3);
+        for (size_t idx = 0; idx < img.size(); ++idx)
+        {
+            ref[idx] = uint16_t((idx * 97) % 4096);
+            img[idx] = uint16_t(ref[idx] << 4);
+        }
+
+        OCIO::PackedImageDesc refDesc(&ref[0], width, height, 3, OCIO::BIT_DEPTH_UINT12,
+                                      OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        OCIO_CHECK_NO_THROW(cpuProcessor12->apply(refDesc));
+
+        OCIO::PackedImageDesc desc(&img[0], width, height, OCIO::PACKED_FORMAT_DPX_RGB12);
+        OCIO_CHECK_NO_THROW(cpuProcessor12->apply(desc));
+
+        for (size_t idx = 0; idx < img.size(); ++idx)
+        {
+            OCIO_CHECK_EQUAL(img[idx], uint16_t(ref[idx] << 4));
+        }
+    }
+}
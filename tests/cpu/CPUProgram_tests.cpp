@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <cmath>
+#include <limits>
+
+#include "CPUProgram.cpp"
+
+#include "ops/exponent/ExponentOp.h"
+#include "ops/matrix/MatrixOp.h"
+#include "ops/range/RangeOp.h"
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+constexpr float qnan = std::numeric_limits<float>::quiet_NaN();
+constexpr float inf  = std::numeric_limits<float>::infinity();
+
+constexpr float g_pixels[] = {  0.0f,   0.0f,  0.0f,  0.0f,
+                                0.1f,   0.5f,  0.9f,  1.0f,
+                               -0.3f,   1.7f,  4.0f,  0.5f,
+                                qnan,  -inf,   inf,   0.25f };
+
+constexpr size_t g_numPixels = sizeof(g_pixels) / (4 * sizeof(float));
+
+// Validate that the program gives exactly the same results than the CPU ops and return the
+// number of called CPU ops.
+size_t ValidateProgram(OCIO::OpRcPtrVec & ops, unsigned line)
+{
+    ops.finalize();
+
+    OCIO::CPUProgram program;
+    OCIO::ConstOpCPURcPtrVec cpuOps;
+
+    for (const auto & op : ops)
+    {
+        OCIO::ConstOpRcPtr constOp = op;
+        cpuOps.push_back(op->getCPUOp(false));
+        program.addOp(constOp, cpuOps.back());
+    }
+
+    OCIO_CHECK_EQUAL_FROM(program.getNumInstructions(), ops.size(), line);
+
+    for (size_t idx = 0; idx < g_numPixels; ++idx)
+    {
+        float ref[4]{ g_pixels[4 * idx + 0], g_pixels[4 * idx + 1],
+                      g_pixels[4 * idx + 2], g_pixels[4 * idx + 3] };
+
+        for (const auto & cpuOp : cpuOps)
+        {
+            cpuOp->apply(ref, ref, 1);
+        }
+
+        float res[4]{ g_pixels[4 * idx + 0], g_pixels[4 * idx + 1],
+                      g_pixels[4 * idx + 2], g_pixels[4 * idx + 3] };
+
+        program.applyRGBA(res);
+
+        for (size_t channel = 0; channel < 4; ++channel)
+        {
+            if (std::isnan(ref[channel]))
+            {
+                OCIO_CHECK_ASSERT_FROM(std::isnan(res[channel]), line);
+            }
+            else
+            {
+                OCIO_CHECK_EQUAL_FROM(ref[channel], res[channel], line);
+            }
+        }
+    }
+
+    return program.getNumCalls();
+}
+
+} // anon.
+
+OCIO_ADD_TEST(CPUProgram, matrix)
+{
+    constexpr double scale4[4]  = { 1.1, 0.9, 1.2, 0.5 };
+    constexpr double offset4[4] = { 0.1, -0.2, 0.3, 0.4 };
+    constexpr double m44[16]    = { 1.1, 0.2, 0.3, 0.4,
+                                    0.1, 0.9, 0.0, 0.1,
+                                    0.0, 0.1, 1.2, 0.0,
+                                   -0.2, 0.0, 0.3, 1.0 };
+
+    {
+        OCIO::OpRcPtrVec ops;
+        OCIO::CreateScaleOp(ops, scale4, OCIO::TRANSFORM_DIR_FORWARD);
+        OCIO_CHECK_EQUAL(ValidateProgram(ops, __LINE__), 0);
+    }
+
+    {
+        OCIO::OpRcPtrVec ops;
+        OCIO::CreateScaleOffsetOp(ops, scale4, offset4, OCIO::TRANSFORM_DIR_FORWARD);
+        OCIO_CHECK_EQUAL(ValidateProgram(ops, __LINE__), 0);
+    }
+
+    {
+        OCIO::OpRcPtrVec ops;
+        OCIO::CreateMatrixOp(ops, m44, OCIO::TRANSFORM_DIR_FORWARD);
+        OCIO_CHECK_EQUAL(ValidateProgram(ops, __LINE__), 0);
+    }
+
+    {
+        OCIO::OpRcPtrVec ops;
+        OCIO::CreateMatrixOffsetOp(ops, m44, offset4, OCIO::TRANSFORM_DIR_FORWARD);
+        OCIO_CHECK_EQUAL(ValidateProgram(ops, __LINE__), 0);
+    }
+
+    {
+        // The inverse is computed by the finalization.
+        OCIO::OpRcPtrVec ops;
+        OCIO::CreateMatrixOffsetOp(ops, m44, offset4, OCIO::TRANSFORM_DIR_INVERSE);
+        OCIO_CHECK_EQUAL(ValidateProgram(ops, __LINE__), 0);
+    }
+}
+
+OCIO_ADD_TEST(CPUProgram, range)
+{
+    const double empty = OCIO::RangeOpData::EmptyValue();
+
+    {
+        OCIO::OpRcPtrVec ops;
+        OCIO::CreateRangeOp(ops, 0.0, 1.0, 0.5, 1.5, OCIO::TRANSFORM_DIR_FORWARD);
+        OCIO_CHECK_EQUAL(ValidateProgram(ops, __LINE__), 0);
+    }
+
+    {
+        OCIO::OpRcPtrVec ops;
+        OCIO::CreateRangeOp(ops, 0.1, 1.2, 0.1, 1.2, OCIO::TRANSFORM_DIR_FORWARD);
+        OCIO_CHECK_EQUAL(ValidateProgram(ops, __LINE__), 0);
+    }
+
+    {
+        OCIO::OpRcPtrVec ops;
+        OCIO::CreateRangeOp(ops, 0.1, empty, 0.1, empty, OCIO::TRANSFORM_DIR_FORWARD);
+        OCIO_CHECK_EQUAL(ValidateProgram(ops, __LINE__), 0);
+    }
+
+    {
+        OCIO::OpRcPtrVec ops;
+        OCIO::CreateRangeOp(ops, empty, 1.2, empty, 1.2, OCIO::TRANSFORM_DIR_FORWARD);
+        OCIO_CHECK_EQUAL(ValidateProgram(ops, __LINE__), 0);
+    }
+}
+
+OCIO_ADD_TEST(CPUProgram, call)
+{
+    // Ops not supported by the interpreter are called through their CPU op.
+
+    constexpr double m44[16]    = { 1.1, 0.2, 0.3, 0.4,
+                                    0.1, 0.9, 0.0, 0.1,
+                                    0.0, 0.1, 1.2, 0.0,
+                                   -0.2, 0.0, 0.3, 1.0 };
+
+    OCIO::OpRcPtrVec ops;
+    OCIO::CreateMatrixOp(ops, m44, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::CreateExponentOp(ops, { 2.2, 2.4, 2.6, 1.0 }, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::CreateRangeOp(ops, 0.0, 1.0, 0.5, 1.5, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_EQUAL(ValidateProgram(ops, __LINE__), 1);
+
+    OCIO::CPUProgram program;
+    OCIO_CHECK_THROW_WHAT(program.addCall(OCIO::ConstOpCPURcPtr()),
+                          OCIO::Exception,
+                          "CPU program: missing CPU op.");
+
+    OCIO_CHECK_NO_THROW(program.addCall(ops[1]->getCPUOp(false)));
+    OCIO_CHECK_EQUAL(program.getNumInstructions(), 1);
+    OCIO_CHECK_EQUAL(program.getNumCalls(), 1);
+
+    program.clear();
+    OCIO_CHECK_EQUAL(program.getNumInstructions(), 0);
+    OCIO_CHECK_EQUAL(program.getNumCalls(), 0);
+}
@@ -2,7 +2,14 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
 #include "Caching.cpp"
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
 
 #include "testutils/UnitTest.h"
 #include "UnitTestUtils.h"
@@ -43,6 +50,16 @@ struct Guard
     
     const std::string m_envvar;
 };
+
+// A guard to restore the default cache limits.
+struct CacheLimitsGuard
+{
+    ~CacheLimitsGuard()
+    {
+        OCIO::SetCacheMaxEntries(0);
+        OCIO::SetCacheMaxMemorySize(0);
+    }
+};
     
 }
 
@@ -56,7 +73,7 @@ OCIO_ADD_TEST(Caching, generic_cache)
         OCIO_CHECK_ASSERT(cache.isEnabled());
 
         {
-            OCIO::AutoMutex m(cache.lock());
+            OCIO::AutoExclusiveLock m(cache.lock());
 
             DataRcPtr entry1 = std::make_shared<Data>();
             cache["entry1"] = entry1;
@@ -82,7 +99,7 @@ OCIO_ADD_TEST(Caching, generic_cache)
         OCIO_CHECK_ASSERT(!cache.isEnabled());
 
         // The lock control is useless here but useful as a good example to copy & paste.
-        OCIO::AutoMutex m(cache.lock());
+        OCIO::AutoExclusiveLock m(cache.lock());
 
         DataRcPtr entry1 = std::make_shared<Data>();
         cache["entry1"] = entry1;
@@ -98,7 +115,7 @@ OCIO_ADD_TEST(Caching, generic_cache)
         OCIO_CHECK_ASSERT(cache.isEnabled());
 
         // The lock control is useless here but useful as a good example to copy & paste.
-        OCIO::AutoMutex m(cache.lock());
+        OCIO::AutoExclusiveLock m(cache.lock());
 
         DataRcPtr entry1 = std::make_shared<Data>();
         cache["entry1"] = entry1;
@@ -107,6 +124,250 @@ OCIO_ADD_TEST(Caching, generic_cache)
     }
 }
 
+OCIO_ADD_TEST(Caching, generic_cache_get_or_create)
+{
+    // A unit test to check the concurrent creation of the cache entries.
+
+    {
+        OCIO::GenericCache<std::string, DataRcPtr> cache;
+
+        std::atomic<int> numCreated{0};
+        auto create = [&numCreated]()
+        {
+            // Make the creation slow enough for the other threads to wait for it.
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            ++numCreated;
+            return std::make_shared<Data>();
+        };
+
+        // Note that the unit test macros are not thread-safe so the checks are deferred.
+        static constexpr unsigned numThreads = 8;
+        std::vector<DataRcPtr> entries(numThreads);
+        std::vector<DataRcPtr> others(numThreads);
+
+        std::vector<std::thread> threads;
+        for (unsigned idx = 0; idx < numThreads; ++idx)
+        {
+            threads.emplace_back([&, idx]()
+            {
+                entries[idx] = cache.getOrCreate("entry1", create);
+                // The other keys are not blocked by the pending creation of 'entry1'.
+                others[idx] = cache.getOrCreate(idx % 2 ? "entry2" : "entry3", create);
+            });
+        }
+        for (auto & thread : threads)
+        {
+            thread.join();
+        }
+
+        // Only one entry per key was created, and all the threads got it.
+        OCIO_CHECK_EQUAL(numCreated.load(), 3);
+        for (unsigned idx = 0; idx < numThreads; ++idx)
+        {
+            OCIO_REQUIRE_ASSERT(entries[idx]);
+            OCIO_CHECK_EQUAL(entries[idx], entries[0]);
+            OCIO_CHECK_EQUAL(others[idx], others[idx % 2]);
+        }
+        OCIO_CHECK_NE(others[0], others[1]);
+
+        OCIO_CHECK_ASSERT(cache.exists("entry1"));
+        OCIO_CHECK_EQUAL(cache.getOrCreate("entry1", create), entries[0]);
+        OCIO_CHECK_EQUAL(numCreated.load(), 3);
+    }
+
+    {
+        // A failed creation is propagated to the waiting threads and nothing is cached.
+
+        OCIO::GenericCache<std::string, DataRcPtr> cache;
+
+        auto create = []() -> DataRcPtr
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            throw OCIO::Exception("Creation failure.");
+        };
+
+        static constexpr unsigned numThreads = 4;
+        std::atomic<unsigned> numFailures{0};
+
+        std::vector<std::thread> threads;
+        for (unsigned idx = 0; idx < numThreads; ++idx)
+        {
+            threads.emplace_back([&]()
+            {
+                try
+                {
+                    cache.getOrCreate("entry1", create);
+                }
+                catch (const OCIO::Exception &)
+                {
+                    ++numFailures;
+                }
+            });
+        }
+        for (auto & thread : threads)
+        {
+            thread.join();
+        }
+
+        OCIO_CHECK_EQUAL(numFailures.load(), numThreads);
+        OCIO_CHECK_ASSERT(!cache.exists("entry1"));
+
+        DataRcPtr entry1;
+        OCIO_CHECK_NO_THROW(entry1 = cache.getOrCreate("entry1", []()
+        {
+            return std::make_shared<Data>();
+        }));
+        OCIO_CHECK_ASSERT(cache.exists("entry1"));
+    }
+
+    {
+        // The concurrent cache hits share the cache lock and keep the usage order.
+
+        CacheLimitsGuard guard;
+
+        OCIO::GenericCache<std::string, DataRcPtr> cache;
+
+        std::atomic<int> numCreated{0};
+        auto create = [&numCreated]()
+        {
+            ++numCreated;
+            return std::make_shared<Data>();
+        };
+
+        const DataRcPtr entry1 = cache.getOrCreate("entry1", create);
+        const DataRcPtr entry2 = cache.getOrCreate("entry2", create);
+
+        static constexpr unsigned numThreads = 8;
+        std::atomic<unsigned> numMismatches{0};
+
+        std::vector<std::thread> threads;
+        for (unsigned idx = 0; idx < numThreads; ++idx)
+        {
+            threads.emplace_back([&, idx]()
+            {
+                for (unsigned iter = 0; iter < 1000; ++iter)
+                {
+                    const bool first = (idx + iter) % 2;
+                    if (cache.getOrCreate(first ? "entry1" : "entry2", create)
+                            != (first ? entry1 : entry2))
+                    {
+                        ++numMismatches;
+                    }
+                }
+            });
+        }
+        for (auto & thread : threads)
+        {
+            thread.join();
+        }
+
+        OCIO_CHECK_EQUAL(numMismatches.load(), 0);
+        OCIO_CHECK_EQUAL(numCreated.load(), 2);
+
+        // Use 'entry1' so 'entry2' becomes the least recently used entry.
+        OCIO_CHECK_EQUAL(cache.getOrCreate("entry1", create), entry1);
+
+        OCIO::SetCacheMaxEntries(2);
+        cache.getOrCreate("entry3", create);
+
+        OCIO_CHECK_ASSERT(cache.exists("entry1"));
+        OCIO_CHECK_ASSERT(!cache.exists("entry2"));
+        OCIO_CHECK_ASSERT(cache.exists("entry3"));
+    }
+
+    {
+        // A disabled cache creates a new entry for each call.
+
+        OCIO::GenericCache<std::string, DataRcPtr> cache;
+        cache.enable(false);
+
+        auto create = []() { return std::make_shared<Data>(); };
+
+        DataRcPtr entry1 = cache.getOrCreate("entry1", create);
+        OCIO_CHECK_NE(entry1, cache.getOrCreate("entry1", create));
+        OCIO_CHECK_ASSERT(!cache.exists("entry1"));
+    }
+}
+
+OCIO_ADD_TEST(Caching, generic_cache_limits)
+{
+    // A unit test to check the eviction of the least recently used entries.
+
+    CacheLimitsGuard guard;
+
+    OCIO_CHECK_EQUAL(OCIO::GetCacheMaxEntries(), 0);
+    OCIO_CHECK_EQUAL(OCIO::GetCacheMaxMemorySize(), 0);
+
+    auto create = []() { return std::make_shared<Data>(); };
+
+    {
+        OCIO::SetCacheMaxEntries(2);
+        OCIO_CHECK_EQUAL(OCIO::GetCacheMaxEntries(), 2);
+
+        OCIO::GenericCache<std::string, DataRcPtr> cache;
+
+        DataRcPtr entry1 = cache.getOrCreate("entry1", create);
+        cache.getOrCreate("entry2", create);
+
+        // Use 'entry1' so 'entry2' becomes the least recently used entry.
+        OCIO_CHECK_EQUAL(cache.getOrCreate("entry1", create), entry1);
+
+        cache.getOrCreate("entry3", create);
+
+        OCIO_CHECK_EQUAL(cache.getNumEntries(), 2);
+        OCIO_CHECK_ASSERT(cache.exists("entry1"));
+        OCIO_CHECK_ASSERT(!cache.exists("entry2"));
+        OCIO_CHECK_ASSERT(cache.exists("entry3"));
+        OCIO_CHECK_EQUAL(cache.getMemorySize(), 0);
+
+        OCIO::SetCacheMaxEntries(0);
+    }
+
+    {
+        OCIO::SetCacheMaxMemorySize(250);
+        OCIO_CHECK_EQUAL(OCIO::GetCacheMaxMemorySize(), 250);
+
+        OCIO::GenericCache<std::string, DataRcPtr> cache([](const DataRcPtr & data)
+        {
+            return size_t(data->status ? 1000 : 100);
+        });
+
+        cache.getOrCreate("entry1", create);
+        cache.getOrCreate("entry2", create);
+        OCIO_CHECK_EQUAL(cache.getMemorySize(), 200);
+
+        cache.getOrCreate("entry3", create);
+        OCIO_CHECK_EQUAL(cache.getNumEntries(), 2);
+        OCIO_CHECK_EQUAL(cache.getMemorySize(), 200);
+        OCIO_CHECK_ASSERT(!cache.exists("entry1"));
+
+        // An entry exceeding the limit evicts all the others but is kept.
+        cache.getOrCreate("entry4", []()
+        {
+            DataRcPtr data = std::make_shared<Data>();
+            data->status = true;
+            return data;
+        });
+        OCIO_CHECK_EQUAL(cache.getNumEntries(), 1);
+        OCIO_CHECK_EQUAL(cache.getMemorySize(), 1000);
+        OCIO_CHECK_ASSERT(cache.exists("entry4"));
+
+        cache.clear();
+        OCIO_CHECK_EQUAL(cache.getNumEntries(), 0);
+        OCIO_CHECK_EQUAL(cache.getMemorySize(), 0);
+    }
+
+    {
+        // The memory sizes of the LUTs are estimated from their arrays.
+
+        OCIO::Lut1DOpData lut1d(1024);
+        OCIO_CHECK_ASSERT(lut1d.getMemorySize() >= 1024 * 3 * sizeof(float));
+
+        OCIO::Lut3DOpData lut3d(33);
+        OCIO_CHECK_ASSERT(lut3d.getMemorySize() >= 33 * 33 * 33 * 3 * sizeof(float));
+    }
+}
+
 OCIO_ADD_TEST(Caching, processor_cache)
 {
     // A unit test to check the ProcessorCache class.
@@ -7772,6 +7772,14 @@ OCIO_ADD_TEST(Config, context_variables_typical_use_cases)
             // Same processor because $SHOT is equal to 'exposure_contrast_linear.ctf'.
             OCIO_CHECK_EQUAL(cfg->getProcessor("cs1", "cs2").get(),
                              cfg->getProcessor("cs1", "cs3").get());
+
+            // Flushing the cache also flushes the cache ID index used by the fallback.
+            OCIO::ConstProcessorRcPtr proc = cfg->getProcessor("cs1", "cs2");
+            cfg->clearProcessorCache();
+
+            OCIO::ConstProcessorRcPtr proc3 = cfg->getProcessor("cs1", "cs3");
+            OCIO_CHECK_NE(proc.get(), proc3.get());
+            OCIO_CHECK_EQUAL(proc3.get(), cfg->getProcessor("cs1", "cs2").get());
         }
 
         {
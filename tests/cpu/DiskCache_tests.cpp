@@ -0,0 +1,240 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <fstream>
+
+#include "DiskCache.cpp"
+
+#include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+// A guard to use a temporary directory for the persistent file cache.
+struct FileCacheDirectoryGuard
+{
+    explicit FileCacheDirectoryGuard(const std::string & name)
+    {
+        m_directoryPath = OCIO::CreateTemporaryDirectory(name);
+        OCIO::SetFileCacheDirectory(m_directoryPath.c_str());
+        OCIO::ClearAllCaches();
+    }
+
+    ~FileCacheDirectoryGuard()
+    {
+        OCIO::SetFileCacheDirectory("");
+        OCIO::ClearAllCaches();
+        OCIO::RemoveTemporaryDirectory(m_directoryPath);
+    }
+
+    std::string m_directoryPath;
+};
+
+void WriteSpi1D(const std::string & filepath, const std::vector<float> & values)
+{
+    std::ofstream stream(filepath.c_str());
+    stream << "Version 1\n"
+           << "From 0.0 1.0\n"
+           << "Length " << values.size() << "\n"
+           << "Components 1\n"
+           << "{\n";
+    for (float value : values)
+    {
+        stream << value << "\n";
+    }
+    stream << "}\n";
+}
+
+float ApplyFile(const std::string & filepath, float value)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    config->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
+
+    OCIO::FileTransformRcPtr transform = OCIO::FileTransform::Create();
+    transform->setSrc(filepath.c_str());
+    transform->setInterpolation(OCIO::INTERP_LINEAR);
+
+    float rgb[3]{ value, value, value };
+    config->getProcessor(transform)->getDefaultCPUProcessor()->applyRGB(rgb);
+    return rgb[0];
+}
+
+} // anon.
+
+
+OCIO_ADD_TEST(DiskCache, writer_reader)
+{
+    OCIO::Lut1DOpDataRcPtr lut1d = std::make_shared<OCIO::Lut1DOpData>(17);
+    lut1d->setInterpolation(OCIO::INTERP_LINEAR);
+    lut1d->setFileOutputBitDepth(OCIO::BIT_DEPTH_UINT10);
+    auto & values1d = lut1d->getArray().getValues();
+    for (size_t idx = 0; idx < values1d.size(); ++idx)
+    {
+        values1d[idx] = float(idx) / float(values1d.size());
+    }
+
+    OCIO::Lut3DOpDataRcPtr lut3d = std::make_shared<OCIO::Lut3DOpData>(5);
+    lut3d->setInterpolation(OCIO::INTERP_TETRAHEDRAL);
+    lut3d->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    auto & values3d = lut3d->getArray().getValues();
+    for (size_t idx = 0; idx < values3d.size(); ++idx)
+    {
+        values3d[idx] = 1.0f - float(idx) / float(values3d.size());
+    }
+
+    OCIO::DiskCacheWriter writer;
+    writer.writeUInt(42);
+    writer.writeLut1D(lut1d);
+    writer.writeFloat(0.5f);
+    writer.writeLut3D(lut3d);
+    writer.writeLut1D(OCIO::ConstLut1DOpDataRcPtr());
+
+    const std::string & payload = writer.getPayload();
+
+    // The arrays start on aligned offsets.
+    const std::string array1d(reinterpret_cast<const char *>(values1d.data()),
+                              values1d.size() * sizeof(float));
+    OCIO_CHECK_EQUAL(payload.find(array1d) % 16, 0);
+
+    {
+        OCIO::DiskCacheReader reader(payload.data(), payload.size());
+
+        OCIO_CHECK_EQUAL(reader.readUInt(), 42);
+
+        OCIO::Lut1DOpDataRcPtr lut1dRead;
+        OCIO_CHECK_NO_THROW(lut1dRead = reader.readLut1D());
+        OCIO_REQUIRE_ASSERT(lut1dRead);
+        OCIO_CHECK_ASSERT(*lut1dRead == *lut1d);
+        OCIO_CHECK_EQUAL(lut1dRead->getFileOutputBitDepth(), OCIO::BIT_DEPTH_UINT10);
+
+        OCIO_CHECK_EQUAL(reader.readFloat(), 0.5f);
+
+        OCIO::Lut3DOpDataRcPtr lut3dRead;
+        OCIO_CHECK_NO_THROW(lut3dRead = reader.readLut3D());
+        OCIO_REQUIRE_ASSERT(lut3dRead);
+        OCIO_CHECK_ASSERT(*lut3dRead == *lut3d);
+
+        OCIO_CHECK_ASSERT(!reader.readLut1D());
+        OCIO_CHECK_ASSERT(reader.atEnd());
+    }
+
+    {
+        // A truncated payload is invalid.
+        OCIO::DiskCacheReader reader(payload.data(), 64);
+
+        OCIO_CHECK_EQUAL(reader.readUInt(), 42);
+        OCIO_CHECK_THROW_WHAT(reader.readLut1D(),
+                              OCIO::Exception,
+                              "Unexpected end of the file cache entry.");
+    }
+}
+
+OCIO_ADD_TEST(DiskCache, file_cache)
+{
+    const char * defaultDirectory = OCIO::GetFileCacheDirectory();
+    OCIO_CHECK_EQUAL(std::string(defaultDirectory), "");
+
+    FileCacheDirectoryGuard guard("ocio_disk_cache_test");
+
+    // The pointer to the previous directory remains valid.
+    OCIO_CHECK_EQUAL(std::string(defaultDirectory), "");
+    OCIO_CHECK_EQUAL(std::string(OCIO::GetFileCacheDirectory()), guard.m_directoryPath);
+
+    const std::string filepath = guard.m_directoryPath + "/lut.spi1d";
+    WriteSpi1D(filepath, { 0.0f, 0.25f, 0.5f });
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    OCIO::DiskCacheEntry entry;
+    OCIO_REQUIRE_ASSERT(OCIO::GetDiskCacheEntry(entry, filepath, OCIO::INTERP_LINEAR, *config));
+
+    // Parse the file and save its entry.
+
+    OCIO_CHECK_EQUAL(ApplyFile(filepath, 1.0f), 0.5f);
+    OCIO_CHECK_ASSERT(std::ifstream(entry.path.c_str()).good());
+
+    // Load the entry.
+
+    OCIO::FileFormat * format = nullptr;
+    OCIO::CachedFileRcPtr cachedFile;
+    OCIO_CHECK_ASSERT(OCIO::LoadDiskCachedFile(format, cachedFile, entry));
+    OCIO_REQUIRE_ASSERT(format);
+    OCIO_CHECK_EQUAL(format->getName(), "spi1d");
+    OCIO_CHECK_ASSERT(cachedFile);
+
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_EQUAL(ApplyFile(filepath, 1.0f), 0.5f);
+
+    // A changed file makes the entry stale so the file is parsed again.
+
+    WriteSpi1D(filepath, { 0.0f, 0.25f, 0.5f, 0.75f });
+
+    OCIO_REQUIRE_ASSERT(OCIO::GetDiskCacheEntry(entry, filepath, OCIO::INTERP_LINEAR, *config));
+    OCIO_CHECK_ASSERT(!OCIO::LoadDiskCachedFile(format, cachedFile, entry));
+
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_EQUAL(ApplyFile(filepath, 1.0f), 0.75f);
+
+    OCIO_CHECK_ASSERT(OCIO::LoadDiskCachedFile(format, cachedFile, entry));
+
+    // A file rewritten in place with the same size (i.e. likely within the same second) makes
+    // the entry stale too.
+
+    WriteSpi1D(filepath, { 0.0f, 0.25f, 0.5f, 0.25f });
+
+    OCIO::DiskCacheEntry sameSizeEntry;
+    OCIO_REQUIRE_ASSERT(OCIO::GetDiskCacheEntry(sameSizeEntry, filepath, OCIO::INTERP_LINEAR,
+                                                *config));
+    OCIO_CHECK_EQUAL(sameSizeEntry.path, entry.path);
+    OCIO_CHECK_EQUAL(sameSizeEntry.fileSize, entry.fileSize);
+    OCIO_CHECK_ASSERT(!OCIO::LoadDiskCachedFile(format, cachedFile, sameSizeEntry));
+
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_EQUAL(ApplyFile(filepath, 1.0f), 0.25f);
+
+    WriteSpi1D(filepath, { 0.0f, 0.25f, 0.5f, 0.75f });
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_EQUAL(ApplyFile(filepath, 1.0f), 0.75f);
+
+    // The entry is named from the path of the LUT file i.e. a copy has its own entry.
+
+    const std::string copyPath = guard.m_directoryPath + "/copy.spi1d";
+    WriteSpi1D(copyPath, { 0.0f, 0.25f, 0.5f, 0.75f });
+
+    OCIO::DiskCacheEntry copyEntry;
+    OCIO_REQUIRE_ASSERT(OCIO::GetDiskCacheEntry(copyEntry, copyPath, OCIO::INTERP_LINEAR, *config));
+    OCIO_CHECK_NE(copyEntry.path, entry.path);
+    OCIO_CHECK_EQUAL(copyEntry.fileHash, entry.fileHash);
+    OCIO_CHECK_ASSERT(!OCIO::LoadDiskCachedFile(format, cachedFile, copyEntry));
+
+    // The relative paths depend on the current directory so they are not cached.
+    OCIO_CHECK_ASSERT(!OCIO::GetDiskCacheEntry(copyEntry, "copy.spi1d", OCIO::INTERP_LINEAR,
+                                               *config));
+
+    // A corrupted entry is ignored.
+
+    {
+        std::fstream stream(entry.path.c_str(),
+                            std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+        stream.seekp(-4, std::ios_base::end);
+        stream.write("ABCD", 4);
+    }
+
+    OCIO_CHECK_ASSERT(!OCIO::LoadDiskCachedFile(format, cachedFile, entry));
+
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_EQUAL(ApplyFile(filepath, 1.0f), 0.75f);
+
+    // The entry was saved again.
+    OCIO_CHECK_ASSERT(OCIO::LoadDiskCachedFile(format, cachedFile, entry));
+
+    // The persistent file cache is disabled.
+
+    OCIO::SetFileCacheDirectory("");
+    OCIO_CHECK_ASSERT(!OCIO::GetDiskCacheEntry(entry, filepath, OCIO::INTERP_LINEAR, *config));
+}
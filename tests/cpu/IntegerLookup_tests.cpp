@@ -0,0 +1,330 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "IntegerLookup.cpp"
+
+#include "ops/matrix/MatrixOp.h"
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+// Color transformation of the tests i.e. a smooth curve, optionally after a matrix mixing the
+// RGB channels. The alpha channel is only scaled.
+template<OCIO::BitDepth inBD>
+void EvalFloat(const void * inImg, float * outImg, long numPixels, bool crosstalk)
+{
+    typedef typename OCIO::BitDepthInfo<inBD>::Type InType;
+    const float scale = 1.0f / float(OCIO::BitDepthInfo<inBD>::maxValue);
+
+    const InType * in = reinterpret_cast<const InType *>(inImg);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        const float r = in[4 * idx + 0] * scale;
+        const float g = in[4 * idx + 1] * scale;
+        const float b = in[4 * idx + 2] * scale;
+        const float a = in[4 * idx + 3] * scale;
+
+        float rgb[3]{ r, g, b };
+        if (crosstalk)
+        {
+            rgb[0] = 0.6f * r + 0.3f * g + 0.1f * b;
+            rgb[1] = 0.2f * r + 0.7f * g + 0.1f * b;
+            rgb[2] = 0.1f * r + 0.1f * g + 0.8f * b;
+        }
+
+        for (int chan = 0; chan < 3; ++chan)
+        {
+            outImg[4 * idx + chan] = rgb[chan] * (1.5f - 0.5f * rgb[chan]);
+        }
+        outImg[4 * idx + 3] = 0.5f * a;
+    }
+}
+
+template<OCIO::BitDepth inBD, OCIO::BitDepth outBD>
+void EvalOut(const void * inImg, void * outImg, long numPixels, bool crosstalk)
+{
+    typedef typename OCIO::BitDepthInfo<outBD>::Type OutType;
+    const float scale = float(OCIO::BitDepthInfo<outBD>::maxValue);
+
+    std::vector<float> values(4 * numPixels);
+    EvalFloat<inBD>(inImg, values.data(), numPixels, crosstalk);
+
+    OutType * out = reinterpret_cast<OutType *>(outImg);
+    for (long idx = 0; idx < 4 * numPixels; ++idx)
+    {
+        out[idx] = OCIO::Converter<outBD>::CastValue(values[idx] * scale);
+    }
+}
+
+template<OCIO::BitDepth inBD, OCIO::BitDepth outBD>
+std::unique_ptr<OCIO::IntegerLookup> CreateLookup(OCIO::IntegerLookup::Type type,
+                                                  unsigned long gridSize)
+{
+    const bool crosstalk = type != OCIO::IntegerLookup::TYPE_1D;
+
+    return OCIO::IntegerLookup::Create(
+        inBD, outBD, type, gridSize,
+        [crosstalk](const void * inImg, void * outImg, long numPixels)
+        {
+            EvalOut<inBD, outBD>(inImg, outImg, numPixels, crosstalk);
+        },
+        [crosstalk](const void * inImg, void * outImg, long numPixels)
+        {
+            EvalFloat<inBD>(inImg, reinterpret_cast<float *>(outImg), numPixels, crosstalk);
+        });
+}
+
+// Process packed RGBA pixels.
+template<typename InType, typename OutType>
+void ApplyRGBA(const OCIO::IntegerLookup & lookup,
+               const std::vector<InType> & in, std::vector<OutType> & out)
+{
+    const char * src = reinterpret_cast<const char *>(in.data());
+    const char * srcChannels[4]{ src, src + sizeof(InType),
+                                 src + 2 * sizeof(InType), src + 3 * sizeof(InType) };
+
+    char * dst = reinterpret_cast<char *>(out.data());
+    char * dstChannels[4]{ dst, dst + sizeof(OutType),
+                           dst + 2 * sizeof(OutType), dst + 3 * sizeof(OutType) };
+
+    lookup.apply(srcChannels, 4 * sizeof(InType), dstChannels, 4 * sizeof(OutType),
+                 long(in.size() / 4));
+}
+
+// Validate the lookup against the exact output codes of the pixels.
+template<OCIO::BitDepth inBD, OCIO::BitDepth outBD>
+void ValidateLookup(const OCIO::IntegerLookup & lookup,
+                    const std::vector<typename OCIO::BitDepthInfo<inBD>::Type> & in,
+                    int tolerance, unsigned line)
+{
+    typedef typename OCIO::BitDepthInfo<outBD>::Type OutType;
+
+    const long numPixels = long(in.size() / 4);
+    const bool crosstalk = lookup.getType() != OCIO::IntegerLookup::TYPE_1D;
+
+    std::vector<OutType> ref(4 * numPixels);
+    EvalOut<inBD, outBD>(in.data(), ref.data(), numPixels, crosstalk);
+
+    std::vector<OutType> res(4 * numPixels);
+    ApplyRGBA(lookup, in, res);
+
+    int maxDiff = 0;
+    for (long idx = 0; idx < 4 * numPixels; ++idx)
+    {
+        maxDiff = std::max(maxDiff, std::abs(int(ref[idx]) - int(res[idx])));
+    }
+    OCIO_CHECK_ASSERT_MESSAGE_FROM(maxDiff <= tolerance,
+                                   "Max difference of " + std::to_string(maxDiff) + " codes",
+                                   line);
+}
+
+// Pixels of all the codes for the channels, and of random RGB codes.
+template<OCIO::BitDepth inBD>
+std::vector<typename OCIO::BitDepthInfo<inBD>::Type> GetPixels(long numRandomPixels)
+{
+    typedef typename OCIO::BitDepthInfo<inBD>::Type InType;
+    constexpr long numCodes = long(OCIO::BitDepthInfo<inBD>::maxValue) + 1;
+
+    std::vector<InType> pixels;
+    for (long code = 0; code < numCodes; ++code)
+    {
+        const InType c = InType(code);
+        const InType pixel[]{ c, c, c, c,
+                              c, 0, 0, c,
+                              0, c, 0, c,
+                              0, 0, c, c };
+        pixels.insert(pixels.end(), pixel, pixel + 16);
+    }
+
+    unsigned seed = 1;
+    for (long idx = 0; idx < 4 * numRandomPixels; ++idx)
+    {
+        seed = seed * 1103515245u + 12345u;
+        pixels.push_back(InType((seed >> 8) % numCodes));
+    }
+
+    return pixels;
+}
+
+} // anon.
+
+OCIO_ADD_TEST(IntegerLookup, get_type)
+{
+    OCIO::IntegerLookup::Type type = OCIO::IntegerLookup::TYPE_3D;
+
+    const double scale[4]{ 0.5, 1.0, 2.0, 1.0 };
+    const double matrix[16]{ 0.6, 0.3, 0.1, 0.0,
+                             0.2, 0.7, 0.1, 0.0,
+                             0.1, 0.1, 0.8, 0.0,
+                             0.0, 0.0, 0.0, 1.0 };
+
+    // Separable ops.
+
+    OCIO::OpRcPtrVec ops;
+    OCIO::CreateScaleOp(ops, scale, OCIO::TRANSFORM_DIR_FORWARD);
+    ops.finalize();
+
+    OCIO_CHECK_ASSERT(OCIO::IntegerLookup::GetType(ops, OCIO::BIT_DEPTH_UINT8,
+                                                   OCIO::BIT_DEPTH_UINT16,
+                                                   OCIO::OPTIMIZATION_DEFAULT, type));
+    OCIO_CHECK_EQUAL(type, OCIO::IntegerLookup::TYPE_1D);
+
+    OCIO_CHECK_ASSERT(!OCIO::IntegerLookup::GetType(ops, OCIO::BIT_DEPTH_UINT8,
+                                                    OCIO::BIT_DEPTH_UINT16,
+                                                    OCIO::OPTIMIZATION_LOSSLESS, type));
+
+    // Only for integer bit-depths.
+    OCIO_CHECK_ASSERT(!OCIO::IntegerLookup::GetType(ops, OCIO::BIT_DEPTH_F16,
+                                                    OCIO::BIT_DEPTH_UINT16,
+                                                    OCIO::OPTIMIZATION_DEFAULT, type));
+    OCIO_CHECK_ASSERT(!OCIO::IntegerLookup::GetType(ops, OCIO::BIT_DEPTH_UINT8,
+                                                    OCIO::BIT_DEPTH_F32,
+                                                    OCIO::OPTIMIZATION_DEFAULT, type));
+
+    // Ops with channel crosstalk.
+
+    OCIO::CreateMatrixOp(ops, matrix, OCIO::TRANSFORM_DIR_FORWARD);
+    ops.finalize();
+
+    OCIO_CHECK_ASSERT(!OCIO::IntegerLookup::GetType(ops, OCIO::BIT_DEPTH_UINT10,
+                                                    OCIO::BIT_DEPTH_UINT10,
+                                                    OCIO::OPTIMIZATION_DEFAULT, type));
+
+    const OCIO::OptimizationFlags flags
+        = OCIO::OptimizationFlags(OCIO::OPTIMIZATION_DEFAULT | OCIO::OPTIMIZATION_INTEGER_LOOKUP);
+
+    OCIO_CHECK_ASSERT(OCIO::IntegerLookup::GetType(ops, OCIO::BIT_DEPTH_UINT10,
+                                                   OCIO::BIT_DEPTH_UINT10, flags, type));
+    OCIO_CHECK_EQUAL(type, OCIO::IntegerLookup::TYPE_3D);
+
+    // The alpha channel must be independent from the RGB channels.
+
+    double alphaMatrix[16];
+    std::copy(matrix, matrix + 16, alphaMatrix);
+    alphaMatrix[14] = 0.1;
+
+    OCIO::CreateMatrixOp(ops, alphaMatrix, OCIO::TRANSFORM_DIR_FORWARD);
+    ops.finalize();
+
+    OCIO_CHECK_ASSERT(!OCIO::IntegerLookup::GetType(ops, OCIO::BIT_DEPTH_UINT10,
+                                                    OCIO::BIT_DEPTH_UINT10, flags, type));
+}
+
+OCIO_ADD_TEST(IntegerLookup, lookup_1d)
+{
+    {
+        auto lookup = CreateLookup<OCIO::BIT_DEPTH_UINT8,
+                                   OCIO::BIT_DEPTH_UINT16>(OCIO::IntegerLookup::TYPE_1D, 65);
+        OCIO_CHECK_EQUAL(lookup->getType(), OCIO::IntegerLookup::TYPE_1D);
+        OCIO_CHECK_EQUAL(lookup->getGridSize(), 0);
+
+        ValidateLookup<OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_UINT16>(
+            *lookup, GetPixels<OCIO::BIT_DEPTH_UINT8>(1000), 0, __LINE__);
+    }
+
+    {
+        auto lookup = CreateLookup<OCIO::BIT_DEPTH_UINT16,
+                                   OCIO::BIT_DEPTH_UINT10>(OCIO::IntegerLookup::TYPE_1D, 0);
+
+        ValidateLookup<OCIO::BIT_DEPTH_UINT16, OCIO::BIT_DEPTH_UINT10>(
+            *lookup, GetPixels<OCIO::BIT_DEPTH_UINT16>(1000), 0, __LINE__);
+    }
+
+    // Process in-place a 10-bit RGB image in the BGR order i.e. without alpha.
+
+    auto lookup = CreateLookup<OCIO::BIT_DEPTH_UINT10,
+                               OCIO::BIT_DEPTH_UINT10>(OCIO::IntegerLookup::TYPE_1D, 0);
+
+    // Note that the codes above the maximum are clamped.
+    std::vector<uint16_t> img{ 0, 100, 1023, 512, 256, 2000 };
+
+    std::vector<uint16_t> ref(8);
+    const std::vector<uint16_t> refIn{ 1023, 100, 0, 0, 1023, 256, 512, 0 };
+    EvalOut<OCIO::BIT_DEPTH_UINT10, OCIO::BIT_DEPTH_UINT10>(refIn.data(), ref.data(), 2, false);
+
+    char * data = reinterpret_cast<char *>(img.data());
+    char * channels[4]{ data + 4, data + 2, data, nullptr };
+    lookup->apply(channels, 6, channels, 6, 2);
+
+    OCIO_CHECK_EQUAL(img[0], ref[2]);
+    OCIO_CHECK_EQUAL(img[1], ref[1]);
+    OCIO_CHECK_EQUAL(img[2], ref[0]);
+    OCIO_CHECK_EQUAL(img[3], ref[6]);
+    OCIO_CHECK_EQUAL(img[4], ref[5]);
+    OCIO_CHECK_EQUAL(img[5], ref[4]);
+}
+
+OCIO_ADD_TEST(IntegerLookup, lookup_3d)
+{
+    {
+        auto lookup = CreateLookup<OCIO::BIT_DEPTH_UINT8,
+                                   OCIO::BIT_DEPTH_UINT8>(OCIO::IntegerLookup::TYPE_3D, 65);
+        OCIO_CHECK_EQUAL(lookup->getType(), OCIO::IntegerLookup::TYPE_3D);
+        OCIO_CHECK_EQUAL(lookup->getGridSize(), 65);
+        OCIO_CHECK_EQUAL(lookup->getMaxError(), 1);
+
+        ValidateLookup<OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_UINT8>(
+            *lookup, GetPixels<OCIO::BIT_DEPTH_UINT8>(10000), 1, __LINE__);
+    }
+
+    {
+        auto lookup = CreateLookup<OCIO::BIT_DEPTH_UINT10,
+                                   OCIO::BIT_DEPTH_UINT10>(OCIO::IntegerLookup::TYPE_3D, 33);
+        OCIO_REQUIRE_ASSERT(lookup);
+
+        ValidateLookup<OCIO::BIT_DEPTH_UINT10, OCIO::BIT_DEPTH_UINT10>(
+            *lookup, GetPixels<OCIO::BIT_DEPTH_UINT10>(10000), 1, __LINE__);
+    }
+
+    // The same grid is too coarse for a 16-bit output i.e. the tolerance is one output code.
+
+    OCIO_CHECK_ASSERT(!(CreateLookup<OCIO::BIT_DEPTH_UINT10,
+                                     OCIO::BIT_DEPTH_UINT16>(OCIO::IntegerLookup::TYPE_3D, 33)));
+
+    {
+        auto lookup = CreateLookup<OCIO::BIT_DEPTH_UINT16,
+                                   OCIO::BIT_DEPTH_UINT12>(OCIO::IntegerLookup::TYPE_3D, 65);
+
+        ValidateLookup<OCIO::BIT_DEPTH_UINT16, OCIO::BIT_DEPTH_UINT12>(
+            *lookup, GetPixels<OCIO::BIT_DEPTH_UINT16>(10000), 1, __LINE__);
+    }
+
+    // A grid of 2 nodes is far too coarse for the curve so the lookup is discarded.
+
+    OCIO_CHECK_ASSERT(!(CreateLookup<OCIO::BIT_DEPTH_UINT12,
+                                     OCIO::BIT_DEPTH_UINT16>(OCIO::IntegerLookup::TYPE_3D, 2)));
+
+    // Invalid grid sizes.
+
+    OCIO_CHECK_THROW_WHAT((CreateLookup<OCIO::BIT_DEPTH_UINT8,
+                                        OCIO::BIT_DEPTH_UINT8>(OCIO::IntegerLookup::TYPE_3D, 1)),
+                          OCIO::Exception,
+                          "Invalid grid size for an integer lookup.");
+
+    OCIO_CHECK_THROW_WHAT((CreateLookup<OCIO::BIT_DEPTH_UINT8,
+                                        OCIO::BIT_DEPTH_UINT8>(OCIO::IntegerLookup::TYPE_3D, 257)),
+                          OCIO::Exception,
+                          "Invalid grid size for an integer lookup.");
+}
+
+OCIO_ADD_TEST(IntegerLookup, lookup_3d_exact)
+{
+    // All the 8-bit RGB codes are in the table.
+
+    auto lookup = CreateLookup<OCIO::BIT_DEPTH_UINT8,
+                               OCIO::BIT_DEPTH_UINT16>(OCIO::IntegerLookup::TYPE_3D, 256);
+    OCIO_CHECK_EQUAL(lookup->getType(), OCIO::IntegerLookup::TYPE_3D_EXACT);
+    OCIO_CHECK_EQUAL(lookup->getGridSize(), 256);
+    OCIO_CHECK_EQUAL(lookup->getMaxError(), 0);
+
+    ValidateLookup<OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_UINT16>(
+        *lookup, GetPixels<OCIO::BIT_DEPTH_UINT8>(10000), 0, __LINE__);
+}
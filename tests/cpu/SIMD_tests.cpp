@@ -73,6 +73,11 @@ OCIO_ADD_TEST_AVX2(packed_uint16_to_f32_test)
 #endif
 OCIO_ADD_TEST_AVX2(packed_nan_inf_test)
 OCIO_ADD_TEST_AVX2(packed_all_test)
+OCIO_ADD_TEST_AVX2(matrix_test)
+OCIO_ADD_TEST_AVX2(scale_test)
+OCIO_ADD_TEST_AVX2(cdl_test)
+OCIO_ADD_TEST_AVX2(log_test)
+OCIO_ADD_TEST_AVX2(gamma_test)
 
 #endif
 
@@ -96,5 +101,10 @@ OCIO_ADD_TEST_AVX512(packed_uint16_to_f32_test)
 OCIO_ADD_TEST_AVX512(packed_f16_to_f32_test)
 OCIO_ADD_TEST_AVX512(packed_nan_inf_test)
 OCIO_ADD_TEST_AVX512(packed_all_test)
+OCIO_ADD_TEST_AVX512(matrix_test)
+OCIO_ADD_TEST_AVX512(scale_test)
+OCIO_ADD_TEST_AVX512(cdl_test)
+OCIO_ADD_TEST_AVX512(log_test)
+OCIO_ADD_TEST_AVX512(gamma_test)
 
 #endif
\ No newline at end of file
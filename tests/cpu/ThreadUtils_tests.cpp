@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <atomic>
+#include <vector>
+
+#include "ThreadUtils.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(ThreadUtils, num_worker_threads)
+{
+    OCIO_CHECK_GE(OCIO::GetNumWorkerThreads(0), 1u);
+    OCIO_CHECK_EQUAL(OCIO::GetNumWorkerThreads(1), 1u);
+    OCIO_CHECK_EQUAL(OCIO::GetNumWorkerThreads(7), 7u);
+}
+
+OCIO_ADD_TEST(ThreadUtils, parallel_for)
+{
+    constexpr long numItems = 1001;
+
+    for (unsigned numThreads : { 0u, 1u, 2u, 8u })
+    {
+        for (long chunkSize : { 0L, 1L, 10L, 2000L })
+        {
+            std::vector<std::atomic<int>> visits(numItems);
+            for (auto & visit : visits)
+            {
+                visit = 0;
+            }
+
+            const unsigned maxWorkers = OCIO::GetNumWorkerThreads(numThreads);
+            std::vector<std::atomic<int>> workers(maxWorkers);
+            for (auto & worker : workers)
+            {
+                worker = 0;
+            }
+
+            // Note that the unit test macros are not thread-safe so the checks of the calls
+            // made by the worker threads are deferred.
+            std::atomic<int> invalidCalls{ 0 };
+
+            OCIO_CHECK_NO_THROW(OCIO::ParallelFor(numItems, chunkSize, numThreads,
+                [&](unsigned workerIndex, long begin, long end)
+                {
+                    if (workerIndex >= maxWorkers
+                        || begin >= end
+                        || end - begin > std::max(chunkSize, 1L))
+                    {
+                        ++invalidCalls;
+                        return;
+                    }
+
+                    // A worker index is never used by two threads at the same time.
+                    if (workers[workerIndex]++ != 0)
+                    {
+                        ++invalidCalls;
+                    }
+
+                    for (long idx = begin; idx < end; ++idx)
+                    {
+                        ++visits[idx];
+                    }
+
+                    --workers[workerIndex];
+                }));
+
+            OCIO_CHECK_EQUAL(invalidCalls.load(), 0);
+
+            // Each item is processed exactly once.
+            for (long idx = 0; idx < numItems; ++idx)
+            {
+                OCIO_CHECK_EQUAL(visits[idx].load(), 1);
+            }
+        }
+    }
+
+    // Nothing to process.
+    OCIO_CHECK_NO_THROW(OCIO::ParallelFor(0, 1, 4, [](unsigned, long, long)
+                                          {
+                                              throw OCIO::Exception("Unexpected call.");
+                                          }));
+}
+
+OCIO_ADD_TEST(ThreadUtils, parallel_for_exception)
+{
+    // The exception thrown by one of the workers is propagated to the calling thread.
+
+    std::atomic<long> numProcessed{ 0 };
+
+    OCIO_CHECK_THROW_WHAT(OCIO::ParallelFor(100, 1, 4,
+                                            [&](unsigned, long begin, long)
+                                            {
+                                                if (begin == 10)
+                                                {
+                                                    throw OCIO::Exception("Failed chunk.");
+                                                }
+                                                ++numProcessed;
+                                            }),
+                          OCIO::Exception,
+                          "Failed chunk.");
+
+    OCIO_CHECK_LT(numProcessed.load(), 100);
+}
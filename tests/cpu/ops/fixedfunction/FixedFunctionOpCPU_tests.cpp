@@ -557,3 +557,228 @@ OCIO_ADD_TEST(FixedFunctionOpCPU, XYZ_TO_LUV)
     img = outputFrame;
     ApplyFixedFunction(&img[0], &inputFrame[0], 2, dataFInv, 1e-5f, __LINE__);
 }
+
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+namespace
+{
+template<typename Renderer, OCIO::ACESRenderParams::Style STYLE, typename... Args>
+void ValidateACESRendererSIMD(OCIO::ACESApplyFunc * applyFunc,
+                              OCIO::FixedFunctionOpData::Style style,
+                              const OCIO::FixedFunctionOpData::Params & params,
+                              int lineNo,
+                              Args... args)
+{
+    OCIO::ConstFixedFunctionOpDataRcPtr fnData
+        = std::make_shared<OCIO::FixedFunctionOpData>(style, params);
+
+    OCIO::ConstOpCPURcPtr ref = std::make_shared<Renderer>(fnData, args...);
+    OCIO::ConstOpCPURcPtr op
+        = std::make_shared<OCIO::ACESRendererSIMD<Renderer, STYLE>>(applyFunc, fnData, args...);
+
+    // Pixels exercising the branches (i.e. null achromatic, hue window & glow ranges) of the
+    // scalar renderers.
+    const std::vector<float> special {
+        0.0f,  0.0f,  0.0f, 1.0f,
+       -0.0f,  0.0f, -0.0f, 0.5f,
+        0.5f,  0.5f,  0.5f, 1.0f,
+        0.8f,  0.1f,  0.1f, 1.0f,
+        0.8f,  0.1f,  0.3f, 1.0f,
+        0.8f,  0.3f,  0.1f, 1.0f,
+        0.05f, 0.01f, 0.0f, 1.0f,
+       -0.5f,  0.0f,  0.2f, 1.0f,
+        2.5f, -1.5f,  0.4f, 1.0f,
+        0.4f,  1.5f, -0.3f, 1.0f };
+
+    // Cover all the remainders of the main loop.
+    for (long numPixels = 1; numPixels <= 37; ++numPixels)
+    {
+        std::vector<float> src(numPixels * 4);
+        for (size_t idx = 0; idx < src.size(); ++idx)
+        {
+            src[idx] = idx < special.size() ? special[idx] : -0.2f + float(idx % 29) * 0.05f;
+        }
+
+        std::vector<float> expected(src.size());
+        ref->apply(src.data(), expected.data(), numPixels);
+
+        std::vector<float> dst(src.size());
+        op->apply(src.data(), dst.data(), numPixels);
+
+        for (size_t idx = 0; idx < expected.size(); ++idx)
+        {
+            if (OCIO::FloatsDiffer(expected[idx], dst[idx], 0, false))
+            {
+                std::ostringstream errorMsg;
+                errorMsg.precision(14);
+                errorMsg << "Style: " << OCIO::FixedFunctionOpData::ConvertStyleToString(style, false);
+                errorMsg << " - Index: " << idx;
+                errorMsg << " - Values: " << dst[idx] << " expected: " << expected[idx];
+                OCIO_CHECK_ASSERT_MESSAGE_FROM(0, errorMsg.str(), lineNo);
+            }
+        }
+    }
+}
+}
+
+OCIO_ADD_TEST(FixedFunctionOpCPU, aces_simd)
+{
+    // The vectorized renderers must produce the same results as the scalar renderers.
+
+    std::vector<OCIO::ACESApplyFunc *> funcs;
+#if OCIO_USE_SSE2
+    if (OCIO::CPUInfo::instance().hasSSE2()) funcs.push_back(OCIO::applyACESSSE2);
+#endif
+#if OCIO_USE_AVX2
+    if (OCIO::CPUInfo::instance().hasAVX2()) funcs.push_back(OCIO::applyACESAVX2);
+#endif
+#if OCIO_USE_AVX512
+    if (OCIO::CPUInfo::instance().hasAVX512()) funcs.push_back(OCIO::applyACESAVX512);
+#endif
+
+    typedef OCIO::FixedFunctionOpData FFD;
+    typedef OCIO::ACESRenderParams RP;
+
+    const FFD::Params gamutComp{ 1.147, 1.264, 1.312, 0.815, 0.803, 0.880, 1.2 };
+
+    for (auto func : funcs)
+    {
+        ValidateACESRendererSIMD<OCIO::Renderer_ACES_RedMod10_Fwd, RP::RED_MOD_10_FWD>(
+            func, FFD::ACES_RED_MOD_10_FWD, {}, __LINE__);
+        ValidateACESRendererSIMD<OCIO::Renderer_ACES_RedMod10_Inv, RP::RED_MOD_10_INV>(
+            func, FFD::ACES_RED_MOD_10_INV, {}, __LINE__);
+        ValidateACESRendererSIMD<OCIO::Renderer_ACES_Glow03_Fwd, RP::GLOW_03_FWD>(
+            func, FFD::ACES_GLOW_03_FWD, {}, __LINE__, 0.075f, 0.1f);
+        ValidateACESRendererSIMD<OCIO::Renderer_ACES_Glow03_Inv, RP::GLOW_03_INV>(
+            func, FFD::ACES_GLOW_03_INV, {}, __LINE__, 0.075f, 0.1f);
+        ValidateACESRendererSIMD<OCIO::Renderer_ACES_Glow03_Fwd, RP::GLOW_03_FWD>(
+            func, FFD::ACES_GLOW_10_FWD, {}, __LINE__, 0.05f, 0.08f);
+        ValidateACESRendererSIMD<OCIO::Renderer_ACES_Glow03_Inv, RP::GLOW_03_INV>(
+            func, FFD::ACES_GLOW_10_INV, {}, __LINE__, 0.05f, 0.08f);
+        ValidateACESRendererSIMD<OCIO::Renderer_ACES_DarkToDim10_Fwd, RP::SURROUND>(
+            func, FFD::ACES_DARK_TO_DIM_10_FWD, {}, __LINE__, 0.9811f);
+        ValidateACESRendererSIMD<OCIO::Renderer_ACES_DarkToDim10_Fwd, RP::SURROUND>(
+            func, FFD::ACES_DARK_TO_DIM_10_INV, {}, __LINE__, 1.0192640913260627f);
+        ValidateACESRendererSIMD<OCIO::Renderer_ACES_GamutComp13_Fwd, RP::GAMUT_COMP_13_FWD>(
+            func, FFD::ACES_GAMUT_COMP_13_FWD, gamutComp, __LINE__);
+        ValidateACESRendererSIMD<OCIO::Renderer_REC2100_Surround, RP::SURROUND>(
+            func, FFD::REC2100_SURROUND_FWD, { 0.78 }, __LINE__);
+        ValidateACESRendererSIMD<OCIO::Renderer_REC2100_Surround, RP::SURROUND>(
+            func, FFD::REC2100_SURROUND_INV, { 0.78 }, __LINE__);
+    }
+
+    // The vectorized renderers do not depend on the fast log/exp/pow optimization.
+    typedef OCIO::ACESRendererSIMD<OCIO::Renderer_ACES_Glow03_Fwd, RP::GLOW_03_FWD> GlowSIMD;
+
+    OCIO::ConstFixedFunctionOpDataRcPtr fnData = std::make_shared<FFD>(FFD::ACES_GLOW_03_FWD);
+
+    OCIO::ConstOpCPURcPtr op = OCIO::GetFixedFunctionCPURenderer(fnData);
+    OCIO_CHECK_EQUAL(!funcs.empty(), bool(std::dynamic_pointer_cast<const GlowSIMD>(op)));
+}
+#endif
+
+#if OCIO_USE_SSE2 || OCIO_USE_AVX2 || OCIO_USE_AVX512
+namespace
+{
+template<typename Renderer, OCIO::ColorModelStyle STYLE>
+void ValidateColorModelSIMD(OCIO::ColorModelApplyFunc * applyFunc,
+                            OCIO::FixedFunctionOpData::Style style,
+                            int tolerance, // in ULPs
+                            int lineNo)
+{
+    OCIO::ConstFixedFunctionOpDataRcPtr fnData = std::make_shared<OCIO::FixedFunctionOpData>(style);
+
+    OCIO::ConstOpCPURcPtr ref = std::make_shared<Renderer>(fnData);
+    OCIO::ConstOpCPURcPtr op
+        = std::make_shared<OCIO::ColorModelRendererSIMD<Renderer, STYLE>>(applyFunc, fnData);
+
+    // Pixels exercising the branches (i.e. equal, zero & negative values) of the scalar renderers.
+    const std::vector<float> special {
+        0.5f,  0.5f,  0.5f, 1.0f,
+        0.0f,  0.0f,  0.0f, 0.0f,
+       -0.0f,  0.0f, -0.0f, 0.5f,
+        0.2f,  0.2f,  0.1f, 1.0f,
+        0.1f,  0.3f,  0.3f, 1.0f,
+       -0.5f,  0.0f,  0.2f, 1.0f,
+       -0.5f, -0.7f, -0.1f, 1.0f,
+        2.5f, -1.5f,  0.4f, 1.0f,
+        0.4f,  1.5f, -0.3f, 1.0f,
+        0.008856451679f, 0.008856451679f, 0.08f, 1.0f };
+
+    // Cover all the remainders of the main loop.
+    for (long numPixels = 1; numPixels <= 37; ++numPixels)
+    {
+        std::vector<float> src(numPixels * 4);
+        for (size_t idx = 0; idx < src.size(); ++idx)
+        {
+            src[idx] = idx < special.size() ? special[idx] : -0.2f + float(idx % 29) * 0.05f;
+        }
+
+        std::vector<float> expected(src.size());
+        ref->apply(src.data(), expected.data(), numPixels);
+
+        std::vector<float> dst(src.size());
+        op->apply(src.data(), dst.data(), numPixels);
+
+        for (size_t idx = 0; idx < expected.size(); ++idx)
+        {
+            if (OCIO::FloatsDiffer(expected[idx], dst[idx], tolerance, false))
+            {
+                std::ostringstream errorMsg;
+                errorMsg.precision(14);
+                errorMsg << "Style: " << OCIO::FixedFunctionOpData::ConvertStyleToString(style, false);
+                errorMsg << " - Index: " << idx;
+                errorMsg << " - Values: " << dst[idx] << " expected: " << expected[idx];
+                OCIO_CHECK_ASSERT_MESSAGE_FROM(0, errorMsg.str(), lineNo);
+            }
+        }
+    }
+}
+}
+
+OCIO_ADD_TEST(FixedFunctionOpCPU, color_model_simd)
+{
+    // The vectorized renderers must produce the same results as the scalar renderers except
+    // for the cube root of the forward LUV.
+
+    std::vector<OCIO::ColorModelApplyFunc *> funcs;
+#if OCIO_USE_SSE2
+    if (OCIO::CPUInfo::instance().hasSSE2()) funcs.push_back(OCIO::applyColorModelSSE2);
+#endif
+#if OCIO_USE_AVX2
+    if (OCIO::CPUInfo::instance().hasAVX2()) funcs.push_back(OCIO::applyColorModelAVX2);
+#endif
+#if OCIO_USE_AVX512
+    if (OCIO::CPUInfo::instance().hasAVX512()) funcs.push_back(OCIO::applyColorModelAVX512);
+#endif
+
+    typedef OCIO::FixedFunctionOpData FFD;
+
+    for (auto func : funcs)
+    {
+        ValidateColorModelSIMD<OCIO::Renderer_RGB_TO_HSV, OCIO::COLOR_MODEL_RGB_TO_HSV>(
+            func, FFD::RGB_TO_HSV, 0, __LINE__);
+        ValidateColorModelSIMD<OCIO::Renderer_HSV_TO_RGB, OCIO::COLOR_MODEL_HSV_TO_RGB>(
+            func, FFD::HSV_TO_RGB, 0, __LINE__);
+        ValidateColorModelSIMD<OCIO::Renderer_XYZ_TO_xyY, OCIO::COLOR_MODEL_XYZ_TO_xyY>(
+            func, FFD::XYZ_TO_xyY, 0, __LINE__);
+        ValidateColorModelSIMD<OCIO::Renderer_xyY_TO_XYZ, OCIO::COLOR_MODEL_xyY_TO_XYZ>(
+            func, FFD::xyY_TO_XYZ, 0, __LINE__);
+        ValidateColorModelSIMD<OCIO::Renderer_XYZ_TO_uvY, OCIO::COLOR_MODEL_XYZ_TO_uvY>(
+            func, FFD::XYZ_TO_uvY, 0, __LINE__);
+        ValidateColorModelSIMD<OCIO::Renderer_uvY_TO_XYZ, OCIO::COLOR_MODEL_uvY_TO_XYZ>(
+            func, FFD::uvY_TO_XYZ, 0, __LINE__);
+        ValidateColorModelSIMD<OCIO::Renderer_XYZ_TO_LUV, OCIO::COLOR_MODEL_XYZ_TO_LUV>(
+            func, FFD::XYZ_TO_LUV, 8, __LINE__);
+        ValidateColorModelSIMD<OCIO::Renderer_LUV_TO_XYZ, OCIO::COLOR_MODEL_LUV_TO_XYZ>(
+            func, FFD::LUV_TO_XYZ, 0, __LINE__);
+    }
+
+    // The vectorized renderers do not depend on the fast log/exp/pow optimization.
+    typedef OCIO::ColorModelRendererSIMD<OCIO::Renderer_RGB_TO_HSV, OCIO::COLOR_MODEL_RGB_TO_HSV> HSVSIMD;
+
+    OCIO::ConstFixedFunctionOpDataRcPtr fnData = std::make_shared<FFD>(FFD::RGB_TO_HSV);
+
+    OCIO::ConstOpCPURcPtr op = OCIO::GetFixedFunctionCPURenderer(fnData);
+    OCIO_CHECK_EQUAL(!funcs.empty(), bool(std::dynamic_pointer_cast<const HSVSIMD>(op)));
+}
+#endif
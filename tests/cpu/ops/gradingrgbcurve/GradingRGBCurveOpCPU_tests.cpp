@@ -440,3 +440,112 @@ OCIO_ADD_TEST(GradingRGBCurveOpCPU, slopes)
     OCIO_CHECK_NO_THROW(op->apply(rev_input_32f, rev_input_32f, num_samples));
     ValidateImage(rev_expected_32f, rev_input_32f, num_samples, __LINE__);
 }
+
+namespace
+{
+// Renderer forced to use the scalar implementation.
+template<typename Renderer>
+class ScalarRenderer : public Renderer
+{
+public:
+    explicit ScalarRenderer(OCIO::ConstGradingRGBCurveOpDataRcPtr & gc)
+        : Renderer(gc)
+    {
+        this->m_applyFunc = nullptr;
+    }
+};
+
+template<typename Renderer>
+void ValidateCurveSIMD(OCIO::GradingRGBCurveApplyFunc * applyFunc,
+                       OCIO::GradingRGBCurveOpDataRcPtr & gc, int lineNo)
+{
+    OCIO::ConstGradingRGBCurveOpDataRcPtr gcc = gc;
+    OCIO::ConstOpCPURcPtr ref = std::make_shared<ScalarRenderer<Renderer>>(gcc);
+
+    const bool linToLog = gc->getStyle() == OCIO::GRADING_LIN;
+    const float minVal = linToLog ? -0.1f : -8.f;
+    const float maxVal = linToLog ? 60.f : 8.f;
+
+    // Cover all the remainders of the main loop.
+    for (long numPixels = 1; numPixels <= 37; ++numPixels)
+    {
+        std::vector<float> src(numPixels * 4);
+        for (size_t idx = 0; idx < src.size(); ++idx)
+        {
+            src[idx] = minVal + (maxVal - minVal) * float((idx * 37) % 101) / 100.f;
+        }
+
+        std::vector<float> expected(src.size());
+        ref->apply(src.data(), expected.data(), numPixels);
+
+        std::vector<float> dst(src.size());
+        applyFunc(gc->getDynamicPropertyInternal()->getKnotsCoefs(), gc->getDirection(),
+                  linToLog, src.data(), dst.data(), numPixels);
+
+        for (size_t idx = 0; idx < expected.size(); ++idx)
+        {
+            if (OCIO::FloatsDiffer(expected[idx], dst[idx], 0, false))
+            {
+                std::ostringstream errorMsg;
+                errorMsg.precision(14);
+                errorMsg << "Index: " << idx;
+                errorMsg << " - Values: " << dst[idx] << " expected: " << expected[idx];
+                OCIO_CHECK_ASSERT_MESSAGE_FROM(0, errorMsg.str(), lineNo);
+            }
+        }
+    }
+}
+}
+
+OCIO_ADD_TEST(GradingRGBCurveOpCPU, simd)
+{
+    // The vectorized implementations must produce the same results as the scalar renderers.
+
+    std::vector<OCIO::GradingRGBCurveApplyFunc *> funcs;
+#if OCIO_USE_SSE2
+    if (OCIO::CPUInfo::instance().hasSSE2()) funcs.push_back(OCIO::applyGradingRGBCurveSSE2);
+#endif
+#if OCIO_USE_AVX2
+    if (OCIO::CPUInfo::instance().hasAVX2()) funcs.push_back(OCIO::applyGradingRGBCurveAVX2);
+#endif
+#if OCIO_USE_AVX512
+    if (OCIO::CPUInfo::instance().hasAVX512()) funcs.push_back(OCIO::applyGradingRGBCurveAVX512);
+#endif
+
+    // Several segments per curve, flat end slopes & an identity curve.
+    auto rnc = OCIO::GradingBSplineCurve::Create({ { 0.1f, 0.15f }, { 0.55f, 0.45f }, { 0.9f, 1.1f } });
+    auto gnc = OCIO::GradingBSplineCurve::Create({ { 0.1f, 0.15f }, { 0.55f, 0.35f }, { 0.9f, 1.1f } });
+    auto mnc = OCIO::GradingBSplineCurve::Create({
+            {-5.26017743f, -4.f},
+            {-3.75502745f, -3.57868829f},
+            {-2.24987747f, -1.82131329f},
+            {-0.74472749f,  0.68124124f},
+            { 1.06145248f,  2.87457742f},
+            { 2.86763245f,  3.83406206f},
+            { 4.67381243f,  4.f}
+        });
+    const float slopes[] = { 0.f, 0.55982688f, 1.77532247f, 1.55f, 0.8787017f, 0.18374463f, 0.f };
+    for (size_t i = 0; i < 7; ++i)
+    {
+        mnc->setSlope(i, slopes[i]);
+    }
+    auto bnc = OCIO::GradingBSplineCurve::Create({ { 0.f, 0.f }, { 1.f, 1.f } });
+
+    OCIO::ConstGradingBSplineCurveRcPtr r = rnc;
+    OCIO::ConstGradingBSplineCurveRcPtr g = gnc;
+    OCIO::ConstGradingBSplineCurveRcPtr b = bnc;
+    OCIO::ConstGradingBSplineCurveRcPtr m = mnc;
+
+    for (auto func : funcs)
+    {
+        auto gc = std::make_shared<OCIO::GradingRGBCurveOpData>(OCIO::GRADING_LOG, r, g, b, m);
+        ValidateCurveSIMD<OCIO::GradingRGBCurveFwdOpCPU>(func, gc, __LINE__);
+        gc->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+        ValidateCurveSIMD<OCIO::GradingRGBCurveRevOpCPU>(func, gc, __LINE__);
+
+        gc = std::make_shared<OCIO::GradingRGBCurveOpData>(OCIO::GRADING_LIN, r, g, b, m);
+        ValidateCurveSIMD<OCIO::GradingRGBCurveLinearFwdOpCPU>(func, gc, __LINE__);
+        gc->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+        ValidateCurveSIMD<OCIO::GradingRGBCurveLinearRevOpCPU>(func, gc, __LINE__);
+    }
+}
@@ -503,3 +503,113 @@ OCIO_ADD_TEST(GradingToneOpCPU, lin_midtones)
     OCIO_CHECK_NO_THROW(op->apply(TS7::expected_32f, res, TS7::num_samples));
     ValidateImage(TS7::input_32f, res, TS7::num_samples, __LINE__);
 }
+
+namespace
+{
+// Renderer forced to use the scalar implementation.
+template<typename Renderer>
+class ScalarRenderer : public Renderer
+{
+public:
+    explicit ScalarRenderer(OCIO::ConstGradingToneOpDataRcPtr & gt)
+        : Renderer(gt)
+    {
+        this->m_applyFunc = nullptr;
+    }
+};
+
+template<typename Renderer>
+void ValidateToneSIMD(OCIO::GradingToneApplyFunc * applyFunc, OCIO::GradingStyle style,
+                      OCIO::TransformDirection dir, int lineNo)
+{
+    // Use values on both sides of the identity to exercise all the branches of the zones.
+    OCIO::GradingTone gtd(style);
+    auto setRGBM = [](OCIO::GradingRGBMSW & val, double r, double g, double b, double m)
+    {
+        val.m_red    = r;
+        val.m_green  = g;
+        val.m_blue   = b;
+        val.m_master = m;
+    };
+    setRGBM(gtd.m_midtones,   1.3, 0.7, 1.0, 1.2);
+    setRGBM(gtd.m_highlights, 0.6, 1.4, 1.0, 1.2);
+    setRGBM(gtd.m_shadows,    1.5, 0.8, 1.0, 0.7);
+    setRGBM(gtd.m_whites,     0.6, 1.4, 1.0, 1.3);
+    setRGBM(gtd.m_blacks,     1.3, 0.7, 1.0, 0.6);
+    gtd.m_scontrast = 1.4;
+
+    auto gt = std::make_shared<OCIO::GradingToneOpData>(style);
+    gt->setDirection(dir);
+    gt->setValue(gtd);
+    OCIO::ConstGradingToneOpDataRcPtr gtc = gt;
+
+    OCIO::ConstOpCPURcPtr ref = std::make_shared<ScalarRenderer<Renderer>>(gtc);
+
+    const bool linToLog = style == OCIO::GRADING_LIN;
+    const float minVal = linToLog ? -0.1f : -0.5f;
+    const float maxVal = linToLog ? 60.f : 1.5f;
+
+    // Cover all the remainders of the main loop.
+    for (long numPixels = 1; numPixels <= 37; ++numPixels)
+    {
+        std::vector<float> src(numPixels * 4);
+        for (size_t idx = 0; idx < src.size(); ++idx)
+        {
+            src[idx] = minVal + (maxVal - minVal) * float((idx * 37) % 101) / 100.f;
+        }
+
+        std::vector<float> expected(src.size());
+        ref->apply(src.data(), expected.data(), numPixels);
+
+        std::vector<float> dst(src.size());
+        applyFunc(gt->getValue(), gt->getDynamicPropertyInternal()->getComputedValue(),
+                  dir, linToLog, src.data(), dst.data(), numPixels);
+
+        for (size_t idx = 0; idx < expected.size(); ++idx)
+        {
+            // The alpha channel is left untouched.
+            const float exp = (idx % 4 == 3) ? src[idx] : expected[idx];
+            if (OCIO::FloatsDiffer(exp, dst[idx], 0, false))
+            {
+                std::ostringstream errorMsg;
+                errorMsg.precision(14);
+                errorMsg << "Index: " << idx;
+                errorMsg << " - Values: " << dst[idx] << " expected: " << exp;
+                OCIO_CHECK_ASSERT_MESSAGE_FROM(0, errorMsg.str(), lineNo);
+            }
+        }
+    }
+}
+}
+
+OCIO_ADD_TEST(GradingToneOpCPU, simd)
+{
+    // The vectorized implementations must produce the same results as the scalar renderers.
+
+    std::vector<OCIO::GradingToneApplyFunc *> funcs;
+#if OCIO_USE_SSE2
+    if (OCIO::CPUInfo::instance().hasSSE2()) funcs.push_back(OCIO::applyGradingToneSSE2);
+#endif
+#if OCIO_USE_AVX2
+    if (OCIO::CPUInfo::instance().hasAVX2()) funcs.push_back(OCIO::applyGradingToneAVX2);
+#endif
+#if OCIO_USE_AVX512
+    if (OCIO::CPUInfo::instance().hasAVX512()) funcs.push_back(OCIO::applyGradingToneAVX512);
+#endif
+
+    for (auto func : funcs)
+    {
+        ValidateToneSIMD<OCIO::GradingToneFwdOpCPU>(func, OCIO::GRADING_LOG,
+                                                    OCIO::TRANSFORM_DIR_FORWARD, __LINE__);
+        ValidateToneSIMD<OCIO::GradingToneRevOpCPU>(func, OCIO::GRADING_LOG,
+                                                    OCIO::TRANSFORM_DIR_INVERSE, __LINE__);
+        ValidateToneSIMD<OCIO::GradingToneFwdOpCPU>(func, OCIO::GRADING_VIDEO,
+                                                    OCIO::TRANSFORM_DIR_FORWARD, __LINE__);
+        ValidateToneSIMD<OCIO::GradingToneRevOpCPU>(func, OCIO::GRADING_VIDEO,
+                                                    OCIO::TRANSFORM_DIR_INVERSE, __LINE__);
+        ValidateToneSIMD<OCIO::GradingToneLinearFwdOpCPU>(func, OCIO::GRADING_LIN,
+                                                          OCIO::TRANSFORM_DIR_FORWARD, __LINE__);
+        ValidateToneSIMD<OCIO::GradingToneLinearRevOpCPU>(func, OCIO::GRADING_LIN,
+                                                          OCIO::TRANSFORM_DIR_INVERSE, __LINE__);
+    }
+}
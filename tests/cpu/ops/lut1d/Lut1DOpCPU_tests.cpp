@@ -2638,3 +2638,178 @@ OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_half_domain_hue_adjust)
     }
 }
 
+
+namespace
+{
+// Inverse renderer forced to use the scalar implementation.
+template<typename Renderer>
+class ScalarInvRenderer : public Renderer
+{
+public:
+    explicit ScalarInvRenderer(OCIO::ConstLut1DOpDataRcPtr & lut)
+        : Renderer(lut)
+    {
+        this->m_applyInvLutFunc = nullptr;
+    }
+
+    const OCIO::ComponentParams & getParams(int channel) const
+    {
+        return channel == 0 ? this->m_paramsR : (channel == 1 ? this->m_paramsG : this->m_paramsB);
+    }
+
+    float getScale() const { return this->m_scale; }
+};
+
+template<typename Renderer, OCIO::BitDepth outBD>
+void ValidateInvLutSIMD(const char * isa,
+                        OCIO::InvLut1DOpCPUApplyFunc * applyFunc,
+                        OCIO::ConstLut1DOpDataRcPtr & lut,
+                        int lineNo)
+{
+    typedef typename OCIO::BitDepthInfo<outBD>::Type OutType;
+
+    auto ref = std::make_shared<ScalarInvRenderer<Renderer>>(lut);
+
+    // Values outside of the LUT ranges, on the LUT entries & flat spots, and special values.
+    const float specials[] = { 0.f, -0.f, 1.f, -1.f, 0.1f, 0.2f, -2.f, 4.f, 0.25f, 1e-5f, -1e-5f,
+                               100.f, -100.f, 65504.f, -65504.f,
+                               std::numeric_limits<float>::infinity(),
+                              -std::numeric_limits<float>::infinity(),
+                               std::numeric_limits<float>::quiet_NaN() };
+    constexpr size_t numSpecials = sizeof(specials) / sizeof(float);
+
+    // Cover all the remainders of the main loop.
+    for (long numPixels = 1; numPixels <= 37; ++numPixels)
+    {
+        std::vector<float> src(numPixels * 4);
+        for (size_t idx = 0; idx < src.size(); ++idx)
+        {
+            const size_t pixel = idx / 4;
+            src[idx] = (pixel % 2 == 0) ? specials[(pixel / 2 + idx % 4) % numSpecials]
+                                        : -3.f + 7.f * float((idx * 37) % 101) / 100.f;
+        }
+
+        std::vector<OutType> expected(src.size());
+        ref->apply(src.data(), expected.data(), numPixels);
+
+        std::vector<OutType> dst(src.size());
+        applyFunc(ref->getParams(0), ref->getParams(1), ref->getParams(2), ref->getScale(),
+                  src.data(), dst.data(), numPixels);
+
+        for (size_t idx = 0; idx < expected.size(); ++idx)
+        {
+            if (OCIO::FloatsDiffer((float)expected[idx], (float)dst[idx], 0, false))
+            {
+                std::ostringstream errorMsg;
+                errorMsg.precision(14);
+                errorMsg << isa << " - Index: " << idx << " - Input: " << src[idx];
+                errorMsg << " - Values: " << (float)dst[idx] << " expected: " << (float)expected[idx];
+                OCIO_CHECK_ASSERT_MESSAGE_FROM(0, errorMsg.str(), lineNo);
+            }
+        }
+    }
+}
+
+template<template<OCIO::BitDepth, OCIO::BitDepth> class Renderer>
+void ValidateInvLutSIMD(OCIO::ConstLut1DOpDataRcPtr & lut, int lineNo)
+{
+    typedef OCIO::InvLut1DOpCPUApplyFunc * (GetFunc)(OCIO::BitDepth, OCIO::BitDepth, bool);
+    std::vector<std::pair<const char *, GetFunc *>> getters;
+#if OCIO_USE_SSE2
+    if (OCIO::CPUInfo::instance().hasSSE2()) getters.push_back({ "SSE2", OCIO::SSE2GetInvLut1DApplyFunc });
+#endif
+#if OCIO_USE_AVX2
+    if (OCIO::CPUInfo::instance().hasAVX2()) getters.push_back({ "AVX2", OCIO::AVX2GetInvLut1DApplyFunc });
+#endif
+#if OCIO_USE_AVX512
+    if (OCIO::CPUInfo::instance().hasAVX512()) getters.push_back({ "AVX512", OCIO::AVX512GetInvLut1DApplyFunc });
+#endif
+
+    const bool halfDomain = lut->isInputHalfDomain();
+    for (const auto & getter : getters)
+    {
+        OCIO::InvLut1DOpCPUApplyFunc * func = nullptr;
+
+        func = getter.second(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32, halfDomain);
+        OCIO_REQUIRE_ASSERT(func);
+        ValidateInvLutSIMD<Renderer<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>,
+                           OCIO::BIT_DEPTH_F32>(getter.first, func, lut, lineNo);
+
+        func = getter.second(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_UINT10, halfDomain);
+        OCIO_REQUIRE_ASSERT(func);
+        ValidateInvLutSIMD<Renderer<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_UINT10>,
+                           OCIO::BIT_DEPTH_UINT10>(getter.first, func, lut, lineNo);
+
+        func = getter.second(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F16, halfDomain);
+        if (func)
+        {
+            ValidateInvLutSIMD<Renderer<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F16>,
+                               OCIO::BIT_DEPTH_F16>(getter.first, func, lut, lineNo);
+        }
+
+        // Only the 32f input is vectorized.
+        OCIO_CHECK_ASSERT(!getter.second(OCIO::BIT_DEPTH_UINT16, OCIO::BIT_DEPTH_F32, halfDomain));
+    }
+}
+
+// Increasing with flat spots at both ends.
+float InvLutRed(float x)   { return std::min(std::max(x * 0.5f + 0.1f, -2.f), 4.f); }
+// Decreasing.
+float InvLutGreen(float x) { return -1.5f * x; }
+// Increasing with a flat spot in the middle.
+float InvLutBlue(float x)  { return x < 0.2f ? x : (x < 0.3f ? 0.2f : x - 0.1f); }
+}
+
+OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_simd)
+{
+    // The vectorized inverse evaluations must produce the same results as the scalar renderers.
+
+    {
+        constexpr unsigned long dim = 1000;
+        OCIO::Lut1DOpDataRcPtr lutData = std::make_shared<OCIO::Lut1DOpData>(dim);
+
+        OCIO::Array::Values & values = lutData->getArray().getValues();
+        for (unsigned long i = 0; i < dim; ++i)
+        {
+            const float x = -1.f + 3.f * (float)i / (float)(dim - 1);
+            values[i * 3 + 0] = InvLutRed(x * 5.f);
+            values[i * 3 + 1] = InvLutGreen(x);
+            values[i * 3 + 2] = InvLutBlue(x);
+        }
+
+        auto invLut = lutData->inverse();
+        OCIO_CHECK_NO_THROW(invLut->validate());
+        OCIO_CHECK_NO_THROW(invLut->finalize());
+
+        OCIO::ConstLut1DOpDataRcPtr constInvLut = invLut;
+        ValidateInvLutSIMD<OCIO::InvLut1DRenderer>(constInvLut, __LINE__);
+    }
+
+    {
+        // By default, this constructor creates an 'identity LUT'.
+        OCIO::Lut1DOpDataRcPtr lutData
+            = std::make_shared<OCIO::Lut1DOpData>(OCIO::Lut1DOpData::LUT_INPUT_HALF_CODE,
+                                                  65536, false);
+
+        OCIO::Array::Values & values = lutData->getArray().getValues();
+        for (unsigned long i = 0; i < 65536; ++i)
+        {
+            half h;
+            h.setBits((unsigned short)i);
+            if (!h.isNan() && !h.isInfinity())
+            {
+                const float x = h;
+                values[i * 3 + 0] = InvLutRed(x);
+                values[i * 3 + 1] = InvLutGreen(x);
+                values[i * 3 + 2] = InvLutBlue(x);
+            }
+        }
+
+        auto invLut = lutData->inverse();
+        OCIO_CHECK_NO_THROW(invLut->validate());
+        OCIO_CHECK_NO_THROW(invLut->finalize());
+
+        OCIO::ConstLut1DOpDataRcPtr constInvLut = invLut;
+        ValidateInvLutSIMD<OCIO::InvLut1DRendererHalfCode>(constInvLut, __LINE__);
+    }
+}
@@ -2,7 +2,9 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <cmath>
 #include <limits>
+#include <vector>
 
 #include "ops/lut3d/Lut3DOpCPU.cpp"
 
@@ -55,3 +57,50 @@ OCIO_ADD_TEST(Lut3DRenderer, nan_tetra_test)
     Lut3DRendererNaNTest(OCIO::INTERP_TETRAHEDRAL);
 }
 
+OCIO_ADD_TEST(Lut3DRenderer, inv_round_trip)
+{
+    // The LUT is big enough for its range tree to be built by several chunks.
+    constexpr unsigned long dim = 33;
+    OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_TETRAHEDRAL, dim);
+
+    float * values = &lut->getArray().getValues()[0];
+    for (unsigned long idx = 0; idx < dim * dim * dim; ++idx)
+    {
+        const float r = values[3 * idx + 0];
+        const float g = values[3 * idx + 1];
+        const float b = values[3 * idx + 2];
+        values[3 * idx + 0] = 0.8f * r * r + 0.1f * g + 0.1f * b;
+        values[3 * idx + 1] = 0.1f * r + 0.8f * std::sqrt(g) + 0.1f * b;
+        values[3 * idx + 2] = 0.05f * r + 0.05f * g + 0.9f * b;
+    }
+
+    OCIO::ConstLut3DOpDataRcPtr fwdLut = lut->clone();
+    OCIO::ConstOpCPURcPtr fwdRenderer = OCIO::GetLut3DRenderer(fwdLut);
+
+    lut->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    OCIO::ConstLut3DOpDataRcPtr invLut = lut;
+    OCIO::ConstOpCPURcPtr invRenderer = OCIO::GetLut3DRenderer(invLut);
+
+    // Values in the LUT range round-trip through the inverse and forward LUTs.
+    constexpr long numPixels = 1000;
+    std::vector<float> pixels(4 * numPixels);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        pixels[4 * idx + 0] = 0.05f + 0.1f * float(idx % 10);
+        pixels[4 * idx + 1] = 0.05f + 0.1f * float((idx / 10) % 10);
+        pixels[4 * idx + 2] = 0.05f + 0.1f * float(idx / 100);
+        pixels[4 * idx + 3] = 1.0f;
+    }
+    fwdRenderer->apply(pixels.data(), pixels.data(), numPixels);
+
+    std::vector<float> inverse(4 * numPixels);
+    invRenderer->apply(pixels.data(), inverse.data(), numPixels);
+
+    std::vector<float> roundTrip(4 * numPixels);
+    fwdRenderer->apply(inverse.data(), roundTrip.data(), numPixels);
+
+    for (long idx = 0; idx < 4 * numPixels; ++idx)
+    {
+        OCIO_CHECK_CLOSE(roundTrip[idx], pixels[idx], 1e-4f);
+    }
+}
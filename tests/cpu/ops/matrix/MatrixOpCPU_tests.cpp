@@ -120,3 +120,86 @@ OCIO_ADD_TEST(MatrixOpCPU, matrix_renderer)
     OCIO_CHECK_EQUAL(rgba[3], 2.f);
 }
 
+
+OCIO_ADD_TEST(MatrixOpCPU, pixel_layouts)
+{
+    // The packed RGBA (whatever the instruction set is), planar and packed RGB processings
+    // must give exactly the same results.
+
+    constexpr long numPixels = 37;
+
+    std::vector<float> rgba(numPixels * 4);
+    for (size_t idx = 0; idx < rgba.size(); ++idx)
+    {
+        // The alpha is 0 to also compare with the packed RGB processing.
+        rgba[idx] = (idx % 4 == 3) ? 0.0f : -0.3f + 1.7f * float((idx * 13) % 97) / 97.0f;
+    }
+
+    std::vector<float> planes(numPixels * 4);
+    std::vector<float> rgb(numPixels * 3);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        for (long c = 0; c < 4; ++c)
+        {
+            planes[c * numPixels + idx] = rgba[4 * idx + c];
+        }
+        for (long c = 0; c < 3; ++c)
+        {
+            rgb[3 * idx + c] = rgba[4 * idx + c];
+        }
+    }
+
+    auto validate = [&](OCIO::MatrixOpDataRcPtr & mat, unsigned lineNo)
+    {
+        OCIO::ConstMatrixOpDataRcPtr m = OCIO::DynamicPtrCast<const OCIO::MatrixOpData>(mat);
+        OCIO::ConstOpCPURcPtr op = OCIO::GetMatrixRenderer(m);
+        OCIO_REQUIRE_ASSERT(op->hasPlanarApply());
+        OCIO_REQUIRE_ASSERT(op->hasPackedRGBApply());
+
+        std::vector<float> resRGBA(rgba.size());
+        op->apply(&rgba[0], &resRGBA[0], numPixels);
+
+        std::vector<float> resPlanes = planes;
+        op->applyPlanar(&resPlanes[0], &resPlanes[numPixels],
+                        &resPlanes[2 * numPixels], &resPlanes[3 * numPixels], numPixels);
+
+        std::vector<float> resRGB(rgb.size());
+        op->applyPackedRGB(&rgb[0], &resRGB[0], numPixels);
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            for (long c = 0; c < 4; ++c)
+            {
+                OCIO_CHECK_EQUAL_FROM(resPlanes[c * numPixels + idx], resRGBA[4 * idx + c],
+                                      lineNo);
+            }
+            for (long c = 0; c < 3; ++c)
+            {
+                OCIO_CHECK_EQUAL_FROM(resRGB[3 * idx + c], resRGBA[4 * idx + c], lineNo);
+            }
+        }
+    };
+
+    OCIO::MatrixOpDataRcPtr scale(OCIO::MatrixOpData::CreateDiagonalMatrix(1.1));
+    validate(scale, __LINE__);
+
+    scale->setOffsetValue(0, 0.1);
+    scale->setOffsetValue(1, -0.2);
+    scale->setOffsetValue(2, 0.3);
+    validate(scale, __LINE__);
+
+    OCIO::MatrixOpDataRcPtr matrix(OCIO::MatrixOpData::CreateDiagonalMatrix(0.9));
+    matrix->setArrayValue(1, 0.13);
+    matrix->setArrayValue(2, 0.27);
+    matrix->setArrayValue(3, 0.5);
+    matrix->setArrayValue(4, -0.11);
+    matrix->setArrayValue(6, 0.31);
+    matrix->setArrayValue(8, 0.07);
+    matrix->setArrayValue(9, -0.19);
+    validate(matrix, __LINE__);
+
+    matrix->setOffsetValue(0, 0.1);
+    matrix->setOffsetValue(1, -0.2);
+    matrix->setOffsetValue(2, 0.3);
+    validate(matrix, __LINE__);
+}
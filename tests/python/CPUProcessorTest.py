@@ -364,6 +364,34 @@ class CPUProcessorTest(unittest.TestCase):
                 delta=self.FLOAT_DELTA
             )
 
+    def test_apply_packed_format(self):
+        if not np:
+            logger.warning("NumPy not found. Skipping test!")
+            return
+
+        cpu_proc_fwd = self.proc_fwd.getOptimizedCPUProcessor(
+            OCIO.BIT_DEPTH_UINT10,
+            OCIO.BIT_DEPTH_UINT10,
+            OCIO.OPTIMIZATION_DEFAULT
+        )
+
+        # 10-bit R, G & B codes in the high bits of 32-bit words (i.e. DPX method A).
+        arr = np.array([1000 << 22 | 500 << 12 | 100 << 2] * 6, dtype=np.uint32)
+        image = OCIO.PackedImageDesc(arr, 3, 2, OCIO.PACKED_FORMAT_DPX_RGB10)
+        self.assertEqual(image.getPackedFormat(), OCIO.PACKED_FORMAT_DPX_RGB10)
+        self.assertEqual(image.getBitDepth(), OCIO.BIT_DEPTH_UINT10)
+
+        cpu_proc_fwd.apply(image)
+
+        for i in range(arr.size):
+            self.assertEqual(arr[i], 500 << 22 | 250 << 12 | 50 << 2)
+
+        # The words must be 32-bit integers.
+        with self.assertRaises(RuntimeError):
+            OCIO.PackedImageDesc(
+                np.zeros(6, dtype=np.uint16), 3, 2, OCIO.PACKED_FORMAT_DPX_RGB10
+            )
+
     def test_apply_rgb_list(self):
         # Forward transform returns modified values
         fwd_result = self.default_cpu_proc_fwd.applyRGB(self.float_rgb_list)
@@ -16,12 +16,18 @@ class ConstantsTest(unittest.TestCase):
         self.assertEqual(OCIO.OCIO_ACTIVE_VIEWS_ENVVAR, 'OCIO_ACTIVE_VIEWS')
         self.assertEqual(OCIO.OCIO_INACTIVE_COLORSPACES_ENVVAR, 'OCIO_INACTIVE_COLORSPACES')
         self.assertEqual(OCIO.OCIO_OPTIMIZATION_FLAGS_ENVVAR, 'OCIO_OPTIMIZATION_FLAGS')
+        self.assertEqual(OCIO.OCIO_BAKE_LUT_SIZE_ENVVAR, 'OCIO_BAKE_LUT_SIZE')
+        self.assertEqual(OCIO.OCIO_BAKE_LUT_MAX_ERROR_ENVVAR, 'OCIO_BAKE_LUT_MAX_ERROR')
+        self.assertEqual(OCIO.OCIO_INTEGER_LOOKUP_SIZE_ENVVAR, 'OCIO_INTEGER_LOOKUP_SIZE')
         self.assertEqual(OCIO.OCIO_USER_CATEGORIES_ENVVAR, 'OCIO_USER_CATEGORIES')
 
         # Cache (env. variables).
         self.assertEqual(OCIO.OCIO_DISABLE_ALL_CACHES, 'OCIO_DISABLE_ALL_CACHES')
         self.assertEqual(OCIO.OCIO_DISABLE_PROCESSOR_CACHES, 'OCIO_DISABLE_PROCESSOR_CACHES')
         self.assertEqual(OCIO.OCIO_DISABLE_CACHE_FALLBACK, 'OCIO_DISABLE_CACHE_FALLBACK')
+        self.assertEqual(OCIO.OCIO_CACHE_MAX_ENTRIES, 'OCIO_CACHE_MAX_ENTRIES')
+        self.assertEqual(OCIO.OCIO_CACHE_MAX_MEMORY_SIZE, 'OCIO_CACHE_MAX_MEMORY_SIZE')
+        self.assertEqual(OCIO.OCIO_FILE_CACHE_DIR, 'OCIO_FILE_CACHE_DIR')
 
         # Roles.
         self.assertEqual(OCIO.ROLE_DEFAULT, 'default')
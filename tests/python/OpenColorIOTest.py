@@ -38,3 +38,32 @@ class OpenColorIOTest(unittest.TestCase):
         OCIO.SetEnvVariable(value='TOTO', name='MY_ENVAR')
         self.assertTrue(OCIO.IsEnvVariablePresent(name='MY_ENVAR'))
         self.assertEqual(OCIO.GetEnvVariable(name='MY_ENVAR'), 'TOTO')
+
+    def test_cache_limits(self):
+        """
+        Test Get/SetCacheMaxEntries() and Get/SetCacheMaxMemorySize().
+        """
+        self.assertEqual(OCIO.GetCacheMaxEntries(), 0)
+        self.assertEqual(OCIO.GetCacheMaxMemorySize(), 0)
+
+        try:
+            OCIO.SetCacheMaxEntries(10)
+            self.assertEqual(OCIO.GetCacheMaxEntries(), 10)
+
+            OCIO.SetCacheMaxMemorySize(maxMemorySize=64 * 1024 * 1024)
+            self.assertEqual(OCIO.GetCacheMaxMemorySize(), 64 * 1024 * 1024)
+        finally:
+            OCIO.SetCacheMaxEntries(0)
+            OCIO.SetCacheMaxMemorySize(0)
+
+    def test_file_cache_directory(self):
+        """
+        Test Get/SetFileCacheDirectory().
+        """
+        self.assertEqual(OCIO.GetFileCacheDirectory(), '')
+
+        try:
+            OCIO.SetFileCacheDirectory(directory='/tmp/ocio_cache')
+            self.assertEqual(OCIO.GetFileCacheDirectory(), '/tmp/ocio_cache')
+        finally:
+            OCIO.SetFileCacheDirectory('')